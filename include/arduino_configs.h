@@ -30,6 +30,79 @@
   #define DEBUG_HEX(label, val, width)
 #endif
 
+// ============================================================================
+// DEFERRED LOGGING CONFIGURATION
+// ============================================================================
+
+// Binary ring-buffer logging for hot paths (log/log.h)
+// Kept on in release builds so records can still be streamed to syslog
+#ifndef CONFIG_LOG_ENABLED
+#define CONFIG_LOG_ENABLED 1
+#endif
+
+// Initial runtime level (0=error 1=warn 2=info 3=debug), overridable by
+// the config server "log_level" key
+#ifndef CONFIG_LOG_DEFAULT_LEVEL
+#define CONFIG_LOG_DEFAULT_LEVEL (DEBUG ? 3 : 2)
+#endif
+
+// Ring buffer size in bytes (a 4-argument record takes 24 bytes)
+#ifndef CONFIG_LOG_RING_SIZE
+#define CONFIG_LOG_RING_SIZE 512
+#endif
+
+// Maximum 32-bit arguments per record
+#ifndef CONFIG_LOG_MAX_ARGS
+#define CONFIG_LOG_MAX_ARGS 4
+#endif
+
+// Records processed per logDrain() call (bounds time spent per loop pass)
+#ifndef CONFIG_LOG_DRAIN_MAX_RECORDS
+#define CONFIG_LOG_DRAIN_MAX_RECORDS 8
+#endif
+
+// Serial bytes written per logDrain() call (debug builds). USB CDC reports
+// room it may not have, so this is what bounds a blocked write: one
+// full-speed bulk packet
+#ifndef CONFIG_LOG_DRAIN_SERIAL_BYTES
+#define CONFIG_LOG_DRAIN_SERIAL_BYTES 64
+#endif
+
+// Longest formatted record text
+#ifndef CONFIG_LOG_TEXT_MAX_LEN
+#define CONFIG_LOG_TEXT_MAX_LEN 96
+#endif
+
+// ============================================================================
+// REMOTE SYSLOG CONFIGURATION
+// ============================================================================
+
+// Default UDP port when config gives a host but no port
+#ifndef CONFIG_SYSLOG_DEFAULT_PORT
+#define CONFIG_SYSLOG_DEFAULT_PORT 514
+#endif
+
+// Datagram size: records are batched up to this many bytes
+#ifndef CONFIG_SYSLOG_BATCH_SIZE
+#define CONFIG_SYSLOG_BATCH_SIZE 384
+#endif
+
+// Maximum time a partial batch waits before being sent
+#ifndef CONFIG_SYSLOG_FLUSH_MS
+#define CONFIG_SYSLOG_FLUSH_MS 2000
+#endif
+
+// Rate limit: sustained records per second and burst size
+#ifndef CONFIG_SYSLOG_RATE_PER_SEC
+#define CONFIG_SYSLOG_RATE_PER_SEC 10
+#endif
+
+#ifndef CONFIG_SYSLOG_BURST
+#define CONFIG_SYSLOG_BURST 30
+#endif
+
+#define CONFIG_SYSLOG_HOSTNAME_MAX_LEN 24
+
 // ============================================================================
 // NETWORK CONFIGURATION
 // ============================================================================
@@ -41,10 +114,52 @@
 #define CONFIG_MDNS_PORT 5353
 #endif
 
+// Maximum duration of one join attempt before backing off
 #ifndef CONFIG_WIFI_TIMEOUT_MS
 #define CONFIG_WIFI_TIMEOUT_MS 30000
 #endif
 
+// Link status poll interval (WiFi.status() is an SPI round trip to NINA)
+#ifndef CONFIG_WIFI_POLL_MS
+#define CONFIG_WIFI_POLL_MS 500
+#endif
+
+// Reconnect backoff: doubles after every failed join, capped at the max
+#ifndef CONFIG_WIFI_BACKOFF_MIN_MS
+#define CONFIG_WIFI_BACKOFF_MIN_MS 1000
+#endif
+
+#ifndef CONFIG_WIFI_BACKOFF_MAX_MS
+#define CONFIG_WIFI_BACKOFF_MAX_MS 60000
+#endif
+
+// Fast rejoin: reuse the IP settings of the last DHCP join (cached in flash)
+// and skip DHCP. Falls back to a normal join if the fast attempt fails.
+#ifndef CONFIG_WIFI_FAST_JOIN_ENABLED
+#define CONFIG_WIFI_FAST_JOIN_ENABLED 1
+#endif
+
+// A fast join that is not associated by then falls back to DHCP
+#ifndef CONFIG_WIFI_FAST_JOIN_TIMEOUT_MS
+#define CONFIG_WIFI_FAST_JOIN_TIMEOUT_MS 8000
+#endif
+
+// Gateway pings that may fail before a fast join falls back to DHCP (one
+// per status poll, so loop() runs between them; each blocks inside NINA)
+#ifndef CONFIG_WIFI_FAST_JOIN_PINGS
+#define CONFIG_WIFI_FAST_JOIN_PINGS 2
+#endif
+
+// Age (s, from the DHCP join) at which cached settings are given up for a
+// DHCP join: NINA can't renew a lease it didn't get. Half of a common 24 h
+// lease; checked once the RTC has network time
+#ifndef CONFIG_WIFI_FAST_JOIN_MAX_AGE_S
+#define CONFIG_WIFI_FAST_JOIN_MAX_AGE_S 43200
+#endif
+
+// Link up/down callbacks (mDNS, MQTT, RTC, ...)
+#define CONFIG_WIFI_MAX_LISTENERS 8
+
 // ============================================================================
 // mDNS SERVICE DISCOVERY CONFIGURATION
 // ============================================================================
@@ -64,6 +179,33 @@
 #define CONFIG_QUERY_INTERVAL_MS 10000
 #endif
 
+// Responder (advertising our own service, see include/mdns/responder.h)
+#define CONFIG_MDNS_LABEL_MAX_LEN 40
+#define CONFIG_MDNS_TXT_MAX_LEN 32
+
+// TTL of announced records (seconds); legacy unicast answers use 10
+#ifndef CONFIG_MDNS_RESPONDER_TTL
+#define CONFIG_MDNS_RESPONDER_TTL 120
+#endif
+
+// Config fetch retry interval while no config has been applied
+#ifndef CONFIG_FETCH_RETRY_INTERVAL_MS
+#define CONFIG_FETCH_RETRY_INTERVAL_MS 30000
+#endif
+
+// Consecutive failed config fetches before the discovered server is
+// forgotten and discovery starts over
+#ifndef CONFIG_DEVICE_FETCH_FAILURES
+#define CONFIG_DEVICE_FETCH_FAILURES 3
+#endif
+
+// Time the transport may stay unusable (WiFi up, no broker or receiver)
+// before the device drops its config and rediscovers the config server.
+// Queued telemetry is kept across the switch
+#ifndef CONFIG_DEVICE_REHOME_AFTER_MS
+#define CONFIG_DEVICE_REHOME_AFTER_MS 600000
+#endif
+
 // ============================================================================
 // DNS PROTOCOL CONSTANTS
 // ============================================================================
@@ -126,6 +268,12 @@
 // SENSOR TELEMETRY CONFIGURATION
 // ============================================================================
 
+// Time from starting the ENV shield to the first read (runs in the
+// background while WiFi joins)
+#ifndef CONFIG_SENSOR_WARMUP_MS
+#define CONFIG_SENSOR_WARMUP_MS 2000
+#endif
+
 // Sensor change detection thresholds (based on hardware accuracy specs)
 // Used to determine if a sensor reading has changed significantly enough to publish
 
@@ -161,4 +309,427 @@
 #define CONFIG_UV_THRESHOLD_INDEX 0.5f
 #endif
 
+// ============================================================================
+// MQTT BROKER CONFIGURATION
+// ============================================================================
+// Ordered broker list ("mqtt_brokers" in the config response) with
+// health-scored failover and failback (see include/mqtt/broker_pool.h)
+
+// Brokers kept from the list (extra entries are ignored)
+#ifndef CONFIG_MQTT_MAX_BROKERS
+#define CONFIG_MQTT_MAX_BROKERS 3
+#endif
+
+#define CONFIG_MQTT_BROKER_HOST_MAX_LEN 64
+
+// Port for list entries that don't give one (and no mqtt_port is set);
+// also the plaintext port tried when mqtt_tls_fallback is enabled
+#define CONFIG_MQTT_DEFAULT_PORT 1883
+
+// Brokers on this port use TLS unless the entry says "tls": false
+#define CONFIG_MQTT_TLS_PORT 8883
+
+// Per-broker retry delay after a failed connect, doubling per failure
+#ifndef CONFIG_MQTT_BROKER_RETRY_MIN_MS
+#define CONFIG_MQTT_BROKER_RETRY_MIN_MS 2000
+#endif
+
+#ifndef CONFIG_MQTT_BROKER_RETRY_MAX_MS
+#define CONFIG_MQTT_BROKER_RETRY_MAX_MS 60000
+#endif
+
+// An earlier (preferred) broker is chosen over a later one unless the later
+// one scores at least this much higher (0-100 scale)
+#define CONFIG_MQTT_BROKER_SCORE_MARGIN 10
+
+// Failback: while on a fallback broker, probe a preferred one this often...
+#ifndef CONFIG_MQTT_FAILBACK_PROBE_MS
+#define CONFIG_MQTT_FAILBACK_PROBE_MS 30000
+#endif
+
+// A probe not established by then counts as failed (polled across loop
+// passes, never waited for)
+#ifndef CONFIG_MQTT_FAILBACK_PROBE_TIMEOUT_MS
+#define CONFIG_MQTT_FAILBACK_PROBE_TIMEOUT_MS 3000
+#endif
+
+// ...and switch after this many consecutive successful probes, once the
+// current session has been up for the hold-down time. The hold-down doubles
+// each time a failback fails again (up to the max), so a flapping primary
+// is tried less and less often.
+#ifndef CONFIG_MQTT_FAILBACK_PROBES
+#define CONFIG_MQTT_FAILBACK_PROBES 3
+#endif
+
+#ifndef CONFIG_MQTT_FAILBACK_HOLDDOWN_MS
+#define CONFIG_MQTT_FAILBACK_HOLDDOWN_MS 120000  // 2 minutes
+#endif
+
+#define CONFIG_MQTT_FAILBACK_HOLDDOWN_MAX_MS 1800000  // 30 minutes
+
+// Keepalive sent in CONNECT: heartbeat + poll interval + slack, clamped to
+// min/max. Publishes count as keepalive traffic; a PINGREQ goes out only
+// after that long without one (see include/mqtt/mqtt_keepalive.h)
+#define CONFIG_MQTT_KEEPALIVE_SLACK_SEC 15
+
+#ifndef CONFIG_MQTT_KEEPALIVE_MIN_SEC
+#define CONFIG_MQTT_KEEPALIVE_MIN_SEC 30
+#endif
+
+#ifndef CONFIG_MQTT_KEEPALIVE_MAX_SEC
+#define CONFIG_MQTT_KEEPALIVE_MAX_SEC 900  // 15 minutes
+#endif
+
+// A PINGREQ not answered within this is a half-open session: the client is
+// stopped (keep below CONFIG_MQTT_NAT_DETECT_MS so it counts as an idle timeout)
+#ifndef CONFIG_MQTT_PINGRESP_TIMEOUT_MS
+#define CONFIG_MQTT_PINGRESP_TIMEOUT_MS 5000
+#endif
+
+// A session lost this soon after sending into a long idle gap is taken as a
+// NAT idle timeout (pings then go out at half that gap)...
+#define CONFIG_MQTT_NAT_DETECT_MS 10000
+
+// ...until this many full-length idle gaps survive, then the limit grows 1/8
+#define CONFIG_MQTT_NAT_GROW_AFTER 4
+
+// ============================================================================
+// PUBLISH QUEUE CONFIGURATION
+// ============================================================================
+// Prioritized outbound queue in front of publishToMQTT()
+// (see include/mqtt/publish_queue.h)
+
+// Messages held while the broker is unreachable or the budget is used up
+#ifndef CONFIG_PUBLISH_QUEUE_SLOTS
+#define CONFIG_PUBLISH_QUEUE_SLOTS 12
+#endif
+
+// Bytes for their subtopics and payloads (a status report is ~700)
+#ifndef CONFIG_PUBLISH_QUEUE_BYTES
+#define CONFIG_PUBLISH_QUEUE_BYTES 2048
+#endif
+
+// Payload bytes sent per loop pass while catching up (at least one message)
+#ifndef CONFIG_PUBLISH_BUDGET_BYTES
+#define CONFIG_PUBLISH_BUDGET_BYTES 1024
+#endif
+
+// A change detected less than this long before the next heartbeat sends the
+// heartbeat early instead (it carries the change and restarts the heartbeat
+// interval), so the change costs no message of its own.
+// "coalesce_window_sec" in the config overrides it; capped at half the
+// heartbeat interval, 0 disables
+#ifndef CONFIG_PUBLISH_COALESCE_WINDOW_SEC
+#define CONFIG_PUBLISH_COALESCE_WINDOW_SEC 30
+#endif
+
+// ============================================================================
+// EDGE RULES CONFIGURATION
+// ============================================================================
+// Rule expressions from the config response ("rules"), see rules/rules.h
+
+// Rules kept (at most 8: verdicts carry one bit per rule)
+#ifndef CONFIG_RULES_MAX
+#define CONFIG_RULES_MAX 4
+#endif
+
+// Bytecode per rule; also bounds the instructions run per evaluation
+// (a constant takes 5 bytes, a reading 2, an operator 1)
+#ifndef CONFIG_RULE_CODE_MAX
+#define CONFIG_RULE_CODE_MAX 48
+#endif
+
+// Evaluation stack entries; deeper expressions are rejected when compiled
+#ifndef CONFIG_RULE_STACK_DEPTH
+#define CONFIG_RULE_STACK_DEPTH 8
+#endif
+
+// Rule name, used in the alarm subtopic ("alarm/<name>")
+#ifndef CONFIG_RULE_NAME_MAX_LEN
+#define CONFIG_RULE_NAME_MAX_LEN 16
+#endif
+
+#if CONFIG_RULES_MAX > 8
+#error "CONFIG_RULES_MAX must be 8 or less"
+#endif
+
+// ============================================================================
+// TELEMETRY TRANSPORT CONFIGURATION
+// ============================================================================
+// UDP datagram transport (transport "udp" in the config response)
+
+// Receiver port when the config gives a udp_host but no udp_port
+#ifndef CONFIG_UDP_TELEMETRY_DEFAULT_PORT
+#define CONFIG_UDP_TELEMETRY_DEFAULT_PORT 5555
+#endif
+
+// Local port the transport sends from; the receiver's acks come back to it
+#ifndef CONFIG_UDP_TELEMETRY_LOCAL_PORT
+#define CONFIG_UDP_TELEMETRY_LOCAL_PORT 5556
+#endif
+
+// Largest frame (8-byte header + 255-byte topic + a full payload buffer);
+// also the retransmit slot
+#define CONFIG_UDP_TELEMETRY_MAX_FRAME (8 + 255 + CONFIG_TELEMETRY_PAYLOAD_SIZE - 1)
+
+// Ack mode: retransmit an unacked message after this long, this many times
+#ifndef CONFIG_UDP_TELEMETRY_ACK_TIMEOUT_MS
+#define CONFIG_UDP_TELEMETRY_ACK_TIMEOUT_MS 500
+#endif
+
+#ifndef CONFIG_UDP_TELEMETRY_MAX_RETRIES
+#define CONFIG_UDP_TELEMETRY_MAX_RETRIES 3
+#endif
+
+// ============================================================================
+// COAP SERVER CONFIGURATION
+// ============================================================================
+// Pull-based telemetry: /sensors and /status over CoAP (RFC 7252), with
+// Observe (RFC 7641) notifications on /sensors (see include/coap/coap_server.h)
+
+#ifndef CONFIG_COAP_ENABLED
+#define CONFIG_COAP_ENABLED 1
+#endif
+
+// UDP port (IANA default for coap://)
+#ifndef CONFIG_COAP_PORT
+#define CONFIG_COAP_PORT 5683
+#endif
+
+// Registered observers (clients watching /sensors)
+#ifndef CONFIG_COAP_MAX_OBSERVERS
+#define CONFIG_COAP_MAX_OBSERVERS 4
+#endif
+
+// Largest request accepted (header + token + options); larger are rejected
+#define CONFIG_COAP_MAX_REQUEST_LEN 128
+
+// Every Nth notification is confirmable; an observer that has not acked
+// the previous confirmable one by then is dropped
+#ifndef CONFIG_COAP_CON_NOTIFY_EVERY
+#define CONFIG_COAP_CON_NOTIFY_EVERY 8
+#endif
+
+// Max-Age of /sensors until the heartbeat interval is known from config
+#define CONFIG_COAP_DEFAULT_MAX_AGE_SEC 60
+
+// ============================================================================
+// METRICS SERVER CONFIGURATION
+// ============================================================================
+// Prometheus scrape endpoint (GET /metrics), advertised over mDNS as
+// _prometheus-http._tcp (see include/metrics/metrics_server.h)
+
+#ifndef CONFIG_METRICS_ENABLED
+#define CONFIG_METRICS_ENABLED 1
+#endif
+
+// TCP port (node_exporter convention)
+#ifndef CONFIG_METRICS_PORT
+#define CONFIG_METRICS_PORT 9100
+#endif
+
+// Accept to close; a slower client is disconnected
+#ifndef CONFIG_METRICS_REQUEST_TIMEOUT_MS
+#define CONFIG_METRICS_REQUEST_TIMEOUT_MS 2000
+#endif
+
+// Request line kept for routing; headers are read and discarded
+#define CONFIG_METRICS_REQUEST_MAX_LEN 64
+
+// Output buffer, flushed to the socket whenever it fills
+#define CONFIG_METRICS_CHUNK_SIZE 128
+
+// ============================================================================
+// FIRMWARE UPDATE (OTA) CONFIGURATION
+// ============================================================================
+// Images offered by the config server ("firmware" in the config response)
+// are streamed over HTTP into the upper flash half (see include/ota/ota.h)
+
+#ifndef CONFIG_OTA_ENABLED
+#define CONFIG_OTA_ENABLED 1
+#endif
+
+// Version of this build; only an offer with a newer version (numeric
+// dot-separated parts, "dev" counts as 0) is installed.
+// Release builds set it from the build (-D CONFIG_FIRMWARE_VERSION="\"1.4.0\"")
+#ifndef CONFIG_FIRMWARE_VERSION
+#define CONFIG_FIRMWARE_VERSION "dev"
+#endif
+
+// Public key offers must be signed with (P-256, X|Y as 128 hex digits, from
+// tools/ota_sign.py keygen). Empty: every offer is refused
+#ifndef CONFIG_OTA_PUBLIC_KEY
+#define CONFIG_OTA_PUBLIC_KEY ""
+#endif
+
+// Bytes held in RAM between the socket and flash: one flash row (256 bytes),
+// also a whole number of SHA-256 blocks
+#define CONFIG_OTA_CHUNK_SIZE 256
+
+// Image URL ("http://host:port/path" or a path on the config server)
+#define CONFIG_OTA_URL_MAX_LEN 128
+
+// Offered version string
+#define CONFIG_OTA_VERSION_MAX_LEN 16
+
+// Download is abandoned when no byte arrives for this long
+#ifndef CONFIG_OTA_STALL_TIMEOUT_MS
+#define CONFIG_OTA_STALL_TIMEOUT_MS 10000
+#endif
+
+// A download that dropped after making progress resumes (HTTP Range) after
+// this long, without counting as an attempt
+#ifndef CONFIG_OTA_RESUME_DELAY_MS
+#define CONFIG_OTA_RESUME_DELAY_MS 5000
+#endif
+
+// A failed download is retried after this long, this many times per offer
+#ifndef CONFIG_OTA_RETRY_INTERVAL_MS
+#define CONFIG_OTA_RETRY_INTERVAL_MS 60000
+#endif
+
+#ifndef CONFIG_OTA_MAX_ATTEMPTS
+#define CONFIG_OTA_MAX_ATTEMPTS 3
+#endif
+
+// A verified image is installed once the publish queue is empty, or after
+// this long regardless (queued messages are lost with the reset)
+#ifndef CONFIG_OTA_DRAIN_TIMEOUT_MS
+#define CONFIG_OTA_DRAIN_TIMEOUT_MS 60000
+#endif
+
+// Patches (tools/ota_delta.py) are decompressed with a window of
+// 1 << CONFIG_OTA_DELTA_WINDOW_BITS bytes; patches with a larger window are
+// refused
+#define CONFIG_OTA_DELTA_WINDOW_BITS 8
+
+// Patch bytes read from the socket at a time
+#define CONFIG_OTA_DELTA_INPUT_SIZE 64
+
+// ============================================================================
+// SCRATCH ARENA CONFIGURATION
+// ============================================================================
+// Shared static region borrowed in turn by discovery, config fetch and
+// publish formatting (see include/mem/scratch.h). Sized by the largest
+// phase layout; every layout is checked against it at compile time.
+
+#ifndef CONFIG_SCRATCH_ARENA_SIZE
+#define CONFIG_SCRATCH_ARENA_SIZE 8192
+#endif
+
+// Pool backing the ArduinoJson document while parsing the config response.
+// ArduinoJson 7 copies every distinct key and string and takes a 1 KB slot
+// pool, so the largest config (docs/MQTT_SETUP.md, about 2000 bytes) needs
+// about 3.9 KB; "json_pool_peak" in the status report shows the real use
+#define CONFIG_SCRATCH_JSON_POOL_SIZE 4608
+
+// HTTP request head for the config fetch (request line + headers)
+#define CONFIG_SCRATCH_REQUEST_MAX_LEN 384
+
+// Telemetry and status payload buffer (publish phase)
+#ifndef CONFIG_TELEMETRY_PAYLOAD_SIZE
+#define CONFIG_TELEMETRY_PAYLOAD_SIZE 1024
+#endif
+
+// ============================================================================
+// DIAGNOSTICS CONFIGURATION
+// ============================================================================
+
+// Status report interval on "<mqtt_topic>/status" (also sent once after connect)
+#ifndef CONFIG_STATUS_INTERVAL_MS
+#define CONFIG_STATUS_INTERVAL_MS 300000  // 5 minutes
+#endif
+
+// Bytes left unpainted above the heap end so small allocations after
+// painting do not register as stack use
+#ifndef CONFIG_MEMSTATS_HEAP_GUARD
+#define CONFIG_MEMSTATS_HEAP_GUARD 256
+#endif
+
+// Bytes left unpainted below the stack pointer of the painting function
+#define CONFIG_MEMSTATS_SP_MARGIN 32
+
+// Hardware watchdog (see include/diag/watchdog.h); the reset cause is
+// recorded either way
+#ifndef CONFIG_WATCHDOG_ENABLED
+#define CONFIG_WATCHDOG_ENABLED 1
+#endif
+
+// Longest loop() pass outside an armed blocking call (also covers setup())
+#ifndef CONFIG_WATCHDOG_LOOP_DEADLINE_MS
+#define CONFIG_WATCHDOG_LOOP_DEADLINE_MS 15000
+#endif
+
+// Broker connect incl. TLS handshake and plaintext fallback
+#ifndef CONFIG_WATCHDOG_CONNECT_DEADLINE_MS
+#define CONFIG_WATCHDOG_CONNECT_DEADLINE_MS 45000
+#endif
+
+// Config fetch: connect, response wait and body read
+#ifndef CONFIG_WATCHDOG_FETCH_DEADLINE_MS
+#define CONFIG_WATCHDOG_FETCH_DEADLINE_MS 30000
+#endif
+
+// Other blocking NINA calls: OTA server connect (DNS + TCP, up to 10 s) and
+// the fast-join gateway ping
+#ifndef CONFIG_WATCHDOG_NET_CALL_DEADLINE_MS
+#define CONFIG_WATCHDOG_NET_CALL_DEADLINE_MS 20000
+#endif
+
+// Stale task or halt reason kept across the reset
+#define CONFIG_WATCHDOG_CULPRIT_LEN 16
+
+// ============================================================================
+// RUNTIME SETTINGS CONFIGURATION
+// ============================================================================
+// Overrides of the tunables in include/settings/settings.h (the CONFIG_
+// macros above stay their defaults)
+
+// Changes are saved to flash once none arrived for this long (flash wear)
+#ifndef CONFIG_SETTINGS_SAVE_DELAY_MS
+#define CONFIG_SETTINGS_SAVE_DELAY_MS 10000
+#endif
+
+// Change callbacks (syslog, main, ...)
+#define CONFIG_SETTINGS_MAX_LISTENERS 4
+
+// Entries taken from the config server's "settings" object
+#define CONFIG_SETTINGS_MAX_OVERRIDES 8
+
+// Longest MQTT command ("name=value ..."); longer ones are refused
+#define CONFIG_SETTINGS_COMMAND_MAX_LEN 160
+
+// Longest setting name, including the terminator
+#define CONFIG_SETTINGS_NAME_MAX_LEN 24
+
+// ============================================================================
+// FAULT INJECTION (RESILIENCE BENCHMARKING)
+// ============================================================================
+
+// Wrap UDP/TCP/MQTT transports with the fault-injection layer (netfault.h)
+// Never enable in production builds
+#ifndef CONFIG_NETFAULT_ENABLED
+#define CONFIG_NETFAULT_ENABLED 0
+#endif
+
+// Duration of each fault scenario before faults are cleared
+#ifndef CONFIG_NETFAULT_SCENARIO_MS
+#define CONFIG_NETFAULT_SCENARIO_MS 120000  // 2 minutes
+#endif
+
+// Maximum time to wait for the first good publish after faults clear
+#ifndef CONFIG_NETFAULT_RECOVERY_TIMEOUT_MS
+#define CONFIG_NETFAULT_RECOVERY_TIMEOUT_MS 120000  // 2 minutes
+#endif
+
+// Largest outgoing datagram the wrapper can stage (mDNS query, syslog batch)
+#ifndef CONFIG_NETFAULT_MAX_DATAGRAM
+#define CONFIG_NETFAULT_MAX_DATAGRAM 512
+#endif
+
+// How long a datagram is held back waiting for a successor to swap with
+#ifndef CONFIG_NETFAULT_REORDER_HOLD_MS
+#define CONFIG_NETFAULT_REORDER_HOLD_MS 500
+#endif
+
 #endif  // ARDUINO_CONFIGS_H
@@ -0,0 +1,101 @@
+/**
+ * ============================================================================
+ * CoAP Server Module Header
+ * ============================================================================
+ * Pull-based telemetry for consumers that don't go through the broker.
+ * A small CoAP server (RFC 7252) on its own WiFiUDP socket serves:
+ *
+ *   /sensors            Last readings as JSON (same format as the heartbeat)
+ *                       Observable (RFC 7641)
+ *   /status             Device status report (see diag/status.h)
+ *   /.well-known/core   Resource discovery (RFC 6690 link format)
+ *
+ * Only GET is supported. Confirmable requests get a piggybacked ACK,
+ * non-confirmable ones a NON response. Options other than Uri-Path,
+ * Observe, Accept, Uri-Host and Uri-Port are rejected if critical
+ * (4.02 Bad Option) and ignored if elective.
+ *
+ * ZERO-COPY RESPONSES:
+ *   The server keeps a pointer to the caller's last SensorReadings and
+ *   writes /sensors straight into the outgoing packet with
+ *   writeSensorJSON(); no formatted copy is held in RAM. /status borrows
+ *   the scratch arena (SCRATCH_COAP) while it is formatted.
+ *
+ * OBSERVE:
+ *   GET /sensors with Observe=0 registers the client (up to
+ *   CONFIG_COAP_MAX_OBSERVERS), Observe=1 deregisters it. After each sensor
+ *   read, coapServerUpdate() computes the same change mask as
+ *   hasSignificantChange() against the last notified readings and notifies
+ *   all observers when it is non-zero (or on heartbeat). Notifications are
+ *   NON; every CONFIG_COAP_CON_NOTIFY_EVERY-th is CON, and an observer that
+ *   hasn't acked the previous CON by then, or answers with RST, is dropped.
+ *
+ * Host test (libcoap / aiocoap / tools/coap_client.py):
+ *   coap-client -m get coap://<device-ip>/sensors -s 60
+ *   aiocoap-client coap://<device-ip>/sensors --observe
+ *
+ * ============================================================================
+ */
+
+#ifndef COAP_SERVER_H
+#define COAP_SERVER_H
+
+#include <Arduino.h>
+#include "sensors/sensors.h"
+#include "arduino_configs.h"
+
+/**
+ * CoAP Server Statistics
+ */
+typedef struct {
+  uint32_t requests;           // Requests handled (any response sent)
+  uint32_t rejected;           // Malformed, oversized or non-GET requests
+  uint32_t notifications;      // Observe notifications sent
+  uint32_t observers_dropped;  // Observers removed for RST or missing ACK
+  uint8_t observers;           // Currently registered observers
+} CoapServerStats;
+
+/**
+ * WiFi link callback - bind the CoAP socket on link up, release it on down
+ *
+ * Registered observers are kept across link losses.
+ */
+void coapServerOnLinkChange(bool up);
+
+/**
+ * Handle pending requests - must be called in loop
+ *
+ * Non-blocking: handles at most a couple of datagrams per call.
+ */
+void coapServerPoll(void);
+
+/**
+ * Publish new readings to the server
+ *
+ * Call after every successful readSensors(). The pointer is kept and
+ * responses are written from it, so it must stay valid (static storage).
+ *
+ * Parameters:
+ *   - readings: Latest sensor readings
+ *   - force: Notify observers even if nothing changed (heartbeat)
+ */
+void coapServerUpdate(const SensorReadings* readings, bool force);
+
+/**
+ * Set the Max-Age advertised for /sensors
+ *
+ * Observers treat the resource as stale (and re-register) if no
+ * notification arrives within Max-Age; set it to the heartbeat interval
+ * once the config is known.
+ *
+ * Parameters:
+ *   - seconds: Max-Age in seconds
+ */
+void coapServerSetMaxAge(uint32_t seconds);
+
+/**
+ * Get CoAP server counters
+ */
+const CoapServerStats* coapServerGetStats(void);
+
+#endif  // COAP_SERVER_H
@@ -3,6 +3,8 @@
 
 #include <Arduino.h>
 #include "device_id/device_id.h"
+#include "settings/settings.h"
+#include "arduino_configs.h"
 
 /**
  * HTTP GET request to fetch configuration
@@ -11,11 +13,96 @@
 
 typedef struct {
   int http_code;           // HTTP response code (200, 404, 500, etc.)
-  char error_msg[256];     // Error message if failed
+  char error_msg[96];      // Error message if failed
   bool success;            // true if 200 OK and config retrieved
   char config_json[2048];  // Raw JSON response
 } ConfigResponse;
 
+
+/**
+ * MQTT Broker Entry
+ */
+typedef struct {
+  char host[CONFIG_MQTT_BROKER_HOST_MAX_LEN];
+  uint16_t port;
+  bool tls;                // Connect with TLS (port 8883 or "tls": true)
+} MQTTBroker;
+
+/**
+ * Firmware Update Offer ("firmware" in the config response)
+ */
+typedef struct {
+  char url[CONFIG_OTA_URL_MAX_LEN];          // "http://host[:port]/path", or a path on the config server
+  char version[CONFIG_OTA_VERSION_MAX_LEN];  // Installed if newer than CONFIG_FIRMWARE_VERSION
+  uint32_t size;                             // Image bytes, 0 = no offer
+  uint8_t sha256[32];                        // Digest of the image
+  uint8_t signature[64];                     // ECDSA P-256 r|s over the offer (tools/ota_sign.py)
+  char delta_url[CONFIG_OTA_URL_MAX_LEN];    // Patch to this image (tools/ota_delta.py)
+  char delta_from[CONFIG_OTA_VERSION_MAX_LEN];  // Version the patch applies to
+  uint32_t delta_size;                       // Patch bytes, 0 = no patch
+} FirmwareOffer;
+
+/**
+ * Parse retrieved JSON config and extract MQTT settings
+ * Supports:
+ *   - mqtt_broker, mqtt_port, mqtt_topic
+ *   - mqtt_brokers (ordered failover list, optional; first entry is the primary)
+ *   - mqtt_tls, mqtt_tls_fallback (TLS for all brokers / allow plaintext retry)
+ *   - poll_frequency_sec, heartbeat_frequency_sec
+ *   - template
+ *   - syslog_host, syslog_port, log_level (remote logging, optional)
+ *   - transport, udp_host, udp_port, udp_ack (telemetry transport, optional)
+ *   - mqtt_layout (combined / per_sensor / both, optional)
+ *   - coalesce_window_sec (send the heartbeat early for a change, optional)
+ *   - firmware {version, url, size, sha256, signature, delta {from, url, size}}
+ *     (update offer, optional; the patch is optional within it)
+ *   - settings {name: value | null} (runtime setting overrides, optional;
+ *     see settings/settings.h)
+ *
+ * mqtt_topic, poll_frequency_sec and heartbeat_frequency_sec are required,
+ * and so is a broker unless transport is "udp". Every field is checked
+ * against the schema in config_fetch.cpp (type, range, length, known name)
+ * while it is parsed; one bad field rejects the whole config.
+ */
+typedef struct {
+  char mqtt_broker[128];
+  uint16_t mqtt_port;
+  char mqtt_topic[256];
+  uint16_t poll_frequency_sec;
+  uint16_t heartbeat_frequency_sec;
+  char template_name[32];
+  char syslog_host[CONFIG_HOSTNAME_MAX_LEN];  // Empty = use mDNS-discovered server
+  uint16_t syslog_port;                       // 0 = remote logging disabled
+  int8_t log_level;                           // LogLevel, -1 = CONFIG_LOG_DEFAULT_LEVEL
+  uint8_t transport;                          // TransportType (0 = MQTT)
+  char udp_host[CONFIG_HOSTNAME_MAX_LEN];     // Empty = use mDNS-discovered server
+  uint16_t udp_port;                          // UDP telemetry receiver port
+  bool udp_ack;                               // Request acks (retransmit if missing)
+  MQTTBroker brokers[CONFIG_MQTT_MAX_BROKERS];  // Preferred first; [0] = mqtt_broker
+  uint8_t broker_count;
+  bool mqtt_tls_fallback;                     // TLS failed: retry plaintext on 1883
+  uint8_t topic_layout;                       // TopicLayout (0 = combined JSON)
+  uint16_t coalesce_window_sec;               // Change this close to a heartbeat: send it now
+  FirmwareOffer firmware;                     // Update offer (size 0 = none)
+  SettingOverride settings[CONFIG_SETTINGS_MAX_OVERRIDES];  // Applied by settingsApply()
+  uint8_t settings_count;
+} MQTTConfig;
+
+/**
+ * Config Fetch Scratch Layout
+ * Borrowed from the scratch arena (SCRATCH_CONFIG_FETCH) for one
+ * fetch + parse cycle; nothing here outlives the phase. The request head
+ * is done with before the candidate config is parsed, so they share.
+ */
+typedef struct {
+  ConfigResponse response;
+  union {
+    char request[CONFIG_SCRATCH_REQUEST_MAX_LEN];  // HTTP request head (fetch)
+    MQTTConfig candidate;                          // Parsed config (until accepted)
+  };
+  alignas(8) uint8_t json_pool[CONFIG_SCRATCH_JSON_POOL_SIZE];  // ArduinoJson storage
+} ConfigFetchScratch;
+
 /**
  * Fetch configuration from discovered server
  *
@@ -23,44 +110,74 @@ typedef struct {
  *   - host: Hostname or IP address (from mDNS discovery)
  *   - port: Server port (from mDNS discovery)
  *   - device_id: Device identification structure
- *   - response: Output buffer for response data
+ *   - scratch: Phase buffers; result is written to scratch->response
  *
- * Returns: ConfigResponse with HTTP code and data
+ * Returns: true if the server answered 200 OK with a body
  *
  * Example:
- *   DeviceID my_device = initializeDeviceID();
- *   ConfigResponse resp = fetchConfigFromServer(
- *     "192.168.1.100", 5050, &my_device
- *   );
- *   if (resp.success) {
- *     Serial.println(resp.config_json);
+ *   ConfigFetchScratch* scratch =
+ *     scratchAcquire<ConfigFetchScratch>(SCRATCH_CONFIG_FETCH);
+ *   if (fetchConfigFromServer("192.168.1.100", 5050, &my_device, scratch) &&
+ *       parseConfigJSON(scratch, &scratch->candidate) == CONFIG_ACCEPTED) {
+ *     config = scratch->candidate;
  *   }
+ *   scratchRelease(SCRATCH_CONFIG_FETCH);
  */
-ConfigResponse fetchConfigFromServer(
+bool fetchConfigFromServer(
   const char* host,
   uint16_t port,
-  const DeviceID* device_id
+  const DeviceID* device_id,
+  ConfigFetchScratch* scratch
 );
 
 /**
- * Parse retrieved JSON config and extract MQTT settings
- * Supports:
- *   - mqtt_broker, mqtt_port, mqtt_topic
- *   - poll_frequency_sec, heartbeat_frequency_sec
- *   - template
+ * Why a fetched config was rejected (names from configRejectName())
+ */
+typedef enum {
+  CONFIG_ACCEPTED = 0,
+  CONFIG_REJECT_JSON,          // Not JSON, or too large for the pool ("json")
+  CONFIG_REJECT_NO_CONFIG,     // No "config" object ("no_config")
+  CONFIG_REJECT_MISSING,       // Required field absent ("missing")
+  CONFIG_REJECT_TYPE,          // Wrong JSON type ("type")
+  CONFIG_REJECT_RANGE,         // Number out of range ("range")
+  CONFIG_REJECT_LENGTH,        // String or list too long/short ("length")
+  CONFIG_REJECT_VALUE          // Unknown name or bad broker entry ("value")
+} ConfigReject;
+
+/**
+ * Validation Statistics
  */
 typedef struct {
-  char mqtt_broker[128];
-  uint16_t mqtt_port;
-  char mqtt_topic[256];
-  uint16_t poll_frequency_sec;
-  uint16_t heartbeat_frequency_sec;
-  char template_name[32];
-} MQTTConfig;
+  uint32_t accepted;           // Configs accepted since boot
+  uint32_t rejected;           // Configs rejected since boot
+  ConfigReject last_reason;    // Of the last rejection
+  const char* last_field;      // Config key of the last rejection ("" = document)
+  uint32_t json_pool_peak;     // Most of scratch->json_pool a parse has used (bytes)
+} ConfigValidationStats;
+
+/**
+ * Parse and validate MQTT configuration from a fetched response
+ * The JSON document is allocated from scratch->json_pool (no heap use);
+ * one that outgrows it is rejected ("json").
+ * Edge rules are replaced only when the config is accepted. A rejection is
+ * counted and reported with the next fetchConfigFromServer() request
+ * (&rejected=<reason>&field=<key>) until a config is accepted.
+ *
+ * Parameters:
+ *   - mqtt_config: Filled in; only meaningful if CONFIG_ACCEPTED is returned
+ *
+ * Returns: CONFIG_ACCEPTED, or the reason for the rejection
+ */
+ConfigReject parseConfigJSON(ConfigFetchScratch* scratch, MQTTConfig* mqtt_config);
+
+/**
+ * Name of a rejection reason ("accepted", "range", ...)
+ */
+const char* configRejectName(ConfigReject reason);
 
 /**
- * Parse MQTT configuration from JSON response
+ * Get validation statistics
  */
-MQTTConfig parseConfigJSON(const char* json_response);
+const ConfigValidationStats* configGetValidationStats(void);
 
 #endif
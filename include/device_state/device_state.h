@@ -0,0 +1,109 @@
+/**
+ * ============================================================================
+ * Device State Header
+ * ============================================================================
+ * Top-level state of the device, with time spent in each state and the
+ * failure budgets that send it back to discovery:
+ *
+ *   DISCOVERING ──server found──> FETCHING ──config──> PUBLISHING
+ *        ^                           │                   │    ^
+ *        │      CONFIG_DEVICE_FETCH_FAILURES             │    │ transport
+ *        ├───────────────────────────┘           not ready    │ ready
+ *        │                                               v    │
+ *        └──── CONFIG_DEVICE_REHOME_AFTER_MS ──────── DEGRADED
+ *
+ * DEGRADED time only counts towards the budget while the WiFi link is up
+ * (a WiFi outage says nothing about the broker). Going back to discovery
+ * drops the broker session and the discovered server, but not the publish
+ * queue or the sampling schedule: readings keep being queued and go out to
+ * whatever broker the new config names.
+ *
+ * The module makes no network calls; main reports what happened.
+ *
+ * ============================================================================
+ */
+
+#ifndef DEVICE_STATE_H
+#define DEVICE_STATE_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Device State
+ */
+typedef enum {
+  DEVICE_DISCOVERING = 0,   // Looking for the config server (mDNS)
+  DEVICE_FETCHING = 1,      // Server known, fetching its config
+  DEVICE_PUBLISHING = 2,    // Config applied, transport ready
+  DEVICE_DEGRADED = 3,      // Config applied, transport not ready
+  DEVICE_STATE_COUNT
+} DeviceState;
+
+/**
+ * Device State Statistics
+ */
+typedef struct {
+  DeviceState state;
+  uint32_t entered_at;                       // millis() when state was entered
+  uint32_t dwell_ms[DEVICE_STATE_COUNT];     // Time in each state (finished visits)
+  uint32_t rehomes;                          // Returns to discovery from DEGRADED
+  uint32_t fetch_giveups;                    // Returns to discovery from FETCHING
+} DeviceStateStats;
+
+/**
+ * Start in DEVICE_DISCOVERING
+ */
+void deviceStateBegin(uint32_t now);
+
+/**
+ * Get current state
+ */
+DeviceState deviceStateGet(void);
+
+/**
+ * Get state name ("discovering", "fetching", "publishing", "degraded")
+ */
+const char* deviceStateName(DeviceState state);
+
+/**
+ * Move to a state (no-op if already there)
+ */
+void deviceStateSet(DeviceState state, uint32_t now);
+
+/**
+ * WiFi link callback (from main's listener)
+ * Link loss while publishing is DEGRADED; outage time is not charged to
+ * the broker's budget
+ */
+void deviceStateOnLinkChange(bool up, uint32_t now);
+
+/**
+ * Report a failed config fetch (FETCHING)
+ *
+ * Returns:
+ *   true if CONFIG_DEVICE_FETCH_FAILURES in a row failed: the state is now
+ *   DISCOVERING and the caller should forget the discovered server
+ */
+bool deviceStateFetchFailed(uint32_t now);
+
+/**
+ * Report transport readiness once per loop pass (PUBLISHING / DEGRADED)
+ *
+ * Returns:
+ *   true if DEGRADED used up CONFIG_DEVICE_REHOME_AFTER_MS: the state is
+ *   now DISCOVERING and the caller should drop the session and rediscover
+ */
+bool deviceStateUpdateTransport(bool ready, uint32_t now);
+
+/**
+ * Get time spent in a state, including the current visit
+ */
+uint32_t deviceStateDwell(DeviceState state, uint32_t now);
+
+/**
+ * Get state counters
+ */
+const DeviceStateStats* deviceStateGetStats(void);
+
+#endif  // DEVICE_STATE_H
@@ -0,0 +1,73 @@
+/**
+ * ============================================================================
+ * Boot Timeline Module Header
+ * ============================================================================
+ * Timestamps (millis() since reset) of the milestones from boot to the first
+ * publish, to see where startup time goes:
+ *
+ *   wifi_begin -> device_id -> serial -> rtc -> setup                (setup())
+ *   sensors, wifi_up, query, discovered, config, transport, first_publish
+ *                                                                    (loop())
+ *
+ * The WiFi join and the sensor warm-up both run in the background from
+ * setup(), so wifi_up and sensors land in either order. Each milestone is
+ * kept the first time it is reached; later rediscovery or reconnects don't
+ * move it.
+ *
+ * The timeline is published once, retained on "<mqtt_topic>/boot", after
+ * the first publish:
+ *
+ *   {"marks_ms":{"wifi_begin":2,"device_id":141,"serial":5001,...},
+ *    "first_publish_ms":8210}
+ *
+ * ============================================================================
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+
+/**
+ * Boot Milestones (in the order they are normally reached)
+ */
+typedef enum {
+  BOOT_MARK_WIFI_BEGIN = 0,  // Background join started
+  BOOT_MARK_DEVICE_ID,       // Crypto chip serial read
+  BOOT_MARK_SERIAL,          // Serial ready (or wait timed out)
+  BOOT_MARK_RTC,             // RTC initialized
+  BOOT_MARK_SETUP,           // setup() done
+  BOOT_MARK_SENSORS,         // Sensors probed after the warm-up
+  BOOT_MARK_WIFI_UP,         // Link up
+  BOOT_MARK_QUERY,           // First mDNS query sent
+  BOOT_MARK_DISCOVERED,      // Config server found
+  BOOT_MARK_CONFIG,          // Config fetched
+  BOOT_MARK_TRANSPORT,       // Broker session (or UDP receiver) ready
+  BOOT_MARK_FIRST_PUBLISH,   // First message handed to the transport
+  BOOT_MARK_COUNT
+} BootMark;
+
+/**
+ * Record a milestone (first call only)
+ */
+void bootMark(BootMark mark);
+
+/**
+ * Time of a milestone (ms since reset), 0 if not reached
+ */
+uint32_t bootMarkTime(BootMark mark);
+
+/**
+ * Get milestone name ("wifi_begin", "device_id", ...)
+ */
+const char* bootMarkName(BootMark mark);
+
+/**
+ * Format the timeline as JSON (milestones not reached are left out)
+ *
+ * Returns:
+ *   buffer, or NULL if it does not fit
+ */
+char* formatBootTimelineJSON(char* buffer, size_t buffer_size);
+
+#endif  // BOOT_TIMELINE_H
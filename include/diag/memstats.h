@@ -0,0 +1,93 @@
+/**
+ * ============================================================================
+ * Memory Statistics Module Header
+ * ============================================================================
+ * Stack high-water-mark and heap usage instrumentation.
+ *
+ * STACK PAINTING:
+ *   Free RAM between the heap end and the stack pointer is filled with a
+ *   pattern once at boot. The deepest overwritten word gives the stack
+ *   high-water mark. Each call path (phase) measures on exit; on entry only
+ *   the words used since the last measurement are repainted, so the peak of
+ *   every phase is tracked separately without rewriting all free RAM.
+ *
+ * HEAP:
+ *   mallinfo() totals plus the number of free chunks as a fragmentation
+ *   indicator.
+ *
+ * PLATFORM: SAMD21 (uses linker symbol __StackTop); other targets report 0
+ *
+ * ============================================================================
+ */
+
+#ifndef MEMSTATS_H
+#define MEMSTATS_H
+
+#include <Arduino.h>
+
+/**
+ * Instrumented Call Paths
+ */
+typedef enum {
+  MEM_PHASE_SETUP = 0,       // setup() from boot to main loop
+  MEM_PHASE_DISCOVERY,       // mDNS response handling
+  MEM_PHASE_CONFIG_FETCH,    // HTTP config fetch + JSON parse
+  MEM_PHASE_PUBLISH,         // Sensor read, format and publish
+  MEM_PHASE_COUNT
+} MemPhase;
+
+/**
+ * Memory Snapshot
+ */
+typedef struct {
+  uint32_t stack_peak;                     // Deepest stack use seen (bytes)
+  uint32_t stack_headroom;                 // Smallest gap heap end <-> stack (bytes)
+  uint32_t heap_arena;                     // Bytes obtained from sbrk
+  uint32_t heap_used;                      // Bytes in allocated chunks
+  uint32_t heap_free;                      // Bytes in free chunks inside arena
+  uint32_t heap_free_chunks;               // Free chunk count (fragmentation)
+  uint32_t free_ram;                       // Unclaimed RAM + heap_free
+  uint32_t phase_peak[MEM_PHASE_COUNT];    // Stack peak per call path (bytes)
+} MemStats;
+
+/**
+ * Paint free stack at boot
+ * Call first thing in setup(); also opens MEM_PHASE_SETUP.
+ */
+void memStatsBegin(void);
+
+/**
+ * Repaint the stack used so far before entering an instrumented call path
+ *
+ * Parameters:
+ *   - phase: Call path about to run
+ */
+void memStatsPhaseBegin(MemPhase phase);
+
+/**
+ * Measure stack depth reached by the call path and update its peak
+ *
+ * Parameters:
+ *   - phase: Call path that just finished
+ */
+void memStatsPhaseEnd(MemPhase phase);
+
+/**
+ * Take a snapshot (measures stack and reads mallinfo)
+ *
+ * Parameters:
+ *   - stats: Output snapshot
+ */
+void memStatsSample(MemStats* stats);
+
+/**
+ * Get human-readable phase name (used in JSON keys and reports)
+ */
+const char* memPhaseName(MemPhase phase);
+
+/**
+ * Print per-call-path report to Serial (debug builds)
+ */
+void memStatsPrintReport(void);
+
+#endif  // MEMSTATS_H
@@ -0,0 +1,35 @@
+/**
+ * ============================================================================
+ * Device Status Report Header
+ * ============================================================================
+ * Builds the JSON document published on the "<mqtt_topic>/status" subtopic:
+ * uptime, RTC state, stack/heap statistics and logging drop counters.
+ *
+ * ============================================================================
+ */
+
+#ifndef STATUS_H
+#define STATUS_H
+
+#include <Arduino.h>
+
+/**
+ * Format device status as JSON
+ *
+ * Parameters:
+ *   - buffer: Output buffer for JSON string
+ *   - buffer_size: Maximum buffer size in bytes
+ *
+ * Returns:
+ *   Pointer to buffer on success
+ *   NULL if invalid parameters or buffer too small
+ *
+ * Format (example):
+ *   {"uptime_s":3600,"rtc":"synced","stack_peak":3120,"stack_headroom":14800,
+ *    "stack_by_path":{"setup":2100,"discovery":1500,"config_fetch":3120,
+ *    "publish":900},"heap_used":1800,"heap_free":240,"heap_free_chunks":2,
+ *    "free_ram":15040,"log_dropped":0,"syslog_dropped":0}
+ */
+char* formatStatusJSON(char* buffer, size_t buffer_size);
+
+#endif  // STATUS_H
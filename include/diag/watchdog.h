@@ -0,0 +1,117 @@
+/**
+ * ============================================================================
+ * Watchdog Module Header
+ * ============================================================================
+ * Hardware watchdog (SAMD21 WDT) fed only while every task is live, plus
+ * the reset cause of the previous run.
+ *
+ * TASKS:
+ *   WATCHDOG_TASK_LOOP is periodic: it checks in on every loop() pass and
+ *   is stale once CONFIG_WATCHDOG_LOOP_DEADLINE_MS pass without one.
+ *   The other tasks wrap one blocking call (MQTT connect, config fetch,
+ *   OTA connect, gateway ping):
+ *   armed before it, disarmed after. While one is armed only its own
+ *   deadline counts - loop() is known to be inside that call.
+ *
+ * FEEDING:
+ *   The WDT runs from the 1.024 kHz OSCULP32K (generic clock 4) with a
+ *   16 s period. Its early-warning interrupt fires every 8 s and feeds it
+ *   if no task is stale, so a blocking call that is still within its
+ *   deadline does not trip the hardware. Once a task is stale (or
+ *   watchdogHalt() was called) feeding stops and the WDT resets the chip
+ *   within 8 s. With interrupts dead, it resets after 16 s.
+ *
+ * RESET RECORD:
+ *   A small record in RAM that the startup code doesn't clear (.noinit)
+ *   survives the reset. It holds the stale task or halt reason, the
+ *   uptime at the last feed and boot/watchdog-reset counters. It is
+ *   validated by a magic word and checksum (garbage after power-on).
+ *   Together with PM->RCAUSE it is reported once after reboot (log +
+ *   status report).
+ *
+ * PLATFORM: SAMD21; other targets compile to no-ops and report "unknown"
+ *
+ * ============================================================================
+ */
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Supervised Tasks
+ */
+typedef enum {
+  WATCHDOG_TASK_LOOP = 0,        // loop() passes (periodic check-in)
+  WATCHDOG_TASK_MQTT_CONNECT,    // Broker connect / failback probe lookup (armed)
+  WATCHDOG_TASK_CONFIG_FETCH,    // HTTP config fetch (armed)
+  WATCHDOG_TASK_NET_CALL,        // OTA server connect / gateway ping (armed)
+  WATCHDOG_TASK_COUNT
+} WatchdogTask;
+
+/**
+ * Reset Cause (PM->RCAUSE, highest priority bit)
+ */
+typedef enum {
+  RESET_CAUSE_UNKNOWN = 0,
+  RESET_CAUSE_POWER_ON,
+  RESET_CAUSE_BROWNOUT,
+  RESET_CAUSE_EXTERNAL,        // Reset pin / double-tap
+  RESET_CAUSE_WATCHDOG,
+  RESET_CAUSE_SOFTWARE         // NVIC_SystemReset (upload, OTA)
+} ResetCause;
+
+/**
+ * Previous Run, as Found at Boot
+ */
+typedef struct {
+  ResetCause cause;
+  char culprit[CONFIG_WATCHDOG_CULPRIT_LEN];  // Stale task or halt reason, "" if none
+  uint32_t uptime_ms;          // Uptime at the last feed before the reset
+  uint32_t boots;              // Boots since power-on
+  uint32_t watchdog_resets;    // Watchdog resets since power-on
+} ResetInfo;
+
+/**
+ * Read the reset cause and record, then start the WDT
+ * Call first thing in setup(); setup() itself runs under the loop deadline.
+ */
+void watchdogBegin(void);
+
+/**
+ * Report progress of a periodic task
+ */
+void watchdogCheckin(WatchdogTask task);
+
+/**
+ * Start / end a blocking call that must finish within the task deadline
+ */
+void watchdogArm(WatchdogTask task);
+void watchdogDisarm(WatchdogTask task);
+
+/**
+ * Stop feeding and wait for the watchdog reset (replaces fatal halts)
+ *
+ * PARAMETERS:
+ *   reason - Short tag kept in the reset record, e.g. "device_id"
+ */
+void watchdogHalt(const char* reason) __attribute__((noreturn));
+
+/**
+ * Previous run's reset cause and record
+ */
+const ResetInfo* watchdogGetResetInfo(void);
+
+/**
+ * Get reset cause name ("power_on", "watchdog", ...)
+ */
+const char* resetCauseName(ResetCause cause);
+
+/**
+ * Get task name ("loop", "mqtt_connect", ...)
+ */
+const char* watchdogTaskName(WatchdogTask task);
+
+#endif  // WATCHDOG_H
@@ -0,0 +1,135 @@
+/**
+ * ============================================================================
+ * Deferred Logging Module Header
+ * ============================================================================
+ * Compact binary logging for hot paths. LOG_EVENT() stores a message ID plus
+ * up to CONFIG_LOG_MAX_ARGS 32-bit arguments in a RAM ring buffer; nothing is
+ * formatted on the device. logDrain() streams queued records to Serial only
+ * as fast as the port accepts them, so logging never blocks loop().
+ *
+ * SERIAL:
+ *   The no-blocking guarantee is exact on a UART, where availableForWrite()
+ *   is the free TX buffer. The SAMD native USB port reports a constant, so
+ *   there a pass writes nothing without a terminal (DTR low) and at most
+ *   CONFIG_LOG_DRAIN_SERIAL_BYTES otherwise: a host that stops reading can
+ *   hold a pass up for one USB write timeout, not for the whole ring.
+ *
+ * FRAME FORMAT (little-endian):
+ *   [0xA5 0x5A] [id:u8] [argc:u8] [millis:u32] [arg:u32 x argc]
+ *
+ * Decode on the host with: tools/decode_log.py --port /dev/ttyACM0
+ * Frames are interleaved with ordinary DEBUG_PRINT text, which the decoder
+ * passes through unchanged.
+ *
+ * When a syslog target is configured (log/syslog.h) the same records are
+ * also formatted on drain and streamed over UDP.
+ *
+ * ============================================================================
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+#include "log/log_messages.h"
+
+/**
+ * Log Severity Levels
+ */
+typedef enum {
+  LOG_LEVEL_ERROR = 0,
+  LOG_LEVEL_WARN = 1,
+  LOG_LEVEL_INFO = 2,
+  LOG_LEVEL_DEBUG = 3
+} LogLevel;
+
+/**
+ * Log Message IDs (generated from log_messages.h)
+ */
+#define LOG_ENUM_ENTRY(id, level, fmt) id,
+typedef enum {
+  LOG_MESSAGES(LOG_ENUM_ENTRY)
+  LOG_MESSAGE_COUNT
+} LogMessageID;
+#undef LOG_ENUM_ENTRY
+
+/**
+ * Append a binary record to the ring buffer
+ * Never blocks: if the ring is full the record is dropped and counted.
+ * Records above the runtime level (logSetLevel) are discarded up front.
+ *
+ * Parameters:
+ *   - id: Message ID from log_messages.h
+ *   - args: Argument words (may be NULL when argc is 0)
+ *   - argc: Number of arguments (clamped to CONFIG_LOG_MAX_ARGS)
+ */
+void logWrite(LogMessageID id, const uint32_t* args, uint8_t argc);
+
+/**
+ * Drain queued records to Serial and the syslog sink
+ * Call when loop() is idle. Writes at most what the serial port can accept
+ * without blocking (see SERIAL above), CONFIG_LOG_DRAIN_SERIAL_BYTES and
+ * CONFIG_LOG_DRAIN_MAX_RECORDS per call, so may need several calls to
+ * empty the ring.
+ */
+void logDrain(void);
+
+/**
+ * Set runtime log level filter
+ *
+ * Parameters:
+ *   - level: Most verbose level to keep (LOG_LEVEL_DEBUG keeps everything)
+ */
+void logSetLevel(LogLevel level);
+
+/**
+ * Get runtime log level filter
+ */
+LogLevel logGetLevel(void);
+
+/**
+ * Parse a level name ("error", "warn", "info", "debug") or digit ("0"-"3")
+ *
+ * Returns:
+ *   true and sets *level if recognised, false otherwise
+ */
+bool logParseLevel(const char* text, LogLevel* level);
+
+/**
+ * Format a record as text using its log_messages.h format string
+ *
+ * Returns:
+ *   Number of characters written (excluding terminator)
+ */
+int logFormat(LogMessageID id, const uint32_t* args, uint8_t argc,
+              char* buffer, size_t buffer_size);
+
+/**
+ * Get severity of a message ID
+ */
+LogLevel logMessageLevel(LogMessageID id);
+
+/**
+ * Get number of records dropped because the ring was full
+ */
+uint32_t logGetDroppedCount(void);
+
+/**
+ * Typed front end for logWrite(): widens every argument to 32 bits
+ * (the leading 0 keeps the array non-empty for argument-less records)
+ */
+template <typename... Args>
+inline void logEvent(LogMessageID id, Args... args)
+{
+  const uint32_t words[] = {0, (uint32_t)args...};
+  logWrite(id, &words[1], (uint8_t)sizeof...(Args));
+}
+
+#if CONFIG_LOG_ENABLED
+  #define LOG_EVENT(id, ...) logEvent((id), ##__VA_ARGS__)
+#else
+  #define LOG_EVENT(id, ...)
+#endif
+
+#endif  // LOG_H
@@ -0,0 +1,67 @@
+/**
+ * ============================================================================
+ * Deferred Log Message Table
+ * ============================================================================
+ * Single source of truth for binary log records. Each entry is:
+ *
+ *   X(ID, LEVEL, "format")
+ *
+ * The device only stores the ID and its 32-bit arguments; the format string
+ * never leaves flash. tools/decode_log.py parses this file to turn records
+ * back into text, so:
+ *   - Append new entries at the end (IDs are positional)
+ *   - Use only %lu, %ld and %lx conversions (all arguments are 32-bit)
+ */
+
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+#define LOG_MESSAGES(X) \
+  X(LOG_MDNS_QUERY_BUILT,     LOG_LEVEL_DEBUG, "mDNS query built: %lu bytes") \
+  X(LOG_MDNS_QUERY_SENT,      LOG_LEVEL_DEBUG, "mDNS PTR query sent (%lu bytes)") \
+  X(LOG_MDNS_RESPONSE,        LOG_LEVEL_DEBUG, "mDNS response: %lu bytes, %lu answers") \
+  X(LOG_MDNS_RECORD,          LOG_LEVEL_DEBUG, "mDNS record type=%lu class=%lu ttl=%lu len=%lu") \
+  X(LOG_MDNS_SRV,             LOG_LEVEL_DEBUG, "mDNS SRV port=%lu target_len=%lu") \
+  X(LOG_MDNS_TXT,             LOG_LEVEL_DEBUG, "mDNS TXT path_len=%lu version_len=%lu") \
+  X(LOG_MDNS_A,               LOG_LEVEL_DEBUG, "mDNS A ip=%lx") \
+  X(LOG_MDNS_INCOMPLETE,      LOG_LEVEL_WARN,  "mDNS response incomplete (port=%lu path=%lu ip=%lu)") \
+  X(LOG_PUBLISH_HEARTBEAT,    LOG_LEVEL_INFO,  "Publishing heartbeat") \
+  X(LOG_PUBLISH_CHANGE,       LOG_LEVEL_INFO,  "Publishing change") \
+  X(LOG_PUBLISH_SKIPPED,      LOG_LEVEL_DEBUG, "Publish skipped (no significant change)") \
+  X(LOG_MQTT_PUBLISH_OK,      LOG_LEVEL_DEBUG, "MQTT published %lu bytes") \
+  X(LOG_MQTT_PUBLISH_FAILED,  LOG_LEVEL_ERROR, "MQTT publish failed (stage=%lu)") \
+  X(LOG_RING_OVERFLOW,        LOG_LEVEL_WARN,  "Log ring overflow: %lu records dropped") \
+  X(LOG_CONFIG_FETCHED,       LOG_LEVEL_INFO,  "Config fetched: HTTP %lu, %lu bytes") \
+  X(LOG_CONFIG_FETCH_FAILED,  LOG_LEVEL_ERROR, "Config fetch failed: HTTP %lu") \
+  X(LOG_MQTT_CONNECTED,       LOG_LEVEL_INFO,  "MQTT connected (port %lu)") \
+  X(LOG_MQTT_CONNECT_FAILED,  LOG_LEVEL_WARN,  "MQTT connect failed (port %lu)") \
+  X(LOG_MQTT_CONNECTION_LOST, LOG_LEVEL_WARN,  "MQTT connection lost") \
+  X(LOG_WIFI_JOIN_FAILED,     LOG_LEVEL_WARN,  "WiFi join failed (attempt %lu, status %lu), retry in %lu ms") \
+  X(LOG_WIFI_UP,              LOG_LEVEL_INFO,  "WiFi up: join %lu ms (fast=%lu), outage %lu ms, rssi %ld") \
+  X(LOG_WIFI_DOWN,            LOG_LEVEL_WARN,  "WiFi link lost (status %lu)") \
+  X(LOG_WIFI_FAST_JOIN_FAILED, LOG_LEVEL_WARN, "WiFi fast join failed (stage %lu), falling back to DHCP") \
+  X(LOG_UDP_TELEMETRY_LOST,   LOG_LEVEL_WARN,  "UDP telemetry seq %lu unacked after retries") \
+  X(LOG_COAP_OBSERVER_ADDED,  LOG_LEVEL_INFO,  "CoAP observer %lx:%lu registered (%lu active)") \
+  X(LOG_COAP_OBSERVER_DROPPED, LOG_LEVEL_INFO, "CoAP observer dropped (reason %lu, %lu active)") \
+  X(LOG_MQTT_FAILOVER,        LOG_LEVEL_WARN,  "MQTT failover: broker %lu -> %lu (score %lu)") \
+  X(LOG_MQTT_FAILBACK,        LOG_LEVEL_INFO,  "MQTT failback to broker %lu (hold-down %lu ms)") \
+  X(LOG_MQTT_TLS_HANDSHAKE,   LOG_LEVEL_INFO,  "MQTT TLS connect %lu ms (TCP + full handshake)") \
+  X(LOG_MQTT_TLS_FALLBACK,    LOG_LEVEL_WARN,  "MQTT TLS failed, connected in plaintext on port %lu") \
+  X(LOG_MQTT_IDLE_TIMEOUT,    LOG_LEVEL_WARN,  "MQTT session lost after %lu s idle (NAT?), pinging every %lu s") \
+  X(LOG_PUBLISH_COALESCED,    LOG_LEVEL_INFO,  "Change folded into heartbeat sent %lu s early") \
+  X(LOG_DEVICE_STATE,         LOG_LEVEL_INFO,  "Device state %lu -> %lu after %lu ms") \
+  X(LOG_DEVICE_REHOME,        LOG_LEVEL_WARN,  "Transport unusable, rediscovering config server (%lu queued)") \
+  X(LOG_RULE_ALARM,           LOG_LEVEL_WARN,  "Rule %lu alarm %lu (1 = raised, 0 = cleared)") \
+  X(LOG_MDNS_ANNOUNCED,       LOG_LEVEL_INFO,  "mDNS service announced (port %lu, %lu bytes)") \
+  X(LOG_METRICS_SCRAPE,       LOG_LEVEL_DEBUG, "Metrics scraped in %lu ms") \
+  X(LOG_RESET_CAUSE,          LOG_LEVEL_WARN,  "Reset cause %lu after %lu ms uptime (%lu watchdog resets)") \
+  X(LOG_BOOT_MARK,            LOG_LEVEL_INFO,  "Boot milestone %lu at %lu ms") \
+  X(LOG_OTA_START,            LOG_LEVEL_INFO,  "OTA download of %lu bytes started (attempt %lu)") \
+  X(LOG_OTA_FAILED,           LOG_LEVEL_WARN,  "OTA failed: error %lu at byte %lu") \
+  X(LOG_OTA_READY,            LOG_LEVEL_INFO,  "OTA image of %lu bytes verified in %lu ms") \
+  X(LOG_OTA_RESUME,           LOG_LEVEL_INFO,  "OTA download resumed at byte %lu of %lu") \
+  X(LOG_SETTING_CHANGED,      LOG_LEVEL_INFO,  "Setting %lu = %lu (source %lu)") \
+  X(LOG_SETTING_REJECTED,     LOG_LEVEL_WARN,  "Setting %lu rejected (result %lu)") \
+  X(LOG_CONFIG_REJECTED,      LOG_LEVEL_WARN,  "Config rejected: reason %lu, field %lu")
+
+#endif  // LOG_MESSAGES_H
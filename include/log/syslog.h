@@ -0,0 +1,79 @@
+/**
+ * ============================================================================
+ * Remote Syslog Sink Header
+ * ============================================================================
+ * Streams deferred log records (log/log.h) to a UDP syslog or collector
+ * endpoint in RFC 5424 format, several records per datagram.
+ *
+ * BEHAVIOR:
+ *   - Target set from config (syslog_host/syslog_port) or, when only a port
+ *     is given, the config server found via mDNS
+ *   - Token-bucket rate limit (settings syslog_rate_per_sec and
+ *     syslog_burst); excess records are dropped and counted
+ *   - Batches flush when full or after CONFIG_SYSLOG_FLUSH_MS
+ *   - Never blocks: no flush while WiFi is down, records are dropped instead
+ *   - A hostname is looked up once, in syslogBegin() (under the watchdog);
+ *     if that fails records are dropped until the next config
+ *
+ * ============================================================================
+ */
+
+#ifndef SYSLOG_H
+#define SYSLOG_H
+
+#include <Arduino.h>
+#include "log/log.h"
+#include "settings/settings.h"
+
+/**
+ * Start streaming to a syslog endpoint
+ *
+ * Parameters:
+ *   - host: Dotted IPv4 or hostname (looked up now; blocks while NINA
+ *           resolves it)
+ *   - port: UDP port (514 for standard syslog)
+ *   - hostname: Device name used in the HOSTNAME field (e.g. device ID)
+ *
+ * Returns:
+ *   true if the target was accepted (an unresolved one included)
+ */
+bool syslogBegin(const char* host, uint16_t port, const char* hostname);
+
+/**
+ * Stop streaming and discard any pending batch
+ */
+void syslogEnd(void);
+
+/**
+ * Check if a syslog target is configured
+ */
+bool syslogIsActive(void);
+
+/**
+ * Queue one formatted record into the current batch
+ * Called by logDrain(); applies the rate limit.
+ *
+ * Parameters:
+ *   - level: Record severity
+ *   - timestamp_ms: millis() when the record was logged
+ *   - text: Formatted message
+ */
+void syslogAppend(LogLevel level, uint32_t timestamp_ms, const char* text);
+
+/**
+ * Flush the batch if it is due
+ * Called by logDrain(); safe to call when inactive.
+ */
+void syslogPoll(void);
+
+/**
+ * Settings listener: a smaller burst takes effect right away
+ */
+void syslogOnSettingChange(SettingKey key);
+
+/**
+ * Get number of records dropped by the rate limiter or while offline
+ */
+uint32_t syslogGetDroppedCount(void);
+
+#endif  // SYSLOG_H
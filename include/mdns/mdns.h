@@ -59,4 +59,12 @@ void handleMDNSResponse(int packetSize);
  */
 const DiscoveredConfig* getDiscoveredConfig(void);
 
+/**
+ * Forget the discovered configuration server
+ *
+ * Used when the server stops answering, or its config no longer works:
+ * only a fresh mDNS response makes the config valid again.
+ */
+void clearDiscoveredConfig(void);
+
 #endif  // MDNS_H
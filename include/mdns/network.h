@@ -10,21 +10,7 @@
 
 #include <Arduino.h>
 #include <stdint.h>
-#include <WiFiUdp.h>
-
-/**
- * Establish WiFi connection with timeout protection
- *
- * FEATURES:
- *   - Timeout protection (30 seconds max)
- *   - Detailed logging of connection progress
- *   - Returns success/failure status
- *
- * RETURNS:
- *   true  - WiFi successfully connected
- *   false - Connection failed or timed out
- */
-bool connectToWiFi(void);
+#include <Udp.h>
 
 /**
  * Initialize mDNS UDP socket and prepare for service discovery
@@ -40,13 +26,30 @@ bool connectToWiFi(void);
  */
 bool initMDNS(void);
 
+/**
+ * WiFi link callback (see wifi/wifi_supervisor.h)
+ *
+ * Closes the mDNS socket when the link goes down and rebinds it when the
+ * link comes back up.
+ *
+ * PARAMETERS:
+ *   up - true when the link came up
+ */
+void mdnsSocketOnLinkChange(bool up);
+
+/**
+ * Check if the mDNS socket is currently bound
+ */
+bool isMDNSSocketBound(void);
+
 /**
  * Get reference to UDP socket for packet operations
  *
  * RETURNS:
- *   Reference to WiFiUDP object
+ *   Reference to UDP object (fault-injection wrapper when
+ *   CONFIG_NETFAULT_ENABLED, the WiFiUDP socket otherwise)
  */
-WiFiUDP& getUDPSocket(void);
+UDP& getUDPSocket(void);
 
 /**
  * Non-blocking delay that allows system to process interrupts
@@ -0,0 +1,60 @@
+/**
+ * ============================================================================
+ * mDNS Responder Header
+ * ============================================================================
+ * Advertises one service of this device over mDNS (RFC 6762 / RFC 6763),
+ * e.g. the metrics endpoint:
+ *
+ *   _prometheus-http._tcp.local  PTR  arduino-<id>._prometheus-http._tcp.local
+ *   arduino-<id>._prometheus-http._tcp.local  SRV  0 0 9100 arduino-<id>.local
+ *   arduino-<id>._prometheus-http._tcp.local  TXT  "path=/metrics"
+ *   arduino-<id>.local  A  <device IP>
+ *
+ * The records are announced twice, one second apart, every time the link
+ * comes up. After that, queries for the service, instance or host name are
+ * answered on a socket joined to 224.0.0.251:5353. The discovery socket
+ * (mdns.h) is separate and only sends queries.
+ *
+ * A query sent from a port other than 5353 (a "legacy" one-shot resolver
+ * such as dig or tools/metrics_scrape.py) gets a unicast answer that
+ * echoes its ID and question, with a short TTL (RFC 6762 section 6.7).
+ *
+ * There is no probing or conflict resolution: the instance and host
+ * names contain the device serial number, so they are unique.
+ *
+ * ============================================================================
+ */
+
+#ifndef RESPONDER_H
+#define RESPONDER_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Set the advertised service (no network activity)
+ *
+ * PARAMETERS:
+ *   service  - Service type and protocol, e.g. "_prometheus-http._tcp"
+ *   instance - Instance and host label, e.g. "arduino-0123ABCD"
+ *              (truncated to CONFIG_MDNS_LABEL_MAX_LEN)
+ *   port     - TCP/UDP port of the service
+ *   txt      - One TXT string ("key=value"), or NULL
+ *
+ * RETURNS:
+ *   true if the names fit
+ */
+bool mdnsResponderBegin(const char *service, const char *instance, uint16_t port, const char *txt);
+
+/**
+ * WiFi link callback - join the mDNS group and announce on link up
+ */
+void mdnsResponderOnLinkChange(bool up);
+
+/**
+ * Send due announcements and answer queries - must be called in loop
+ * Non-blocking: handles at most one datagram per call.
+ */
+void mdnsResponderPoll(void);
+
+#endif  // RESPONDER_H
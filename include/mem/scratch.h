@@ -0,0 +1,86 @@
+/**
+ * ============================================================================
+ * Scratch Arena Module Header
+ * ============================================================================
+ * One static RAM region shared by the large, short-lived buffers of the
+ * mutually exclusive program phases:
+ *
+ *   SCRATCH_DISCOVERY     mDNS response parsing (URL, record names),
+ *                         answering mDNS queries
+ *   SCRATCH_CONFIG_FETCH  HTTP response body, request URL / candidate
+ *                         config, JSON pool
+ *   SCRATCH_PUBLISH       Telemetry/status payload formatting
+ *   SCRATCH_COAP          CoAP /status response formatting
+ *
+ * Each phase describes its buffers as a struct and borrows the arena with
+ * scratchAcquire<T>(); sizeof(T) is checked against the arena at compile
+ * time. Only one phase may hold the arena: a second acquire fails (NULL)
+ * until the owner releases it, so overlapping phases are caught on the
+ * first run instead of silently corrupting each other.
+ *
+ * The arena is sized by the largest phase (config fetch); the publish
+ * phase uses the remainder as its telemetry buffer.
+ *
+ * ============================================================================
+ */
+
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Arena Owners
+ */
+typedef enum {
+  SCRATCH_IDLE = 0,
+  SCRATCH_DISCOVERY,
+  SCRATCH_CONFIG_FETCH,
+  SCRATCH_PUBLISH,
+  SCRATCH_COAP
+} ScratchPhase;
+
+/**
+ * Borrow the arena for a phase
+ *
+ * Parameters:
+ *   - phase: Phase taking ownership
+ *   - size: Bytes required
+ *
+ * Returns:
+ *   Pointer to zeroed arena (8-byte aligned)
+ *   NULL if another phase holds it or size exceeds CONFIG_SCRATCH_ARENA_SIZE
+ */
+void* scratchAcquire(ScratchPhase phase, size_t size);
+
+/**
+ * Typed acquire with compile-time size check
+ */
+template <typename T>
+inline T* scratchAcquire(ScratchPhase phase)
+{
+  static_assert(sizeof(T) <= CONFIG_SCRATCH_ARENA_SIZE,
+                "Phase layout does not fit CONFIG_SCRATCH_ARENA_SIZE");
+  return static_cast<T*>(scratchAcquire(phase, sizeof(T)));
+}
+
+/**
+ * Return the arena
+ *
+ * Parameters:
+ *   - phase: Phase releasing ownership (must match the owner)
+ */
+void scratchRelease(ScratchPhase phase);
+
+/**
+ * Get the phase currently holding the arena
+ */
+ScratchPhase scratchOwner(void);
+
+/**
+ * Get the largest size requested so far (for sizing the arena)
+ */
+size_t scratchHighWater(void);
+
+#endif  // SCRATCH_H
@@ -0,0 +1,82 @@
+/**
+ * ============================================================================
+ * Metrics Server Module Header
+ * ============================================================================
+ * Prometheus scrape endpoint: GET /metrics on CONFIG_METRICS_PORT returns
+ * the current readings, RTC state, publish counters, loop timing and free
+ * memory in the text exposition format (version 0.0.4):
+ *
+ *   # TYPE arduino_temperature_celsius gauge
+ *   arduino_temperature_celsius 23.5
+ *   # TYPE arduino_publish_sent_total counter
+ *   arduino_publish_sent_total 1042
+ *   ...
+ *
+ * The service is advertised over mDNS as _prometheus-http._tcp (see
+ * mdns/responder.h) with TXT "path=/metrics".
+ *
+ * NON-BLOCKING:
+ *   One connection at a time; further connections wait in the NINA
+ *   backlog until the current one is closed. Each metricsServerPoll()
+ *   does one step: read what has arrived of the request, or write one
+ *   group of metrics. A request that isn't complete within
+ *   CONFIG_METRICS_REQUEST_TIMEOUT_MS is dropped.
+ *
+ * STREAMED:
+ *   Metrics are printed from the counters straight into a
+ *   CONFIG_METRICS_CHUNK_SIZE byte buffer that is flushed to the socket
+ *   whenever it fills; the response is never held in RAM. It is sent
+ *   without Content-Length and the connection is closed to end it (HTTP/1.0).
+ *
+ * Host test: tools/metrics_scrape.py
+ *
+ * ============================================================================
+ */
+
+#ifndef METRICS_SERVER_H
+#define METRICS_SERVER_H
+
+#include <Arduino.h>
+#include "sensors/sensors.h"
+#include "arduino_configs.h"
+
+/**
+ * Metrics Server Statistics
+ */
+typedef struct {
+  uint32_t scrapes;        // /metrics responses completed
+  uint32_t rejected;       // Other paths/methods, oversized or timed-out requests
+  uint32_t last_scrape_ms; // Accept to close of the last scrape
+} MetricsServerStats;
+
+/**
+ * Loop timing - call first thing in every loop() pass
+ * Measures the time between calls (one full pass, whatever path it took).
+ */
+void metricsLoopTick(void);
+
+/**
+ * WiFi link callback - start listening on the first link up; drop the
+ * client in progress when the link goes down
+ */
+void metricsServerOnLinkChange(bool up);
+
+/**
+ * Accept, read or write one step - must be called in loop
+ */
+void metricsServerPoll(void);
+
+/**
+ * Set the readings served
+ *
+ * The pointer is kept and the values are printed from it, so it must stay
+ * valid (static storage).
+ */
+void metricsServerUpdate(const SensorReadings* readings);
+
+/**
+ * Get metrics server counters
+ */
+const MetricsServerStats* metricsServerGetStats(void);
+
+#endif  // METRICS_SERVER_H
@@ -0,0 +1,86 @@
+/**
+ * ============================================================================
+ * MQTT Broker Client Header
+ * ============================================================================
+ * One Client for the MQTT session that connects either in plaintext
+ * (WiFiClient) or over TLS (WiFiSSLClient), chosen per broker before each
+ * connect. A single MqttClient can then serve a broker list that mixes
+ * TLS and plaintext brokers.
+ *
+ * TLS:
+ *   The handshake runs on the NINA module (mbedTLS); the server certificate
+ *   is verified against the root certificates stored in the NINA firmware.
+ *   Add a private CA with the firmware/certificate uploader (see
+ *   docs/MQTT_SETUP.md). The WiFiNINA API has no session cache, so every
+ *   connect is a full handshake; its duration is recorded here.
+ *
+ * ============================================================================
+ */
+
+#ifndef BROKER_CLIENT_H
+#define BROKER_CLIENT_H
+
+#include <Arduino.h>
+#include <WiFiNINA.h>
+
+/**
+ * Connect Statistics
+ */
+typedef struct {
+  bool tls;                      // Last connect used TLS
+  uint32_t tls_handshakes;       // Successful TLS connects (TCP + full handshake)
+  uint32_t tls_failures;         // Failed TLS connects
+  uint32_t last_handshake_ms;    // TCP + TLS time of the last successful TLS connect
+  uint32_t max_handshake_ms;
+  uint32_t plain_connects;       // Successful plaintext connects
+  uint32_t last_plain_ms;        // TCP time of the last plaintext connect
+  uint32_t plaintext_fallbacks;  // TLS broker reached in plaintext (mqtt_tls_fallback)
+} BrokerClientStats;
+
+class BrokerClient : public Client {
+public:
+  /**
+   * Select TLS or plaintext for the next connect (not while connected)
+   */
+  void setSecure(bool secure) { _secure = secure; }
+  bool isSecure(void) const { return _secure; }
+
+  /**
+   * Count a TLS broker that was reached in plaintext instead
+   */
+  void notePlaintextFallback(void) { _stats.plaintext_fallbacks++; }
+
+  const BrokerClientStats* stats(void) const { return &_stats; }
+
+  /**
+   * Bytes read from the session so far (wraps); any change shows the
+   * broker is still answering
+   */
+  uint32_t bytesRead(void) const { return _rx_bytes; }
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  size_t write(uint8_t b) override { return active().write(b); }
+  size_t write(const uint8_t* buf, size_t size) override { return active().write(buf, size); }
+  using Print::write;
+  int available() override { return active().available(); }
+  int read() override;
+  int read(uint8_t* buf, size_t size) override;
+  int peek() override { return active().peek(); }
+  void flush() override { active().flush(); }
+  void stop() override { active().stop(); }
+  uint8_t connected() override { return active().connected(); }
+  operator bool() override { return (bool)active(); }
+
+private:
+  Client& active(void) { return _secure ? (Client&)_tls : (Client&)_plain; }
+  void record(bool ok, uint32_t elapsed_ms);
+
+  WiFiClient _plain;
+  WiFiSSLClient _tls;
+  bool _secure = false;
+  uint32_t _rx_bytes = 0;
+  BrokerClientStats _stats = {};
+};
+
+#endif  // BROKER_CLIENT_H
@@ -0,0 +1,130 @@
+/**
+ * ============================================================================
+ * MQTT Broker Pool Header
+ * ============================================================================
+ * Health bookkeeping and selection over the ordered broker list from the
+ * config ("mqtt_brokers"), so a broker restart fails over to the next one
+ * without a config fetch, and the device returns to the preferred broker
+ * once it is healthy again.
+ *
+ * HEALTH SCORE (0-100, higher is better):
+ *   100 - min(40, connect_ewma_ms / 50) - min(60, 20 * consecutive_failures)
+ *   connect_ewma_ms is a moving average (1/4 weight) of TCP+CONNECT time.
+ *
+ * SELECTION (when disconnected):
+ *   Brokers still inside their retry delay (CONFIG_MQTT_BROKER_RETRY_MIN_MS
+ *   doubling per consecutive failure) are skipped. Of the rest, the earliest
+ *   in the list wins unless a later one scores CONFIG_MQTT_BROKER_SCORE_MARGIN
+ *   higher. If every broker is waiting, nothing is tried this pass.
+ *
+ * FAILBACK (while on a later broker):
+ *   The most preferred broker not in its retry delay is probed (TCP connect
+ *   only) every CONFIG_MQTT_FAILBACK_PROBE_MS. After CONFIG_MQTT_FAILBACK_PROBES
+ *   consecutive successes, and once the current session has been up for the
+ *   hold-down time, the session moves back. If the broker then fails again
+ *   within the hold-down, the hold-down doubles (flap damping); a session
+ *   that outlives it resets the hold-down.
+ *
+ * The pool makes no network calls; mqtt_publish reports connect, probe and
+ * session-loss outcomes and asks it what to do next.
+ *
+ * ============================================================================
+ */
+
+#ifndef BROKER_POOL_H
+#define BROKER_POOL_H
+
+#include <Arduino.h>
+#include "config_fetch/config_fetch.h"
+#include "arduino_configs.h"
+
+#define BROKER_NONE -1
+
+/**
+ * Broker Pool Statistics
+ */
+typedef struct {
+  int8_t current;          // Connected broker index, BROKER_NONE if none
+  uint32_t failovers;      // Sessions established on a different broker after a loss
+  uint32_t failbacks;      // Moves back to a preferred broker
+  uint32_t probes;         // Failback probes sent
+  uint32_t holddown_ms;    // Current failback hold-down
+} BrokerPoolStats;
+
+/**
+ * Load the broker list and reset all health state
+ *
+ * Parameters:
+ *   - config: Parsed config (brokers / broker_count)
+ */
+void brokerPoolBegin(const MQTTConfig* config);
+
+/**
+ * Get number of brokers in the list
+ */
+uint8_t brokerPoolCount(void);
+
+/**
+ * Get a broker entry
+ *
+ * Returns: Entry, or NULL if index is out of range
+ */
+const MQTTBroker* brokerPoolGet(int8_t index);
+
+/**
+ * Choose the broker to connect to next
+ *
+ * Returns: Broker index, or BROKER_NONE if all are inside their retry delay
+ */
+int8_t brokerPoolSelect(uint32_t now);
+
+/**
+ * Report the outcome of a connect attempt
+ *
+ * Parameters:
+ *   - index: Broker tried
+ *   - ok: Session established
+ *   - latency_ms: Time spent in connect (success or failure)
+ *   - now: millis()
+ */
+void brokerPoolReportConnect(int8_t index, bool ok, uint32_t latency_ms, uint32_t now);
+
+/**
+ * Report loss of the current session (broker restart, network drop)
+ *
+ * Parameters:
+ *   - broker_fault: Count against the broker's health (false when the
+ *     WiFi link went down, which says nothing about the broker)
+ */
+void brokerPoolReportSessionLost(bool broker_fault, uint32_t now);
+
+/**
+ * Get the preferred broker due for a failback probe
+ *
+ * Returns: Broker index, or BROKER_NONE if on the primary or not yet due
+ */
+int8_t brokerPoolProbeCandidate(uint32_t now);
+
+/**
+ * Report the outcome of a failback probe
+ */
+void brokerPoolReportProbe(int8_t index, bool ok, uint32_t latency_ms, uint32_t now);
+
+/**
+ * Check whether to move the session back to a preferred broker
+ *
+ * Returns: Broker index to fail back to, or BROKER_NONE
+ */
+int8_t brokerPoolFailbackTarget(uint32_t now);
+
+/**
+ * Get a broker's health score (0-100)
+ */
+uint8_t brokerPoolScore(int8_t index);
+
+/**
+ * Get broker pool counters
+ */
+const BrokerPoolStats* brokerPoolGetStats(void);
+
+#endif  // BROKER_POOL_H
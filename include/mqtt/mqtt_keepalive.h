@@ -0,0 +1,99 @@
+/**
+ * ============================================================================
+ * MQTT Keepalive Header
+ * ============================================================================
+ * Keepalive sized to the publish schedule instead of the library default,
+ * with publishes counted as keepalive traffic and a learned NAT idle limit.
+ *
+ * NEGOTIATED KEEPALIVE (CONNECT):
+ *   heartbeat_frequency_sec + poll_frequency_sec + CONFIG_MQTT_KEEPALIVE_SLACK_SEC,
+ *   clamped to [CONFIG_MQTT_KEEPALIVE_MIN_SEC, CONFIG_MQTT_KEEPALIVE_MAX_SEC].
+ *   A heartbeat is published at least every heartbeat interval (checked at
+ *   the poll interval), so with a reachable broker no PINGREQ is ever needed.
+ *
+ * PINGS:
+ *   Sent only after the session has been idle (nothing transmitted, publish
+ *   or ping) for the ping interval: the negotiated keepalive, or the learned
+ *   NAT limit if that is shorter. The library's own keepalive (and with it
+ *   its receive timeout) is off during a session, so mqtt_publish stops the
+ *   client when nothing arrives within CONFIG_MQTT_PINGRESP_TIMEOUT_MS of a
+ *   PINGREQ. Only completed publishes count as traffic.
+ *
+ * NAT LEARNING:
+ *   A session lost within CONFIG_MQTT_NAT_DETECT_MS of a transmission that
+ *   ended an idle gap of at least CONFIG_MQTT_KEEPALIVE_MIN_SEC is taken as
+ *   a NAT/firewall idle timeout: the limit becomes half that gap. After
+ *   CONFIG_MQTT_NAT_GROW_AFTER idle gaps of the full limit survive, it grows
+ *   by 1/8, up to 7/8 of the gap that failed (or until it reaches the
+ *   negotiated keepalive again and is dropped).
+ *
+ * The module makes no network calls; mqtt_publish reports traffic and
+ * session loss and asks it when to ping.
+ *
+ * ============================================================================
+ */
+
+#ifndef MQTT_KEEPALIVE_H
+#define MQTT_KEEPALIVE_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Keepalive Statistics
+ */
+typedef struct {
+  uint16_t keepalive_sec;  // Negotiated in CONNECT
+  uint16_t ping_sec;       // Idle time before a PINGREQ
+  uint16_t nat_limit_sec;  // Learned NAT idle limit, 0 if none
+  uint32_t pings;          // PINGREQs sent
+  uint32_t nat_drops;      // Sessions lost to an idle timeout
+} KeepaliveStats;
+
+/**
+ * Derive the keepalive from the publish schedule (learned NAT limit is kept)
+ *
+ * Parameters:
+ *   - poll_sec: poll_frequency_sec
+ *   - heartbeat_sec: heartbeat_frequency_sec
+ */
+void keepaliveBegin(uint16_t poll_sec, uint16_t heartbeat_sec);
+
+/**
+ * Get keepalive to send in CONNECT, in milliseconds
+ */
+uint32_t keepaliveNegotiatedMs(void);
+
+/**
+ * Start idle tracking for a new session
+ */
+void keepaliveOnConnect(uint32_t now);
+
+/**
+ * Record a transmission on the session (publish or ping)
+ *
+ * Parameters:
+ *   - is_ping: Transmission is a PINGREQ
+ *   - now: millis()
+ */
+void keepaliveNoteTraffic(bool is_ping, uint32_t now);
+
+/**
+ * Check whether the session has been idle long enough to need a PINGREQ
+ */
+bool keepalivePingDue(uint32_t now);
+
+/**
+ * Report loss of the session while the WiFi link is up
+ *
+ * Returns: true if the loss looks like a NAT idle timeout (the limit was
+ * lowered), false if it should count against the broker
+ */
+bool keepaliveOnSessionLost(uint32_t now);
+
+/**
+ * Get keepalive counters
+ */
+const KeepaliveStats* keepaliveGetStats(void);
+
+#endif  // MQTT_KEEPALIVE_H
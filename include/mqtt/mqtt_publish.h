@@ -10,6 +10,7 @@
 
 #include <Arduino.h>
 #include "config_fetch/config_fetch.h"
+#include "mqtt/broker_client.h"
 
 /**
  * MQTT Connection Status
@@ -42,6 +43,15 @@ MQTTStatus initMQTT(const MQTTConfig* config);
  */
 MQTTStatus maintainMQTT();
 
+/**
+ * WiFi link callback (see wifi/wifi_supervisor.h)
+ * Closes the session when the link drops; reconnects resume on link up
+ *
+ * Parameters:
+ *   - up: true when the link came up
+ */
+void mqttOnLinkChange(bool up);
+
 /**
  * Publish message to MQTT topic
  *
@@ -54,6 +64,33 @@ MQTTStatus maintainMQTT();
  */
 MQTTStatus publishToMQTT(const char* topic, const char* message);
 
+/**
+ * Publish message with the MQTT retained flag
+ * The broker keeps it as the topic's current value and hands it to new
+ * subscribers immediately; an empty message clears the retained value
+ *
+ * Parameters and return value as publishToMQTT()
+ */
+MQTTStatus publishRetainedToMQTT(const char* topic, const char* message);
+
+/**
+ * Build a subtopic of the configured topic: "<mqtt_topic>/<suffix>"
+ *
+ * Parameters:
+ *   - suffix: Subtopic name (e.g. "status")
+ *   - buffer: Output buffer for topic string
+ *   - buffer_size: Maximum buffer size in bytes
+ *
+ * Returns:
+ *   Pointer to buffer on success, NULL if not initialized or too long
+ */
+char* buildMQTTSubtopic(const char* suffix, char* buffer, size_t buffer_size);
+
+/**
+ * Get broker connect statistics (TLS handshake times, plaintext fallbacks)
+ */
+const BrokerClientStats* getMQTTClientStats();
+
 /**
  * Get current MQTT connection status
  *
@@ -0,0 +1,104 @@
+/**
+ * ============================================================================
+ * Publish Queue Header
+ * ============================================================================
+ * Small prioritized outbound queue in front of publishToMQTT(). Messages
+ * are produced whether or not the broker is reachable and sent highest
+ * priority first (oldest first within a priority), up to a byte budget per
+ * loop pass, so an alarm is not stuck behind a backlog after a reconnect.
+ *
+ * PRIORITIES:
+ *   PUBLISH_ALARM > PUBLISH_CHANGE > PUBLISH_HEARTBEAT > PUBLISH_STATS
+ *
+ * SUPERSEDING:
+ *   A message for a topic always replaces queued messages for the same
+ *   topic of lower priority: they would be sent after it and leave stale
+ *   data as the last (retained) value, e.g. an unsent heartbeat behind a
+ *   newer change. With PUBLISH_SUPERSEDE it replaces those of equal
+ *   priority too (a newer heartbeat replaces the unsent one; a newer
+ *   retained per-sensor value replaces the stale one).
+ *
+ * WHEN FULL (CONFIG_PUBLISH_QUEUE_SLOTS / CONFIG_PUBLISH_QUEUE_BYTES):
+ *   The oldest message of the lowest priority is dropped to make room, but
+ *   never one more important than the message being added.
+ *
+ * Messages are stored back to back in one static pool (subtopic and payload
+ * strings); the full topic is built when the message is sent.
+ *
+ * ============================================================================
+ */
+
+#ifndef PUBLISH_QUEUE_H
+#define PUBLISH_QUEUE_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Message Priority (lower value is sent first)
+ */
+typedef enum {
+  PUBLISH_ALARM = 0,
+  PUBLISH_CHANGE = 1,
+  PUBLISH_HEARTBEAT = 2,
+  PUBLISH_STATS = 3
+} PublishPriority;
+
+/**
+ * Message Flags
+ */
+#define PUBLISH_RETAIN     0x01  // MQTT retained flag
+#define PUBLISH_SUPERSEDE  0x02  // Also replace same-topic messages of equal priority
+
+/**
+ * Publish Queue Statistics
+ */
+typedef struct {
+  uint32_t queued;       // Messages accepted
+  uint32_t sent;         // Messages handed to the transport
+  uint32_t superseded;   // Replaced by a newer message for the same topic
+  uint32_t dropped;      // Evicted or rejected for lack of room
+  uint8_t depth;         // Messages waiting now
+} PublishQueueStats;
+
+/**
+ * Queue a message
+ *
+ * Parameters:
+ *   - priority: PublishPriority
+ *   - subtopic: Suffix below mqtt_topic ("status"), or NULL/"" for mqtt_topic
+ *   - payload: Message text (copied)
+ *   - flags: PUBLISH_RETAIN / PUBLISH_SUPERSEDE
+ *
+ * Returns:
+ *   true if queued, false if it cannot fit without dropping something
+ *   more important
+ */
+bool publishQueuePush(PublishPriority priority, const char* subtopic,
+                      const char* payload, uint8_t flags);
+
+/**
+ * Send queued messages while the transport accepts them
+ * Stops after CONFIG_PUBLISH_BUDGET_BYTES (at least one message is sent)
+ * or at the first failure (the message stays queued).
+ *
+ * Parameters:
+ *   - topic: Scratch buffer for building subtopic names
+ *   - topic_size: Size of topic in bytes
+ *
+ * Returns:
+ *   Number of messages sent
+ */
+uint8_t publishQueueService(char* topic, size_t topic_size);
+
+/**
+ * Get number of messages waiting
+ */
+uint8_t publishQueueDepth(void);
+
+/**
+ * Get queue counters
+ */
+const PublishQueueStats* publishQueueGetStats(void);
+
+#endif  // PUBLISH_QUEUE_H
@@ -0,0 +1,63 @@
+/**
+ * ============================================================================
+ * Per-Sensor Topics Header
+ * ============================================================================
+ * Optional topic layout ("mqtt_layout" in the config response) where each
+ * reading is published on its own subtopic as a plain number with the
+ * retained flag:
+ *
+ *   <mqtt_topic>/temperature_celsius   23.5
+ *   <mqtt_topic>/humidity_percent      45.2
+ *   <mqtt_topic>/pressure_millibar     1013.3
+ *   <mqtt_topic>/illuminance_lux       542.0
+ *   <mqtt_topic>/uv_index              2.1
+ *
+ * A subscriber gets the current value of each topic as soon as it
+ * subscribes. Heartbeats refresh every valid reading; change publishes send
+ * only the changed ones. A sensor that stops reading gets an empty retained
+ * message, which clears its last value on the broker.
+ *
+ * ============================================================================
+ */
+
+#ifndef SENSOR_TOPICS_H
+#define SENSOR_TOPICS_H
+
+#include <Arduino.h>
+#include "sensors/sensors.h"
+#include "mqtt/publish_queue.h"
+
+/**
+ * Topic Layout (MQTTConfig.topic_layout)
+ */
+typedef enum {
+  TOPIC_LAYOUT_COMBINED = 0,    // One JSON message on mqtt_topic (default)
+  TOPIC_LAYOUT_PER_SENSOR = 1,  // Retained plain numbers on <mqtt_topic>/<sensor>
+  TOPIC_LAYOUT_BOTH = 2
+} TopicLayout;
+
+/**
+ * Parse a layout name ("combined", "per_sensor", "both")
+ *
+ * Returns:
+ *   true if recognised (value stored in *layout)
+ */
+bool topicLayoutParse(const char* name, TopicLayout* layout);
+
+/**
+ * Queue readings for their per-sensor subtopics (retained)
+ * Each value supersedes an unsent older value for the same subtopic.
+ *
+ * Parameters:
+ *   - readings: Readings to publish
+ *   - fields: SensorChangeBit mask of subtopics to publish; a field whose
+ *     sensor is invalid is published empty (clears the retained value)
+ *   - priority: Queue priority (change or heartbeat)
+ *
+ * Returns:
+ *   true if every requested subtopic was queued
+ */
+bool queueSensorTopics(const SensorReadings* readings, uint8_t fields,
+                       PublishPriority priority);
+
+#endif  // SENSOR_TOPICS_H
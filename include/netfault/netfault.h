@@ -0,0 +1,178 @@
+/**
+ * ============================================================================
+ * Network Fault Injection Module Header
+ * ============================================================================
+ * Wraps the UDP (mDNS), TCP (config fetch) and MQTT transports with a layer
+ * that injects packet loss, delay, truncation, reordering and hangs.
+ *
+ * Used for resilience benchmarking only. Compiled in when
+ * CONFIG_NETFAULT_ENABLED is set (see [env:mkrwifi1010_netfault]); the
+ * wrappers are pass-through otherwise and never instantiated.
+ *
+ * SCENARIO RUN:
+ *   Built-in scenarios run back to back for CONFIG_NETFAULT_SCENARIO_MS each,
+ *   followed by a fault-free recovery window. At the end of every window a
+ *   report line is printed with time-to-recover and data loss counters.
+ *
+ * DATA LOSS:
+ *   A failed publish is not lost: the publish queue keeps the message and
+ *   sends it again. Loss is what the queue drops for lack of room
+ *   (publishQueueGetStats()->dropped) over the fault and recovery windows;
+ *   failed publishes are reported separately as retries.
+ *
+ * ============================================================================
+ */
+
+#ifndef NETFAULT_H
+#define NETFAULT_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <Udp.h>
+#include "arduino_configs.h"
+
+/**
+ * Fault Profile
+ * One scenario of injected network faults
+ */
+typedef struct {
+  const char* name;          // Scenario label used in reports
+  uint8_t loss_percent;      // UDP datagrams dropped / TCP connects refused (0-100)
+  uint16_t delay_ms;         // Added latency (UDP send, TCP first byte after connect)
+  uint16_t truncate_bytes;   // Cut datagrams / TCP streams after N bytes (0 = off)
+  bool reorder;              // Swap consecutive outgoing UDP datagrams
+  bool hang;                 // TCP connects succeed but no data ever arrives
+} NetFaultProfile;
+
+/**
+ * Fault Statistics
+ * Counters for the scenario currently running (reset per scenario)
+ */
+typedef struct {
+  uint32_t udp_sent;          // Datagrams delivered to the real socket
+  uint32_t udp_dropped;       // Datagrams discarded (send or receive)
+  uint32_t udp_truncated;     // Datagrams cut short
+  uint32_t udp_reordered;     // Datagrams sent out of order
+  uint32_t tcp_refused;       // TCP connects failed by injection
+  uint32_t tcp_truncated;     // TCP streams cut short
+  uint32_t tcp_hung;          // TCP connections that never returned data
+  uint32_t publish_ok;        // Successful publishes during the window
+  uint32_t publish_retried;   // Failed publishes during the window (kept by the queue)
+  uint32_t publish_dropped;   // Messages the publish queue dropped (data loss)
+  uint32_t recover_ms;        // Time from faults cleared to first good publish
+  bool recovered;             // A publish succeeded during the recovery window
+} NetFaultStats;
+
+/**
+ * Fault-injecting UDP wrapper
+ *
+ * Forwards to an inner UDP socket. Outgoing datagrams are staged so they can
+ * be dropped, truncated, held back (delay) or swapped with the next one
+ * (reorder). Incoming datagrams can be dropped or truncated.
+ */
+class NetFaultUDP : public UDP {
+public:
+  explicit NetFaultUDP(UDP& inner) : _inner(inner) {}
+
+  uint8_t begin(uint16_t port) override { return _inner.begin(port); }
+  uint8_t beginMulticast(IPAddress ip, uint16_t port) override { return _inner.beginMulticast(ip, port); }
+  void stop() override { _inner.stop(); }
+
+  int beginPacket(IPAddress ip, uint16_t port) override;
+  int beginPacket(const char* host, uint16_t port) override;
+  int endPacket() override;
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t* buf, size_t size) override;
+  using Print::write;
+
+  int parsePacket() override;
+  int available() override;
+  int read() override;
+  int read(unsigned char* buf, size_t len) override;
+  int read(char* buf, size_t len) override { return read((unsigned char*)buf, len); }
+  int peek() override { return _inner.peek(); }
+  void flush() override { _inner.flush(); }
+  IPAddress remoteIP() override { return _inner.remoteIP(); }
+  uint16_t remotePort() override { return _inner.remotePort(); }
+
+  /** Send held-back datagrams whose delay elapsed (called from netFaultPoll) */
+  void poll(void);
+
+private:
+  UDP& _inner;
+  int _rxRemaining = 0;       // Readable bytes left after truncation
+};
+
+/**
+ * Fault-injecting TCP client wrapper
+ *
+ * Forwards to an inner Client. Connects can be refused, streams delayed or
+ * truncated, and a "hang" makes the peer look connected but silent (e.g.
+ * a broker that accepts TCP but never sends CONNACK). A delayed connect
+ * returns at once; its first byte arrives delay_ms later, so the loop
+ * keeps running through the round trip.
+ */
+class NetFaultClient : public Client {
+public:
+  explicit NetFaultClient(Client& inner) : _inner(inner) {}
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(const char* host, uint16_t port) override;
+  size_t write(uint8_t b) override { return _inner.write(b); }
+  size_t write(const uint8_t* buf, size_t size) override { return _inner.write(buf, size); }
+  using Print::write;
+  int available() override;
+  int read() override;
+  int read(uint8_t* buf, size_t size) override;
+  int peek() override { return available() > 0 ? _inner.peek() : -1; }
+  void flush() override { _inner.flush(); }
+  void stop() override { _inner.stop(); }
+  uint8_t connected() override;
+  operator bool() override { return (bool)_inner; }
+
+private:
+  bool beforeConnect(void);
+  void afterConnect(int result);
+  bool inHandshake(void);
+
+  Client& _inner;
+  uint32_t _connectedAt = 0;  // millis() of last successful connect
+  uint32_t _rxCount = 0;      // Bytes delivered since connect
+  bool _hung = false;         // Current connection is silenced
+  bool _cut = false;          // Current connection was truncated
+};
+
+/**
+ * Start the scenario schedule
+ * Call once from setup() after the network modules are initialized
+ */
+void netFaultBegin(void);
+
+/**
+ * Advance the scenario schedule and flush delayed datagrams
+ * Must be called regularly in loop
+ */
+void netFaultPoll(void);
+
+/**
+ * Record the outcome of a telemetry publish (drives recovery/loss metrics)
+ *
+ * Parameters:
+ *   - ok: true if the publish succeeded
+ */
+void netFaultNotePublish(bool ok);
+
+/**
+ * Get the fault profile currently applied
+ *
+ * Returns:
+ *   Pointer to active profile (all-zero profile during recovery windows)
+ */
+const NetFaultProfile* netFaultActiveProfile(void);
+
+/**
+ * Get counters for the scenario currently running
+ */
+const NetFaultStats* netFaultGetStats(void);
+
+#endif  // NETFAULT_H
@@ -0,0 +1,107 @@
+/**
+ * ============================================================================
+ * Firmware Patch Decoder Header
+ * ============================================================================
+ * Rebuilds a new image from a patch against the running one, as the patch
+ * arrives (format and patch tool: tools/ota_delta.py).
+ *
+ * FORMAT:
+ *   16-byte header: "OTD1", target size, base size (u32), block size
+ *   (u16), LZSS window bits, count bits (u8), little-endian. Then blocks of
+ *   `block size` target bytes, each a u16 length and that many bytes of
+ *   LZSS-compressed operations:
+ *
+ *     COPY   offset, length        running image bytes
+ *     ADD    offset, length, diff  running image bytes plus diff bytes
+ *     INSERT length, bytes         new bytes
+ *
+ *   (a byte tag, then LEB128 varints). Operations never cross a block.
+ *
+ * STREAMING:
+ *   LZSS (heatshrink-style) needs only its window in RAM: 2^window bits
+ *   bytes, at most 1 << CONFIG_OTA_DELTA_WINDOW_BITS. The running image is
+ *   read in place from flash. deltaDecode() takes whatever arrived and
+ *   stops when the output buffer is full.
+ *
+ * RESUMING:
+ *   Every block starts from scratch (empty window, no operation open), so
+ *   after a dropped connection deltaRewind() goes back to the last block
+ *   boundary: request the patch from `resume_offset`, and the target is
+ *   rebuilt again from `resume_target`.
+ *
+ * The decoder checks the structure (header, ranges, block lengths); that
+ * the running image is the one the patch was made against is shown by the
+ * hash of the result.
+ *
+ * ============================================================================
+ */
+
+#ifndef DELTA_H
+#define DELTA_H
+
+#include <Arduino.h>
+
+#define DELTA_HEADER_SIZE 16
+
+/**
+ * Decoder State
+ */
+typedef enum {
+  DELTA_HEADER = 0,      // Reading the header
+  DELTA_BLOCK_LENGTH,    // Reading a block's length
+  DELTA_BLOCK,           // Decoding a block
+  DELTA_DONE,            // Whole target rebuilt
+  DELTA_ERROR            // Malformed patch (not resumable)
+} DeltaState;
+
+/**
+ * Decoder Status
+ */
+typedef struct {
+  DeltaState state;
+  uint32_t consumed;       // Patch bytes taken so far
+  uint32_t produced;       // Target bytes rebuilt so far
+  uint32_t resume_offset;  // Patch offset of the last block boundary
+  uint32_t resume_target;  // Target bytes before that boundary
+} DeltaStatus;
+
+/**
+ * Start decoding a patch from its first byte
+ *
+ * PARAMETERS:
+ *   base          - Running image (read in place)
+ *   base_capacity - Bytes readable at base
+ *   target_size   - Expected image size (the header must agree)
+ *   block_align   - Block size must be a multiple of this (flash row)
+ */
+void deltaBegin(const uint8_t* base, uint32_t base_capacity, uint32_t target_size,
+                uint32_t block_align);
+
+/**
+ * Go back to the last block boundary (after a dropped connection)
+ */
+void deltaRewind(void);
+
+/**
+ * Decode patch bytes into target bytes
+ *
+ * PARAMETERS:
+ *   in       - Patch bytes, continuing at status.consumed
+ *   length   - Bytes in `in`
+ *   out      - Target bytes are written here
+ *   space    - Room in `out`
+ *   produced - Set to the target bytes written
+ *
+ * Returns:
+ *   Patch bytes consumed (less than length once out is full, the target is
+ *   done, or on error)
+ */
+uint32_t deltaDecode(const uint8_t* in, uint32_t length, uint8_t* out, uint32_t space,
+                     uint32_t* produced);
+
+/**
+ * Get decoder status
+ */
+const DeltaStatus* deltaGetStatus(void);
+
+#endif  // DELTA_H
@@ -0,0 +1,115 @@
+/**
+ * ============================================================================
+ * Flash Bank Module Header
+ * ============================================================================
+ * Staging area for a new firmware image in the upper half of the internal
+ * flash, the copy that installs it, and the rows that persist device data
+ * across updates.
+ *
+ * LAYOUT (SAMD21G18, 256 KB):
+ *
+ *   0x00000  bootloader (8 KB, never touched)
+ *   0x02000  running sketch            <- image is copied here on apply
+ *   0x20000  staging bank              <- image is written here
+ *   0x3E000  persisted rows (8 KB)     <- settings, WiFi join cache
+ *
+ * An image can be at most 120 KB (the smaller of the two areas). The bank
+ * is refused (capacity 0) if the running sketch reaches into it.
+ *
+ * WRITES:
+ *   Whole rows (4 pages, 256 bytes): each row is erased, written page by
+ *   page and read back. The last row of an image is padded with 0xFF.
+ *
+ * PERSISTED ROWS:
+ *   One row per FlashRow at a fixed address above the bank. Neither an
+ *   image download nor apply touches them, so saved data outlives every
+ *   update, and the sketch image (the base patches are made against)
+ *   holds no device-specific bytes. A USB upload erases them.
+ *
+ * APPLY:
+ *   The stock bootloader can't install an image, so the copy runs from
+ *   RAM with interrupts off: erase and write the sketch area row by row
+ *   from the bank, then reset into the new sketch. The bootloader stays
+ *   intact, so a board interrupted mid-copy can still be flashed over USB
+ *   (double-tap reset).
+ *
+ * HOST BUILDS:
+ *   Without ARDUINO_ARCH_SAMD ([env:native] tests) the bank, the sketch
+ *   area and the rows are simulated in RAM with NOR rules (a write can only
+ *   clear bits; rows must be erased first), and apply copies into the
+ *   simulated sketch area and returns.
+ *
+ * ============================================================================
+ */
+
+#ifndef FLASH_BANK_H
+#define FLASH_BANK_H
+
+#include <Arduino.h>
+
+#define FLASH_BANK_ROW_SIZE 256
+
+/**
+ * Persisted Rows (fixed addresses; append only, never reorder)
+ */
+typedef enum {
+  FLASH_ROW_SETTINGS = 0,     // Runtime setting overrides (settings.h)
+  FLASH_ROW_WIFI_CACHE,       // Last DHCP lease for fast join (wifi_cache.h)
+  FLASH_ROW_COUNT
+} FlashRow;
+
+/**
+ * Largest image the bank can hold (bytes), 0 if it is not usable
+ */
+uint32_t flashBankCapacity(void);
+
+/**
+ * Erase and write one or more whole rows
+ *
+ * PARAMETERS:
+ *   offset - Row-aligned offset into the bank
+ *   data   - Bytes to write
+ *   length - Up to a whole number of rows; a partial last row is padded
+ *            with 0xFF
+ *
+ * Returns:
+ *   false if out of range, misaligned, or the read-back differs
+ */
+bool flashBankWrite(uint32_t offset, const uint8_t* data, uint32_t length);
+
+/**
+ * Bank contents (memory-mapped on the device)
+ */
+const uint8_t* flashBankData(void);
+
+/**
+ * Running sketch (memory-mapped), as large as the bank: the image patches
+ * are applied against
+ */
+const uint8_t* flashBankSketch(void);
+
+/**
+ * Install the first `length` bytes of the bank as the running sketch
+ *
+ * Does not return on the device (resets into the new image). Returns
+ * false if length is 0 or over capacity; the simulation returns true.
+ */
+bool flashBankApply(uint32_t length);
+
+/**
+ * Copy a persisted row into data (erased flash reads as 0xFF)
+ *
+ * Returns:
+ *   false if the row doesn't exist or length is over a row (data zeroed)
+ */
+bool flashRowRead(FlashRow row, void* data, uint32_t length);
+
+/**
+ * Erase a persisted row and write data to it (the rest reads 0xFF)
+ *
+ * Returns:
+ *   false if out of range or the read-back differs
+ */
+bool flashRowWrite(FlashRow row, const void* data, uint32_t length);
+
+#endif  // FLASH_BANK_H
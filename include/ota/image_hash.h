@@ -0,0 +1,68 @@
+/**
+ * ============================================================================
+ * Image Hash Module Header
+ * ============================================================================
+ * SHA-256 over a firmware image as it streams in, computed by the ECCX08
+ * crypto chip (SHA command: 64-byte blocks, the last one partial).
+ *
+ * The chip holds the hash state between calls, so no context is kept in
+ * RAM. The chip shares the I2C bus with the ENV shield: it is started with
+ * ECCX08.begin() and never ended (ECCX08.end() would release the bus).
+ *
+ * The chip also verifies the ECDSA P-256 signature of an offer against a
+ * public key passed in (external key, nothing is stored in the chip).
+ *
+ * Host builds (no ARDUINO_ARCH_SAMD, [env:native] tests) hash in software
+ * and check a stand-in signature: r = SHA-256(public_key | digest),
+ * s = digest. It proves nothing about the sender and is never built for
+ * the device.
+ *
+ * ============================================================================
+ */
+
+#ifndef IMAGE_HASH_H
+#define IMAGE_HASH_H
+
+#include <Arduino.h>
+
+#define IMAGE_HASH_BLOCK_SIZE 64
+#define IMAGE_HASH_SIZE 32
+
+/**
+ * Start a new hash
+ *
+ * Returns:
+ *   false if the crypto chip does not respond
+ */
+bool imageHashBegin(void);
+
+/**
+ * Add whole blocks
+ *
+ * PARAMETERS:
+ *   data   - Bytes to hash
+ *   length - Multiple of IMAGE_HASH_BLOCK_SIZE
+ */
+bool imageHashUpdate(const uint8_t* data, uint32_t length);
+
+/**
+ * Add the final partial block (0-63 bytes) and get the digest
+ */
+bool imageHashFinish(const uint8_t* tail, uint32_t length, uint8_t digest[IMAGE_HASH_SIZE]);
+
+/**
+ * Verify an ECDSA P-256 signature over a digest
+ *
+ * PARAMETERS:
+ *   digest     - SHA-256 of the signed message
+ *   signature  - r | s, 32 bytes each
+ *   public_key - X | Y, 32 bytes each
+ *
+ * Returns:
+ *   true only if the signature is valid (host builds: the stand-in
+ *   signature above)
+ */
+bool imageSignatureVerify(const uint8_t digest[IMAGE_HASH_SIZE], const uint8_t signature[64],
+                          const uint8_t public_key[64]);
+
+#endif  // IMAGE_HASH_H
@@ -0,0 +1,157 @@
+/**
+ * ============================================================================
+ * Firmware Update (OTA) Module Header
+ * ============================================================================
+ * Installs firmware images offered by the config server:
+ *
+ *   "firmware": {"version": "1.4.0", "url": "/firmware/mkr-1.4.0.bin",
+ *                "size": 98304, "sha256": "9f86d0...0f00a08",
+ *                "signature": "3b1f...c2d4"}
+ *
+ * An offer whose version is newer than CONFIG_FIRMWARE_VERSION is downloaded
+ * over HTTP (a relative url is fetched from the config server itself).
+ *
+ * SIGNED:
+ *   Before anything is downloaded the offer's signature is checked in the
+ *   crypto chip: ECDSA P-256 over SHA-256(sha256 | size (LE) | version),
+ *   against CONFIG_OTA_PUBLIC_KEY (tools/ota_sign.py). The image must then
+ *   hash to the signed sha256, so only images released with the private
+ *   key are installed, whoever serves the offer or the image. The signed
+ *   version, and the newer-version rule, keep an old signed image from
+ *   being offered as an update.
+ *
+ * PATCHES:
+ *   An offer may also carry a patch from one version to this one:
+ *
+ *     "delta": {"from": "1.3.2", "url": "/firmware/1.3.2-1.4.0.otd", "size": 6120}
+ *
+ *   A device running `from` downloads the patch instead and rebuilds the
+ *   image against its own flash (ota/delta.h). If the patch doesn't apply
+ *   (malformed, or the result fails the hash) the next attempt takes the
+ *   full image.
+ *
+ * STREAMED:
+ *   The image goes through one CONFIG_OTA_CHUNK_SIZE buffer (one flash
+ *   row) into the staging bank (ota/flash_bank.h); it is never held in RAM.
+ *   Each otaPoll() moves at most one chunk, so telemetry keeps flowing
+ *   meanwhile.
+ *
+ * RESUMED:
+ *   A transfer that drops (closed, stalled) continues with an HTTP Range
+ *   request after CONFIG_OTA_RESUME_DELAY_MS: the image from the last row
+ *   written, a patch from the last block boundary. A resume that follows
+ *   progress doesn't count as an attempt. A server answering 200 instead
+ *   of 206 gets the download started over.
+ *
+ * VERIFIED:
+ *   Once the bank holds `size` bytes it is hashed as written (SHA-256 in
+ *   the crypto chip, ota/image_hash.h, one chunk per poll) and compared
+ *   with the offer. Any other failure is retried from the start after
+ *   CONFIG_OTA_RETRY_INTERVAL_MS, CONFIG_OTA_MAX_ATTEMPTS times per offer;
+ *   an image that doesn't fit or a bad url is not retried.
+ *
+ * INSTALLED:
+ *   otaApply() copies the bank over the running sketch and resets; main
+ *   calls it once the publish queue has drained.
+ *
+ * Host tests: test/test_ota (this module over a scripted server, into
+ * the RAM flash bank of host builds), tools/ota_server.py (serves an
+ * image and its patch, and replays the download into a simulated flash
+ * bank), tools/ota_delta.py (makes patches, applies them with resumes)
+ *
+ * ============================================================================
+ */
+
+#ifndef OTA_H
+#define OTA_H
+
+#include <Arduino.h>
+#include "config_fetch/config_fetch.h"
+#include "arduino_configs.h"
+
+/**
+ * Update State
+ */
+typedef enum {
+  OTA_IDLE = 0,        // No offer, or the offer is not newer than this build
+  OTA_DOWNLOADING,     // Streaming into the bank
+  OTA_READY,           // Image verified, waiting for otaApply()
+  OTA_FAILED           // Last attempt failed (retried while attempts remain)
+} OtaState;
+
+/**
+ * Failure Reason
+ */
+typedef enum {
+  OTA_ERROR_NONE = 0,
+  OTA_ERROR_TOO_LARGE,     // Image larger than the bank
+  OTA_ERROR_URL,           // Unusable url
+  OTA_ERROR_CONNECT,       // Server did not accept the connection
+  OTA_ERROR_HTTP,          // Not 200, or Content-Length differs from the offer
+  OTA_ERROR_STALLED,       // Nothing received for CONFIG_OTA_STALL_TIMEOUT_MS
+  OTA_ERROR_SHORT,         // Connection closed before `size` bytes
+  OTA_ERROR_FLASH,         // Write or read-back failed
+  OTA_ERROR_HASH,          // Digest differs from the offer (or chip error)
+  OTA_ERROR_DELTA,         // Patch malformed or not for this image
+  OTA_ERROR_SIGNATURE,     // Offer not signed with CONFIG_OTA_PUBLIC_KEY
+  OTA_ERROR_COUNT
+} OtaError;
+
+/**
+ * Update Status
+ */
+typedef struct {
+  OtaState state;
+  OtaError error;          // Last failure
+  char version[CONFIG_OTA_VERSION_MAX_LEN];  // Offered version
+  uint32_t size;           // Image bytes
+  uint32_t received;       // Bytes written to the bank so far
+  uint8_t attempts;        // Downloads started for this offer
+  uint32_t download_ms;    // Duration of the successful download
+  bool delta;              // Current attempt takes the patch
+  uint32_t transferred;    // Body bytes received for this offer
+  uint8_t resumes;         // Transfers resumed after a drop
+} OtaStatus;
+
+/**
+ * Take the firmware offer of a freshly fetched config
+ *
+ * PARAMETERS:
+ *   offer       - Parsed offer (size 0 = none)
+ *   server_host - Config server, for a relative url
+ *   server_port - Config server port
+ *   now         - Current millis()
+ *
+ * Returns:
+ *   true if a download was started (an offer already in progress or
+ *   installed is kept)
+ */
+bool otaOffer(const FirmwareOffer* offer, const char* server_host, uint16_t server_port,
+              uint32_t now);
+
+/**
+ * Advance the download by at most one chunk - call in loop
+ */
+OtaState otaPoll(uint32_t now);
+
+/**
+ * Install the verified image and reset (returns false if not OTA_READY)
+ */
+bool otaApply(void);
+
+/**
+ * Get update status
+ */
+const OtaStatus* otaGetStatus(void);
+
+/**
+ * Get state name ("idle", "downloading", ...)
+ */
+const char* otaStateName(OtaState state);
+
+/**
+ * Get failure reason name ("none", "connect", "hash", ...)
+ */
+const char* otaErrorName(OtaError error);
+
+#endif  // OTA_H
@@ -54,6 +54,16 @@ RTCStatus initRTC(void);
  */
 RTCStatus syncRTCWithNetwork(void);
 
+/**
+ * WiFi link callback (see wifi/wifi_supervisor.h)
+ * A link up requests a sync on the next syncRTCWithNetwork() call,
+ * bypassing the adaptive interval (time may have drifted during the outage)
+ *
+ * Parameters:
+ *   - up: true when the link came up
+ */
+void rtcOnLinkChange(bool up);
+
 /**
  * Get current Unix timestamp from RTC
  *
@@ -0,0 +1,138 @@
+/**
+ * ============================================================================
+ * Edge Rules Header
+ * ============================================================================
+ * Small rule expressions from the config response ("rules"), compiled once
+ * into stack bytecode and evaluated against every sensor sample:
+ *
+ *   "rules": [
+ *     {"name": "humid_warm", "when": "humidity > 70 && d_temperature > 0"},
+ *     {"name": "dark", "when": "illuminance < 5", "action": "drop"},
+ *     {"name": "frost", "when": "temperature < 0.5", "action": "alarm"}
+ *   ]
+ *
+ * EXPRESSIONS:
+ *   - Readings: temperature, humidity, pressure, illuminance, uv (or the
+ *     full JSON keys, e.g. temperature_celsius)
+ *   - d_<reading>: change since the previous sample (> 0 means rising)
+ *   - Numbers with up to 3 decimals
+ *   - Operators: ( ) - ! * / + - < <= > >= == != && || (and / or / not)
+ *   A reading whose sensor is invalid makes the rule unknown (not true).
+ *
+ * ACTIONS:
+ *   publish (default) - With any publish rule configured, a change message
+ *                       is sent when one turns true, instead of when a
+ *                       threshold is crossed; it carries every reading
+ *   drop              - No change message while true (heartbeats still go)
+ *   alarm             - Retained {"active":...} on <mqtt_topic>/alarm/<name>
+ *                       when the rule turns true or false, sent first
+ *
+ * EVALUATION:
+ *   Values are fixed point (thousandths), so no float math runs per rule.
+ *   Bytecode has no jumps: a rule runs at most CONFIG_RULE_CODE_MAX bytes of
+ *   instructions, and the compiler rejects expressions needing more than
+ *   CONFIG_RULE_STACK_DEPTH stack entries.
+ *
+ * ============================================================================
+ */
+
+#ifndef RULES_H
+#define RULES_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+#include "sensors/sensors.h"
+
+/**
+ * Rule Action
+ */
+typedef enum {
+  RULE_PUBLISH = 0,
+  RULE_DROP = 1,
+  RULE_ALARM = 2
+} RuleAction;
+
+/**
+ * Outcome of one evaluation pass
+ */
+typedef struct {
+  bool has_publish;     // Publish rules exist (they replace the change thresholds)
+  bool publish;         // A publish rule turned true
+  bool suppress;        // A drop rule is true
+  uint8_t raised;       // Alarm rules that turned true (bit per rule index)
+  uint8_t cleared;      // Alarm rules that turned false
+} RuleVerdict;
+
+/**
+ * Rule Statistics
+ */
+typedef struct {
+  uint8_t count;        // Rules loaded
+  uint32_t evaluations; // Rule runs
+  uint32_t matches;     // Runs that were true
+  uint32_t unknown;     // Runs on an invalid reading or division by zero
+  uint32_t alarms;      // Alarm messages queued
+  uint32_t max_eval_us; // Longest single evaluation pass
+} RuleStats;
+
+/**
+ * Remove all rules
+ */
+void rulesClear(void);
+
+/**
+ * Parse an action name ("publish", "drop", "alarm")
+ *
+ * Returns:
+ *   true if recognised (value stored in *action)
+ */
+bool ruleActionParse(const char* name, RuleAction* action);
+
+/**
+ * Compile and add a rule
+ *
+ * Parameters:
+ *   - name: Rule name (alarm subtopic); NULL/"" = "rule<n>"
+ *   - expr: Expression text
+ *   - action: RuleAction
+ *
+ * Returns:
+ *   true if compiled; false on a syntax error, an expression that needs
+ *   more than CONFIG_RULE_CODE_MAX bytes / CONFIG_RULE_STACK_DEPTH stack,
+ *   or when CONFIG_RULES_MAX rules are loaded
+ */
+bool rulesAdd(const char* name, const char* expr, RuleAction action);
+
+/**
+ * Number of rules loaded
+ */
+uint8_t rulesCount(void);
+
+/**
+ * Evaluate every rule against a sample
+ * The sample becomes the "previous" one for the d_<reading> terms.
+ *
+ * Parameters:
+ *   - readings: Current sample
+ *   - verdict: Output
+ */
+void rulesEvaluate(const SensorReadings* readings, RuleVerdict* verdict);
+
+/**
+ * Queue the alarm messages of a verdict (PUBLISH_ALARM, retained)
+ *
+ * Parameters:
+ *   - verdict: From rulesEvaluate()
+ *   - readings: Sample included in the message
+ *   - buffer: Scratch for the payload
+ *   - buffer_size: Size of buffer in bytes
+ */
+void rulesQueueAlarms(const RuleVerdict* verdict, const SensorReadings* readings,
+                      char* buffer, size_t buffer_size);
+
+/**
+ * Get rule counters
+ */
+const RuleStats* rulesGetStats(void);
+
+#endif  // RULES_H
@@ -37,6 +37,29 @@ typedef struct {
   bool uv_valid;
 } SensorReadings;
 
+/**
+ * Sensor Change Mask Bits
+ * One bit per reading, set by computeChangeMask() when the value moved
+ * beyond its threshold or its validity flag changed
+ */
+typedef enum {
+  SENSOR_CHANGE_TEMPERATURE = 0x01,
+  SENSOR_CHANGE_HUMIDITY    = 0x02,
+  SENSOR_CHANGE_PRESSURE    = 0x04,
+  SENSOR_CHANGE_ILLUMINANCE = 0x08,
+  SENSOR_CHANGE_UV          = 0x10,
+  SENSOR_CHANGE_ALL         = 0x1F
+} SensorChangeBit;
+
+/**
+ * Sensor Initialization State (non-blocking init)
+ */
+typedef enum {
+  SENSORS_WARMING = 0,     // Shield started, warm-up not over yet
+  SENSORS_READY,           // At least one sensor works
+  SENSORS_FAILED           // Shield missing or every sensor failed
+} SensorInitState;
+
 /**
  * Initialize all available sensors on MKR ENV Shield
  *
@@ -46,7 +69,8 @@ typedef struct {
  *   - TEMT6000 (Light Intensity)
  *   - UV Sensor (if available on Rev1 boards)
  *
- * Includes 2-second warm-up delay for sensor stability.
+ * Blocks for the CONFIG_SENSOR_WARMUP_MS warm-up; sensorsBegin() and
+ * sensorsInitPoll() do the same without blocking.
  *
  * Returns:
  *   true if at least one sensor initialized successfully
@@ -54,6 +78,24 @@ typedef struct {
  */
 bool initSensors(void);
 
+/**
+ * Start the ENV shield and the warm-up, without waiting
+ *
+ * Returns:
+ *   false if the shield does not respond (sensorsInitPoll() reports
+ *   SENSORS_FAILED)
+ */
+bool sensorsBegin(void);
+
+/**
+ * Probe the sensors once the warm-up has elapsed - call in loop
+ *
+ * Returns:
+ *   SENSORS_WARMING until then, SENSORS_READY if at least one sensor
+ *   works, SENSORS_FAILED otherwise
+ */
+SensorInitState sensorsInitPoll(void);
+
 /**
  * Read all sensor values and update readings structure
  *
@@ -82,20 +124,21 @@ bool readSensors(SensorReadings* readings);
 bool areSensorsReady(void);
 
 /**
- * Check if sensor readings have changed significantly
+ * Compute which sensor readings have changed significantly
  *
- * Compares two sensor readings and returns true if any value has changed
- * beyond its configured threshold. Uses individual sensor validity flags
- * to avoid comparing invalid readings.
+ * Compares two sensor readings field by field against the configured
+ * thresholds. Uses individual sensor validity flags to avoid comparing
+ * invalid readings.
  *
  * Parameters:
  *   - prev: Pointer to previous SensorReadings struct
  *   - curr: Pointer to current SensorReadings struct
  *
  * Returns:
- *   true if any sensor value exceeded its change threshold OR
- *   if any validity flag changed (sensor failure/recovery)
- *   false if all sensor values are within thresholds and no validity changes
+ *   Bitmask of SensorChangeBit values: a bit is set if the value exceeded
+ *   its change threshold OR its validity flag changed (failure/recovery)
+ *   SENSOR_CHANGE_ALL if either pointer is NULL
+ *   0 if all values are within thresholds and no validity changed
  *
  * Thresholds (configurable in arduino_configs.h):
  *   - Temperature: ±0.5°C (CONFIG_TEMP_THRESHOLD_CELSIUS)
@@ -107,7 +150,19 @@ bool areSensorsReady(void);
  * Notes:
  *   - Timestamp differences are ignored (not a sensor change)
  *   - NaN values are handled via validity flags
- *   - Returns true if either sensor changes OR validity changes (OR logic)
+ */
+uint8_t computeChangeMask(const SensorReadings* prev, const SensorReadings* curr);
+
+/**
+ * Check if sensor readings have changed significantly
+ *
+ * Parameters:
+ *   - prev: Pointer to previous SensorReadings struct
+ *   - curr: Pointer to current SensorReadings struct
+ *
+ * Returns:
+ *   true if computeChangeMask() reports any change
+ *   false if all sensor values are within thresholds and no validity changes
  */
 bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr);
 
@@ -159,10 +214,80 @@ char* formatSensorJSON(const SensorReadings* readings,
  *   - Includes only fields that changed beyond threshold or validity changed
  *   - Always includes timestamp
  *   - Reduces MQTT payload for change-triggered publishes
- *   - Uses same thresholds as hasSignificantChange()
+ *   - Fields selected by computeChangeMask() (same as hasSignificantChange())
  *   - If no fields changed, still includes timestamp
  */
 char* formatChangedSensorJSON(const SensorReadings* prev, const SensorReadings* curr,
                               char* buffer, size_t buffer_size);
 
+/**
+ * Get the name of one reading (its JSON key and per-sensor subtopic)
+ *
+ * Parameters:
+ *   - field: A single SensorChangeBit
+ *
+ * Returns:
+ *   e.g. "temperature_celsius", or NULL if field is not a single bit
+ */
+const char* sensorFieldName(uint8_t field);
+
+/**
+ * Get one reading
+ *
+ * Parameters:
+ *   - readings: Pointer to SensorReadings struct
+ *   - field: A single SensorChangeBit
+ *   - value: Receives the reading
+ *
+ * Returns:
+ *   true if the sensor is valid (value set)
+ *   false if invalid, unavailable (UV on Rev2) or bad parameters
+ */
+bool getSensorField(const SensorReadings* readings, uint8_t field, float* value);
+
+/**
+ * Get the readings that are currently valid
+ *
+ * Returns:
+ *   SensorChangeBit mask of fields getSensorField() would return
+ */
+uint8_t sensorValidMask(const SensorReadings* readings);
+
+/**
+ * Format one reading as a plain number (e.g. "23.5")
+ *
+ * Parameters:
+ *   - readings: Pointer to SensorReadings struct
+ *   - field: A single SensorChangeBit
+ *   - buffer: Output buffer
+ *   - buffer_size: Maximum buffer size in bytes
+ *
+ * Returns:
+ *   Pointer to buffer ("" if the sensor is invalid)
+ *   NULL if buffer is missing or too small
+ */
+char* formatSensorValue(const SensorReadings* readings, uint8_t field,
+                        char* buffer, size_t buffer_size);
+
+/**
+ * Write sensor readings as JSON to a stream
+ *
+ * Streams the JSON straight to the output (e.g. a UDP packet) without a
+ * formatted copy in RAM. formatSensorJSON() and formatChangedSensorJSON()
+ * produce the same text through this writer.
+ *
+ * Parameters:
+ *   - out: Destination stream
+ *   - readings: Pointer to SensorReadings struct to write
+ *   - fields: SensorChangeBit mask of fields to include (SENSOR_CHANGE_ALL
+ *     for all); fields whose sensor is invalid are skipped
+ *
+ * Returns:
+ *   Number of bytes written (0 if readings is NULL)
+ *
+ * Notes:
+ *   - Always includes timestamp
+ */
+size_t writeSensorJSON(Print& out, const SensorReadings* readings, uint8_t fields);
+
 #endif  // SENSORS_H
@@ -0,0 +1,288 @@
+/**
+ * ============================================================================
+ * Runtime Settings Registry Header
+ * ============================================================================
+ * Tunables that can change without a rebuild. Each entry of SETTINGS_TABLE
+ * is:
+ *
+ *   X(KEY, name, type, default, min, max)
+ *
+ * `default` is the CONFIG_ macro from arduino_configs.h (still the way to
+ * change a build's defaults), `name` is the key used by the config server
+ * and MQTT commands. Values are unsigned integers checked against
+ * [min, max]; defaults are checked at compile time.
+ *
+ * Pairs listed in SETTINGS_ORDER (X(LOW, HIGH)) must keep LOW <= HIGH: a
+ * change that would invert one is refused. Within one config or command
+ * both ends move together, so raising a min above the old max works when
+ * the max is raised alongside it.
+ *
+ * READING:
+ *   settingGet<SETTING_STATUS_INTERVAL_MS>() is a plain load from the
+ *   settings struct: the key is a template argument, so there is no lookup
+ *   at run time. settingValue(key) is the lookup for code that only has
+ *   the key at run time (formatting, commands).
+ *
+ * OVERRIDES (last writer wins):
+ *   - Config server: "settings": {"status_interval_ms": 600000, ...} in
+ *     the config response. A key the server stops sending goes back to
+ *     its default at the next fetch; null resets it right away.
+ *   - MQTT: "<mqtt_topic>/settings/set" with "name=value" pairs separated
+ *     by spaces or commas ("name=default" resets). The effective values
+ *     are published, retained, on "<mqtt_topic>/settings" after a change
+ *     or a refusal.
+ *   A key the server lists is re-applied at every fetch, so commands stick
+ *   for the keys it leaves alone.
+ *
+ * PERSISTENCE:
+ *   Overrides (value and source) are saved in a persisted flash row
+ *   (FLASH_ROW_SETTINGS, outside the sketch, so they survive OTA updates)
+ *   CONFIG_SETTINGS_SAVE_DELAY_MS after the last change, only when they
+ *   differ from what is saved, and loaded by settingsBegin(). The saved
+ *   row is keyed to the table layout: a build that adds, removes or
+ *   resizes an entry starts from its defaults.
+ *
+ * NOTIFICATION:
+ *   Modules that cache something derived from a setting register a
+ *   listener; it is called after the value changed. Modules that read the
+ *   setting where they use it need none.
+ *
+ * ============================================================================
+ */
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+#define SETTINGS_TABLE(X) \
+  X(STATUS_INTERVAL_MS,    status_interval_ms,    uint32_t, CONFIG_STATUS_INTERVAL_MS,          10000, 86400000) \
+  X(QUERY_INTERVAL_MS,     query_interval_ms,     uint32_t, CONFIG_QUERY_INTERVAL_MS,           1000,  600000) \
+  X(FETCH_RETRY_MS,        fetch_retry_ms,        uint32_t, CONFIG_FETCH_RETRY_INTERVAL_MS,     1000,  3600000) \
+  X(FETCH_FAILURES,        fetch_failures,        uint8_t,  CONFIG_DEVICE_FETCH_FAILURES,       1,     50) \
+  X(RTC_SYNC_STABLE_MS,    rtc_sync_stable_ms,    uint32_t, CONFIG_RTC_SYNC_INTERVAL_STABLE_MS, 60000, 86400000) \
+  X(BROKER_RETRY_MIN_MS,   broker_retry_min_ms,   uint32_t, CONFIG_MQTT_BROKER_RETRY_MIN_MS,    500,   600000) \
+  X(BROKER_RETRY_MAX_MS,   broker_retry_max_ms,   uint32_t, CONFIG_MQTT_BROKER_RETRY_MAX_MS,    1000,  3600000) \
+  X(SYSLOG_RATE_PER_SEC,   syslog_rate_per_sec,   uint16_t, CONFIG_SYSLOG_RATE_PER_SEC,         1,     1000) \
+  X(SYSLOG_BURST,          syslog_burst,          uint16_t, CONFIG_SYSLOG_BURST,                1,     1000) \
+  X(COAP_CON_NOTIFY_EVERY, coap_con_notify_every, uint8_t,  CONFIG_COAP_CON_NOTIFY_EVERY,       1,     255) \
+  X(OTA_STALL_TIMEOUT_MS,  ota_stall_timeout_ms,  uint32_t, CONFIG_OTA_STALL_TIMEOUT_MS,        1000,  600000) \
+  X(OTA_RETRY_INTERVAL_MS, ota_retry_interval_ms, uint32_t, CONFIG_OTA_RETRY_INTERVAL_MS,       1000,  86400000) \
+  X(OTA_MAX_ATTEMPTS,      ota_max_attempts,      uint8_t,  CONFIG_OTA_MAX_ATTEMPTS,            1,     20) \
+  X(OTA_DRAIN_TIMEOUT_MS,  ota_drain_timeout_ms,  uint32_t, CONFIG_OTA_DRAIN_TIMEOUT_MS,        0,     3600000)
+
+#define SETTINGS_ORDER(X) \
+  X(BROKER_RETRY_MIN_MS, BROKER_RETRY_MAX_MS)
+
+/**
+ * Setting Values (one field per table entry)
+ */
+typedef struct {
+#define X(key, name, type, ...) type name;
+  SETTINGS_TABLE(X)
+#undef X
+} Settings;
+
+/**
+ * Setting Keys
+ */
+typedef enum {
+#define X(key, ...) SETTING_##key,
+  SETTINGS_TABLE(X)
+#undef X
+  SETTING_COUNT
+} SettingKey;
+
+/**
+ * Where the current value came from
+ */
+typedef enum {
+  SETTING_SOURCE_DEFAULT = 0,  // Compile-time default
+  SETTING_SOURCE_SERVER,       // Config server "settings" object
+  SETTING_SOURCE_COMMAND       // MQTT command
+} SettingSource;
+
+/**
+ * Result of a change (rejections are counted in SettingsStats)
+ */
+typedef enum {
+  SETTING_OK = 0,              // Value changed
+  SETTING_UNCHANGED,           // Same value and source
+  SETTING_UNKNOWN_KEY,         // Not in the table
+  SETTING_BAD_VALUE,           // Not an unsigned integer
+  SETTING_OUT_OF_RANGE,        // Outside the entry's [min, max]
+  SETTING_CONFLICT             // Would invert a SETTINGS_ORDER pair
+} SettingResult;
+
+/**
+ * One override from the config server (parsed, applied later)
+ */
+typedef struct {
+  uint8_t key;                 // SettingKey
+  bool reset;                  // Back to the default (null in the config)
+  uint32_t value;
+} SettingOverride;
+
+/**
+ * Registry Statistics
+ */
+typedef struct {
+  uint8_t overrides;           // Keys not at their default source
+  uint32_t changes;            // Values changed since boot
+  uint32_t rejected;           // Changes refused
+  uint32_t saves;              // Flash writes since boot
+  char last_rejected[CONFIG_SETTINGS_NAME_MAX_LEN];  // Key of the last refusal
+  SettingResult last_reason;
+} SettingsStats;
+
+/**
+ * Current values; read through settingGet<>(), changed through settingSet()
+ */
+extern Settings settings_values;
+
+/**
+ * Per-key type and field (generated from the table)
+ */
+template <SettingKey K>
+struct SettingTraits;
+
+#define X(key, name, type, ...) \
+  template <> \
+  struct SettingTraits<SETTING_##key> \
+  { \
+    typedef type Type; \
+    static inline type get(void) { return settings_values.name; } \
+  };
+SETTINGS_TABLE(X)
+#undef X
+
+/**
+ * Read a setting (compiles to a load of its field)
+ *
+ * Example:
+ *   if (now - last_status_time >= settingGet<SETTING_STATUS_INTERVAL_MS>())
+ */
+template <SettingKey K>
+inline typename SettingTraits<K>::Type settingGet(void)
+{
+  return SettingTraits<K>::get();
+}
+
+/**
+ * Setting change callback
+ *
+ * Parameters:
+ *   - key: Setting whose value just changed
+ */
+typedef void (*SettingListener)(SettingKey key);
+
+/**
+ * Load the overrides saved in flash
+ * Call early in setup(), before the modules that read settings start
+ */
+void settingsBegin(void);
+
+/**
+ * Save pending changes once they have settled (call from loop())
+ */
+void settingsPoll(uint32_t now);
+
+/**
+ * Register a change callback
+ * Up to CONFIG_SETTINGS_MAX_LISTENERS; called in registration order
+ *
+ * Returns:
+ *   true if registered
+ */
+bool settingsAddListener(SettingListener listener);
+
+/**
+ * Change a setting
+ *
+ * Returns:
+ *   SETTING_OK if the value changed (listeners were called)
+ */
+SettingResult settingSet(SettingKey key, uint32_t value, SettingSource source);
+
+/**
+ * Return a setting to its compile-time default
+ */
+SettingResult settingReset(SettingKey key);
+
+/**
+ * Check a value against its entry's range without applying it
+ * (settingSet also refuses a value that would invert a SETTINGS_ORDER
+ * pair, which depends on the other end's current value)
+ */
+SettingResult settingCheck(SettingKey key, uint32_t value);
+
+/**
+ * Apply the overrides of a fetched config
+ * Keys the server set before and no longer lists go back to their default;
+ * SETTINGS_ORDER pairs are checked once the rest of the list is in
+ *
+ * Returns:
+ *   Number of settings changed
+ */
+uint8_t settingsApply(const SettingOverride* overrides, uint8_t count, SettingSource source);
+
+/**
+ * Apply an MQTT command: "name=value" pairs separated by spaces, commas or
+ * semicolons; "name=default" resets. SETTINGS_ORDER pairs are checked once
+ * the rest of the command is in
+ *
+ * Returns:
+ *   Number of settings changed
+ */
+uint8_t settingsApplyCommand(const char* command);
+
+/**
+ * Look a setting up by name
+ *
+ * Returns:
+ *   true if found (key set)
+ */
+bool settingFind(const char* name, SettingKey* key);
+
+/**
+ * Current value of a setting (run-time key)
+ */
+uint32_t settingValue(SettingKey key);
+
+/**
+ * Source of a setting's current value
+ */
+SettingSource settingSource(SettingKey key);
+
+/**
+ * Name of a setting (config and command key)
+ */
+const char* settingName(SettingKey key);
+
+/**
+ * Name of a source ("default", "server", "command")
+ */
+const char* settingSourceName(SettingSource source);
+
+/**
+ * Name of a result ("ok", "out_of_range", ...)
+ */
+const char* settingResultName(SettingResult result);
+
+/**
+ * Get registry statistics
+ */
+const SettingsStats* settingsGetStats(void);
+
+/**
+ * Format the effective settings as JSON:
+ *   {"values":{...},"overrides":{"name":"server",...},"rejected":N,
+ *    "last_rejected":{"key":"name","reason":"out_of_range"}}
+ *
+ * Returns:
+ *   buffer, or NULL if it does not fit
+ */
+char* settingsFormatJSON(char* buffer, size_t buffer_size);
+
+#endif  // SETTINGS_H
@@ -0,0 +1,62 @@
+/**
+ * ============================================================================
+ * Telemetry Transport Interface
+ * ============================================================================
+ * publishToMQTT() and friends delegate to one transport chosen per device
+ * by MQTTConfig.transport:
+ *
+ *   TRANSPORT_MQTT  MQTT over TCP to the configured broker (default)
+ *   TRANSPORT_UDP   Framed datagrams with sequence numbers and optional
+ *                   ack (see transport/udp_transport.h); no session state
+ *
+ * A transport is a table of functions, defined next to its implementation.
+ *
+ * ============================================================================
+ */
+
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <Arduino.h>
+#include "config_fetch/config_fetch.h"
+
+/**
+ * Transport Selection (MQTTConfig.transport)
+ */
+typedef enum {
+  TRANSPORT_MQTT = 0,
+  TRANSPORT_UDP = 1
+} TransportType;
+
+/**
+ * Transport Operations
+ */
+typedef struct {
+  const char* name;
+
+  /** Take over the configuration; must not block on the network */
+  bool (*begin)(const MQTTConfig* config);
+
+  /** Called every loop pass while the link is up; true if ready to publish */
+  bool (*maintain)(void);
+
+  /** True if a publish may be attempted now */
+  bool (*ready)(void);
+
+  /** Send one message; true if handed to the network. retain: keep it as
+   *  the topic's current value for new subscribers (ignored without a broker) */
+  bool (*publish)(const char* topic, const char* payload, bool retain);
+
+  /** Drop any session state (link loss, disconnect) */
+  void (*stop)(void);
+} TelemetryTransport;
+
+/**
+ * Parse a transport name ("mqtt", "udp")
+ *
+ * Returns:
+ *   true if recognised (value stored in *type)
+ */
+bool transportParseType(const char* name, TransportType* type);
+
+#endif  // TRANSPORT_H
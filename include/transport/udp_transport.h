@@ -0,0 +1,53 @@
+/**
+ * ============================================================================
+ * UDP Telemetry Transport Header
+ * ============================================================================
+ * Sends each publish as one datagram to a receiver (default: the config
+ * server found via mDNS), which forwards or stores it. See
+ * tools/udp_telemetry_receiver.py for a reference receiver.
+ *
+ * FRAME FORMAT (multi-byte fields big-endian):
+ *   0  magic      0xD7 0x54
+ *   2  flags      bits 7-4 version (1), bit 0 ack requested,
+ *                 bit 1 ack, bit 2 retransmission
+ *   3  topic_len  bytes of topic that follow the header
+ *   4  seq        uint32, increments per message (not per retransmission)
+ *   8  topic      topic_len bytes (no terminator)
+ *   .. payload    remainder of the datagram
+ *
+ * An ack is a bare 8-byte header with the ack flag and the acked seq.
+ *
+ * ACK MODE (udp_ack in config):
+ *   The last message is kept in a single slot and retransmitted every
+ *   CONFIG_UDP_TELEMETRY_ACK_TIMEOUT_MS up to CONFIG_UDP_TELEMETRY_MAX_RETRIES
+ *   times. A newer message supersedes an unacked one (latest reading wins).
+ *
+ * ============================================================================
+ */
+
+#ifndef UDP_TRANSPORT_H
+#define UDP_TRANSPORT_H
+
+#include <Arduino.h>
+#include "transport/transport.h"
+
+/**
+ * UDP Transport Statistics
+ */
+typedef struct {
+  uint32_t sent;          // Messages sent (first transmission)
+  uint32_t acked;         // Messages acknowledged
+  uint32_t retransmits;   // Retransmissions
+  uint32_t lost;          // Unacked after all retries
+  uint32_t superseded;    // Unacked when a newer message replaced them
+  uint32_t last_rtt_ms;   // Send to ack, last acked message
+} UdpTransportStats;
+
+extern const TelemetryTransport udpTransport;
+
+/**
+ * Get UDP transport counters
+ */
+const UdpTransportStats* udpTransportGetStats(void);
+
+#endif  // UDP_TRANSPORT_H
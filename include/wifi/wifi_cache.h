@@ -0,0 +1,69 @@
+/**
+ * ============================================================================
+ * WiFi Join Cache Module Header
+ * ============================================================================
+ * Persists the result of the last successful DHCP join (IP settings and
+ * BSSID) in a persisted flash row (FLASH_ROW_WIFI_CACHE, kept across OTA
+ * updates) so the next join can skip DHCP: the supervisor applies
+ * the cached addresses with WiFi.config() before WiFi.begin().
+ *
+ * The entry is keyed to the compiled-in SSID and stamped with the time of
+ * the DHCP join, so the supervisor can stop reusing a lease the server may
+ * have expired (CONFIG_WIFI_FAST_JOIN_MAX_AGE_S). A fast join that fails,
+ * or a lease that got too old, falls back to a normal DHCP join, which
+ * then refreshes the cache. The row is rewritten only when the entry
+ * changes, so only on those DHCP joins (flash wear).
+ *
+ * ============================================================================
+ */
+
+#ifndef WIFI_CACHE_H
+#define WIFI_CACHE_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Cached Join Parameters
+ */
+typedef struct {
+  uint32_t magic;          // Layout marker (flash is all-0xFF or zero when unset)
+  uint32_t ssid_hash;      // FNV-1a of the SSID the entry belongs to
+  uint8_t bssid[6];        // Access point of the last DHCP join
+  uint8_t ip[4];
+  uint8_t gateway[4];
+  uint8_t subnet[4];
+  uint8_t dns[4];
+  uint32_t leased_at;      // Unix time of the DHCP join (0 = clock not set yet)
+} WiFiCache;
+
+/**
+ * Load the cache for an SSID
+ *
+ * Parameters:
+ *   - ssid: Network the entry must belong to
+ *   - cache: Output
+ *
+ * Returns:
+ *   true if a valid entry for this SSID was found
+ */
+bool wifiCacheLoad(const char* ssid, WiFiCache* cache);
+
+/**
+ * Capture the current link settings and persist them if they changed
+ * Call right after a successful DHCP join, and again with the time once
+ * the clock is set if it wasn't then
+ *
+ * Parameters:
+ *   - ssid: Network just joined
+ *   - leased_at: Unix time of the DHCP join, 0 if unknown
+ */
+void wifiCacheCapture(const char* ssid, uint32_t leased_at);
+
+/**
+ * Mark the entry unusable for this boot (keeps flash untouched; the next
+ * DHCP join overwrites it)
+ */
+void wifiCacheInvalidate(void);
+
+#endif  // WIFI_CACHE_H
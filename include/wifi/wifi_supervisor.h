@@ -0,0 +1,110 @@
+/**
+ * ============================================================================
+ * WiFi Supervisor Module Header
+ * ============================================================================
+ * Owns the WiFi link: joins in the background, watches for link loss and
+ * reconnects with exponential backoff. Modules that hold network state
+ * (mDNS socket, MQTT session, RTC sync) register a link callback and are
+ * told when the link comes up or goes down.
+ *
+ * STATE MACHINE:
+ *   WIFI_LINK_DOWN ──begin join──→ WIFI_LINK_CONNECTING ──joined──→ WIFI_LINK_UP
+ *        ↑                               │ timeout                    │ lost
+ *        └──── backoff elapsed ──── WIFI_LINK_BACKOFF ←───────────────┘
+ *
+ * The WiFiNINA join is made non-blocking with WiFi.setTimeout(0): begin()
+ * only hands the credentials to the NINA module and the supervisor polls
+ * WiFi.status() every CONFIG_WIFI_POLL_MS.
+ *
+ * FAST JOIN (CONFIG_WIFI_FAST_JOIN_ENABLED):
+ *   When wifi/wifi_cache holds the settings of an earlier DHCP join, they
+ *   are applied with WiFi.config() so the join skips DHCP. The gateway is
+ *   pinged once associated; a failed fast attempt resets NINA (WiFi.end())
+ *   and falls back to a DHCP join right away.
+ *
+ *   NINA never renews a lease it was given statically, so cached settings
+ *   are used only until CONFIG_WIFI_FAST_JOIN_MAX_AGE_S after their DHCP
+ *   join. The age is known once the RTC has network time: an older entry
+ *   is skipped at join, and a link that came up with one is dropped and
+ *   rejoined with DHCP (so is one whose lease time was never recorded).
+ *   Without network time the age is not enforced.
+ *
+ * ============================================================================
+ */
+
+#ifndef WIFI_SUPERVISOR_H
+#define WIFI_SUPERVISOR_H
+
+#include <Arduino.h>
+#include "arduino_configs.h"
+
+/**
+ * Link State
+ */
+typedef enum {
+  WIFI_LINK_DOWN = 0,        // Idle, join starts on next poll
+  WIFI_LINK_CONNECTING = 1,  // Join in progress
+  WIFI_LINK_UP = 2,          // Associated with an IP address
+  WIFI_LINK_BACKOFF = 3      // Waiting before the next join attempt
+} WiFiLinkState;
+
+/**
+ * Link Statistics
+ */
+typedef struct {
+  uint32_t reconnects;        // Link losses followed by a successful rejoin
+  uint32_t join_attempts;     // Join attempts since the link was last up
+  uint32_t last_join_ms;      // Duration of the last successful join (incl. fallback)
+  bool last_join_fast;        // Last join used the cached IP settings
+  uint32_t fast_joins;        // Successful fast joins
+  uint32_t fast_fallbacks;    // Fast joins that fell back to DHCP
+  uint32_t last_recover_ms;   // Link lost → link up, last outage
+  uint32_t max_recover_ms;    // Longest outage seen
+} WiFiLinkStats;
+
+/**
+ * Link change callback
+ *
+ * Parameters:
+ *   - up: true when the link came up, false when it was lost
+ */
+typedef void (*WiFiLinkCallback)(bool up);
+
+/**
+ * Register a link change callback
+ * Up to CONFIG_WIFI_MAX_LISTENERS; called in registration order
+ *
+ * Returns:
+ *   true if registered
+ */
+bool wifiSupervisorAddListener(WiFiLinkCallback callback);
+
+/**
+ * Start supervising the link (first join begins immediately)
+ */
+void wifiSupervisorBegin(void);
+
+/**
+ * Advance the state machine - must be called regularly in loop
+ *
+ * Returns:
+ *   Current link state
+ */
+WiFiLinkState wifiSupervisorPoll(void);
+
+/**
+ * Check if the link is up (no SPI traffic, uses cached state)
+ */
+bool wifiIsUp(void);
+
+/**
+ * Get link statistics
+ */
+const WiFiLinkStats* wifiGetStats(void);
+
+/**
+ * Get state name for logs and status reports
+ */
+const char* wifiLinkStateName(WiFiLinkState link_state);
+
+#endif  // WIFI_SUPERVISOR_H
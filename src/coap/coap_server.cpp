@@ -0,0 +1,778 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include <WiFiUdp.h>
+#include "coap/coap_server.h"
+#include "diag/status.h"
+#include "mem/scratch.h"
+#include "log/log.h"
+#include "settings/settings.h"
+#include "arduino_configs.h"
+
+#if CONFIG_COAP_ENABLED
+
+// ============================================================================
+// PROTOCOL CONSTANTS (RFC 7252 / RFC 7641)
+// ============================================================================
+
+static const uint8_t COAP_VERSION = 1;
+
+static const uint8_t COAP_TYPE_CON = 0;
+static const uint8_t COAP_TYPE_NON = 1;
+static const uint8_t COAP_TYPE_ACK = 2;
+static const uint8_t COAP_TYPE_RST = 3;
+
+// Codes: class << 5 | detail
+static const uint8_t COAP_CODE_EMPTY = 0x00;
+static const uint8_t COAP_CODE_GET = 0x01;
+static const uint8_t COAP_CODE_CONTENT = 0x45;            // 2.05
+static const uint8_t COAP_CODE_BAD_OPTION = 0x82;         // 4.02
+static const uint8_t COAP_CODE_NOT_FOUND = 0x84;          // 4.04
+static const uint8_t COAP_CODE_METHOD_NOT_ALLOWED = 0x85; // 4.05
+static const uint8_t COAP_CODE_NOT_ACCEPTABLE = 0x86;     // 4.06
+static const uint8_t COAP_CODE_UNAVAILABLE = 0xA3;        // 5.03
+
+static const uint16_t COAP_OPT_URI_HOST = 3;
+static const uint16_t COAP_OPT_OBSERVE = 6;
+static const uint16_t COAP_OPT_URI_PORT = 7;
+static const uint16_t COAP_OPT_URI_PATH = 11;
+static const uint16_t COAP_OPT_CONTENT_FORMAT = 12;
+static const uint16_t COAP_OPT_MAX_AGE = 14;
+static const uint16_t COAP_OPT_ACCEPT = 17;
+
+static const uint16_t COAP_FORMAT_LINK = 40;              // application/link-format
+static const uint16_t COAP_FORMAT_JSON = 50;              // application/json
+
+static const uint8_t COAP_PAYLOAD_MARKER = 0xFF;
+static const uint8_t COAP_MAX_TOKEN_LEN = 8;
+static const uint8_t COAP_REQUESTS_PER_POLL = 2;
+
+static const char CORE_LINKS[] =
+  "</sensors>;rt=\"sensors\";ct=50;obs,</status>;rt=\"status\";ct=50";
+
+/**
+ * Response Body
+ */
+typedef enum {
+  BODY_NONE = 0,
+  BODY_SENSORS,        // Written from the latest SensorReadings
+  BODY_JSON,           // Text (status report)
+  BODY_LINK_FORMAT     // Text (/.well-known/core)
+} CoapBody;
+
+/**
+ * Observer drop reasons (LOG_COAP_OBSERVER_DROPPED)
+ */
+typedef enum {
+  DROP_DEREGISTERED = 0,
+  DROP_RESET = 1,
+  DROP_NO_ACK = 2
+} CoapDropReason;
+
+/**
+ * Parsed Request
+ */
+typedef struct {
+  uint8_t type;
+  uint8_t code;
+  uint16_t mid;
+  uint8_t tkl;
+  uint8_t token[COAP_MAX_TOKEN_LEN];
+  char path[24];           // Uri-Path segments joined with '/'
+  bool path_overflow;
+  int32_t observe;         // -1 if absent
+  int32_t accept;          // -1 if absent
+  bool bad_option;         // Unrecognized critical option
+} CoapRequest;
+
+/**
+ * Registered Observer
+ */
+typedef struct {
+  bool active;
+  IPAddress ip;
+  uint16_t port;
+  uint8_t tkl;
+  uint8_t token[COAP_MAX_TOKEN_LEN];
+  uint16_t last_mid;       // MID of the last notification (matches ACK/RST)
+  uint8_t notify_count;
+  bool con_pending;        // Last CON notification not acked yet
+} CoapObserver;
+
+// ============================================================================
+// STATIC STATE - Socket, latest readings and observers
+// ============================================================================
+
+static WiFiUDP udp;
+static bool socket_bound = false;
+static uint16_t next_mid = 0;
+
+static const SensorReadings* latest = NULL;    // Caller's storage (zero-copy)
+static SensorReadings notified;                // Baseline for the change mask
+static bool have_notified = false;
+static uint32_t observe_seq = 0;               // 24-bit Observe sequence
+static uint32_t max_age_sec = CONFIG_COAP_DEFAULT_MAX_AGE_SEC;
+
+static CoapObserver observers[CONFIG_COAP_MAX_OBSERVERS];
+static CoapServerStats stats;
+
+// ============================================================================
+// HELPER FUNCTIONS - Packet writing
+// ============================================================================
+
+/**
+ * Write-combining stream into the open UDP packet
+ *
+ * Each WiFiUDP::write() is an SPI transaction with the NINA module, and
+ * Print emits numbers a digit at a time; small writes are gathered here
+ * and handed over in chunks.
+ */
+class PacketWriter : public Print
+{
+public:
+  using Print::write;
+
+  PacketWriter() : len(0) {}
+
+  size_t write(uint8_t c) override
+  {
+    if (len == sizeof(chunk))
+    {
+      flush();
+    }
+    chunk[len++] = c;
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t size) override
+  {
+    if (size > sizeof(chunk) - len)
+    {
+      flush();
+      if (size >= sizeof(chunk))
+      {
+        return udp.write(data, size);
+      }
+    }
+    memcpy(&chunk[len], data, size);
+    len += size;
+    return size;
+  }
+
+  void flush(void) override
+  {
+    if (len > 0)
+    {
+      udp.write(chunk, len);
+      len = 0;
+    }
+  }
+
+private:
+  uint8_t chunk[64];
+  size_t len;
+};
+
+/**
+ * Write one option (delta-encoded against the previous option number)
+ * Values are at most 4 bytes here, so only the delta can need extending.
+ */
+static void writeOption(PacketWriter& out, uint16_t* last, uint16_t number,
+                        const uint8_t* value, uint8_t len)
+{
+  uint16_t delta = number - *last;
+  *last = number;
+
+  if (delta < 13)
+  {
+    out.write((uint8_t)((delta << 4) | len));
+  }
+  else
+  {
+    out.write((uint8_t)((13 << 4) | len));
+    out.write((uint8_t)(delta - 13));
+  }
+  out.write(value, len);
+}
+
+/**
+ * Write an unsigned integer option in its shortest form (0 = empty)
+ */
+static void writeUintOption(PacketWriter& out, uint16_t* last, uint16_t number, uint32_t value)
+{
+  uint8_t bytes[4];
+  uint8_t len = 0;
+  for (int shift = 24; shift >= 0; shift -= 8)
+  {
+    uint8_t b = (value >> shift) & 0xFF;
+    if (len > 0 || b != 0)
+    {
+      bytes[len++] = b;
+    }
+  }
+  writeOption(out, last, number, bytes, len);
+}
+
+/**
+ * Send one message
+ *
+ * Parameters:
+ *   - observe: Observe option value, or -1 to omit it
+ *   - text: Body for BODY_JSON / BODY_LINK_FORMAT
+ */
+static bool sendMessage(IPAddress ip, uint16_t port, uint8_t type, uint8_t code, uint16_t mid,
+                        const uint8_t* token, uint8_t tkl, CoapBody body,
+                        int32_t observe, const char* text)
+{
+  if (!udp.beginPacket(ip, port))
+  {
+    return false;
+  }
+
+  PacketWriter out;
+  uint8_t header[4] = {
+    (uint8_t)((COAP_VERSION << 6) | (type << 4) | tkl),
+    code,
+    (uint8_t)(mid >> 8),
+    (uint8_t)(mid & 0xFF)
+  };
+  out.write(header, sizeof(header));
+  if (tkl > 0)
+  {
+    out.write(token, tkl);
+  }
+
+  // Options in ascending number order
+  uint16_t last = 0;
+  if (observe >= 0)
+  {
+    writeUintOption(out, &last, COAP_OPT_OBSERVE, (uint32_t)observe);
+  }
+  if (body != BODY_NONE)
+  {
+    writeUintOption(out, &last, COAP_OPT_CONTENT_FORMAT,
+                    body == BODY_LINK_FORMAT ? COAP_FORMAT_LINK : COAP_FORMAT_JSON);
+  }
+  if (body == BODY_SENSORS)
+  {
+    writeUintOption(out, &last, COAP_OPT_MAX_AGE, max_age_sec);
+  }
+
+  if (body != BODY_NONE)
+  {
+    out.write(COAP_PAYLOAD_MARKER);
+    if (body == BODY_SENSORS)
+    {
+      writeSensorJSON(out, latest, SENSOR_CHANGE_ALL);
+    }
+    else
+    {
+      out.print(text);
+    }
+  }
+
+  out.flush();
+  return udp.endPacket();
+}
+
+// ============================================================================
+// HELPER FUNCTIONS - Request parsing
+// ============================================================================
+
+/**
+ * Parse a request datagram
+ *
+ * Returns:
+ *   true if the header and options are well-formed
+ *   false on a message format error
+ */
+static bool parseRequest(const uint8_t* data, int len, CoapRequest* req)
+{
+  memset(req, 0, sizeof(CoapRequest));
+  req->observe = -1;
+  req->accept = -1;
+
+  if (len < 4 || (data[0] >> 6) != COAP_VERSION)
+  {
+    return false;
+  }
+
+  req->type = (data[0] >> 4) & 0x03;
+  req->tkl = data[0] & 0x0F;
+  req->code = data[1];
+  req->mid = ((uint16_t)data[2] << 8) | data[3];
+
+  if (req->tkl > COAP_MAX_TOKEN_LEN || 4 + req->tkl > len)
+  {
+    return false;
+  }
+  memcpy(req->token, &data[4], req->tkl);
+
+  int pos = 4 + req->tkl;
+  uint16_t number = 0;
+  size_t path_len = 0;
+
+  while (pos < len && data[pos] != COAP_PAYLOAD_MARKER)
+  {
+    uint16_t delta = data[pos] >> 4;
+    uint16_t opt_len = data[pos] & 0x0F;
+    pos++;
+
+    // Extended delta / length (15 is reserved outside the payload marker)
+    if (delta == 15 || opt_len == 15)
+    {
+      return false;
+    }
+    if (delta == 13)
+    {
+      if (pos + 1 > len) return false;
+      delta = 13 + data[pos++];
+    }
+    else if (delta == 14)
+    {
+      if (pos + 2 > len) return false;
+      delta = 269 + (((uint16_t)data[pos] << 8) | data[pos + 1]);
+      pos += 2;
+    }
+    if (opt_len == 13)
+    {
+      if (pos + 1 > len) return false;
+      opt_len = 13 + data[pos++];
+    }
+    else if (opt_len == 14)
+    {
+      if (pos + 2 > len) return false;
+      opt_len = 269 + (((uint16_t)data[pos] << 8) | data[pos + 1]);
+      pos += 2;
+    }
+    if (pos + opt_len > len)
+    {
+      return false;
+    }
+
+    number += delta;
+    const uint8_t* value = &data[pos];
+    pos += opt_len;
+
+    if (number == COAP_OPT_URI_PATH)
+    {
+      // Join segments with '/' ("/.well-known/core" arrives as two segments)
+      if (path_len + (path_len ? 1 : 0) + opt_len >= sizeof(req->path))
+      {
+        req->path_overflow = true;
+        continue;
+      }
+      if (path_len)
+      {
+        req->path[path_len++] = '/';
+      }
+      memcpy(&req->path[path_len], value, opt_len);
+      path_len += opt_len;
+      req->path[path_len] = '\0';
+    }
+    else if (number == COAP_OPT_OBSERVE || number == COAP_OPT_ACCEPT)
+    {
+      uint32_t v = 0;
+      for (uint16_t i = 0; i < opt_len && i < 4; i++)
+      {
+        v = (v << 8) | value[i];
+      }
+      if (number == COAP_OPT_OBSERVE)
+      {
+        req->observe = (int32_t)v;
+      }
+      else
+      {
+        req->accept = (int32_t)v;
+      }
+    }
+    else if (number == COAP_OPT_URI_HOST || number == COAP_OPT_URI_PORT)
+    {
+      // Addressed to us by definition
+    }
+    else if (number & 1)
+    {
+      req->bad_option = true;    // Unrecognized critical option
+    }
+  }
+
+  return true;
+}
+
+// ============================================================================
+// HELPER FUNCTIONS - Observers
+// ============================================================================
+
+static uint8_t countObservers(void)
+{
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < CONFIG_COAP_MAX_OBSERVERS; i++)
+  {
+    if (observers[i].active)
+    {
+      count++;
+    }
+  }
+  return count;
+}
+
+static CoapObserver* findObserver(IPAddress ip, uint16_t port, const uint8_t* token, uint8_t tkl)
+{
+  for (uint8_t i = 0; i < CONFIG_COAP_MAX_OBSERVERS; i++)
+  {
+    CoapObserver* obs = &observers[i];
+    if (obs->active && obs->ip == ip && obs->port == port &&
+        obs->tkl == tkl && memcmp(obs->token, token, tkl) == 0)
+    {
+      return obs;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Register (or refresh) an observer
+ *
+ * Returns:
+ *   true if the client is now registered
+ *   false if the table is full (served as a plain GET)
+ */
+static bool addObserver(IPAddress ip, uint16_t port, const uint8_t* token, uint8_t tkl)
+{
+  CoapObserver* obs = findObserver(ip, port, token, tkl);
+  if (obs)
+  {
+    obs->con_pending = false;
+    return true;
+  }
+
+  for (uint8_t i = 0; i < CONFIG_COAP_MAX_OBSERVERS; i++)
+  {
+    obs = &observers[i];
+    if (!obs->active)
+    {
+      *obs = CoapObserver();
+      obs->active = true;
+      obs->ip = ip;
+      obs->port = port;
+      obs->tkl = tkl;
+      memcpy(obs->token, token, tkl);
+
+      stats.observers = countObservers();
+      LOG_EVENT(LOG_COAP_OBSERVER_ADDED, (uint32_t)ip, port, stats.observers);
+      return true;
+    }
+  }
+
+  DEBUG_PRINTLN(F("⚠ CoAP observer table full"));
+  return false;
+}
+
+static void removeObserver(CoapObserver* obs, CoapDropReason reason)
+{
+  obs->active = false;
+  stats.observers = countObservers();
+  if (reason != DROP_DEREGISTERED)
+  {
+    stats.observers_dropped++;
+  }
+  LOG_EVENT(LOG_COAP_OBSERVER_DROPPED, reason, stats.observers);
+}
+
+/**
+ * ACK or RST from a client: match it to an observer's last notification
+ */
+static void handleEmptyMessage(IPAddress ip, uint16_t port, const CoapRequest* req)
+{
+  for (uint8_t i = 0; i < CONFIG_COAP_MAX_OBSERVERS; i++)
+  {
+    CoapObserver* obs = &observers[i];
+    if (obs->active && obs->ip == ip && obs->port == port && obs->last_mid == req->mid)
+    {
+      if (req->type == COAP_TYPE_RST)
+      {
+        removeObserver(obs, DROP_RESET);
+      }
+      else
+      {
+        obs->con_pending = false;
+      }
+      return;
+    }
+  }
+}
+
+// ============================================================================
+// HELPER FUNCTIONS - Request handling
+// ============================================================================
+
+static void handleRequest(IPAddress ip, uint16_t port, const CoapRequest* req)
+{
+  // CON gets a piggybacked ACK (same MID), NON a NON with a fresh MID
+  uint8_t type = (req->type == COAP_TYPE_CON) ? COAP_TYPE_ACK : COAP_TYPE_NON;
+  uint16_t mid = (req->type == COAP_TYPE_CON) ? req->mid : next_mid++;
+  uint8_t code = COAP_CODE_CONTENT;
+  CoapBody body = BODY_NONE;
+  int32_t observe = -1;
+  const char* text = NULL;
+
+  if (req->code != COAP_CODE_GET)
+  {
+    code = COAP_CODE_METHOD_NOT_ALLOWED;
+    stats.rejected++;
+  }
+  else if (req->bad_option)
+  {
+    code = COAP_CODE_BAD_OPTION;
+    stats.rejected++;
+  }
+  else if (req->path_overflow)
+  {
+    code = COAP_CODE_NOT_FOUND;
+  }
+  else if (strcmp(req->path, "sensors") == 0)
+  {
+    if (req->accept >= 0 && req->accept != COAP_FORMAT_JSON)
+    {
+      code = COAP_CODE_NOT_ACCEPTABLE;
+    }
+    else if (!latest || !latest->valid)
+    {
+      code = COAP_CODE_UNAVAILABLE;    // No reading yet
+    }
+    else
+    {
+      body = BODY_SENSORS;
+      if (req->observe == 0 && addObserver(ip, port, req->token, req->tkl))
+      {
+        observe = observe_seq;
+      }
+      else if (req->observe == 1)
+      {
+        CoapObserver* obs = findObserver(ip, port, req->token, req->tkl);
+        if (obs)
+        {
+          removeObserver(obs, DROP_DEREGISTERED);
+        }
+      }
+    }
+  }
+  else if (strcmp(req->path, "status") == 0)
+  {
+    if (req->accept >= 0 && req->accept != COAP_FORMAT_JSON)
+    {
+      code = COAP_CODE_NOT_ACCEPTABLE;
+    }
+    else
+    {
+      // Formatted into the arena; sent (and the arena released) below
+      char* payload = (char*)scratchAcquire(SCRATCH_COAP, CONFIG_TELEMETRY_PAYLOAD_SIZE);
+      if (payload && formatStatusJSON(payload, CONFIG_TELEMETRY_PAYLOAD_SIZE))
+      {
+        body = BODY_JSON;
+        text = payload;
+      }
+      else
+      {
+        code = COAP_CODE_UNAVAILABLE;
+      }
+    }
+  }
+  else if (strcmp(req->path, ".well-known/core") == 0)
+  {
+    if (req->accept >= 0 && req->accept != COAP_FORMAT_LINK)
+    {
+      code = COAP_CODE_NOT_ACCEPTABLE;
+    }
+    else
+    {
+      body = BODY_LINK_FORMAT;
+      text = CORE_LINKS;
+    }
+  }
+  else
+  {
+    code = COAP_CODE_NOT_FOUND;
+  }
+
+  sendMessage(ip, port, type, code, mid, req->token, req->tkl, body, observe, text);
+  stats.requests++;
+
+  if (scratchOwner() == SCRATCH_COAP)
+  {
+    scratchRelease(SCRATCH_COAP);
+  }
+}
+
+/**
+ * Read and dispatch one datagram
+ */
+static void handlePacket(int size)
+{
+  uint8_t data[CONFIG_COAP_MAX_REQUEST_LEN];
+  IPAddress ip = udp.remoteIP();
+  uint16_t port = udp.remotePort();
+
+  if (size > (int)sizeof(data))
+  {
+    // Oversized (GETs are small): dropped, rest discarded by parsePacket()
+    stats.rejected++;
+    return;
+  }
+
+  int len = udp.read(data, size);
+  CoapRequest req;
+
+  if (!parseRequest(data, len, &req))
+  {
+    // Message format error: reject CON with RST, ignore anything else
+    if (len >= 4 && ((data[0] >> 4) & 0x03) == COAP_TYPE_CON)
+    {
+      uint16_t mid = ((uint16_t)data[2] << 8) | data[3];
+      sendMessage(ip, port, COAP_TYPE_RST, COAP_CODE_EMPTY, mid, NULL, 0, BODY_NONE, -1, NULL);
+    }
+    stats.rejected++;
+    return;
+  }
+
+  if (req.code == COAP_CODE_EMPTY)
+  {
+    if (req.type == COAP_TYPE_CON)
+    {
+      // CoAP ping
+      sendMessage(ip, port, COAP_TYPE_RST, COAP_CODE_EMPTY, req.mid, NULL, 0, BODY_NONE, -1, NULL);
+    }
+    else
+    {
+      handleEmptyMessage(ip, port, &req);
+    }
+    return;
+  }
+
+  if ((req.code >> 5) != 0)
+  {
+    // A response: we never send requests, so reject CON and ignore the rest
+    if (req.type == COAP_TYPE_CON)
+    {
+      sendMessage(ip, port, COAP_TYPE_RST, COAP_CODE_EMPTY, req.mid, NULL, 0, BODY_NONE, -1, NULL);
+    }
+    return;
+  }
+
+  if (req.type == COAP_TYPE_CON || req.type == COAP_TYPE_NON)
+  {
+    handleRequest(ip, port, &req);
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void coapServerOnLinkChange(bool up)
+{
+  if (up)
+  {
+    if (next_mid == 0)
+    {
+      next_mid = (uint16_t)random(1, 0xFFFF);   // RFC 7252: randomized initial MID
+    }
+
+    socket_bound = udp.begin(CONFIG_COAP_PORT);
+    if (socket_bound)
+    {
+      DEBUG_PRINT(F("✓ CoAP server listening on port "));
+      DEBUG_PRINTLN(CONFIG_COAP_PORT);
+    }
+    else
+    {
+      DEBUG_PRINTLN(F("✗ CoAP socket bind failed"));
+    }
+  }
+  else if (socket_bound)
+  {
+    udp.stop();
+    socket_bound = false;
+  }
+}
+
+void coapServerPoll(void)
+{
+  if (!socket_bound)
+  {
+    return;
+  }
+
+  for (uint8_t i = 0; i < COAP_REQUESTS_PER_POLL; i++)
+  {
+    int size = udp.parsePacket();
+    if (size <= 0)
+    {
+      break;
+    }
+    handlePacket(size);
+  }
+}
+
+void coapServerUpdate(const SensorReadings* readings, bool force)
+{
+  latest = readings;
+  if (!readings || !readings->valid)
+  {
+    return;
+  }
+
+  // Same change mask as the MQTT change publish, against what observers last saw
+  uint8_t mask = have_notified ? computeChangeMask(&notified, readings) : SENSOR_CHANGE_ALL;
+  if (mask == 0 && !force)
+  {
+    return;
+  }
+
+  notified = *readings;
+  have_notified = true;
+
+  if (!socket_bound || stats.observers == 0)
+  {
+    return;
+  }
+
+  observe_seq = (observe_seq + 1) & 0xFFFFFF;
+
+  for (uint8_t i = 0; i < CONFIG_COAP_MAX_OBSERVERS; i++)
+  {
+    CoapObserver* obs = &observers[i];
+    if (!obs->active)
+    {
+      continue;
+    }
+
+    bool confirmable = (++obs->notify_count % settingGet<SETTING_COAP_CON_NOTIFY_EVERY>()) == 0;
+    if (confirmable && obs->con_pending)
+    {
+      // Previous CON went unanswered: the client is gone
+      removeObserver(obs, DROP_NO_ACK);
+      continue;
+    }
+
+    obs->last_mid = next_mid++;
+    if (sendMessage(obs->ip, obs->port, confirmable ? COAP_TYPE_CON : COAP_TYPE_NON,
+                    COAP_CODE_CONTENT, obs->last_mid, obs->token, obs->tkl,
+                    BODY_SENSORS, observe_seq, NULL))
+    {
+      obs->con_pending = confirmable;
+      stats.notifications++;
+    }
+  }
+}
+
+void coapServerSetMaxAge(uint32_t seconds)
+{
+  max_age_sec = seconds;
+}
+
+const CoapServerStats* coapServerGetStats(void)
+{
+  return &stats;
+}
+
+#endif  // CONFIG_COAP_ENABLED
@@ -1,19 +1,646 @@
 #include <Arduino.h>
 #include "config_fetch/config_fetch.h"
 #include "arduino_configs.h"
+#include "log/log.h"
+#include "transport/transport.h"
+#include "mqtt/sensor_topics.h"
+#include "rules/rules.h"
 #include <WiFiNINA.h>
 #include <ArduinoJson.h>
 
+#if CONFIG_NETFAULT_ENABLED
+#include "netfault/netfault.h"
+#endif
+
+// ============================================================================
+// HELPER CLASSES
+// ============================================================================
+
+/**
+ * ArduinoJson allocator over a fixed pool (scratch arena)
+ *
+ * Bump allocation with a size header per block. Only the most recent block
+ * can grow in place or be returned; an older one shrinks in place (the
+ * document's slot pool, trimmed after parsing). Everything is discarded
+ * together when the config fetch phase releases the arena.
+ */
+class ScratchJsonAllocator : public ArduinoJson::Allocator
+{
+public:
+  ScratchJsonAllocator(uint8_t* pool, size_t size)
+      : _pool(pool), _size(size), _used(0), _peak(0), _last(NO_BLOCK) {}
+
+  void* allocate(size_t size) override
+  {
+    size_t need = HEADER + align(size);
+    if (need > _size - _used)
+    {
+      return nullptr;
+    }
+
+    uint8_t* block = _pool + _used;
+    *(uint32_t*)block = size;
+    _last = _used;
+    _used += need;
+    if (_used > _peak)
+    {
+      _peak = _used;
+    }
+    return block + HEADER;
+  }
+
+  void deallocate(void* ptr) override
+  {
+    if (ptr && isLast(ptr))
+    {
+      _used = _last;
+      _last = NO_BLOCK;
+    }
+  }
+
+  void* reallocate(void* ptr, size_t new_size) override
+  {
+    if (!ptr)
+    {
+      return allocate(new_size);
+    }
+
+    // Newest block: resize in place
+    if (isLast(ptr))
+    {
+      size_t need = HEADER + align(new_size);
+      if (need > _size - _last)
+      {
+        return nullptr;
+      }
+      *(uint32_t*)(_pool + _last) = new_size;
+      _used = _last + need;
+      if (_used > _peak)
+      {
+        _peak = _used;
+      }
+      return ptr;
+    }
+
+    // Older block: shrink in place, or copy into a new one to grow (the old
+    // space is not reclaimed either way)
+    size_t old_size = *(uint32_t*)((uint8_t*)ptr - HEADER);
+    if (new_size <= old_size)
+    {
+      return ptr;
+    }
+    void* moved = allocate(new_size);
+    if (moved)
+    {
+      memcpy(moved, ptr, old_size < new_size ? old_size : new_size);
+    }
+    return moved;
+  }
+
+  /**
+   * Most of the pool in use at once (bytes)
+   */
+  size_t peak() const { return _peak; }
+
+private:
+  static const size_t HEADER = 8;                 // Keeps blocks 8-byte aligned
+  static const size_t NO_BLOCK = (size_t)-1;
+
+  static size_t align(size_t size) { return (size + 7) & ~(size_t)7; }
+
+  bool isLast(void* ptr) const
+  {
+    return _last != NO_BLOCK && (uint8_t*)ptr == _pool + _last + HEADER;
+  }
+
+  uint8_t* _pool;
+  size_t _size;
+  size_t _used;
+  size_t _peak;
+  size_t _last;    // Offset of the newest block header
+};
+
+// ============================================================================
+// CONFIG SCHEMA
+// ============================================================================
+// One row per field:
+//
+//   X(ID, "key", type, flags, min, max)
+//
+// UINT values must lie in [min, max], STRING lengths in [min, max], ARRAY
+// sizes up to max. NAME fields are strings looked up by their module (a
+// number in [min, max] is also taken with SCHEMA_NUMBER). Rows are checked
+// and stored in order, so a field that defaults another (mqtt_port for the
+// broker list, syslog_host for syslog_port, transport for udp_port) comes
+// first. Keys not in the table are ignored, so a newer server can add some.
+
+#define CONFIG_STRING_MAX(field) (sizeof(((MQTTConfig*)0)->field) - 1)
+
+#define CONFIG_SCHEMA(X) \
+  X(MQTT_PORT,            "mqtt_port",               SCHEMA_UINT,   0,               1, 65535) \
+  X(MQTT_TLS,             "mqtt_tls",                SCHEMA_BOOL,   0,               0, 0) \
+  X(MQTT_TLS_FALLBACK,    "mqtt_tls_fallback",       SCHEMA_BOOL,   0,               0, 0) \
+  X(MQTT_BROKERS,         "mqtt_brokers",            SCHEMA_ARRAY,  0,               0, 255) \
+  X(MQTT_BROKER,          "mqtt_broker",             SCHEMA_STRING, 0,               1, CONFIG_STRING_MAX(mqtt_broker)) \
+  X(MQTT_TOPIC,           "mqtt_topic",              SCHEMA_STRING, SCHEMA_REQUIRED, 1, CONFIG_STRING_MAX(mqtt_topic)) \
+  X(MQTT_LAYOUT,          "mqtt_layout",             SCHEMA_NAME,   0,               0, 0) \
+  X(POLL_FREQUENCY,       "poll_frequency_sec",      SCHEMA_UINT,   SCHEMA_REQUIRED, 1, 65535) \
+  X(HEARTBEAT_FREQUENCY,  "heartbeat_frequency_sec", SCHEMA_UINT,   SCHEMA_REQUIRED, 1, 65535) \
+  X(COALESCE_WINDOW,      "coalesce_window_sec",     SCHEMA_UINT,   0,               0, 65535) \
+  X(TEMPLATE,             "template",                SCHEMA_STRING, 0,               0, CONFIG_STRING_MAX(template_name)) \
+  X(SYSLOG_HOST,          "syslog_host",             SCHEMA_STRING, 0,               1, CONFIG_STRING_MAX(syslog_host)) \
+  X(SYSLOG_PORT,          "syslog_port",             SCHEMA_UINT,   0,               0, 65535) \
+  X(LOG_LEVEL,            "log_level",               SCHEMA_NAME,   SCHEMA_NUMBER,   LOG_LEVEL_ERROR, LOG_LEVEL_DEBUG) \
+  X(TRANSPORT,            "transport",               SCHEMA_NAME,   0,               0, 0) \
+  X(UDP_HOST,             "udp_host",                SCHEMA_STRING, 0,               1, CONFIG_STRING_MAX(udp_host)) \
+  X(UDP_PORT,             "udp_port",                SCHEMA_UINT,   0,               1, 65535) \
+  X(UDP_ACK,              "udp_ack",                 SCHEMA_BOOL,   0,               0, 0) \
+  X(RULES,                "rules",                   SCHEMA_ARRAY,  0,               0, 255) \
+  X(FIRMWARE,             "firmware",                SCHEMA_OBJECT, 0,               0, 0) \
+  X(SETTINGS,             "settings",                SCHEMA_OBJECT, 0,               0, 0)
+
+typedef enum {
+  SCHEMA_STRING = 0,     // min/max = length
+  SCHEMA_UINT,           // min/max = value
+  SCHEMA_BOOL,
+  SCHEMA_NAME,           // String the owning module parses
+  SCHEMA_ARRAY,          // max = entries
+  SCHEMA_OBJECT
+} SchemaType;
+
+#define SCHEMA_REQUIRED 0x01   // Absent or null rejects the config
+#define SCHEMA_NUMBER   0x02   // NAME: a number in [min, max] is also taken
+
+typedef enum {
+#define X(id, ...) FIELD_##id,
+  CONFIG_SCHEMA(X)
+#undef X
+  FIELD_COUNT
+} ConfigFieldId;
+
+typedef struct {
+  const char* key;
+  uint8_t type;          // SchemaType
+  uint8_t flags;
+  uint32_t min;
+  uint32_t max;
+} ConfigField;
+
+static const ConfigField config_schema[FIELD_COUNT] = {
+#define X(id, key, type, flags, lo, hi) {key, type, flags, (uint32_t)(lo), (uint32_t)(hi)},
+  CONFIG_SCHEMA(X)
+#undef X
+};
+
+/**
+ * Values carried from one field to a later one during the pass
+ */
+typedef struct {
+  bool default_tls;      // mqtt_tls, for brokers that do not say
+  JsonArray rules;       // Compiled once the whole config is accepted
+} ParseState;
+
+// ============================================================================
+// STATIC STATE - Validation results
+// ============================================================================
+
+static ConfigValidationStats validation = {0, 0, CONFIG_ACCEPTED, "", 0};
+static bool report_pending = false;    // Send the last rejection with the next fetch
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Parse one "mqtt_brokers" entry: "host", "host:port" or {"host","port","tls"}
+ *
+ * Returns: true if the entry names a host that fits and a valid port
+ */
+static bool parseBrokerEntry(JsonVariant entry, uint16_t default_port, bool default_tls,
+                             MQTTBroker* broker)
+{
+  broker->host[0] = '\0';
+  broker->port = default_port;
+  broker->tls = default_tls;
+
+  if (entry.is<const char *>())
+  {
+    const char* text = entry.as<const char *>();
+    const char* colon = strrchr(text, ':');
+    size_t host_len = colon ? (size_t)(colon - text) : strlen(text);
+    if (host_len >= sizeof(broker->host))
+    {
+      return false;
+    }
+    memcpy(broker->host, text, host_len);
+    broker->host[host_len] = '\0';
+    if (colon)
+    {
+      long port = atol(colon + 1);
+      if (port <= 0 || port > 65535)
+      {
+        return false;
+      }
+      broker->port = (uint16_t)port;
+    }
+    broker->tls = default_tls || broker->port == CONFIG_MQTT_TLS_PORT;
+  }
+  else if (entry.is<JsonObject>())
+  {
+    JsonObject obj = entry;
+    if (!obj["host"].is<const char *>())
+    {
+      return false;  // Absent, or not a string
+    }
+    const char* host = obj["host"].as<const char *>();
+    if (strlen(host) >= sizeof(broker->host))
+    {
+      return false;
+    }
+    strlcpy(broker->host, host, sizeof(broker->host));
+    if (obj.containsKey("port"))
+    {
+      if (!obj["port"].is<uint16_t>())
+      {
+        return false;
+      }
+      broker->port = obj["port"].as<uint16_t>();
+    }
+    broker->tls = obj.containsKey("tls") ? obj["tls"].as<bool>() :
+                  (default_tls || broker->port == CONFIG_MQTT_TLS_PORT);
+  }
+
+  return broker->host[0] != '\0' && broker->port != 0;
+}
+
+/**
+ * Decode exactly `len` bytes of hex
+ */
+static bool parseHex(const char* hex, uint8_t* out, size_t len)
+{
+  if (!hex || strlen(hex) != 2 * len)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++)
+  {
+    char byte[3] = {hex[i * 2], hex[i * 2 + 1], '\0'};
+    char* end;
+    out[i] = (uint8_t)strtoul(byte, &end, 16);
+    if (end != byte + 2)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Parse the "firmware" offer: {"version", "url", "size", "sha256" (hex),
+ * "signature" (hex)}
+ *
+ * Returns: true if every field is present and well-formed; a missing or
+ * malformed signature is left zeroed and the offer refused by ota
+ */
+static bool parseFirmwareOffer(JsonObject entry, FirmwareOffer* offer)
+{
+  memset(offer, 0, sizeof(*offer));
+
+  const char* url = entry["url"].as<const char *>();
+  const char* version = entry["version"].as<const char *>();
+  uint32_t size = entry["size"].as<uint32_t>();
+  if (!parseHex(entry["sha256"].as<const char *>(), offer->sha256, sizeof(offer->sha256)) ||
+      !url || url[0] == '\0' || strlen(url) >= sizeof(offer->url) ||
+      !version || version[0] == '\0' || strlen(version) >= sizeof(offer->version) || size == 0)
+  {
+    return false;
+  }
+
+  if (!parseHex(entry["signature"].as<const char *>(), offer->signature, sizeof(offer->signature)))
+  {
+    memset(offer->signature, 0, sizeof(offer->signature));
+  }
+
+  strlcpy(offer->url, url, sizeof(offer->url));
+  strlcpy(offer->version, version, sizeof(offer->version));
+  offer->size = size;
+
+  // Patch (optional): without a usable one the full image is taken
+  JsonObject delta = entry["delta"];
+  const char* delta_url = delta["url"].as<const char *>();
+  const char* delta_from = delta["from"].as<const char *>();
+  uint32_t delta_size = delta["size"].as<uint32_t>();
+  if (!delta.isNull())
+  {
+    if (delta_url && delta_url[0] != '\0' && strlen(delta_url) < sizeof(offer->delta_url) &&
+        delta_from && delta_from[0] != '\0' && strlen(delta_from) < sizeof(offer->delta_from) &&
+        delta_size > 0)
+    {
+      strlcpy(offer->delta_url, delta_url, sizeof(offer->delta_url));
+      strlcpy(offer->delta_from, delta_from, sizeof(offer->delta_from));
+      offer->delta_size = delta_size;
+    }
+    else
+    {
+      DEBUG_PRINTLN(F("⚠ Malformed firmware patch ignored"));
+    }
+  }
+  return true;
+}
+
+/**
+ * Count a rejection and keep it for the status message and the next fetch
+ *
+ * Parameters:
+ *   - field: Offending field, FIELD_COUNT for the document as a whole
+ *
+ * Returns: reason
+ */
+static ConfigReject reject(ConfigReject reason, uint8_t field)
+{
+  validation.rejected++;
+  validation.last_reason = reason;
+  validation.last_field = field < FIELD_COUNT ? config_schema[field].key : "";
+  report_pending = true;
+
+  LOG_EVENT(LOG_CONFIG_REJECTED, reason, field);
+  DEBUG_PRINT(F("✗ Config rejected: "));
+  DEBUG_PRINT(configRejectName(reason));
+  DEBUG_PRINT(F(" ("));
+  DEBUG_PRINT(validation.last_field);
+  DEBUG_PRINTLN(F(")"));
+  return reason;
+}
+
+/**
+ * Check one value against its schema row (type, range, length, presence)
+ */
+static ConfigReject checkField(const ConfigField* field, JsonVariant value)
+{
+  if (value.isNull())
+  {
+    return (field->flags & SCHEMA_REQUIRED) ? CONFIG_REJECT_MISSING : CONFIG_ACCEPTED;
+  }
+
+  switch (field->type)
+  {
+    case SCHEMA_STRING:
+    {
+      if (!value.is<const char *>())
+      {
+        return CONFIG_REJECT_TYPE;
+      }
+      size_t length = strlen(value.as<const char *>());
+      return (length >= field->min && length <= field->max) ? CONFIG_ACCEPTED : CONFIG_REJECT_LENGTH;
+    }
+
+    case SCHEMA_UINT:
+    {
+      if (!value.is<uint32_t>())
+      {
+        return CONFIG_REJECT_TYPE;
+      }
+      uint32_t number = value.as<uint32_t>();
+      return (number >= field->min && number <= field->max) ? CONFIG_ACCEPTED : CONFIG_REJECT_RANGE;
+    }
+
+    case SCHEMA_BOOL:
+      return value.is<bool>() ? CONFIG_ACCEPTED : CONFIG_REJECT_TYPE;
+
+    case SCHEMA_NAME:
+      if (value.is<const char *>())
+      {
+        return CONFIG_ACCEPTED;
+      }
+      if ((field->flags & SCHEMA_NUMBER) && value.is<uint32_t>())
+      {
+        uint32_t number = value.as<uint32_t>();
+        return (number >= field->min && number <= field->max) ? CONFIG_ACCEPTED : CONFIG_REJECT_RANGE;
+      }
+      return CONFIG_REJECT_TYPE;
+
+    case SCHEMA_ARRAY:
+      if (!value.is<JsonArray>())
+      {
+        return CONFIG_REJECT_TYPE;
+      }
+      return value.size() <= field->max ? CONFIG_ACCEPTED : CONFIG_REJECT_LENGTH;
+
+    case SCHEMA_OBJECT:
+      return value.is<JsonObject>() ? CONFIG_ACCEPTED : CONFIG_REJECT_TYPE;
+
+    default:
+      return CONFIG_REJECT_TYPE;
+  }
+}
+
+/**
+ * Store a checked value (names are resolved here: an unknown one rejects)
+ */
+static ConfigReject storeField(ConfigFieldId id, JsonVariant value, MQTTConfig* mqtt_config,
+                               ParseState* state)
+{
+  switch (id)
+  {
+    case FIELD_MQTT_PORT:
+      mqtt_config->mqtt_port = value.as<uint16_t>();
+      break;
+
+    case FIELD_MQTT_TLS:
+      state->default_tls = value.as<bool>();
+      break;
+
+    case FIELD_MQTT_TLS_FALLBACK:
+      mqtt_config->mqtt_tls_fallback = value.as<bool>();
+      break;
+
+    case FIELD_MQTT_BROKERS:
+    {
+      uint16_t default_port = mqtt_config->mqtt_port ? mqtt_config->mqtt_port : CONFIG_MQTT_DEFAULT_PORT;
+      for (JsonVariant entry : value.as<JsonArray>())
+      {
+        if (mqtt_config->broker_count == CONFIG_MQTT_MAX_BROKERS)
+        {
+          DEBUG_PRINTLN(F("⚠ Broker list truncated to CONFIG_MQTT_MAX_BROKERS"));
+          break;
+        }
+        if (!parseBrokerEntry(entry, default_port, state->default_tls,
+                              &mqtt_config->brokers[mqtt_config->broker_count]))
+        {
+          return CONFIG_REJECT_VALUE;
+        }
+        mqtt_config->broker_count++;
+      }
+      break;
+    }
+
+    case FIELD_MQTT_BROKER:
+      strlcpy(mqtt_config->mqtt_broker, value.as<const char *>(), sizeof(mqtt_config->mqtt_broker));
+      break;
+
+    case FIELD_MQTT_TOPIC:
+      strlcpy(mqtt_config->mqtt_topic, value.as<const char *>(), sizeof(mqtt_config->mqtt_topic));
+      break;
+
+    // Topic layout: "combined" (default), "per_sensor" or "both"
+    case FIELD_MQTT_LAYOUT:
+    {
+      TopicLayout layout;
+      if (!topicLayoutParse(value.as<const char *>(), &layout))
+      {
+        return CONFIG_REJECT_VALUE;
+      }
+      mqtt_config->topic_layout = layout;
+      break;
+    }
+
+    case FIELD_POLL_FREQUENCY:
+      mqtt_config->poll_frequency_sec = value.as<uint16_t>();
+      break;
+
+    case FIELD_HEARTBEAT_FREQUENCY:
+      mqtt_config->heartbeat_frequency_sec = value.as<uint16_t>();
+      break;
+
+    case FIELD_COALESCE_WINDOW:
+      mqtt_config->coalesce_window_sec = value.as<uint16_t>();
+      break;
+
+    case FIELD_TEMPLATE:
+      strlcpy(mqtt_config->template_name, value.as<const char *>(), sizeof(mqtt_config->template_name));
+      break;
+
+    // Remote logging: a host alone implies the standard syslog port
+    case FIELD_SYSLOG_HOST:
+      strlcpy(mqtt_config->syslog_host, value.as<const char *>(), sizeof(mqtt_config->syslog_host));
+      mqtt_config->syslog_port = CONFIG_SYSLOG_DEFAULT_PORT;
+      break;
+
+    case FIELD_SYSLOG_PORT:
+      mqtt_config->syslog_port = value.as<uint16_t>();
+      break;
+
+    case FIELD_LOG_LEVEL:
+    {
+      LogLevel level;
+      if (!value.is<const char *>())
+      {
+        mqtt_config->log_level = value.as<uint8_t>();
+      }
+      else if (logParseLevel(value.as<const char *>(), &level))
+      {
+        mqtt_config->log_level = level;
+      }
+      else
+      {
+        return CONFIG_REJECT_VALUE;
+      }
+      break;
+    }
+
+    // Telemetry transport: "mqtt" (default) or "udp"
+    case FIELD_TRANSPORT:
+    {
+      TransportType transport;
+      if (!transportParseType(value.as<const char *>(), &transport))
+      {
+        return CONFIG_REJECT_VALUE;
+      }
+      mqtt_config->transport = transport;
+      if (transport == TRANSPORT_UDP)
+      {
+        mqtt_config->udp_port = CONFIG_UDP_TELEMETRY_DEFAULT_PORT;
+      }
+      break;
+    }
+
+    case FIELD_UDP_HOST:
+      strlcpy(mqtt_config->udp_host, value.as<const char *>(), sizeof(mqtt_config->udp_host));
+      break;
+
+    case FIELD_UDP_PORT:
+      mqtt_config->udp_port = value.as<uint16_t>();
+      break;
+
+    case FIELD_UDP_ACK:
+      mqtt_config->udp_ack = value.as<bool>();
+      break;
+
+    case FIELD_RULES:
+      state->rules = value.as<JsonArray>();
+      break;
+
+    // Firmware update offer, installed by the OTA module if the version
+    // differs. A malformed one is dropped, not the config around it.
+    case FIELD_FIRMWARE:
+      if (!parseFirmwareOffer(value.as<JsonObject>(), &mqtt_config->firmware))
+      {
+        DEBUG_PRINTLN(F("⚠ Malformed firmware offer ignored"));
+        mqtt_config->firmware.size = 0;
+      }
+      break;
+
+    // Runtime setting overrides. Keys this build does not know are skipped;
+    // a known key must hold a value its entry accepts
+    case FIELD_SETTINGS:
+      for (JsonPair entry : value.as<JsonObject>())
+      {
+        SettingKey key;
+        if (!settingFind(entry.key().c_str(), &key))
+        {
+          DEBUG_PRINT(F("⚠ Unknown setting ignored: "));
+          DEBUG_PRINTLN(entry.key().c_str());
+          continue;
+        }
+        bool reset = entry.value().isNull();
+        if (!reset && !entry.value().is<uint32_t>())
+        {
+          return CONFIG_REJECT_TYPE;
+        }
+        if (!reset && settingCheck(key, entry.value().as<uint32_t>()) != SETTING_OK)
+        {
+          return CONFIG_REJECT_RANGE;
+        }
+        if (mqtt_config->settings_count == CONFIG_SETTINGS_MAX_OVERRIDES)
+        {
+          DEBUG_PRINTLN(F("⚠ Settings truncated to CONFIG_SETTINGS_MAX_OVERRIDES"));
+          break;
+        }
+
+        SettingOverride* setting = &mqtt_config->settings[mqtt_config->settings_count++];
+        setting->key = key;
+        setting->reset = reset;
+        setting->value = entry.value().as<uint32_t>();
+      }
+      break;
+
+    default:
+      break;
+  }
+  return CONFIG_ACCEPTED;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
 /**
  * Fetch configuration from HTTP server
- * Constructs GET request: GET /config?device_id=<serial>&mac=<mac>
+ * Constructs GET request: GET /config?device_id=<serial>&mac=<mac>[&rejected=..&field=..]
  */
-ConfigResponse fetchConfigFromServer(
+bool fetchConfigFromServer(
     const char *host,
     uint16_t port,
-    const DeviceID *device_id)
+    const DeviceID *device_id,
+    ConfigFetchScratch *scratch)
 {
-  ConfigResponse response;
+  if (!scratch)
+  {
+    DEBUG_PRINTLN(F("✗ No scratch buffer for config fetch"));
+    return false;
+  }
+
+  ConfigResponse &response = scratch->response;
   response.success = false;
   response.http_code = 0;
 
@@ -21,7 +648,7 @@ ConfigResponse fetchConfigFromServer(
   {
     snprintf(response.error_msg, sizeof(response.error_msg),
              "Invalid device ID");
-    return response;
+    return false;
   }
 
   DEBUG_PRINT(F("→ Connecting to: "));
@@ -30,7 +657,12 @@ ConfigResponse fetchConfigFromServer(
   DEBUG_PRINTLN(port);
 
   // Create WiFi client
+#if CONFIG_NETFAULT_ENABLED
+  WiFiClient wifi_client;
+  NetFaultClient client(wifi_client);
+#else
   WiFiClient client;
+#endif
 
   // Connect to server
   if (!client.connect(host, port))
@@ -38,41 +670,48 @@ ConfigResponse fetchConfigFromServer(
     DEBUG_PRINTLN(F("✗ Connection failed"));
     snprintf(response.error_msg, sizeof(response.error_msg),
              "Failed to connect to %s:%u", host, port);
-    return response;
+    return false;
   }
 
   DEBUG_PRINTLN(F("✓ Connected"));
 
-  // Build request URL with parameters
-  char request_url[512];
-  snprintf(request_url, sizeof(request_url),
-           "/config?device_id=%s&mac=%s",
-           device_id->device_id,
-           device_id->mac_address);
-
-  // Debug: Print full HTTP GET request URL
-  #if DEBUG
-  char full_url[768];
-  snprintf(full_url, sizeof(full_url),
-           "GET http://%s:%u%s HTTP/1.1",
-           host,
-           port,
-           request_url);
-  DEBUG_PRINT(F("→ Sending: "));
-  DEBUG_PRINTLN(full_url);
-  #endif
+  // Build the whole request head so it goes out in a single write. A
+  // config rejected since the last accepted one is reported in the query
+  // (&rejected=<reason>&field=<key>) so the server can see the bad push.
+  char report[64] = "";
+  if (report_pending)
+  {
+    snprintf(report, sizeof(report), "&rejected=%s&field=%s",
+             configRejectName(validation.last_reason), validation.last_field);
+  }
+  int request_len = snprintf(scratch->request, sizeof(scratch->request),
+                             "GET /config?device_id=%s&mac=%s%s HTTP/1.1\r\n"
+                             "Host: %s:%u\r\n"
+                             "User-Agent: Arduino/1.0\r\n"
+                             "Connection: close\r\n\r\n",
+                             device_id->device_id,
+                             device_id->mac_address,
+                             report,
+                             host,
+                             port);
+  if (request_len < 0 || request_len >= (int)sizeof(scratch->request))
+  {
+    DEBUG_PRINTLN(F("✗ Request buffer overflow"));
+    snprintf(response.error_msg, sizeof(response.error_msg),
+             "Request too long");
+    client.stop();
+    return false;
+  }
+
+  DEBUG_PRINT(F("→ Sending: GET http://"));
+  DEBUG_PRINT(host);
+  DEBUG_PRINT(F(":"));
+  DEBUG_PRINT(port);
+  DEBUG_PRINT(F("/config?device_id="));
+  DEBUG_PRINTLN(device_id->device_id);
 
   // Send HTTP GET request
-  client.print(F("GET "));
-  client.print(request_url);
-  client.println(F(" HTTP/1.1"));
-  client.print(F("Host: "));
-  client.print(host);
-  client.print(F(":"));
-  client.println(port);
-  client.println(F("User-Agent: Arduino/1.0"));
-  client.println(F("Connection: close"));
-  client.println();
+  client.write((const uint8_t *)scratch->request, request_len);
 
   // Wait for response
   unsigned long timeout = millis();
@@ -87,7 +726,7 @@ ConfigResponse fetchConfigFromServer(
     snprintf(response.error_msg, sizeof(response.error_msg),
              "Server timeout");
     client.stop();
-    return response;
+    return false;
   }
 
   // Read response header and extract HTTP status code
@@ -124,6 +763,7 @@ ConfigResponse fetchConfigFromServer(
   if (response.http_code == 200)
   {
     response.success = true;
+    LOG_EVENT(LOG_CONFIG_FETCHED, response.http_code, body_index);
     DEBUG_PRINT(F("✓ Configuration retrieved ("));
     DEBUG_PRINT(body_index);
     DEBUG_PRINTLN(F(" bytes)"));
@@ -132,32 +772,45 @@ ConfigResponse fetchConfigFromServer(
   {
     snprintf(response.error_msg, sizeof(response.error_msg),
              "HTTP %d", response.http_code);
+    LOG_EVENT(LOG_CONFIG_FETCH_FAILED, response.http_code);
     DEBUG_PRINT(F("✗ Server returned HTTP "));
     DEBUG_PRINTLN(response.http_code);
   }
 
-  return response;
+  return response.success;
 }
 
 /**
- * Parse configuration JSON
- * Uses ArduinoJson library (included in PlatformIO)
+ * Parse and validate configuration JSON
+ * Uses ArduinoJson library (included in PlatformIO) with the scratch pool.
+ * Fields are checked against the schema and stored in the same pass; rules
+ * are compiled only once the whole config has been accepted.
  */
-MQTTConfig parseConfigJSON(const char *json_response)
+ConfigReject parseConfigJSON(ConfigFetchScratch *scratch, MQTTConfig *mqtt_config)
 {
-  MQTTConfig mqtt_config;
-  memset(&mqtt_config, 0, sizeof(mqtt_config));
+  memset(mqtt_config, 0, sizeof(*mqtt_config));
+  mqtt_config->log_level = -1;
+  mqtt_config->coalesce_window_sec = CONFIG_PUBLISH_COALESCE_WINDOW_SEC;
 
-  // Allocate JSON document
-  StaticJsonDocument<2048> doc;
+  // JSON document lives in the scratch arena, not on the heap
+  ScratchJsonAllocator allocator(scratch->json_pool, sizeof(scratch->json_pool));
+  JsonDocument doc(&allocator);
 
-  // Parse JSON
-  DeserializationError error = deserializeJson(doc, json_response);
-  if (error)
+  // Parse JSON (a document that outgrew the pool is incomplete: reject it too)
+  DeserializationError error = deserializeJson(doc, scratch->response.config_json);
+  if (allocator.peak() > validation.json_pool_peak)
+  {
+    validation.json_pool_peak = allocator.peak();
+  }
+  DEBUG_PRINT(F("  JSON pool used: "));
+  DEBUG_PRINT((uint32_t)allocator.peak());
+  DEBUG_PRINT(F(" / "));
+  DEBUG_PRINTLN((uint32_t)sizeof(scratch->json_pool));
+  if (error || doc.overflowed())
   {
     DEBUG_PRINT(F("✗ JSON parse error: "));
-    DEBUG_PRINTLN(error.c_str());
-    return mqtt_config;
+    DEBUG_PRINTLN(error ? error.c_str() : "document pool full");
+    return reject(CONFIG_REJECT_JSON, FIELD_COUNT);
   }
 
   // Extract config section
@@ -165,68 +818,120 @@ MQTTConfig parseConfigJSON(const char *json_response)
   if (config.isNull())
   {
     DEBUG_PRINTLN(F("✗ Missing 'config' section in response"));
-    return mqtt_config;
+    return reject(CONFIG_REJECT_NO_CONFIG, FIELD_COUNT);
   }
 
-  // Extract MQTT settings
-  if (config.containsKey("mqtt_broker"))
+  // One pass over the schema: check each field, then store it
+  ParseState state;
+  state.default_tls = false;
+  for (uint8_t i = 0; i < FIELD_COUNT; i++)
   {
-    strlcpy(mqtt_config.mqtt_broker,
-            config["mqtt_broker"].as<const char *>(),
-            sizeof(mqtt_config.mqtt_broker));
-  }
-
-  if (config.containsKey("mqtt_port"))
-  {
-    mqtt_config.mqtt_port = config["mqtt_port"].as<uint16_t>();
-  }
+    const ConfigField* field = &config_schema[i];
+    JsonVariant value = config[field->key];
 
-  if (config.containsKey("mqtt_topic"))
-  {
-    strlcpy(mqtt_config.mqtt_topic,
-            config["mqtt_topic"].as<const char *>(),
-            sizeof(mqtt_config.mqtt_topic));
+    ConfigReject verdict = checkField(field, value);
+    if (verdict == CONFIG_ACCEPTED && !value.isNull())
+    {
+      verdict = storeField((ConfigFieldId)i, value, mqtt_config, &state);
+    }
+    if (verdict != CONFIG_ACCEPTED)
+    {
+      return reject(verdict, i);
+    }
   }
 
-  if (config.containsKey("poll_frequency_sec"))
+  // Broker failover list (preferred first). Without one, mqtt_broker is the
+  // only entry; with one, mqtt_broker/mqtt_port mirror the primary.
+  uint16_t default_port = mqtt_config->mqtt_port ? mqtt_config->mqtt_port : CONFIG_MQTT_DEFAULT_PORT;
+  if (mqtt_config->broker_count > 0)
   {
-    mqtt_config.poll_frequency_sec =
-        config["poll_frequency_sec"].as<uint16_t>();
+    strlcpy(mqtt_config->mqtt_broker, mqtt_config->brokers[0].host, sizeof(mqtt_config->mqtt_broker));
+    mqtt_config->mqtt_port = mqtt_config->brokers[0].port;
   }
-
-  if (config.containsKey("heartbeat_frequency_sec"))
+  else if (mqtt_config->mqtt_broker[0] != '\0')
   {
-    mqtt_config.heartbeat_frequency_sec =
-        config["heartbeat_frequency_sec"].as<uint16_t>();
+    strlcpy(mqtt_config->brokers[0].host, mqtt_config->mqtt_broker, sizeof(mqtt_config->brokers[0].host));
+    mqtt_config->brokers[0].port = default_port;
+    mqtt_config->brokers[0].tls = state.default_tls || default_port == CONFIG_MQTT_TLS_PORT;
+    mqtt_config->mqtt_port = default_port;
+    mqtt_config->broker_count = 1;
   }
 
-  if (config.containsKey("template"))
+  // The MQTT transport cannot start without a broker
+  if (mqtt_config->transport == TRANSPORT_MQTT && mqtt_config->broker_count == 0)
   {
-    strlcpy(mqtt_config.template_name,
-            config["template"].as<const char *>(),
-            sizeof(mqtt_config.template_name));
+    return reject(CONFIG_REJECT_MISSING, FIELD_MQTT_BROKER);
   }
 
-  DEBUG_PRINTLN(F("✓ Configuration parsed successfully"));
-
   // ========================================================================
   // Validate heartbeat_frequency_sec >= poll_frequency_sec
-  // (unless heartbeat = 0 to disable heartbeat)
+  // (both are at least 1, see the schema)
   // ========================================================================
-  if (mqtt_config.heartbeat_frequency_sec > 0 &&
-      mqtt_config.heartbeat_frequency_sec < mqtt_config.poll_frequency_sec)
+  if (mqtt_config->heartbeat_frequency_sec < mqtt_config->poll_frequency_sec)
   {
     DEBUG_PRINTLN(F(""));
     DEBUG_PRINTLN(F("⚠ Configuration Validation Warning:"));
     DEBUG_PRINT(F("  heartbeat_frequency_sec ("));
-    DEBUG_PRINT(mqtt_config.heartbeat_frequency_sec);
+    DEBUG_PRINT(mqtt_config->heartbeat_frequency_sec);
     DEBUG_PRINT(F(") must be >= poll_frequency_sec ("));
-    DEBUG_PRINT(mqtt_config.poll_frequency_sec);
+    DEBUG_PRINT(mqtt_config->poll_frequency_sec);
     DEBUG_PRINTLN(F(")"));
     DEBUG_PRINTLN(F("→ Auto-correcting: setting heartbeat = poll"));
 
-    mqtt_config.heartbeat_frequency_sec = mqtt_config.poll_frequency_sec;
+    mqtt_config->heartbeat_frequency_sec = mqtt_config->poll_frequency_sec;
+  }
+
+  // A window of half the heartbeat or more would turn most changes into
+  // full heartbeats
+  if (mqtt_config->coalesce_window_sec > mqtt_config->heartbeat_frequency_sec / 2)
+  {
+    mqtt_config->coalesce_window_sec = mqtt_config->heartbeat_frequency_sec / 2;
   }
 
-  return mqtt_config;
+  // Accepted: edge rules replace the previous ones (compiled now, evaluated
+  // on every sample). Entries are {"name", "when", "action"} objects or bare
+  // expressions (publish rules)
+  rulesClear();
+  for (JsonVariant entry : state.rules)
+  {
+    RuleAction action = RULE_PUBLISH;
+    if (entry.is<const char *>())
+    {
+      rulesAdd(NULL, entry.as<const char *>(), action);
+      continue;
+    }
+    if (entry["action"].is<const char *>() &&
+        !ruleActionParse(entry["action"].as<const char *>(), &action))
+    {
+      DEBUG_PRINTLN(F("⚠ Unknown rule action, rule ignored"));
+      continue;
+    }
+    rulesAdd(entry["name"].as<const char *>(), entry["when"].as<const char *>(), action);
+  }
+
+  validation.accepted++;
+  report_pending = false;
+  DEBUG_PRINTLN(F("✓ Configuration parsed successfully"));
+  return CONFIG_ACCEPTED;
+}
+
+const char *configRejectName(ConfigReject reason)
+{
+  switch (reason)
+  {
+    case CONFIG_ACCEPTED:          return "accepted";
+    case CONFIG_REJECT_JSON:       return "json";
+    case CONFIG_REJECT_NO_CONFIG:  return "no_config";
+    case CONFIG_REJECT_MISSING:    return "missing";
+    case CONFIG_REJECT_TYPE:       return "type";
+    case CONFIG_REJECT_RANGE:      return "range";
+    case CONFIG_REJECT_LENGTH:     return "length";
+    case CONFIG_REJECT_VALUE:      return "value";
+    default:                       return "unknown";
+  }
+}
+
+const ConfigValidationStats *configGetValidationStats(void)
+{
+  return &validation;
 }
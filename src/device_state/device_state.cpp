@@ -0,0 +1,158 @@
+#include <Arduino.h>
+#include "device_state/device_state.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+#include "settings/settings.h"
+
+// ============================================================================
+// STATIC STATE - Current state, dwell times and failure budgets
+// ============================================================================
+
+static DeviceStateStats stats = {DEVICE_DISCOVERING, 0, {0}, 0, 0};
+static bool link_up = false;
+static uint8_t fetch_failures = 0;      // Consecutive failed fetches (FETCHING)
+static uint32_t degraded_ms = 0;        // Link-up time spent DEGRADED
+static uint32_t degraded_mark = 0;      // Last time degraded_ms was advanced
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void deviceStateBegin(uint32_t now)
+{
+  memset(&stats, 0, sizeof(stats));
+  stats.state = DEVICE_DISCOVERING;
+  stats.entered_at = now;
+  fetch_failures = 0;
+  degraded_ms = 0;
+}
+
+DeviceState deviceStateGet(void)
+{
+  return stats.state;
+}
+
+const char* deviceStateName(DeviceState state)
+{
+  switch (state)
+  {
+    case DEVICE_DISCOVERING: return "discovering";
+    case DEVICE_FETCHING:    return "fetching";
+    case DEVICE_PUBLISHING:  return "publishing";
+    case DEVICE_DEGRADED:    return "degraded";
+    default:                 return "unknown";
+  }
+}
+
+void deviceStateSet(DeviceState state, uint32_t now)
+{
+  if (state == stats.state || state >= DEVICE_STATE_COUNT)
+  {
+    return;
+  }
+
+  uint32_t dwell = now - stats.entered_at;
+  stats.dwell_ms[stats.state] += dwell;
+  LOG_EVENT(LOG_DEVICE_STATE, stats.state, state, dwell);
+
+  DEBUG_PRINT(F("→ Device state: "));
+  DEBUG_PRINT(deviceStateName(stats.state));
+  DEBUG_PRINT(F(" -> "));
+  DEBUG_PRINTLN(deviceStateName(state));
+
+  stats.state = state;
+  stats.entered_at = now;
+
+  if (state == DEVICE_FETCHING)
+  {
+    fetch_failures = 0;
+  }
+  if (state == DEVICE_DEGRADED)
+  {
+    degraded_mark = now;
+  }
+  if (state == DEVICE_PUBLISHING || state == DEVICE_DISCOVERING)
+  {
+    degraded_ms = 0;
+  }
+}
+
+void deviceStateOnLinkChange(bool up, uint32_t now)
+{
+  // Don't charge the outage to the broker
+  if (stats.state == DEVICE_DEGRADED && link_up && !up)
+  {
+    degraded_ms += now - degraded_mark;
+  }
+  degraded_mark = now;
+  link_up = up;
+
+  if (!up && stats.state == DEVICE_PUBLISHING)
+  {
+    deviceStateSet(DEVICE_DEGRADED, now);
+  }
+}
+
+bool deviceStateFetchFailed(uint32_t now)
+{
+  if (stats.state != DEVICE_FETCHING || ++fetch_failures < settingGet<SETTING_FETCH_FAILURES>())
+  {
+    return false;
+  }
+
+  stats.fetch_giveups++;
+  deviceStateSet(DEVICE_DISCOVERING, now);
+  return true;
+}
+
+bool deviceStateUpdateTransport(bool ready, uint32_t now)
+{
+  if (stats.state == DEVICE_PUBLISHING)
+  {
+    if (!ready)
+    {
+      deviceStateSet(DEVICE_DEGRADED, now);
+    }
+    return false;
+  }
+
+  if (stats.state != DEVICE_DEGRADED)
+  {
+    return false;
+  }
+
+  if (ready)
+  {
+    deviceStateSet(DEVICE_PUBLISHING, now);
+    return false;
+  }
+
+  if (link_up)
+  {
+    degraded_ms += now - degraded_mark;
+  }
+  degraded_mark = now;
+
+  if (degraded_ms < CONFIG_DEVICE_REHOME_AFTER_MS)
+  {
+    return false;
+  }
+
+  stats.rehomes++;
+  deviceStateSet(DEVICE_DISCOVERING, now);
+  return true;
+}
+
+uint32_t deviceStateDwell(DeviceState state, uint32_t now)
+{
+  if (state >= DEVICE_STATE_COUNT)
+  {
+    return 0;
+  }
+  return stats.dwell_ms[state] + (state == stats.state ? now - stats.entered_at : 0);
+}
+
+const DeviceStateStats* deviceStateGetStats(void)
+{
+  return &stats;
+}
@@ -0,0 +1,86 @@
+#include <Arduino.h>
+#include "diag/boot_timeline.h"
+#include "log/log.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// STATIC STATE - Milestone timestamps
+// ============================================================================
+
+static uint32_t marks[BOOT_MARK_COUNT] = {0};
+static bool reached[BOOT_MARK_COUNT] = {false};
+
+static const char* const mark_names[BOOT_MARK_COUNT] = {
+  "wifi_begin",
+  "device_id",
+  "serial",
+  "rtc",
+  "setup",
+  "sensors",
+  "wifi_up",
+  "query",
+  "discovered",
+  "config",
+  "transport",
+  "first_publish",
+};
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void bootMark(BootMark mark)
+{
+  if (mark >= BOOT_MARK_COUNT || reached[mark])
+  {
+    return;
+  }
+
+  marks[mark] = millis();
+  reached[mark] = true;
+  LOG_EVENT(LOG_BOOT_MARK, mark, marks[mark]);
+
+  DEBUG_PRINT(F("→ Boot: "));
+  DEBUG_PRINT(mark_names[mark]);
+  DEBUG_PRINT(F(" at "));
+  DEBUG_PRINT(marks[mark]);
+  DEBUG_PRINTLN(F(" ms"));
+}
+
+uint32_t bootMarkTime(BootMark mark)
+{
+  return mark < BOOT_MARK_COUNT ? marks[mark] : 0;
+}
+
+const char* bootMarkName(BootMark mark)
+{
+  return mark < BOOT_MARK_COUNT ? mark_names[mark] : "unknown";
+}
+
+char* formatBootTimelineJSON(char* buffer, size_t buffer_size)
+{
+  if (!buffer || buffer_size < 32)
+  {
+    return NULL;
+  }
+
+  int offset = snprintf(buffer, buffer_size, "{\"marks_ms\":{");
+  bool first = true;
+  for (uint8_t i = 0; i < BOOT_MARK_COUNT && offset < (int)buffer_size; i++)
+  {
+    if (reached[i])
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset, "%s\"%s\":%lu",
+                         first ? "" : ",", mark_names[i], marks[i]);
+      first = false;
+    }
+  }
+
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       "},\"first_publish_ms\":%lu}", marks[BOOT_MARK_FIRST_PUBLISH]);
+  }
+
+  return offset < (int)buffer_size ? buffer : NULL;
+}
@@ -0,0 +1,226 @@
+#include <Arduino.h>
+#include <malloc.h>
+#include <unistd.h>
+#include "diag/memstats.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// STATIC STATE - Painted region and peaks
+// ============================================================================
+
+static const uint32_t STACK_PAINT = 0xC5C5C5C5;
+
+static uint32_t* paint_low = NULL;     // Lowest painted word
+static uint32_t* paint_high = NULL;    // One past highest painted word
+static uint32_t* dirty_low = NULL;     // Deepest overwritten word found by the last scan
+static uint32_t stack_peak = 0;
+static uint32_t stack_headroom = 0xFFFFFFFF;
+static uint32_t phase_peak[MEM_PHASE_COUNT] = {0};
+
+static const char* const phase_names[MEM_PHASE_COUNT] = {
+  "setup",
+  "discovery",
+  "config_fetch",
+  "publish",
+};
+
+#if defined(ARDUINO_ARCH_SAMD)
+extern "C" char __StackTop;
+#endif
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static uintptr_t stackTop(void)
+{
+#if defined(ARDUINO_ARCH_SAMD)
+  return (uintptr_t)&__StackTop;
+#else
+  return 0;
+#endif
+}
+
+static uint32_t* heapEnd(void)
+{
+  return (uint32_t*)(((uintptr_t)sbrk(0) + 3) & ~(uintptr_t)3);
+}
+
+/**
+ * Fill RAM between heap end (+ guard) and the current stack pointer
+ */
+static void __attribute__((noinline)) paintFreeStack(void)
+{
+#if defined(ARDUINO_ARCH_SAMD)
+  uint32_t* low = heapEnd() + CONFIG_MEMSTATS_HEAP_GUARD / 4;
+  uint32_t* high = (uint32_t*)((__get_MSP() - CONFIG_MEMSTATS_SP_MARGIN) & ~(uintptr_t)3);
+
+  for (uint32_t* p = low; p < high; p++)
+  {
+    *p = STACK_PAINT;
+  }
+
+  paint_low = low;
+  paint_high = high;
+#endif
+}
+
+/**
+ * Repaint only the words used since the last scan (from the deepest one up
+ * to the current stack pointer); everything below them still holds the
+ * pattern from boot
+ */
+static void __attribute__((noinline)) repaintUsedStack(void)
+{
+#if defined(ARDUINO_ARCH_SAMD)
+  if (!dirty_low || dirty_low >= paint_high)
+  {
+    return;
+  }
+
+  uint32_t* high = (uint32_t*)((__get_MSP() - CONFIG_MEMSTATS_SP_MARGIN) & ~(uintptr_t)3);
+  for (uint32_t* p = dirty_low; p < high; p++)
+  {
+    *p = STACK_PAINT;
+  }
+
+  paint_high = high;
+  dirty_low = NULL;
+#endif
+}
+
+/**
+ * Scan painted region for the deepest overwritten word
+ *
+ * Returns:
+ *   Stack bytes in use at the deepest point since the last paint
+ */
+static uint32_t measureStackDepth(void)
+{
+  if (!paint_low || paint_high <= paint_low)
+  {
+    return 0;
+  }
+
+  // Heap may have grown into the painted region: start above it
+  uint32_t* p = heapEnd();
+  if (p < paint_low) p = paint_low;
+
+  while (p < paint_high && *p == STACK_PAINT)
+  {
+    p++;
+  }
+  dirty_low = p;
+
+  uint32_t headroom = (uint32_t)((uintptr_t)p - (uintptr_t)heapEnd());
+  if (headroom < stack_headroom)
+  {
+    stack_headroom = headroom;
+  }
+
+  uint32_t depth = (uint32_t)(stackTop() - (uintptr_t)p);
+  if (depth > stack_peak)
+  {
+    stack_peak = depth;
+  }
+  return depth;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void memStatsBegin(void)
+{
+  paintFreeStack();
+}
+
+void memStatsPhaseBegin(MemPhase phase)
+{
+  (void)phase;
+
+  // Fold whatever happened since the last paint into the global peak, then
+  // restore the pattern over the part that was used (not all free RAM)
+  measureStackDepth();
+  repaintUsedStack();
+}
+
+void memStatsPhaseEnd(MemPhase phase)
+{
+  if (phase >= MEM_PHASE_COUNT)
+  {
+    return;
+  }
+
+  uint32_t depth = measureStackDepth();
+  if (depth > phase_peak[phase])
+  {
+    phase_peak[phase] = depth;
+  }
+}
+
+void memStatsSample(MemStats* stats)
+{
+  if (!stats)
+  {
+    return;
+  }
+
+  measureStackDepth();
+
+  struct mallinfo mi = mallinfo();
+
+  stats->stack_peak = stack_peak;
+  stats->stack_headroom = (stack_headroom == 0xFFFFFFFF) ? 0 : stack_headroom;
+  stats->heap_arena = mi.arena;
+  stats->heap_used = mi.uordblks;
+  stats->heap_free = mi.fordblks;
+  stats->heap_free_chunks = mi.ordblks;
+
+  uint8_t marker;
+  uintptr_t gap = (uintptr_t)&marker - (uintptr_t)heapEnd();
+  stats->free_ram = (uint32_t)gap + mi.fordblks;
+
+  memcpy(stats->phase_peak, phase_peak, sizeof(phase_peak));
+}
+
+const char* memPhaseName(MemPhase phase)
+{
+  return phase < MEM_PHASE_COUNT ? phase_names[phase] : "unknown";
+}
+
+void memStatsPrintReport(void)
+{
+#if DEBUG
+  MemStats stats;
+  memStatsSample(&stats);
+
+  DEBUG_PRINTLN(F(""));
+  DEBUG_PRINTLN(F("=== MEMORY REPORT ==="));
+  DEBUG_PRINT(F("Stack peak: "));
+  DEBUG_PRINT(stats.stack_peak);
+  DEBUG_PRINT(F(" B, min headroom: "));
+  DEBUG_PRINT(stats.stack_headroom);
+  DEBUG_PRINTLN(F(" B"));
+  for (uint8_t i = 0; i < MEM_PHASE_COUNT; i++)
+  {
+    DEBUG_PRINT(F("  "));
+    DEBUG_PRINT(memPhaseName((MemPhase)i));
+    DEBUG_PRINT(F(": "));
+    DEBUG_PRINT(stats.phase_peak[i]);
+    DEBUG_PRINTLN(F(" B"));
+  }
+  DEBUG_PRINT(F("Heap arena/used/free: "));
+  DEBUG_PRINT(stats.heap_arena);
+  DEBUG_PRINT(F("/"));
+  DEBUG_PRINT(stats.heap_used);
+  DEBUG_PRINT(F("/"));
+  DEBUG_PRINT(stats.heap_free);
+  DEBUG_PRINT(F(" B in "));
+  DEBUG_PRINT(stats.heap_free_chunks);
+  DEBUG_PRINTLN(F(" free chunks"));
+  DEBUG_PRINT(F("Free RAM: "));
+  DEBUG_PRINT(stats.free_ram);
+  DEBUG_PRINTLN(F(" B"));
+#endif
+}
@@ -0,0 +1,282 @@
+#include <Arduino.h>
+#include "diag/status.h"
+#include "diag/memstats.h"
+#include "diag/watchdog.h"
+#include "log/log.h"
+#include "log/syslog.h"
+#include "rtc/rtc.h"
+#include "mem/scratch.h"
+#include "wifi/wifi_supervisor.h"
+#include "transport/udp_transport.h"
+#include "coap/coap_server.h"
+#include "mqtt/broker_pool.h"
+#include "mqtt/mqtt_keepalive.h"
+#include "mqtt/publish_queue.h"
+#include "mqtt/mqtt_publish.h"
+#include "device_state/device_state.h"
+#include "rules/rules.h"
+#include "metrics/metrics_server.h"
+#include "ota/ota.h"
+#include "settings/settings.h"
+#include "config_fetch/config_fetch.h"
+#include <WiFiNINA.h>
+#include "arduino_configs.h"
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static const char* rtcStatusName(RTCStatus status)
+{
+  switch (status)
+  {
+    case RTC_INITIALIZED: return "initialized";
+    case RTC_SYNCED:      return "synced";
+    case RTC_SYNC_STALE:  return "stale";
+    default:              return "uninitialized";
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+/**
+ * Format device status as JSON
+ */
+char* formatStatusJSON(char* buffer, size_t buffer_size)
+{
+  if (!buffer || buffer_size < 64)
+  {
+    return NULL;
+  }
+
+  MemStats mem;
+  memStatsSample(&mem);
+
+  int offset = snprintf(buffer, buffer_size,
+                        "{\"uptime_s\":%lu,\"rtc\":\"%s\","
+                        "\"stack_peak\":%lu,\"stack_headroom\":%lu,\"stack_by_path\":{",
+                        millis() / 1000, rtcStatusName(getRTCStatus()),
+                        mem.stack_peak, mem.stack_headroom);
+
+  for (uint8_t i = 0; i < MEM_PHASE_COUNT && offset < (int)buffer_size; i++)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       "%s\"%s\":%lu", i ? "," : "",
+                       memPhaseName((MemPhase)i), mem.phase_peak[i]);
+  }
+
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       "},\"heap_used\":%lu,\"heap_free\":%lu,\"heap_free_chunks\":%lu,"
+                       "\"free_ram\":%lu,\"scratch_peak\":%lu,\"json_pool_peak\":%lu",
+                       mem.heap_used, mem.heap_free, mem.heap_free_chunks, mem.free_ram,
+                       (uint32_t)scratchHighWater(), configGetValidationStats()->json_pool_peak);
+  }
+
+  if (offset < (int)buffer_size)
+  {
+    const WiFiLinkStats* wifi = wifiGetStats();
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"wifi\":{\"rssi\":%ld,\"reconnects\":%lu,"
+                       "\"last_recover_ms\":%lu,\"max_recover_ms\":%lu,"
+                       "\"last_join_ms\":%lu,\"last_join_fast\":%s,\"fast_fallbacks\":%lu}",
+                       (int32_t)WiFi.RSSI(), wifi->reconnects,
+                       wifi->last_recover_ms, wifi->max_recover_ms,
+                       wifi->last_join_ms, wifi->last_join_fast ? "true" : "false",
+                       wifi->fast_fallbacks);
+  }
+
+  // Device state and time spent in each (seconds, including the current visit)
+  if (offset < (int)buffer_size)
+  {
+    const DeviceStateStats* state = deviceStateGetStats();
+    uint32_t now = millis();
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"state\":{\"now\":\"%s\",\"rehomes\":%lu,\"fetch_giveups\":%lu,\"dwell_s\":{",
+                       deviceStateName(state->state), state->rehomes, state->fetch_giveups);
+    for (uint8_t i = 0; i < DEVICE_STATE_COUNT && offset < (int)buffer_size; i++)
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset,
+                         "%s\"%s\":%lu", i ? "," : "",
+                         deviceStateName((DeviceState)i), deviceStateDwell((DeviceState)i, now) / 1000);
+    }
+    if (offset < (int)buffer_size)
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset, "}}");
+    }
+  }
+
+  // Why the previous run ended and how long it had been up
+  if (offset < (int)buffer_size)
+  {
+    const ResetInfo* reset = watchdogGetResetInfo();
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"reset\":{\"cause\":\"%s\",\"task\":\"%s\",\"prev_uptime_s\":%lu,"
+                       "\"boots\":%lu,\"watchdog_resets\":%lu}",
+                       resetCauseName(reset->cause), reset->culprit, reset->uptime_ms / 1000,
+                       reset->boots, reset->watchdog_resets);
+  }
+
+  // Broker failover state (only with a broker list)
+  if (brokerPoolCount() > 1 && offset < (int)buffer_size)
+  {
+    const BrokerPoolStats* pool = brokerPoolGetStats();
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"mqtt\":{\"broker\":%d,\"failovers\":%lu,\"failbacks\":%lu,"
+                       "\"holddown_ms\":%lu,\"scores\":[",
+                       pool->current, pool->failovers, pool->failbacks, pool->holddown_ms);
+    for (uint8_t i = 0; i < brokerPoolCount() && offset < (int)buffer_size; i++)
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset,
+                         "%s%u", i ? "," : "", brokerPoolScore(i));
+    }
+    if (offset < (int)buffer_size)
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset, "]}");
+    }
+  }
+
+  // TLS connect times (only once a TLS broker was tried)
+  const BrokerClientStats* tls = getMQTTClientStats();
+  if ((tls->tls_handshakes > 0 || tls->tls_failures > 0) && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"tls\":{\"handshakes\":%lu,\"failures\":%lu,\"last_ms\":%lu,"
+                       "\"max_ms\":%lu,\"plaintext_fallbacks\":%lu}",
+                       tls->tls_handshakes, tls->tls_failures, tls->last_handshake_ms,
+                       tls->max_handshake_ms, tls->plaintext_fallbacks);
+  }
+
+  // MQTT keepalive schedule (only with the MQTT transport)
+  const KeepaliveStats* keepalive = keepaliveGetStats();
+  if (keepalive->keepalive_sec > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"keepalive\":{\"sec\":%u,\"ping_sec\":%u,\"nat_limit_sec\":%u,"
+                       "\"pings\":%lu,\"nat_drops\":%lu}",
+                       keepalive->keepalive_sec, keepalive->ping_sec, keepalive->nat_limit_sec,
+                       keepalive->pings, keepalive->nat_drops);
+  }
+
+  // Publish queue backlog and losses
+  const PublishQueueStats* queue = publishQueueGetStats();
+  if (queue->queued > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"queue\":{\"depth\":%u,\"sent\":%lu,\"superseded\":%lu,\"dropped\":%lu}",
+                       queue->depth, queue->sent, queue->superseded, queue->dropped);
+  }
+
+  // Edge rules (only when the config has some)
+  const RuleStats* rule_stats = rulesGetStats();
+  if (rule_stats->count > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"rules\":{\"count\":%u,\"evals\":%lu,\"matches\":%lu,"
+                       "\"unknown\":%lu,\"alarms\":%lu,\"max_eval_us\":%lu}",
+                       rule_stats->count, rule_stats->evaluations, rule_stats->matches,
+                       rule_stats->unknown, rule_stats->alarms, rule_stats->max_eval_us);
+  }
+
+  // UDP transport counters (only once it has carried traffic)
+  const UdpTransportStats* udp = udpTransportGetStats();
+  if (udp->sent > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"udp\":{\"sent\":%lu,\"acked\":%lu,\"retransmits\":%lu,"
+                       "\"lost\":%lu,\"superseded\":%lu,\"rtt_ms\":%lu}",
+                       udp->sent, udp->acked, udp->retransmits,
+                       udp->lost, udp->superseded, udp->last_rtt_ms);
+  }
+
+#if CONFIG_COAP_ENABLED
+  // CoAP server counters (only once a client has talked to it)
+  const CoapServerStats* coap = coapServerGetStats();
+  if (coap->requests > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"coap\":{\"requests\":%lu,\"rejected\":%lu,\"observers\":%u,"
+                       "\"notifications\":%lu,\"observers_dropped\":%lu}",
+                       coap->requests, coap->rejected, coap->observers,
+                       coap->notifications, coap->observers_dropped);
+  }
+#endif
+
+#if CONFIG_METRICS_ENABLED
+  // Metrics server counters (only once it has been scraped or probed)
+  const MetricsServerStats* metrics = metricsServerGetStats();
+  if ((metrics->scrapes > 0 || metrics->rejected > 0) && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"metrics\":{\"scrapes\":%lu,\"rejected\":%lu,\"last_ms\":%lu}",
+                       metrics->scrapes, metrics->rejected, metrics->last_scrape_ms);
+  }
+#endif
+
+#if CONFIG_OTA_ENABLED
+  // Running version, and the update in progress (only once one is offered)
+  const OtaStatus* ota = otaGetStatus();
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"firmware\":\"%s\"", CONFIG_FIRMWARE_VERSION);
+  }
+  if (ota->attempts > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"ota\":{\"version\":\"%s\",\"state\":\"%s\",\"error\":\"%s\","
+                       "\"received\":%lu,\"size\":%lu,\"attempts\":%u,"
+                       "\"delta\":%s,\"transferred\":%lu,\"resumes\":%u}",
+                       ota->version, otaStateName(ota->state), otaErrorName(ota->error),
+                       ota->received, ota->size, ota->attempts,
+                       ota->delta ? "true" : "false", ota->transferred, ota->resumes);
+  }
+#endif
+
+  // Runtime settings (only once something was overridden or refused;
+  // values are on "<topic>/settings")
+  const SettingsStats* settings = settingsGetStats();
+  if ((settings->overrides > 0 || settings->rejected > 0) && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"settings\":{\"overrides\":%u,\"changes\":%lu,\"rejected\":%lu,"
+                       "\"saves\":%lu}",
+                       settings->overrides, settings->changes, settings->rejected,
+                       settings->saves);
+  }
+
+  // Config validation (only once a fetched config was refused; the last
+  // good one is still in use)
+  const ConfigValidationStats* validation = configGetValidationStats();
+  if (validation->rejected > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"config\":{\"accepted\":%lu,\"rejected\":%lu,\"reason\":\"%s\","
+                       "\"field\":\"%s\"}",
+                       validation->accepted, validation->rejected,
+                       configRejectName(validation->last_reason), validation->last_field);
+  }
+
+#if CONFIG_LOG_ENABLED
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"log_dropped\":%lu,\"syslog_dropped\":%lu",
+                       logGetDroppedCount(), syslogGetDroppedCount());
+  }
+#endif
+
+  // Close JSON
+  if (offset + 1 < (int)buffer_size)
+  {
+    buffer[offset++] = '}';
+    buffer[offset] = '\0';
+    return buffer;
+  }
+
+  // Buffer overflow
+  return NULL;
+}
@@ -0,0 +1,303 @@
+#include <Arduino.h>
+#include <stddef.h>
+#include <string.h>
+#include "diag/watchdog.h"
+#include "log/log.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// RESET RECORD - Survives a reset (not cleared by the startup code)
+// ============================================================================
+
+static const uint32_t RECORD_MAGIC = 0x57444F47;  // "WDOG"
+
+typedef struct {
+  uint32_t magic;
+  uint32_t boots;
+  uint32_t watchdog_resets;
+  uint32_t uptime_ms;
+  char culprit[CONFIG_WATCHDOG_CULPRIT_LEN];
+  uint32_t check;
+} ResetRecord;
+
+#if defined(ARDUINO_ARCH_SAMD)
+// The core's linker script has no .noinit: declared %nobits it is placed
+// after .bss as an orphan, outside the zeroed range and the flash image
+// (the trailing @ comments out the section flags GCC appends)
+#define NOINIT __attribute__((section(".noinit,\"aw\",%nobits@")))
+#else
+#define NOINIT
+#endif
+
+static ResetRecord record NOINIT;
+
+// ============================================================================
+// STATIC STATE - Tasks (shared with the early-warning interrupt)
+// ============================================================================
+
+static const uint32_t task_deadline[WATCHDOG_TASK_COUNT] = {
+  CONFIG_WATCHDOG_LOOP_DEADLINE_MS,
+  CONFIG_WATCHDOG_CONNECT_DEADLINE_MS,
+  CONFIG_WATCHDOG_FETCH_DEADLINE_MS,
+  CONFIG_WATCHDOG_NET_CALL_DEADLINE_MS,
+};
+
+static const char* const task_names[WATCHDOG_TASK_COUNT] = {
+  "loop",
+  "mqtt_connect",
+  "config_fetch",
+  "net_call",
+};
+
+static const char* const cause_names[] = {
+  "unknown",
+  "power_on",
+  "brownout",
+  "external",
+  "watchdog",
+  "software",
+};
+
+static volatile uint32_t last_checkin = 0;              // WATCHDOG_TASK_LOOP
+static volatile uint32_t armed_at[WATCHDOG_TASK_COUNT] = {0};
+static volatile uint8_t armed = 0;                      // Bit per task
+static volatile bool halted = false;                    // Feeding stopped for good
+
+static ResetInfo info = {RESET_CAUSE_UNKNOWN, "", 0, 0, 0};
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static uint32_t recordChecksum(void)
+{
+  const uint32_t* words = (const uint32_t*)&record;
+  uint32_t sum = 0;
+  for (size_t i = 0; i < offsetof(ResetRecord, check) / 4; i++)
+  {
+    sum = (sum << 1 | sum >> 31) ^ words[i];
+  }
+  return ~sum;
+}
+
+static void sealRecord(void)
+{
+  record.check = recordChecksum();
+}
+
+static void setCulprit(const char* culprit)
+{
+  strncpy(record.culprit, culprit, sizeof(record.culprit) - 1);
+  record.culprit[sizeof(record.culprit) - 1] = '\0';
+  sealRecord();
+}
+
+/**
+ * First task past its deadline, or WATCHDOG_TASK_COUNT if all are live
+ */
+static uint8_t staleTask(uint32_t now)
+{
+  // Inside a blocking call: only that call's deadline counts
+  if (armed)
+  {
+    for (uint8_t task = 0; task < WATCHDOG_TASK_COUNT; task++)
+    {
+      if ((armed & (1 << task)) && now - armed_at[task] > task_deadline[task])
+      {
+        return task;
+      }
+    }
+    return WATCHDOG_TASK_COUNT;
+  }
+
+  if (now - last_checkin > task_deadline[WATCHDOG_TASK_LOOP])
+  {
+    return WATCHDOG_TASK_LOOP;
+  }
+  return WATCHDOG_TASK_COUNT;
+}
+
+static ResetCause readResetCause(void)
+{
+#if defined(ARDUINO_ARCH_SAMD)
+  uint8_t rcause = PM->RCAUSE.reg;
+  if (rcause & PM_RCAUSE_POR)                     return RESET_CAUSE_POWER_ON;
+  if (rcause & (PM_RCAUSE_BOD12 | PM_RCAUSE_BOD33)) return RESET_CAUSE_BROWNOUT;
+  if (rcause & PM_RCAUSE_WDT)                     return RESET_CAUSE_WATCHDOG;
+  if (rcause & PM_RCAUSE_SYST)                    return RESET_CAUSE_SOFTWARE;
+  if (rcause & PM_RCAUSE_EXT)                     return RESET_CAUSE_EXTERNAL;
+#endif
+  return RESET_CAUSE_UNKNOWN;
+}
+
+#if defined(ARDUINO_ARCH_SAMD) && CONFIG_WATCHDOG_ENABLED
+/**
+ * 16 s period, early warning at 8 s, clocked from OSCULP32K / 32
+ * (generic clock 4; RTCZero takes over generic clock 2)
+ */
+static void startWDT(void)
+{
+  GCLK->GENDIV.reg = GCLK_GENDIV_ID(4) | GCLK_GENDIV_DIV(4);
+  GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(4) | GCLK_GENCTRL_GENEN |
+                      GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_DIVSEL;
+  while (GCLK->STATUS.bit.SYNCBUSY);
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID_WDT | GCLK_CLKCTRL_CLKEN | GCLK_CLKCTRL_GEN_GCLK4;
+
+  WDT->CTRL.reg = 0;
+  while (WDT->STATUS.bit.SYNCBUSY);
+
+  WDT->CONFIG.reg = WDT_CONFIG_PER(0xB);          // 16384 cycles
+  WDT->EWCTRL.reg = WDT_EWCTRL_EWOFFSET(0xA);     // 8192 cycles
+  WDT->INTFLAG.reg = WDT_INTFLAG_EW;
+  WDT->INTENSET.reg = WDT_INTENSET_EW;
+
+  // Lowest priority: SysTick (millis) must be able to preempt it
+  NVIC_ClearPendingIRQ(WDT_IRQn);
+  NVIC_SetPriority(WDT_IRQn, 3);
+  NVIC_EnableIRQ(WDT_IRQn);
+
+  WDT->CTRL.reg = WDT_CTRL_ENABLE;
+  while (WDT->STATUS.bit.SYNCBUSY);
+}
+
+/**
+ * Early warning: feed the WDT if every task is live
+ */
+extern "C" void WDT_Handler(void)
+{
+  WDT->INTFLAG.reg = WDT_INTFLAG_EW;
+  if (halted)
+  {
+    return;
+  }
+
+  uint32_t now = millis();
+  uint8_t task = staleTask(now);
+  if (task < WATCHDOG_TASK_COUNT)
+  {
+    // Not fed again: the reset follows at the end of the period
+    halted = true;
+    setCulprit(task_names[task]);
+    return;
+  }
+
+  record.uptime_ms = now;
+  sealRecord();
+  WDT->CLEAR.reg = WDT_CLEAR_CLEAR_KEY;
+}
+#endif
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void watchdogBegin(void)
+{
+  info.cause = readResetCause();
+
+  // Power-on leaves RAM undefined: start a fresh record
+  if (info.cause == RESET_CAUSE_POWER_ON || record.magic != RECORD_MAGIC ||
+      record.check != recordChecksum())
+  {
+    memset(&record, 0, sizeof(record));
+    record.magic = RECORD_MAGIC;
+  }
+
+  record.boots++;
+  if (info.cause == RESET_CAUSE_WATCHDOG)
+  {
+    record.watchdog_resets++;
+    strncpy(info.culprit, record.culprit, sizeof(info.culprit));
+  }
+  info.uptime_ms = record.uptime_ms;
+  info.boots = record.boots;
+  info.watchdog_resets = record.watchdog_resets;
+
+  record.culprit[0] = '\0';
+  record.uptime_ms = 0;
+  sealRecord();
+
+  LOG_EVENT(LOG_RESET_CAUSE, info.cause, info.uptime_ms, info.watchdog_resets);
+  DEBUG_PRINT(F("→ Reset cause: "));
+  DEBUG_PRINT(resetCauseName(info.cause));
+  if (info.culprit[0] != '\0')
+  {
+    DEBUG_PRINT(F(" ("));
+    DEBUG_PRINT(info.culprit);
+    DEBUG_PRINT(F(")"));
+  }
+  DEBUG_PRINT(F(", boot "));
+  DEBUG_PRINTLN(info.boots);
+
+  last_checkin = millis();
+#if defined(ARDUINO_ARCH_SAMD) && CONFIG_WATCHDOG_ENABLED
+  startWDT();
+#endif
+}
+
+void watchdogCheckin(WatchdogTask task)
+{
+  if (task == WATCHDOG_TASK_LOOP)
+  {
+    last_checkin = millis();
+  }
+}
+
+void watchdogArm(WatchdogTask task)
+{
+  if (task < WATCHDOG_TASK_COUNT)
+  {
+    armed_at[task] = millis();
+    armed |= (1 << task);
+  }
+}
+
+void watchdogDisarm(WatchdogTask task)
+{
+  if (task < WATCHDOG_TASK_COUNT)
+  {
+    armed &= ~(1 << task);
+
+    // Returning from the call is progress of the pass that made it
+    last_checkin = millis();
+  }
+}
+
+void watchdogHalt(const char* reason)
+{
+  halted = true;
+  setCulprit(reason);
+
+  DEBUG_PRINT(F("✗ Halted ("));
+  DEBUG_PRINT(reason);
+  DEBUG_PRINTLN(F(") - waiting for the watchdog reset"));
+
+  // With CONFIG_WATCHDOG_ENABLED 0 this halts for good, as before
+  while (1)
+  {
+    yield();
+  }
+}
+
+const ResetInfo* watchdogGetResetInfo(void)
+{
+  return &info;
+}
+
+const char* resetCauseName(ResetCause cause)
+{
+  if (cause > RESET_CAUSE_SOFTWARE)
+  {
+    return "unknown";
+  }
+  return cause_names[cause];
+}
+
+const char* watchdogTaskName(WatchdogTask task)
+{
+  if (task >= WATCHDOG_TASK_COUNT)
+  {
+    return "unknown";
+  }
+  return task_names[task];
+}
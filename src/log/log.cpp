@@ -0,0 +1,267 @@
+#include <Arduino.h>
+#include "log/log.h"
+#include "log/syslog.h"
+#include "arduino_configs.h"
+
+#if CONFIG_LOG_ENABLED
+
+static_assert(CONFIG_LOG_MAX_ARGS <= 4, "logFormat() passes at most 4 arguments");
+static_assert(CONFIG_LOG_DRAIN_SERIAL_BYTES >= 8 + 4 * CONFIG_LOG_MAX_ARGS,
+              "Each drain pass must fit the largest frame");
+
+// ============================================================================
+// STATIC STATE - Ring buffer of encoded frames
+// ============================================================================
+
+static const uint8_t FRAME_SYNC_0 = 0xA5;
+static const uint8_t FRAME_SYNC_1 = 0x5A;
+static const uint8_t FRAME_HEADER_LEN = 8;  // sync(2) + id + argc + millis(4)
+
+static uint8_t ring[CONFIG_LOG_RING_SIZE];
+static uint16_t ring_head = 0;      // Next byte to write
+static uint16_t ring_tail = 0;      // Next byte to drain
+static uint16_t ring_used = 0;
+static uint32_t dropped_count = 0;
+static uint32_t dropped_reported = 0;
+
+static LogLevel runtime_level = (LogLevel)CONFIG_LOG_DEFAULT_LEVEL;
+
+// Per-message severity and format (format strings stay in flash)
+#define LOG_LEVEL_ENTRY(id, level, fmt) level,
+static const uint8_t message_levels[LOG_MESSAGE_COUNT] = {
+  LOG_MESSAGES(LOG_LEVEL_ENTRY)
+};
+#undef LOG_LEVEL_ENTRY
+
+#define LOG_FORMAT_ENTRY(id, level, fmt) fmt,
+static const char* const message_formats[LOG_MESSAGE_COUNT] = {
+  LOG_MESSAGES(LOG_FORMAT_ENTRY)
+};
+#undef LOG_FORMAT_ENTRY
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void ringPut(uint8_t b)
+{
+  ring[ring_head] = b;
+  ring_head = (ring_head + 1) % CONFIG_LOG_RING_SIZE;
+  ring_used++;
+}
+
+static void ringPutU32(uint32_t v)
+{
+  ringPut(v & 0xFF);
+  ringPut((v >> 8) & 0xFF);
+  ringPut((v >> 16) & 0xFF);
+  ringPut((v >> 24) & 0xFF);
+}
+
+static uint8_t ringPeek(uint16_t offset)
+{
+  return ring[(ring_tail + offset) % CONFIG_LOG_RING_SIZE];
+}
+
+static uint32_t ringPeekU32(uint16_t offset)
+{
+  return (uint32_t)ringPeek(offset) |
+         ((uint32_t)ringPeek(offset + 1) << 8) |
+         ((uint32_t)ringPeek(offset + 2) << 16) |
+         ((uint32_t)ringPeek(offset + 3) << 24);
+}
+
+/**
+ * Encode one frame; caller has checked there is room
+ */
+static void putFrame(LogMessageID id, const uint32_t* args, uint8_t argc)
+{
+  ringPut(FRAME_SYNC_0);
+  ringPut(FRAME_SYNC_1);
+  ringPut((uint8_t)id);
+  ringPut(argc);
+  ringPutU32(millis());
+  for (uint8_t i = 0; i < argc; i++)
+  {
+    ringPutU32(args[i]);
+  }
+}
+
+#if DEBUG
+/**
+ * Copy the frame at the ring tail to Serial
+ *
+ * availableForWrite() is exact on a UART. On the SAMD USB CDC port it is
+ * a constant, so the drain's byte budget is what bounds the time a write
+ * can block while the host isn't reading.
+ *
+ * Returns:
+ *   false if the serial port cannot take the whole frame without blocking
+ */
+static bool writeFrameToSerial(uint16_t frame_len)
+{
+  if (Serial.availableForWrite() < frame_len)
+  {
+    return false;
+  }
+
+  // Frame may wrap around the end of the ring: write in two runs
+  uint16_t first = CONFIG_LOG_RING_SIZE - ring_tail;
+  if (first > frame_len) first = frame_len;
+
+  Serial.write(&ring[ring_tail], first);
+  if (first < frame_len)
+  {
+    Serial.write(&ring[0], frame_len - first);
+  }
+  return true;
+}
+#endif
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void logWrite(LogMessageID id, const uint32_t* args, uint8_t argc)
+{
+  if (id >= LOG_MESSAGE_COUNT || message_levels[id] > runtime_level)
+  {
+    return;
+  }
+
+  if (argc > CONFIG_LOG_MAX_ARGS)
+  {
+    argc = CONFIG_LOG_MAX_ARGS;
+  }
+
+  uint16_t frame_len = FRAME_HEADER_LEN + 4 * argc;
+  if (CONFIG_LOG_RING_SIZE - ring_used < frame_len)
+  {
+    dropped_count++;
+    return;
+  }
+
+  putFrame(id, args, argc);
+}
+
+void logDrain(void)
+{
+  // Report overflow once there is room again
+  if (dropped_count != dropped_reported &&
+      CONFIG_LOG_RING_SIZE - ring_used >= FRAME_HEADER_LEN + 4)
+  {
+    uint32_t lost = dropped_count - dropped_reported;
+    dropped_reported = dropped_count;
+    putFrame(LOG_RING_OVERFLOW, &lost, 1);
+  }
+
+  bool to_syslog = syslogIsActive();
+#if DEBUG
+  bool to_serial = (bool)Serial;  // No terminal open (DTR low): nothing written
+  uint16_t serial_budget = CONFIG_LOG_DRAIN_SERIAL_BYTES;
+#endif
+
+  for (uint8_t n = 0; n < CONFIG_LOG_DRAIN_MAX_RECORDS && ring_used >= FRAME_HEADER_LEN; n++)
+  {
+    LogMessageID id = (LogMessageID)ringPeek(2);
+    uint8_t argc = ringPeek(3);
+    uint16_t frame_len = FRAME_HEADER_LEN + 4 * argc;
+
+#if DEBUG
+    if (to_serial)
+    {
+      if (frame_len > serial_budget || !writeFrameToSerial(frame_len))
+      {
+        break;  // Serial busy or this pass's share written: next idle pass
+      }
+      serial_budget -= frame_len;
+    }
+#endif
+
+    if (to_syslog)
+    {
+      uint32_t args[CONFIG_LOG_MAX_ARGS];
+      for (uint8_t i = 0; i < argc; i++)
+      {
+        args[i] = ringPeekU32(FRAME_HEADER_LEN + 4 * i);
+      }
+
+      char text[CONFIG_LOG_TEXT_MAX_LEN];
+      logFormat(id, args, argc, text, sizeof(text));
+      syslogAppend(logMessageLevel(id), ringPeekU32(4), text);
+    }
+
+    ring_tail = (ring_tail + frame_len) % CONFIG_LOG_RING_SIZE;
+    ring_used -= frame_len;
+  }
+
+  syslogPoll();
+}
+
+void logSetLevel(LogLevel level)
+{
+  runtime_level = level;
+}
+
+LogLevel logGetLevel(void)
+{
+  return runtime_level;
+}
+
+int logFormat(LogMessageID id, const uint32_t* args, uint8_t argc,
+              char* buffer, size_t buffer_size)
+{
+  if (!buffer || buffer_size == 0 || id >= LOG_MESSAGE_COUNT)
+  {
+    return 0;
+  }
+
+  // Unused trailing arguments are ignored by snprintf
+  uint32_t a[4] = {0, 0, 0, 0};
+  for (uint8_t i = 0; i < argc && i < 4; i++)
+  {
+    a[i] = args[i];
+  }
+
+  int len = snprintf(buffer, buffer_size, message_formats[id], a[0], a[1], a[2], a[3]);
+  if (len < 0)
+  {
+    buffer[0] = '\0';
+    return 0;
+  }
+  return len < (int)buffer_size ? len : (int)buffer_size - 1;
+}
+
+LogLevel logMessageLevel(LogMessageID id)
+{
+  return id < LOG_MESSAGE_COUNT ? (LogLevel)message_levels[id] : LOG_LEVEL_ERROR;
+}
+
+uint32_t logGetDroppedCount(void)
+{
+  return dropped_count;
+}
+
+#endif  // CONFIG_LOG_ENABLED
+
+/**
+ * Parse level names (also used when logging is compiled out)
+ */
+bool logParseLevel(const char* text, LogLevel* level)
+{
+  if (!text || !level)
+  {
+    return false;
+  }
+
+  static const char* const names[] = {"error", "warn", "info", "debug"};
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    if (strcasecmp(text, names[i]) == 0 || (text[0] == '0' + i && text[1] == '\0'))
+    {
+      *level = (LogLevel)i;
+      return true;
+    }
+  }
+  return false;
+}
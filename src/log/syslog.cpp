@@ -0,0 +1,231 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "log/syslog.h"
+#include "wifi/wifi_supervisor.h"
+#include "diag/watchdog.h"
+#include "arduino_configs.h"
+
+#if CONFIG_LOG_ENABLED
+
+// ============================================================================
+// STATIC STATE - Target, batch buffer and rate limiter
+// ============================================================================
+
+static const uint8_t SYSLOG_FACILITY_LOCAL0 = 16;
+
+static bool syslog_active = false;
+static char target_host[CONFIG_HOSTNAME_MAX_LEN] = {0};
+static uint16_t target_port = 0;
+static IPAddress target_ip;
+static WiFiUDP syslog_udp;                // Outbound only, opened on first send
+static bool target_resolved = false;
+static char device_hostname[CONFIG_SYSLOG_HOSTNAME_MAX_LEN] = {0};
+
+static char batch[CONFIG_SYSLOG_BATCH_SIZE];
+static uint16_t batch_len = 0;
+static uint16_t batch_lines = 0;
+static uint32_t batch_started = 0;
+
+static uint32_t bucket_millitokens = CONFIG_SYSLOG_BURST * 1000UL;
+static uint32_t bucket_refilled_at = 0;
+static uint32_t dropped_count = 0;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Map log level to syslog severity (RFC 5424 section 6.2.1)
+ */
+static uint8_t syslogSeverity(LogLevel level)
+{
+  switch (level)
+  {
+    case LOG_LEVEL_ERROR: return 3;
+    case LOG_LEVEL_WARN:  return 4;
+    case LOG_LEVEL_INFO:  return 6;
+    default:              return 7;
+  }
+}
+
+/**
+ * Token bucket: true if a record may be sent now
+ */
+static bool takeToken(void)
+{
+  uint32_t now = millis();
+  uint32_t elapsed = now - bucket_refilled_at;
+  bucket_refilled_at = now;
+
+  // Past cap / rate ms the bucket is full anyway; clamping first keeps
+  // elapsed * rate from wrapping after a long idle
+  uint32_t cap = settingGet<SETTING_SYSLOG_BURST>() * 1000UL;
+  uint32_t rate = settingGet<SETTING_SYSLOG_RATE_PER_SEC>();
+  if (elapsed > cap / rate)
+  {
+    elapsed = cap / rate;
+  }
+  uint32_t refill = elapsed * rate;
+  bucket_millitokens = (refill >= cap - bucket_millitokens) ? cap : bucket_millitokens + refill;
+
+  if (bucket_millitokens < 1000)
+  {
+    return false;
+  }
+  bucket_millitokens -= 1000;
+  return true;
+}
+
+/**
+ * Send the current batch as one datagram
+ * Drops it (counted) if the link is down or the target unresolved, so the
+ * caller never waits.
+ */
+static void flushBatch(void)
+{
+  if (batch_len == 0)
+  {
+    return;
+  }
+
+  if (wifiIsUp() && target_resolved)
+  {
+    // Own socket: beginPacket() on the mDNS socket would discard discovery
+    // responses waiting in it
+    syslog_udp.beginPacket(target_ip, target_port);
+    syslog_udp.write((const uint8_t*)batch, batch_len);
+    if (!syslog_udp.endPacket())
+    {
+      dropped_count += batch_lines;
+    }
+  }
+  else
+  {
+    dropped_count += batch_lines;
+  }
+
+  batch_len = 0;
+  batch_lines = 0;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool syslogBegin(const char* host, uint16_t port, const char* hostname)
+{
+  if (!host || host[0] == '\0' || port == 0)
+  {
+    return false;
+  }
+
+  strlcpy(target_host, host, sizeof(target_host));
+  strlcpy(device_hostname, (hostname && hostname[0]) ? hostname : "-", sizeof(device_hostname));
+  target_port = port;
+
+  // Looked up here, once per config: a name lookup blocks inside NINA, so
+  // it stays off the flush path (logDrain() in the loop)
+  target_resolved = target_ip.fromString(target_host);
+  if (!target_resolved && wifiIsUp())
+  {
+    watchdogArm(WATCHDOG_TASK_NET_CALL);
+    target_resolved = WiFi.hostByName(target_host, target_ip) == 1;
+    watchdogDisarm(WATCHDOG_TASK_NET_CALL);
+  }
+  batch_len = 0;
+  batch_lines = 0;
+  bucket_millitokens = settingGet<SETTING_SYSLOG_BURST>() * 1000UL;
+  bucket_refilled_at = millis();
+  syslog_active = true;
+
+  if (!target_resolved)
+  {
+    DEBUG_PRINT(F("⚠ Syslog host not resolved, dropping records: "));
+    DEBUG_PRINTLN(target_host);
+    return true;
+  }
+
+  DEBUG_PRINT(F("✓ Syslog streaming to "));
+  DEBUG_PRINT(target_host);
+  DEBUG_PRINT(F(":"));
+  DEBUG_PRINTLN(target_port);
+  return true;
+}
+
+void syslogEnd(void)
+{
+  syslog_active = false;
+  syslog_udp.stop();
+  batch_len = 0;
+  batch_lines = 0;
+}
+
+bool syslogIsActive(void)
+{
+  return syslog_active;
+}
+
+void syslogAppend(LogLevel level, uint32_t timestamp_ms, const char* text)
+{
+  if (!syslog_active || !text)
+  {
+    return;
+  }
+
+  if (!takeToken())
+  {
+    dropped_count++;
+    return;
+  }
+
+  char line[CONFIG_LOG_TEXT_MAX_LEN + 64];
+  int len = snprintf(line, sizeof(line), "<%u>1 - %s arduino-mdns - - - [%lu] %s\n",
+                     SYSLOG_FACILITY_LOCAL0 * 8 + syslogSeverity(level),
+                     device_hostname, (unsigned long)timestamp_ms, text);
+  if (len <= 0)
+  {
+    return;
+  }
+  if (len >= (int)sizeof(line))
+  {
+    len = sizeof(line) - 1;
+  }
+
+  if (batch_len + len > sizeof(batch))
+  {
+    flushBatch();
+  }
+
+  if (batch_len == 0)
+  {
+    batch_started = millis();
+  }
+  memcpy(&batch[batch_len], line, len);
+  batch_len += len;
+  batch_lines++;
+}
+
+void syslogPoll(void)
+{
+  if (syslog_active && batch_len > 0 && millis() - batch_started >= CONFIG_SYSLOG_FLUSH_MS)
+  {
+    flushBatch();
+  }
+}
+
+void syslogOnSettingChange(SettingKey key)
+{
+  // The refill assumes the bucket never holds more than the burst
+  uint32_t cap = settingGet<SETTING_SYSLOG_BURST>() * 1000UL;
+  if (key == SETTING_SYSLOG_BURST && bucket_millitokens > cap)
+  {
+    bucket_millitokens = cap;
+  }
+}
+
+uint32_t syslogGetDroppedCount(void)
+{
+  return dropped_count;
+}
+
+#endif  // CONFIG_LOG_ENABLED
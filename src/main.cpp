@@ -15,9 +15,17 @@
  * MODULE ARCHITECTURE:
  * ============================================================================
  * - config.h        : Centralized configuration and data structures
- * - network.h/.cpp  : WiFi and mDNS UDP socket initialization
+ * - wifi_supervisor : Background WiFi join/reconnect with backoff
+ * - network.h/.cpp  : mDNS UDP socket initialization
  * - packet.h/.cpp   : DNS packet building and parsing
  * - mdns.h/.cpp     : mDNS query sending and response handling
+ * - coap_server     : CoAP /sensors and /status for pull-based consumers
+ * - metrics_server  : Prometheus /metrics, advertised by the mDNS responder
+ * - device_state    : Discovering/fetching/publishing/degraded, re-homing
+ * - watchdog        : Hardware watchdog fed while every task is live
+ * - boot_timeline   : Boot-to-first-publish milestones, published once
+ * - ota             : Firmware updates offered by the config server
+ * - settings        : Runtime tunables (defaults, server and MQTT overrides)
  * - main (this file): Program flow (setup/loop)
  *
  * ============================================================================
@@ -29,8 +37,30 @@
 #include "device_id/device_id.h"
 #include "config_fetch/config_fetch.h"
 #include "mqtt/mqtt_publish.h"
+#include "mqtt/sensor_topics.h"
+#include "mqtt/publish_queue.h"
 #include "sensors/sensors.h"
 #include "rtc/rtc.h"
+#include "log/log.h"
+#include "log/syslog.h"
+#include "diag/memstats.h"
+#include "diag/status.h"
+#include "diag/watchdog.h"
+#include "diag/boot_timeline.h"
+#include "mem/scratch.h"
+#include "wifi/wifi_supervisor.h"
+#include "transport/transport.h"
+#include "coap/coap_server.h"
+#include "device_state/device_state.h"
+#include "rules/rules.h"
+#include "mdns/responder.h"
+#include "metrics/metrics_server.h"
+#include "ota/ota.h"
+#include "settings/settings.h"
+
+#if CONFIG_NETFAULT_ENABLED
+#include "netfault/netfault.h"
+#endif
 
 // ============================================================================
 // GLOBAL STATE - Device and configuration tracking
@@ -38,17 +68,103 @@
 
 static DeviceID device;
 static MQTTConfig mqtt_config;
-static bool config_fetched = false;
+static bool config_fetched = false;             // Config in use (cleared to rediscover)
+static bool config_applied = false;             // mqtt_config holds a fetched config
 static uint32_t last_config_fetch_attempt = 0;
-static const uint32_t CONFIG_FETCH_RETRY_INTERVAL = 30000;  // Retry every 30s
 
 static bool mqtt_initialized = false;
-static uint32_t last_publish_time = 0;
+static uint32_t last_heartbeat_time = 0;         // Heartbeats only (changes don't move it)
 static uint32_t last_change_check_time = 0;      // For change detection timing
 static SensorReadings previous_readings = {0};   // For change comparison
+static SensorReadings latest_readings = {0};     // Last read (served over CoAP, /metrics)
 static bool first_publish = true;                // Force first publish
 
 static bool sensors_initialized = false;
+static bool sensors_warming = false;             // Warm-up finishing in loop()
+
+static bool query_now = false;                   // Send mDNS query on next pass
+static bool fetch_now = false;                   // Server just discovered: fetch now
+#if CONFIG_OTA_ENABLED
+static uint32_t ota_ready_at = 0;                // Verified image waiting for the queue
+#endif
+
+static uint32_t last_status_time = 0;
+static bool status_published = false;            // Force first status after connect
+static bool settings_published = false;          // Effective settings, after a change
+static uint32_t settings_rejected_seen = 0;      // Refusals already reported
+static bool boot_timeline_published = false;     // Sent once, after the first publish
+
+/**
+ * Publish Scratch Layout
+ * Telemetry/status formatting buffers, borrowed from the scratch arena
+ * (SCRATCH_PUBLISH) for each publish
+ */
+typedef struct {
+  char payload[CONFIG_TELEMETRY_PAYLOAD_SIZE];
+  char topic[sizeof(MQTTConfig::mqtt_topic) + 24];  // + "/temperature_celsius"
+} PublishScratch;
+
+// ============================================================================
+// LINK EVENTS - WiFi supervisor callback
+// ============================================================================
+
+/**
+ * Query right away when the link comes up, and send a fresh status report
+ * (with the outage duration) once MQTT is back
+ */
+static void onWiFiLinkChange(bool up)
+{
+  deviceStateOnLinkChange(up, millis());
+
+  if (up)
+  {
+    bootMark(BOOT_MARK_WIFI_UP);
+    query_now = true;
+    status_published = false;
+  }
+}
+
+// ============================================================================
+// SETTINGS EVENTS - Runtime settings callback
+// ============================================================================
+
+/**
+ * Publish the effective settings and a fresh status report after a change
+ * (the acknowledgement of an MQTT command)
+ */
+static void onSettingChange(SettingKey key)
+{
+  (void)key;
+  settings_published = false;
+  status_published = false;
+}
+
+// ============================================================================
+// RE-HOMING - Back to discovery when the configured transport stays down
+// ============================================================================
+
+/**
+ * Drop the transport session and the discovered server, and look for the
+ * config server again. mqtt_config, the sampling schedule and the publish
+ * queue are kept: readings taken meanwhile go out once a config is applied.
+ */
+static void rehome(uint32_t now)
+{
+  LOG_EVENT(LOG_DEVICE_REHOME, publishQueueDepth());
+  DEBUG_PRINTLN(F("⚠ Transport unusable too long - rediscovering config server"));
+
+  disconnectMQTT();
+  clearDiscoveredConfig();
+#if CONFIG_LOG_ENABLED
+  // The target may be the server being left; the next config sets both
+  syslogEnd();
+  logSetLevel((LogLevel)CONFIG_LOG_DEFAULT_LEVEL);
+#endif
+  config_fetched = false;
+  status_published = false;
+  query_now = true;
+  last_config_fetch_attempt = now;  // Give discovery a full fetch interval
+}
 
 // ============================================================================
 // SETUP - Initialize hardware, WiFi, and mDNS
@@ -58,18 +174,61 @@ static bool sensors_initialized = false;
  * setup() - Run once at startup
  *
  * INITIALIZATION ORDER:
- *   1. Serial communication (debugging)
- *   2. WiFi connection
- *   3. mDNS network setup
- *   4. Send initial query
+ *   1. WiFi supervisor (join runs in the background)
+ *   2. Device ID, sensors (warm-up runs in the background)
+ *   3. Serial wait (debugging), watchdog, RTC
+ *
+ * Nothing waits on the join or the warm-up: the sensors are probed from
+ * loop() once warm, and the mDNS socket is bound and the first query sent
+ * once the link is up.
  */
 void setup(void)
 {
+  // Paint free stack before anything else runs (high-water-mark tracking)
+  memStatsBegin();
+
 #if DEBUG
   // Initialize serial communication (debug only)
   Serial.begin(115200);
+#endif
+
+  deviceStateBegin(millis());
 
-  // Wait for serial port (with timeout for non-USB boards)
+  // Start WiFi in the background; modules follow the link up/down.
+  // Order matters: the mDNS socket is bound before the query goes out.
+  wifiSupervisorAddListener(mdnsSocketOnLinkChange);
+  wifiSupervisorAddListener(mqttOnLinkChange);
+  wifiSupervisorAddListener(rtcOnLinkChange);
+#if CONFIG_COAP_ENABLED
+  wifiSupervisorAddListener(coapServerOnLinkChange);
+#endif
+#if CONFIG_METRICS_ENABLED
+  wifiSupervisorAddListener(metricsServerOnLinkChange);
+  wifiSupervisorAddListener(mdnsResponderOnLinkChange);
+#endif
+  wifiSupervisorAddListener(onWiFiLinkChange);
+  wifiSupervisorBegin();
+  bootMark(BOOT_MARK_WIFI_BEGIN);
+
+  // Device identification (serial number + MAC address). Before the ENV
+  // shield: ECCX08.end() releases the I2C bus.
+  device = initializeDeviceID();
+  if (device.valid)
+  {
+    bootMark(BOOT_MARK_DEVICE_ID);
+  }
+
+  // Start the sensors; their warm-up finishes in loop() while WiFi joins
+  sensors_warming = sensorsBegin();
+  if (!sensors_warming)
+  {
+    DEBUG_PRINTLN(F("⚠ Sensor initialization failed - will publish without sensor data"));
+    bootMark(BOOT_MARK_SENSORS);
+  }
+
+#if DEBUG
+  // Wait for serial port (with timeout for non-USB boards); the join and
+  // the warm-up carry on meanwhile
   uint32_t serialWaitStart = millis();
   while (!Serial && millis() - serialWaitStart < CONFIG_SERIAL_WAIT_TIMEOUT)
   {
@@ -82,54 +241,31 @@ void setup(void)
   DEBUG_PRINTLN(F(""));
 #endif
 
-  // Establish WiFi connection
-  if (!connectToWiFi())
-  {
-    DEBUG_PRINTLN(F("✗ WiFi setup failed - halting"));
-    while (1)
-    {
-      yield();  // Fatal error - halt indefinitely
-    }
-  }
+  bootMark(BOOT_MARK_SERIAL);
 
-  // Initialize device identification (serial number + MAC address)
-  device = initializeDeviceID();
-  if (!device.valid)
-  {
-    DEBUG_PRINTLN(F("✗ Device ID initialization failed - halting"));
-    while (1)
-    {
-      yield();  // Fatal error - halt indefinitely
-    }
-  }
+  // Runtime settings: compile-time defaults plus the overrides saved in flash
+  settingsBegin();
+  settingsAddListener(onSettingChange);
+#if CONFIG_LOG_ENABLED
+  settingsAddListener(syslogOnSettingChange);
+#endif
 
-  // Initialize mDNS networking
-  if (!initMDNS())
-  {
-    DEBUG_PRINTLN(F("✗ mDNS setup failed - halting"));
-    while (1)
-    {
-      yield();  // Fatal error - halt indefinitely
-    }
-  }
+  // Reset cause of the last run; the rest of setup() runs under the watchdog
+  watchdogBegin();
 
-  // Send initial mDNS query
-  if (!sendMDNSQuery())
+  if (!device.valid)
   {
-    DEBUG_PRINTLN(F("⚠ Initial query failed, retrying in loop"));
+    DEBUG_PRINTLN(F("✗ Device ID initialization failed"));
+    watchdogHalt("device_id");  // Reset and retry (the crypto chip may recover)
   }
 
-  // Initialize environmental sensors
-  if (!initSensors())
-  {
-    DEBUG_PRINTLN(F("⚠ Sensor initialization failed - will publish without sensor data"));
-    sensors_initialized = false;
-  }
-  else
-  {
-    sensors_initialized = true;
-    DEBUG_PRINTLN(F("✓ Environmental sensors initialized"));
-  }
+#if CONFIG_METRICS_ENABLED
+  // Advertise /metrics as arduino-<serial>._prometheus-http._tcp.local
+  char instance[CONFIG_MDNS_LABEL_MAX_LEN + 1];
+  snprintf(instance, sizeof(instance), "arduino-%s", device.device_id);
+  mdnsResponderBegin("_prometheus-http._tcp", instance, CONFIG_METRICS_PORT, "path=/metrics");
+  metricsServerUpdate(&latest_readings);
+#endif
 
   // Initialize Real-Time Clock (RTC)
   RTCStatus rtc_init_status = initRTC();
@@ -141,6 +277,15 @@ void setup(void)
   {
     DEBUG_PRINTLN(F("✓ Real-Time Clock initialized"));
   }
+  bootMark(BOOT_MARK_RTC);
+
+#if CONFIG_NETFAULT_ENABLED
+  // Start resilience benchmark scenarios
+  netFaultBegin();
+#endif
+
+  memStatsPhaseEnd(MEM_PHASE_SETUP);
+  bootMark(BOOT_MARK_SETUP);
 
   DEBUG_PRINTLN(F("✓ Setup complete - entering main loop"));
 }
@@ -169,19 +314,111 @@ void loop(void)
   static uint32_t lastQueryTime = 0;
   uint32_t now = millis();
 
+  watchdogCheckin(WATCHDOG_TASK_LOOP);
+#if CONFIG_METRICS_ENABLED
+  metricsLoopTick();
+#endif
+
+  // === BACKGROUND: Supervise the WiFi link (join, loss, backoff) ===
+  wifiSupervisorPoll();
+
+#if CONFIG_LOG_ENABLED
+  // === BACKGROUND: Drain deferred log records queued by the last pass ===
+  logDrain();
+#endif
+
   // === BACKGROUND: Periodically sync RTC with network time (non-blocking) ===
   syncRTCWithNetwork();
 
+  // === BACKGROUND: Probe the sensors once their warm-up is over ===
+  if (sensors_warming)
+  {
+    SensorInitState init = sensorsInitPoll();
+    if (init != SENSORS_WARMING)
+    {
+      sensors_warming = false;
+      sensors_initialized = (init == SENSORS_READY);
+      if (sensors_initialized)
+      {
+        DEBUG_PRINTLN(F("✓ Environmental sensors initialized"));
+      }
+      else
+      {
+        DEBUG_PRINTLN(F("⚠ Sensor initialization failed - will publish without sensor data"));
+      }
+      bootMark(BOOT_MARK_SENSORS);
+    }
+  }
+
+  // === BACKGROUND: Save settings changes once they have settled ===
+  settingsPoll(now);
+
+#if CONFIG_NETFAULT_ENABLED
+  // === BACKGROUND: Advance fault-injection scenarios ===
+  netFaultPoll();
+#endif
+
+  // === NO LINK: nothing below can make progress until the supervisor rejoins ===
+  if (!wifiIsUp())
+  {
+    return;
+  }
+
+#if CONFIG_COAP_ENABLED
+  // === BACKGROUND: Answer CoAP requests (pull-based consumers) ===
+  coapServerPoll();
+#endif
+
+#if CONFIG_METRICS_ENABLED
+  // === BACKGROUND: Serve /metrics and answer mDNS queries for it ===
+  metricsServerPoll();
+  mdnsResponderPoll();
+#endif
+
+#if CONFIG_OTA_ENABLED
+  // === BACKGROUND: Download offered firmware; install once the queue drains ===
+  if (otaPoll(now) == OTA_READY)
+  {
+    if (ota_ready_at == 0)
+    {
+      ota_ready_at = now;
+    }
+    if (publishQueueDepth() == 0 || now - ota_ready_at >= settingGet<SETTING_OTA_DRAIN_TIMEOUT_MS>())
+    {
+      disconnectMQTT();
+      otaApply();  // Resets into the new image
+    }
+  }
+#endif
+
   // === IF CONFIG ALREADY FETCHED: FOCUS ON MQTT ===
   if (config_fetched)
   {
     // Maintain MQTT connection
     maintainMQTT();
 
+    // Transport unusable for the whole budget: the config is probably stale
+    if (deviceStateUpdateTransport(isMQTTReady(), now))
+    {
+      rehome(now);
+    }
+    if (isMQTTReady())
+    {
+      bootMark(BOOT_MARK_TRANSPORT);
+    }
+  }
+
+  // === TELEMETRY: Sample, queue and send once a config has been applied ===
+  // (sampling carries on with the previous config while rediscovering)
+  if (config_applied)
+  {
     // ====================================================================
     // DUAL-INTERVAL PUBLISHING LOGIC:
     // 1. Change Detection: Every poll_frequency_sec, check for significant changes
     // 2. Heartbeat: Every heartbeat_frequency_sec, force publish regardless
+    //    (on its own schedule; change publishes don't postpone it)
+    // 3. Coalescing: A change within coalesce_window_sec of the heartbeat
+    //    sends the heartbeat early instead, saving the change message
     // ====================================================================
 
     uint32_t poll_interval_ms = mqtt_config.poll_frequency_sec * 1000;
@@ -189,82 +426,149 @@ void loop(void)
 
     // Determine which condition triggered this cycle
     bool should_check_change = (now - last_change_check_time >= poll_interval_ms);
-    bool should_force_publish = (now - last_publish_time >= heartbeat_interval_ms);
-
-    if (isMQTTReady() && (should_check_change || should_force_publish))
+    bool should_force_publish = (now - last_heartbeat_time >= heartbeat_interval_ms);
+
+    // Readings are queued even while the broker is unreachable; the queue
+    // keeps the latest heartbeat and as many changes as fit, and sends the
+    // most important first once it is back
+    PublishScratch* scratch = NULL;
+    if ((should_check_change || should_force_publish) &&
+        (scratch = scratchAcquire<PublishScratch>(SCRATCH_PUBLISH)) != NULL)
     {
-      SensorReadings current_readings;
-      char payload[256];
+      memStatsPhaseBegin(MEM_PHASE_PUBLISH);
+
+      SensorReadings& current_readings = latest_readings;
+      char* payload = scratch->payload;
+      const size_t payload_size = sizeof(scratch->payload);
 
       // Read sensor data
       if (sensors_initialized && readSensors(&current_readings))
       {
         bool publish = false;
         bool is_heartbeat = false;
+        bool coalesced = false;   // Heartbeat sent early for a change
+
+#if CONFIG_COAP_ENABLED
+        coapServerUpdate(&current_readings, should_force_publish);
+#endif
+
+        // Edge rules: alarm transitions are queued ahead of everything else;
+        // publish / drop rules decide on change messages below
+        RuleVerdict verdict;
+        rulesEvaluate(&current_readings, &verdict);
+        rulesQueueAlarms(&verdict, &current_readings, payload, payload_size);
 
         // CASE 1: Heartbeat interval elapsed - force publish regardless of changes
         if (should_force_publish)
         {
           publish = true;
           is_heartbeat = true;
-          DEBUG_PRINTLN(F("[MQTT] Publishing (heartbeat)"));
+          LOG_EVENT(LOG_PUBLISH_HEARTBEAT);
         }
         // CASE 2: Change check interval elapsed - check for significant changes
         else if (should_check_change)
         {
           last_change_check_time = now;
 
-          if (first_publish || hasSignificantChange(&previous_readings, &current_readings))
+          // Publish rules, when configured, replace the change thresholds;
+          // a true drop rule holds change messages back
+          bool changed = verdict.has_publish ? verdict.publish :
+                         hasSignificantChange(&previous_readings, &current_readings);
+
+          if (first_publish || (changed && !verdict.suppress))
           {
             publish = true;
-            is_heartbeat = false;
-            DEBUG_PRINTLN(F("[MQTT] Publishing (change detected)"));
+
+            // Heartbeat due within the coalescing window: send it now with
+            // the change instead of a change message followed by a heartbeat
+            uint32_t until_heartbeat = heartbeat_interval_ms - (now - last_heartbeat_time);
+            if (!first_publish && until_heartbeat <= mqtt_config.coalesce_window_sec * 1000UL)
+            {
+              is_heartbeat = true;
+              coalesced = true;
+              LOG_EVENT(LOG_PUBLISH_COALESCED, until_heartbeat / 1000);
+            }
+            else
+            {
+              is_heartbeat = false;
+              LOG_EVENT(LOG_PUBLISH_CHANGE);
+            }
           }
           else
           {
-            DEBUG_PRINTLN(F("[MQTT] Skipped (no significant change)"));
+            LOG_EVENT(LOG_PUBLISH_SKIPPED);
           }
         }
 
-        // Publish if triggered
+        // Queue if triggered
         if (publish)
         {
+          bool queued = true;
+          PublishPriority priority = (is_heartbeat && !coalesced) ? PUBLISH_HEARTBEAT : PUBLISH_CHANGE;
+
           // Format sensor readings based on publish type:
-          // - Heartbeat: All sensor values
+          // - Heartbeat: All sensor values (replaces an unsent heartbeat)
+          // - Publish rule matched: All sensor values
           // - Change: Only changed values + timestamp (optimization)
-          if (is_heartbeat)
+          bool all_fields = is_heartbeat || verdict.publish;
+          if (mqtt_config.topic_layout != TOPIC_LAYOUT_PER_SENSOR)
           {
-            if (!formatSensorJSON(&current_readings, payload, sizeof(payload)))
+            if (all_fields)
+            {
+              if (!formatSensorJSON(&current_readings, payload, payload_size))
+              {
+                // JSON formatting failed, fall back to minimal payload
+                snprintf(payload, payload_size,
+                         "{\"timestamp\":%lu}",
+                         current_readings.timestamp);
+              }
+            }
+            else
             {
-              // JSON formatting failed, fall back to minimal payload
-              snprintf(payload, sizeof(payload),
-                       "{\"timestamp\":%lu}",
-                       current_readings.timestamp);
+              // Change detection: Only publish changed fields
+              if (!formatChangedSensorJSON(&previous_readings, &current_readings, payload, payload_size))
+              {
+                // JSON formatting failed, fall back to minimal payload
+                snprintf(payload, payload_size,
+                         "{\"timestamp\":%lu}",
+                         current_readings.timestamp);
+              }
             }
+
+            queued = publishQueuePush(priority, NULL, payload,
+                                      is_heartbeat ? PUBLISH_SUPERSEDE : 0);
           }
-          else
+
+          // Per-sensor retained subtopics: the changed ones (including
+          // sensors that failed or recovered), plus every valid one on a
+          // heartbeat or publish rule; everything on the first publish to
+          // replace stale values
+          if (queued && mqtt_config.topic_layout != TOPIC_LAYOUT_COMBINED)
           {
-            // Change detection: Only publish changed fields
-            if (!formatChangedSensorJSON(&previous_readings, &current_readings, payload, sizeof(payload)))
+            uint8_t fields = first_publish ? SENSOR_CHANGE_ALL :
+                             computeChangeMask(&previous_readings, &current_readings);
+            if (all_fields)
             {
-              // JSON formatting failed, fall back to minimal payload
-              snprintf(payload, sizeof(payload),
-                       "{\"timestamp\":%lu}",
-                       current_readings.timestamp);
+              fields |= sensorValidMask(&current_readings);
             }
+            queued = queueSensorTopics(&current_readings, fields, priority);
           }
 
-          MQTTStatus pub_status = publishToMQTT(nullptr, payload);
-          if (pub_status != MQTT_ERROR)
+          if (queued)
           {
-            // Update state only on successful publish
-            last_publish_time = now;
+            // Update state only once the readings are queued
             previous_readings = current_readings;
             first_publish = false;
           }
           else
           {
-            DEBUG_PRINTLN(F("⚠ Failed to publish to MQTT (will retry)"));
+            DEBUG_PRINTLN(F("⚠ Publish queue full (will retry)"));
+          }
+
+          // A heartbeat that didn't fit is replaced by the next one anyway
+          if (is_heartbeat)
+          {
+            last_heartbeat_time = now;
           }
         }
       }
@@ -274,45 +578,127 @@ void loop(void)
         if (should_force_publish)
         {
           // Still publish on heartbeat with timestamp only
-          snprintf(payload, sizeof(payload),
+          snprintf(payload, payload_size,
                    "{\"timestamp\":%lu}",
                    now / 1000);
 
-          MQTTStatus pub_status = publishToMQTT(nullptr, payload);
-          if (pub_status != MQTT_ERROR)
-          {
-            last_publish_time = now;
-            first_publish = false;
-          }
+          publishQueuePush(PUBLISH_HEARTBEAT, NULL, payload, PUBLISH_SUPERSEDE);
+          last_heartbeat_time = now;
+          first_publish = false;
         }
       }
+
+      memStatsPhaseEnd(MEM_PHASE_PUBLISH);
+      scratchRelease(SCRATCH_PUBLISH);
+    }
+
+    // === STATUS: Memory and health report on "<topic>/status" ===
+    if (isMQTTReady() &&
+        (!status_published || now - last_status_time >= settingGet<SETTING_STATUS_INTERVAL_MS>()) &&
+        (scratch = scratchAcquire<PublishScratch>(SCRATCH_PUBLISH)) != NULL)
+    {
+      if (formatStatusJSON(scratch->payload, sizeof(scratch->payload)) &&
+          publishQueuePush(PUBLISH_STATS, "status", scratch->payload, PUBLISH_SUPERSEDE))
+      {
+        status_published = true;
+        last_status_time = now;
+        memStatsPrintReport();
+      }
+      scratchRelease(SCRATCH_PUBLISH);
+    }
+
+    // === SETTINGS: Effective values, retained on "<topic>/settings", after
+    // a change or a refused one ===
+    uint32_t settings_rejected = settingsGetStats()->rejected;
+    if (isMQTTReady() && (!settings_published || settings_rejected != settings_rejected_seen) &&
+        (scratch = scratchAcquire<PublishScratch>(SCRATCH_PUBLISH)) != NULL)
+    {
+      if (settingsFormatJSON(scratch->payload, sizeof(scratch->payload)) &&
+          publishQueuePush(PUBLISH_STATS, "settings", scratch->payload,
+                           PUBLISH_SUPERSEDE | PUBLISH_RETAIN))
+      {
+        settings_published = true;
+        settings_rejected_seen = settings_rejected;
+      }
+      scratchRelease(SCRATCH_PUBLISH);
+    }
+
+    // === SEND: Drain the publish queue, most important first, within the
+    // per-pass byte budget ===
+    if (isMQTTReady() && publishQueueDepth() > 0 &&
+        (scratch = scratchAcquire<PublishScratch>(SCRATCH_PUBLISH)) != NULL)
+    {
+      memStatsPhaseBegin(MEM_PHASE_PUBLISH);
+      if (publishQueueService(scratch->topic, sizeof(scratch->topic)) > 0)
+      {
+        bootMark(BOOT_MARK_FIRST_PUBLISH);
+      }
+      memStatsPhaseEnd(MEM_PHASE_PUBLISH);
+      scratchRelease(SCRATCH_PUBLISH);
     }
+
+    // === BOOT TIMELINE: Once, retained on "<topic>/boot" ===
+    if (!boot_timeline_published && bootMarkTime(BOOT_MARK_FIRST_PUBLISH) != 0 &&
+        (scratch = scratchAcquire<PublishScratch>(SCRATCH_PUBLISH)) != NULL)
+    {
+      if (formatBootTimelineJSON(scratch->payload, sizeof(scratch->payload)) &&
+          publishQueuePush(PUBLISH_STATS, "boot", scratch->payload, PUBLISH_RETAIN))
+      {
+        boot_timeline_published = true;
+      }
+      scratchRelease(SCRATCH_PUBLISH);
+    }
+  }
+
+  if (config_fetched)
+  {
     return;  // Skip remaining config discovery code
   }
 
   // === IF NO CONFIG YET: DISCOVER AND FETCH ===
 
   // === STEP 1: Send periodic mDNS queries ===
-  if (now - lastQueryTime >= CONFIG_QUERY_INTERVAL_MS)
+  if (query_now || now - lastQueryTime >= settingGet<SETTING_QUERY_INTERVAL_MS>())
   {
     lastQueryTime = now;
-    sendMDNSQuery();
+    query_now = !sendMDNSQuery();
+    if (query_now)
+    {
+      DEBUG_PRINTLN(F("⚠ mDNS query failed, retrying next pass"));
+    }
+    else
+    {
+      bootMark(BOOT_MARK_QUERY);
+    }
   }
 
   // === STEP 2: Listen for mDNS responses ===
-  WiFiUDP& udp = getUDPSocket();
+  UDP& udp = getUDPSocket();
   int packetSize = udp.parsePacket();
   if (packetSize > 0)
   {
+    const DiscoveredConfig* discovered = getDiscoveredConfig();
+    bool was_valid = discovered && discovered->valid;
+
+    memStatsPhaseBegin(MEM_PHASE_DISCOVERY);
     handleMDNSResponse(packetSize);
+    memStatsPhaseEnd(MEM_PHASE_DISCOVERY);
+
+    discovered = getDiscoveredConfig();
+    if (!was_valid && discovered && discovered->valid)
+    {
+      fetch_now = true;
+      bootMark(BOOT_MARK_DISCOVERED);
+    }
   }
 
   // === STEP 3: Fetch config from discovered server ===
-  // (Waits CONFIG_FETCH_RETRY_INTERVAL before first attempt to allow mDNS discovery)
+  // (right after discovery; the fetch_retry_ms setting spaces out retries)
 
-  if (now - last_config_fetch_attempt >= CONFIG_FETCH_RETRY_INTERVAL)
+  if (fetch_now || now - last_config_fetch_attempt >= settingGet<SETTING_FETCH_RETRY_MS>())
   {
     last_config_fetch_attempt = now;
+    fetch_now = false;
 
     const DiscoveredConfig* discovered = getDiscoveredConfig();
     if (discovered && discovered->valid)
@@ -323,18 +709,44 @@ void loop(void)
       DEBUG_PRINT(F(":"));
       DEBUG_PRINTLN(discovered->port);
 
-      // Fetch configuration from server
-      ConfigResponse response = fetchConfigFromServer(
-          discovered->ipStr,
-          discovered->port,
-          &device
-      );
+      deviceStateSet(DEVICE_FETCHING, now);
+
+      // Fetch configuration from server (buffers borrowed from the arena)
+      memStatsPhaseBegin(MEM_PHASE_CONFIG_FETCH);
+      ConfigFetchScratch* scratch = scratchAcquire<ConfigFetchScratch>(SCRATCH_CONFIG_FETCH);
+
+      watchdogArm(WATCHDOG_TASK_CONFIG_FETCH);
+      bool fetched = fetchConfigFromServer(discovered->ipStr, discovered->port, &device, scratch);
+      watchdogDisarm(WATCHDOG_TASK_CONFIG_FETCH);
+
+      // Parse into a candidate (in the arena for this pass only): the
+      // running config is replaced only by one that passes validation
+      ConfigReject verdict = fetched ? parseConfigJSON(scratch, &scratch->candidate) : CONFIG_ACCEPTED;
 
-      if (response.success)
+      if (fetched && verdict != CONFIG_ACCEPTED && !config_applied)
       {
-        // Parse the JSON configuration
-        mqtt_config = parseConfigJSON(response.config_json);
+        // Nothing good to fall back to: ask again later (not a server
+        // failure, so no rediscovery; the reason goes with the next request)
+        DEBUG_PRINTLN(F("✗ Configuration rejected, retrying"));
+        scratchRelease(SCRATCH_CONFIG_FETCH);
+        memStatsPhaseEnd(MEM_PHASE_CONFIG_FETCH);
+      }
+      else if (fetched)
+      {
+        if (verdict == CONFIG_ACCEPTED)
+        {
+          mqtt_config = scratch->candidate;
+        }
+        else
+        {
+          DEBUG_PRINTLN(F("⚠ Configuration rejected, keeping the last good one"));
+        }
         config_fetched = true;
+        bootMark(BOOT_MARK_CONFIG);
+        config_applied = true;
+        deviceStateSet(DEVICE_PUBLISHING, now);  // DEGRADED if the transport does not come up
+        scratchRelease(SCRATCH_CONFIG_FETCH);
+        memStatsPhaseEnd(MEM_PHASE_CONFIG_FETCH);
 
         DEBUG_PRINTLN(F(""));
         DEBUG_PRINTLN(F("=== CONFIGURATION SUCCESSFULLY RETRIEVED ==="));
@@ -342,8 +754,13 @@ void loop(void)
         DEBUG_PRINTLN(mqtt_config.mqtt_broker);
         DEBUG_PRINT(F("MQTT Port: "));
         DEBUG_PRINTLN(mqtt_config.mqtt_port);
+        DEBUG_PRINT(F("MQTT Fallback Brokers: "));
+        DEBUG_PRINTLN(mqtt_config.broker_count > 0 ? mqtt_config.broker_count - 1 : 0);
         DEBUG_PRINT(F("MQTT Topic: "));
-        DEBUG_PRINTLN(mqtt_config.mqtt_topic);
+        DEBUG_PRINT(mqtt_config.mqtt_topic);
+        DEBUG_PRINTLN(mqtt_config.topic_layout == TOPIC_LAYOUT_COMBINED ? F("") :
+                      mqtt_config.topic_layout == TOPIC_LAYOUT_BOTH ? F(" (+ per-sensor subtopics)") :
+                      F("/<sensor> (per-sensor)"));
         DEBUG_PRINT(F("Poll Interval: "));
         DEBUG_PRINT(mqtt_config.poll_frequency_sec);
         DEBUG_PRINTLN(F(" seconds"));
@@ -352,6 +769,43 @@ void loop(void)
         DEBUG_PRINTLN(F(" seconds"));
         DEBUG_PRINTLN(F(""));
 
+        // Setting overrides from the server (keys it dropped go back to
+        // their defaults)
+        settingsApply(mqtt_config.settings, mqtt_config.settings_count, SETTING_SOURCE_SERVER);
+
+#if CONFIG_COAP_ENABLED
+        // Observers get at least one notification per heartbeat
+        coapServerSetMaxAge(mqtt_config.heartbeat_frequency_sec + mqtt_config.poll_frequency_sec);
+#endif
+
+#if CONFIG_LOG_ENABLED
+        // Remote logging: runtime level and syslog target from config
+        // (no host given = stream to the config server found via mDNS).
+        // Left out of the config: back to the default, syslog stopped
+        logSetLevel(mqtt_config.log_level >= 0 ? (LogLevel)mqtt_config.log_level
+                                               : (LogLevel)CONFIG_LOG_DEFAULT_LEVEL);
+        if (mqtt_config.syslog_port > 0)
+        {
+          syslogBegin(mqtt_config.syslog_host[0] ? mqtt_config.syslog_host : discovered->ipStr,
+                      mqtt_config.syslog_port, device.device_id);
+        }
+        else
+        {
+          syslogEnd();
+        }
+#endif
+
+#if CONFIG_OTA_ENABLED
+        // Firmware offer: downloaded in the background while publishing
+        otaOffer(&mqtt_config.firmware, discovered->ipStr, discovered->port, now);
+#endif
+
+        // UDP telemetry without a receiver host goes to the config server
+        if (mqtt_config.transport == TRANSPORT_UDP && mqtt_config.udp_host[0] == '\0')
+        {
+          strlcpy(mqtt_config.udp_host, discovered->ipStr, sizeof(mqtt_config.udp_host));
+        }
+
         // Initialize MQTT connection
         MQTTStatus init_status = initMQTT(&mqtt_config);
         if (init_status != MQTT_ERROR)
@@ -368,7 +822,17 @@ void loop(void)
       else
       {
         DEBUG_PRINT(F("✗ Failed to fetch config: "));
-        DEBUG_PRINTLN(response.error_msg);
+        DEBUG_PRINTLN(scratch ? scratch->response.error_msg : "scratch arena busy");
+        scratchRelease(SCRATCH_CONFIG_FETCH);
+        memStatsPhaseEnd(MEM_PHASE_CONFIG_FETCH);
+
+        // Server keeps failing: wait for a fresh mDNS answer
+        if (deviceStateFetchFailed(now))
+        {
+          DEBUG_PRINTLN(F("⚠ Config server not answering - rediscovering"));
+          clearDiscoveredConfig();
+          query_now = true;
+        }
       }
     }
     else
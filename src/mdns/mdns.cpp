@@ -10,6 +10,8 @@
 #include "mdns/packet.h"
 #include "mdns/network.h"
 #include "arduino_configs.h"
+#include "log/log.h"
+#include "mem/scratch.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -20,6 +22,20 @@ static char lastRequestedService[CONFIG_SERVICE_NAME_MAX_LEN] = {0};
 static DiscoveredConfig discoveredConfig = {{0}, 0, {0}, {0}, 0, {0}, false};
 static IPAddress mdnsMulticastIP(224, 0, 0, 251);
 
+/**
+ * Discovery Scratch Layout
+ * Name and URL buffers used while parsing one response, borrowed from the
+ * scratch arena (SCRATCH_DISCOVERY) instead of the stack
+ */
+typedef struct {
+  char responseName[CONFIG_SERVICE_NAME_MAX_LEN];
+  char recordName[CONFIG_HOSTNAME_MAX_LEN];
+  char txtString[128];
+  char configURL[CONFIG_URL_MAX_LEN];
+} DiscoveryScratch;
+
+static DiscoveryScratch *scratch = NULL;   // Valid during handleMDNSResponse()
+
 // ============================================================================
 // HELPER FUNCTIONS
 // ============================================================================
@@ -33,12 +49,13 @@ static bool validateResponseService(const byte *packet, int packetSize)
     return false;
   }
 
-  char responseName[CONFIG_SERVICE_NAME_MAX_LEN];
+  char *responseName = scratch->responseName;
+  const uint16_t responseNameLen = sizeof(scratch->responseName);
   uint16_t pos = 12;
   uint16_t namePos = 0;
 
   // Decode domain name from response
-  while (pos < packetSize && namePos < sizeof(responseName) - 1) {
+  while (pos < packetSize && namePos < responseNameLen - 1) {
     byte len = packet[pos++];
 
     if (len == 0x00) {
@@ -56,7 +73,7 @@ static bool validateResponseService(const byte *packet, int packetSize)
       responseName[namePos++] = '.';
     }
 
-    for (uint16_t i = 0; i < len && pos < packetSize && namePos < sizeof(responseName) - 1; i++) {
+    for (uint16_t i = 0; i < len && pos < packetSize && namePos < responseNameLen - 1; i++) {
       responseName[namePos++] = packet[pos++];
     }
   }
@@ -88,16 +105,13 @@ static bool parseSRVRecord(const byte *packet, int packetSize, uint16_t dataOffs
   port = ((uint16_t)packet[pos] << 8) | packet[pos + 1];
   pos += 2;
 
-  DEBUG_PRINTF(F("  ✓ Port from SRV: "), port);
-
   uint16_t nextPos;
   if (!decodeDNSName(packet, packetSize, pos, hostname, hostMaxLen, nextPos)) {
     DEBUG_PRINTLN(F("✗ Failed to decode SRV target hostname"));
     return false;
   }
 
-  DEBUG_PRINT(F("  ✓ Hostname from SRV: "));
-  DEBUG_PRINTLN(hostname);
+  LOG_EVENT(LOG_MDNS_SRV, port, strlen(hostname));
 
   return true;
 }
@@ -123,10 +137,10 @@ static bool parseTXTRecord(const byte *packet, uint16_t dataOffset, uint16_t dat
 
     if (strLen == 0) break;
 
-    char txtString[128];
+    char *txtString = scratch->txtString;
     uint16_t strPos = 0;
 
-    for (byte i = 0; i < strLen && pos < endPos && strPos < sizeof(txtString) - 1; i++) {
+    for (byte i = 0; i < strLen && pos < endPos && strPos < sizeof(scratch->txtString) - 1; i++) {
       txtString[strPos++] = packet[pos++];
     }
     txtString[strPos] = '\0';
@@ -134,19 +148,17 @@ static bool parseTXTRecord(const byte *packet, uint16_t dataOffset, uint16_t dat
     if (strncmp(txtString, "path=", 5) == 0) {
       strncpy(path, &txtString[5], pathMaxLen - 1);
       path[pathMaxLen - 1] = '\0';
-      DEBUG_PRINT(F("  ✓ Path from TXT: "));
-      DEBUG_PRINTLN(path);
       foundPath = true;
     }
 
     if (strncmp(txtString, "version=", 8) == 0) {
       strncpy(version, &txtString[8], versionMaxLen - 1);
       version[versionMaxLen - 1] = '\0';
-      DEBUG_PRINT(F("  ✓ Version from TXT: "));
-      DEBUG_PRINTLN(version);
     }
   }
 
+  LOG_EVENT(LOG_MDNS_TXT, strlen(path), strlen(version));
+
   return foundPath;
 }
 
@@ -167,8 +179,7 @@ static bool parseARecord(const byte *packet, uint16_t dataOffset,
            packet[dataOffset + 2],
            packet[dataOffset + 3]);
 
-  DEBUG_PRINT(F("  ✓ IP from A record: "));
-  DEBUG_PRINTLN(ipStr);
+  LOG_EVENT(LOG_MDNS_A, ipAddress);
 
   return true;
 }
@@ -184,9 +195,8 @@ static bool parseAnswerRecords(const byte *packet, int packetSize, uint16_t ques
 
   while (recordsProcessed < ancount && pos < packetSize) {
     uint16_t nameEnd;
-    char recordName[CONFIG_HOSTNAME_MAX_LEN];
-
-    if (!decodeDNSName(packet, packetSize, pos, recordName, sizeof(recordName), nameEnd)) {
+    if (!decodeDNSName(packet, packetSize, pos, scratch->recordName,
+                       sizeof(scratch->recordName), nameEnd)) {
       DEBUG_PRINTLN(F("✗ Failed to decode record name"));
       return false;
     }
@@ -207,16 +217,7 @@ static bool parseAnswerRecords(const byte *packet, int packetSize, uint16_t ques
 
     pos += 10;
 
-    DEBUG_PRINT(F("\n  Record: "));
-    DEBUG_PRINT(recordName);
-    DEBUG_PRINT(F(" Type="));
-    DEBUG_PRINT(recordType);
-    DEBUG_PRINT(F(" Class="));
-    DEBUG_PRINT(recordClass);
-    DEBUG_PRINT(F(" TTL="));
-    DEBUG_PRINT(ttl);
-    DEBUG_PRINT(F(" Length="));
-    DEBUG_PRINTLN(dataLength);
+    LOG_EVENT(LOG_MDNS_RECORD, recordType, recordClass, ttl, dataLength);
 
     if (pos + dataLength > packetSize) {
       DEBUG_PRINTLN(F("✗ Record data extends beyond packet"));
@@ -225,20 +226,17 @@ static bool parseAnswerRecords(const byte *packet, int packetSize, uint16_t ques
 
     // Parse based on record type
     if (recordType == 33) {  // SRV record
-      DEBUG_PRINTLN(F("  → Parsing SRV record"));
       parseSRVRecord(packet, packetSize, pos, dataLength,
                      config.hostname, sizeof(config.hostname),
                      config.port);
     }
     else if (recordType == 16) {  // TXT record
-      DEBUG_PRINTLN(F("  → Parsing TXT record"));
       parseTXTRecord(packet, pos, dataLength,
                      config.path, sizeof(config.path),
                      config.version, sizeof(config.version));
     }
     else if (recordType == 1) {  // A record
       if (dataLength == 4) {
-        DEBUG_PRINTLN(F("  → Parsing A record"));
         parseARecord(packet, pos, config.ipAddress,
                     config.ipStr, sizeof(config.ipStr));
       }
@@ -255,7 +253,8 @@ static bool parseAnswerRecords(const byte *packet, int packetSize, uint16_t ques
     return true;
   }
 
-  DEBUG_PRINTLN(F("\n⚠ Incomplete config (missing required fields)"));
+  LOG_EVENT(LOG_MDNS_INCOMPLETE, config.port,
+            config.path[0] != '\0', config.ipStr[0] != '\0');
   return false;
 }
 
@@ -283,6 +282,56 @@ static bool buildConfigURL(const DiscoveredConfig &config, char *url, uint16_t m
   return true;
 }
 
+/**
+ * Parse a response already read into the packet buffer
+ * Caller holds the discovery scratch arena
+ */
+static void parseResponse(const byte *packetBuffer, int bytesRead)
+{
+  if (!validateResponseService(packetBuffer, bytesRead)) {
+    return;
+  }
+
+  uint16_t flags = (packetBuffer[2] << 8) | packetBuffer[3];
+  uint16_t ancount = (packetBuffer[6] << 8) | packetBuffer[7];
+
+  if (!(flags & 0x8000)) {
+    DEBUG_PRINTLN(F("⚠ Received query, not response - ignoring"));
+    return;
+  }
+
+  if (ancount > 0) {
+    LOG_EVENT(LOG_MDNS_RESPONSE, bytesRead, ancount);
+
+    // Find end of question section
+    uint16_t questionPos = 12;
+    while (questionPos < bytesRead) {
+      byte len = packetBuffer[questionPos++];
+
+      if (len == 0x00) {
+        break;
+      }
+
+      if ((len & 0xC0) == 0xC0) {
+        questionPos++;
+        break;
+      }
+
+      questionPos += len;
+    }
+
+    questionPos += 4;  // Skip QTYPE and QCLASS
+
+    if (questionPos < bytesRead) {
+      if (parseAnswerRecords(packetBuffer, bytesRead, questionPos, ancount, discoveredConfig)) {
+        buildConfigURL(discoveredConfig, scratch->configURL, sizeof(scratch->configURL));
+      }
+    } else {
+      DEBUG_PRINTLN(F("⚠ Question section extends beyond packet"));
+    }
+  }
+}
+
 // ============================================================================
 // PUBLIC FUNCTIONS
 // ============================================================================
@@ -302,7 +351,7 @@ bool sendMDNSQuery(void)
     return false;
   }
 
-  WiFiUDP& udp = getUDPSocket();
+  UDP& udp = getUDPSocket();
   udp.beginPacket(mdnsMulticastIP, CONFIG_MDNS_PORT);
   udp.write(packetBuffer, querySize);
   if (!udp.endPacket()) {
@@ -310,8 +359,7 @@ bool sendMDNSQuery(void)
     return false;
   }
 
-  DEBUG_PRINT(F("✓ Sent mDNS query for: "));
-  DEBUG_PRINTLN(serviceName);
+  LOG_EVENT(LOG_MDNS_QUERY_SENT, querySize);
 
   strncpy(lastRequestedService, serviceName, sizeof(lastRequestedService) - 1);
   lastRequestedService[sizeof(lastRequestedService) - 1] = '\0';
@@ -327,7 +375,7 @@ void handleMDNSResponse(int packetSize)
   }
 
   byte *packetBuffer = getPacketBuffer();
-  WiFiUDP& udp = getUDPSocket();
+  UDP& udp = getUDPSocket();
 
   int bytesRead = udp.read(packetBuffer, getPacketBufferSize());
   if (bytesRead < 12) {
@@ -335,54 +383,23 @@ void handleMDNSResponse(int packetSize)
     return;
   }
 
-  if (!validateResponseService(packetBuffer, bytesRead)) {
+  scratch = scratchAcquire<DiscoveryScratch>(SCRATCH_DISCOVERY);
+  if (!scratch) {
     return;
   }
 
-  uint16_t flags = (packetBuffer[2] << 8) | packetBuffer[3];
-  uint16_t ancount = (packetBuffer[6] << 8) | packetBuffer[7];
-
-  if (!(flags & 0x8000)) {
-    DEBUG_PRINTLN(F("⚠ Received query, not response - ignoring"));
-    return;
-  }
-
-  if (ancount > 0) {
-    DEBUG_PRINT(F("✓ mDNS Response received with "));
-    DEBUG_PRINT(ancount);
-    DEBUG_PRINTLN(F(" answer records"));
-
-    // Find end of question section
-    uint16_t questionPos = 12;
-    while (questionPos < bytesRead) {
-      byte len = packetBuffer[questionPos++];
-
-      if (len == 0x00) {
-        break;
-      }
-
-      if ((len & 0xC0) == 0xC0) {
-        questionPos++;
-        break;
-      }
-
-      questionPos += len;
-    }
+  parseResponse(packetBuffer, bytesRead);
 
-    questionPos += 4;  // Skip QTYPE and QCLASS
-
-    if (questionPos < bytesRead) {
-      if (parseAnswerRecords(packetBuffer, bytesRead, questionPos, ancount, discoveredConfig)) {
-        char configURL[CONFIG_URL_MAX_LEN];
-        buildConfigURL(discoveredConfig, configURL, sizeof(configURL));
-      }
-    } else {
-      DEBUG_PRINTLN(F("⚠ Question section extends beyond packet"));
-    }
-  }
+  scratch = NULL;
+  scratchRelease(SCRATCH_DISCOVERY);
 }
 
 const DiscoveredConfig* getDiscoveredConfig(void)
 {
   return &discoveredConfig;
 }
+
+void clearDiscoveredConfig(void)
+{
+  memset(&discoveredConfig, 0, sizeof(discoveredConfig));
+}
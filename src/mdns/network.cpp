@@ -8,16 +8,20 @@
 #include <Arduino.h>
 #include "mdns/network.h"
 #include "arduino_configs.h"
-#include "arduino_secrets.h"
 
 #include <WiFiNINA.h>
 
-// Global WiFi credentials (from arduino_secrets.h)
-char ssid[] = SECRET_SSID;
-char pass[] = SECRET_PASS;
+#if CONFIG_NETFAULT_ENABLED
+#include "netfault/netfault.h"
+#endif
 
 // Global UDP socket for mDNS communication
 static WiFiUDP udpSocket;
+static bool socketBound = false;
+
+#if CONFIG_NETFAULT_ENABLED
+static NetFaultUDP faultyUdpSocket(udpSocket);
+#endif
 
 // mDNS multicast address (224.0.0.251)
 static IPAddress mdnsMulticastIP(224, 0, 0, 251);
@@ -26,32 +30,6 @@ static IPAddress mdnsMulticastIP(224, 0, 0, 251);
 // PUBLIC FUNCTIONS
 // ============================================================================
 
-bool connectToWiFi(void)
-{
-  DEBUG_PRINT(F("Connecting to WiFi: "));
-  DEBUG_PRINTLN(ssid);
-
-  WiFi.begin(ssid, pass);
-
-  const uint32_t START_TIME = millis();
-
-  while (WiFi.status() != WL_CONNECTED) {
-    // Check for timeout
-    if (millis() - START_TIME > CONFIG_WIFI_TIMEOUT_MS) {
-      DEBUG_PRINTLN(F("\n✗ WiFi connection timeout!"));
-      return false;
-    }
-
-    nonBlockingDelay(250);  // Non-blocking wait with yield
-    DEBUG_PRINT(F("."));
-  }
-
-  DEBUG_PRINTLN(F(""));
-  DEBUG_PRINT(F("✓ WiFi connected! IP: "));
-  DEBUG_PRINTLN(WiFi.localIP());
-  return true;
-}
-
 bool initMDNS(void)
 {
   DEBUG_PRINT(F("Initializing mDNS on port "));
@@ -60,16 +38,40 @@ bool initMDNS(void)
   // Begin listening on mDNS port
   if (!udpSocket.begin(CONFIG_LOCAL_UDP_PORT)) {
     DEBUG_PRINTLN(F("✗ Failed to bind UDP socket!"));
+    socketBound = false;
     return false;
   }
 
+  socketBound = true;
   DEBUG_PRINTLN(F("✓ mDNS initialized, listening for responses..."));
   return true;
 }
 
-WiFiUDP& getUDPSocket(void)
+void mdnsSocketOnLinkChange(bool up)
+{
+  // NINA drops its sockets with the link: rebind on every link up
+  if (socketBound) {
+    udpSocket.stop();
+    socketBound = false;
+  }
+
+  if (up) {
+    initMDNS();
+  }
+}
+
+bool isMDNSSocketBound(void)
+{
+  return socketBound;
+}
+
+UDP& getUDPSocket(void)
 {
+#if CONFIG_NETFAULT_ENABLED
+  return faultyUdpSocket;
+#else
   return udpSocket;
+#endif
 }
 
 IPAddress getMDNSMulticastIP(void)
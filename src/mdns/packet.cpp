@@ -8,6 +8,7 @@
 #include <Arduino.h>
 #include "mdns/packet.h"
 #include "arduino_configs.h"
+#include "log/log.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -139,8 +140,7 @@ uint16_t buildMDNSQuery(byte *packet, uint16_t maxLen, const char *serviceName)
   packet[pos++] = 0x00;
   packet[pos++] = CONFIG_DNS_CLASS_IN;
 
-  DEBUG_PRINTF(F("✓ Built query: "), pos);
-  DEBUG_PRINTLN(F(" bytes"));
+  LOG_EVENT(LOG_MDNS_QUERY_BUILT, pos);
 
   return pos;
 }
@@ -0,0 +1,371 @@
+/**
+ * ============================================================================
+ * mDNS Responder - Implementation
+ * ============================================================================
+ * Announces one service and answers queries for it
+ */
+
+#include <Arduino.h>
+#include "mdns/responder.h"
+#include "mdns/packet.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+#include "mem/scratch.h"
+#include <WiFiNINA.h>
+#include <WiFiUdp.h>
+#include <string.h>
+#include <stdio.h>
+
+// ============================================================================
+// PROTOCOL CONSTANTS
+// ============================================================================
+static const uint16_t DNS_TYPE_A = 1;
+static const uint16_t DNS_TYPE_TXT = 16;
+static const uint16_t DNS_TYPE_SRV = 33;
+static const uint16_t DNS_TYPE_ANY = 255;
+static const uint16_t DNS_CLASS_FLUSH = 0x8001;    // IN + cache-flush (unique records)
+static const uint16_t DNS_FLAGS_RESPONSE = 0x8400; // QR + AA
+static const uint32_t LEGACY_TTL = 10;             // RFC 6762 section 6.7
+static const uint8_t ANNOUNCE_COUNT = 2;
+static const uint32_t ANNOUNCE_SPACING_MS = 1000;
+
+// ============================================================================
+// STATIC STATE
+// ============================================================================
+static WiFiUDP udp;
+static bool socketBound = false;
+static IPAddress mdnsMulticastIP(224, 0, 0, 251);
+
+static char serviceName[CONFIG_SERVICE_NAME_MAX_LEN] = {0};   // "_x._tcp.local"
+static char instanceLabel[CONFIG_MDNS_LABEL_MAX_LEN + 1] = {0};
+static char txtRecord[CONFIG_MDNS_TXT_MAX_LEN + 1] = {0};
+static uint16_t servicePort = 0;
+
+static uint8_t announcementsLeft = 0;
+static uint32_t nextAnnouncement = 0;
+
+/**
+ * Responder Scratch Layout
+ * Query names while a query is matched, borrowed from the scratch arena
+ * (SCRATCH_DISCOVERY)
+ */
+typedef struct {
+  char queryName[CONFIG_HOSTNAME_MAX_LEN];
+  char ownName[CONFIG_HOSTNAME_MAX_LEN];
+} ResponderScratch;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void put16(byte *packet, uint16_t &pos, uint16_t value)
+{
+  packet[pos++] = value >> 8;
+  packet[pos++] = value & 0xFF;
+}
+
+static void put32(byte *packet, uint16_t &pos, uint32_t value)
+{
+  put16(packet, pos, value >> 16);
+  put16(packet, pos, value & 0xFFFF);
+}
+
+/**
+ * Write one label followed by a compression pointer
+ */
+static void putLabel(byte *packet, uint16_t &pos, const char *label, uint16_t pointer)
+{
+  uint8_t len = strlen(label);
+  packet[pos++] = len;
+  memcpy(&packet[pos], label, len);
+  pos += len;
+  put16(packet, pos, 0xC000 | pointer);
+}
+
+/**
+ * Write a record header (name already written); returns the RDLENGTH
+ * position to fill in once the data is written
+ */
+static uint16_t putRecordHeader(byte *packet, uint16_t &pos, uint16_t type, uint16_t rrclass,
+                                uint32_t ttl)
+{
+  put16(packet, pos, type);
+  put16(packet, pos, rrclass);
+  put32(packet, pos, ttl);
+  uint16_t rdlength = pos;
+  pos += 2;
+  return rdlength;
+}
+
+static void endRecord(byte *packet, uint16_t pos, uint16_t rdlength)
+{
+  uint16_t len = pos - rdlength - 2;
+  packet[rdlength] = len >> 8;
+  packet[rdlength + 1] = len & 0xFF;
+}
+
+/**
+ * Offset of the last label ("local") of an encoded name
+ */
+static uint16_t lastLabelOffset(const byte *packet, uint16_t offset)
+{
+  uint16_t last = offset;
+  while (packet[offset] != 0) {
+    last = offset;
+    offset += packet[offset] + 1;
+  }
+  return last;
+}
+
+/**
+ * Build the PTR/SRV/TXT/A answer set
+ *
+ * PARAMETERS:
+ *   packet      - Output buffer (getPacketBuffer())
+ *   maxLen      - Buffer size
+ *   id          - Transaction ID (0 for multicast)
+ *   question    - Question to echo (legacy unicast), or NULL
+ *   questionLen - Bytes in question
+ *   ttl         - Record TTL in seconds
+ *
+ * RETURNS:
+ *   Packet size (0 if it doesn't fit)
+ */
+static uint16_t buildAnswer(byte *packet, uint16_t maxLen, uint16_t id,
+                            const byte *question, uint16_t questionLen, uint32_t ttl)
+{
+  // Worst case: names + 4 record headers + SRV/A data + TXT
+  uint16_t need = 12 + questionLen + strlen(serviceName) + 2 +
+                  2 * (strlen(instanceLabel) + 3) + 4 * 10 + 6 + 4 + strlen(txtRecord) + 1 + 6;
+  if (need > maxLen) {
+    DEBUG_PRINTLN(F("✗ mDNS answer does not fit the packet buffer"));
+    return 0;
+  }
+
+  uint16_t pos = 0;
+  put16(packet, pos, id);
+  put16(packet, pos, DNS_FLAGS_RESPONSE);
+  put16(packet, pos, question ? 1 : 0);   // QDCOUNT
+  put16(packet, pos, 4);                  // ANCOUNT
+  put16(packet, pos, 0);                  // NSCOUNT
+  put16(packet, pos, 0);                  // ARCOUNT
+
+  if (question) {
+    memcpy(&packet[pos], question, questionLen);
+    pos += questionLen;
+  }
+
+  // PTR: service -> instance (shared record, no cache-flush)
+  uint16_t serviceOffset = pos;
+  uint16_t nameLen = encodeDomainName(serviceName, &packet[pos], maxLen - pos);
+  if (nameLen == 0) {
+    return 0;
+  }
+  pos += nameLen;
+  uint16_t localOffset = lastLabelOffset(packet, serviceOffset);
+
+  uint16_t rdlength = putRecordHeader(packet, pos, CONFIG_DNS_TYPE_PTR, CONFIG_DNS_CLASS_IN, ttl);
+  uint16_t instanceOffset = pos;
+  putLabel(packet, pos, instanceLabel, serviceOffset);
+  endRecord(packet, pos, rdlength);
+
+  // SRV: instance -> host:port
+  put16(packet, pos, 0xC000 | instanceOffset);
+  rdlength = putRecordHeader(packet, pos, DNS_TYPE_SRV, DNS_CLASS_FLUSH, ttl);
+  put16(packet, pos, 0);             // Priority
+  put16(packet, pos, 0);             // Weight
+  put16(packet, pos, servicePort);
+  uint16_t hostOffset = pos;
+  putLabel(packet, pos, instanceLabel, localOffset);
+  endRecord(packet, pos, rdlength);
+
+  // TXT
+  put16(packet, pos, 0xC000 | instanceOffset);
+  rdlength = putRecordHeader(packet, pos, DNS_TYPE_TXT, DNS_CLASS_FLUSH, ttl);
+  uint8_t txtLen = strlen(txtRecord);
+  packet[pos++] = txtLen;            // Empty TXT is a single zero byte
+  memcpy(&packet[pos], txtRecord, txtLen);
+  pos += txtLen;
+  endRecord(packet, pos, rdlength);
+
+  // A: host -> IP
+  IPAddress ip = WiFi.localIP();
+  put16(packet, pos, 0xC000 | hostOffset);
+  rdlength = putRecordHeader(packet, pos, DNS_TYPE_A, DNS_CLASS_FLUSH, ttl);
+  for (uint8_t i = 0; i < 4; i++) {
+    packet[pos++] = ip[i];
+  }
+  endRecord(packet, pos, rdlength);
+
+  return pos;
+}
+
+static bool sendAnswer(IPAddress ip, uint16_t port, uint16_t len)
+{
+  udp.beginPacket(ip, port);
+  udp.write(getPacketBuffer(), len);
+  return udp.endPacket();
+}
+
+/**
+ * Does a question ask for one of our records?
+ */
+static bool questionMatches(ResponderScratch *s, uint16_t qtype)
+{
+  // Service type: PTR
+  if ((qtype == CONFIG_DNS_TYPE_PTR || qtype == DNS_TYPE_ANY) &&
+      strcasecmp(s->queryName, serviceName) == 0) {
+    return true;
+  }
+
+  // Instance: SRV / TXT
+  snprintf(s->ownName, sizeof(s->ownName), "%s.%s", instanceLabel, serviceName);
+  if ((qtype == DNS_TYPE_SRV || qtype == DNS_TYPE_TXT || qtype == DNS_TYPE_ANY) &&
+      strcasecmp(s->queryName, s->ownName) == 0) {
+    return true;
+  }
+
+  // Host: A
+  snprintf(s->ownName, sizeof(s->ownName), "%s.%s", instanceLabel, CONFIG_MDNS_DOMAIN);
+  return (qtype == DNS_TYPE_A || qtype == DNS_TYPE_ANY) &&
+         strcasecmp(s->queryName, s->ownName) == 0;
+}
+
+/**
+ * Handle one received datagram
+ */
+static void handleQuery(int packetSize)
+{
+  byte *packet = getPacketBuffer();
+  int bytesRead = udp.read(packet, getPacketBufferSize());
+  if (bytesRead < 12 || bytesRead != packetSize) {
+    return;  // Short, or larger than the buffer (not a query for us)
+  }
+
+  uint16_t id = (packet[0] << 8) | packet[1];
+  uint16_t flags = (packet[2] << 8) | packet[3];
+  uint16_t qdcount = (packet[4] << 8) | packet[5];
+  if ((flags & 0x8000) || qdcount == 0) {
+    return;  // Responses (including our own announcements)
+  }
+
+  ResponderScratch *s = scratchAcquire<ResponderScratch>(SCRATCH_DISCOVERY);
+  if (!s) {
+    return;
+  }
+
+  bool match = false;
+  uint16_t pos = 12;
+  uint16_t firstQuestionEnd = 0;
+  for (uint16_t q = 0; q < qdcount && !match; q++) {
+    uint16_t next;
+    if (!decodeDNSName(packet, bytesRead, pos, s->queryName, sizeof(s->queryName), next) ||
+        next + 4 > bytesRead) {
+      break;
+    }
+    uint16_t qtype = (packet[next] << 8) | packet[next + 1];
+    pos = next + 4;
+    if (q == 0) {
+      firstQuestionEnd = pos;
+    }
+    match = questionMatches(s, qtype);
+  }
+  scratchRelease(SCRATCH_DISCOVERY);
+
+  if (!match) {
+    return;
+  }
+
+  IPAddress remoteIP = udp.remoteIP();
+  uint16_t remotePort = udp.remotePort();
+
+  if (remotePort == CONFIG_MDNS_PORT) {
+    // Regular mDNS querier: multicast answer
+    uint16_t len = buildAnswer(packet, getPacketBufferSize(), 0, NULL, 0, CONFIG_MDNS_RESPONDER_TTL);
+    if (len > 0) {
+      sendAnswer(mdnsMulticastIP, CONFIG_MDNS_PORT, len);
+    }
+    return;
+  }
+
+  // Legacy one-shot resolver: unicast, same ID, first question echoed.
+  // The question is moved out of the way of the answer being built.
+  byte question[64];
+  uint16_t questionLen = firstQuestionEnd - 12;
+  if (questionLen > sizeof(question)) {
+    return;
+  }
+  memcpy(question, &packet[12], questionLen);
+
+  uint16_t len = buildAnswer(packet, getPacketBufferSize(), id, question, questionLen, LEGACY_TTL);
+  if (len > 0) {
+    sendAnswer(remoteIP, remotePort, len);
+  }
+}
+
+// ============================================================================
+// PUBLIC FUNCTIONS
+// ============================================================================
+
+bool mdnsResponderBegin(const char *service, const char *instance, uint16_t port, const char *txt)
+{
+  if (!service || !instance) {
+    return false;
+  }
+
+  int len = snprintf(serviceName, sizeof(serviceName), "%s.%s", service, CONFIG_MDNS_DOMAIN);
+  if (len < 0 || len >= (int)sizeof(serviceName)) {
+    DEBUG_PRINTLN(F("✗ mDNS service name too long"));
+    serviceName[0] = '\0';
+    return false;
+  }
+
+  strlcpy(instanceLabel, instance, sizeof(instanceLabel));
+  strlcpy(txtRecord, txt ? txt : "", sizeof(txtRecord));
+  servicePort = port;
+  return true;
+}
+
+void mdnsResponderOnLinkChange(bool up)
+{
+  if (socketBound) {
+    udp.stop();
+    socketBound = false;
+  }
+
+  if (!up || serviceName[0] == '\0') {
+    return;
+  }
+
+  socketBound = udp.beginMulticast(mdnsMulticastIP, CONFIG_MDNS_PORT);
+  if (!socketBound) {
+    DEBUG_PRINTLN(F("✗ mDNS responder socket bind failed"));
+    return;
+  }
+
+  // Announce on the next poll, then once more (RFC 6762 section 8.3)
+  announcementsLeft = ANNOUNCE_COUNT;
+  nextAnnouncement = millis();
+}
+
+void mdnsResponderPoll(void)
+{
+  if (!socketBound) {
+    return;
+  }
+
+  if (announcementsLeft > 0 && (int32_t)(millis() - nextAnnouncement) >= 0) {
+    uint16_t len = buildAnswer(getPacketBuffer(), getPacketBufferSize(), 0, NULL, 0,
+                               CONFIG_MDNS_RESPONDER_TTL);
+    if (len > 0 && sendAnswer(mdnsMulticastIP, CONFIG_MDNS_PORT, len)) {
+      LOG_EVENT(LOG_MDNS_ANNOUNCED, servicePort, len);
+    }
+    announcementsLeft--;
+    nextAnnouncement = millis() + ANNOUNCE_SPACING_MS;
+  }
+
+  int packetSize = udp.parsePacket();
+  if (packetSize > 0) {
+    handleQuery(packetSize);
+  }
+}
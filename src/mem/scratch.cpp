@@ -0,0 +1,59 @@
+#include <Arduino.h>
+#include "mem/scratch.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// STATIC STATE - Arena storage and ownership
+// ============================================================================
+
+alignas(8) static uint8_t arena[CONFIG_SCRATCH_ARENA_SIZE];
+static ScratchPhase owner = SCRATCH_IDLE;
+static size_t high_water = 0;
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void* scratchAcquire(ScratchPhase phase, size_t size)
+{
+  if (phase == SCRATCH_IDLE || size > sizeof(arena))
+  {
+    return NULL;
+  }
+
+  if (owner != SCRATCH_IDLE)
+  {
+    DEBUG_PRINT(F("✗ Scratch arena overlap: phase "));
+    DEBUG_PRINT(phase);
+    DEBUG_PRINT(F(" while held by phase "));
+    DEBUG_PRINTLN(owner);
+    return NULL;
+  }
+
+  owner = phase;
+  if (size > high_water)
+  {
+    high_water = size;
+  }
+
+  memset(arena, 0, size);
+  return arena;
+}
+
+void scratchRelease(ScratchPhase phase)
+{
+  if (owner == phase)
+  {
+    owner = SCRATCH_IDLE;
+  }
+}
+
+ScratchPhase scratchOwner(void)
+{
+  return owner;
+}
+
+size_t scratchHighWater(void)
+{
+  return high_water;
+}
@@ -0,0 +1,444 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "metrics/metrics_server.h"
+#include "mqtt/mqtt_publish.h"
+#include "mqtt/publish_queue.h"
+#include "device_state/device_state.h"
+#include "diag/memstats.h"
+#include "wifi/wifi_supervisor.h"
+#include "rtc/rtc.h"
+#include "log/log.h"
+#include "arduino_configs.h"
+
+#if CONFIG_METRICS_ENABLED
+
+// ============================================================================
+// STATIC STATE - Listening socket, connection in progress, loop timing
+// ============================================================================
+
+/**
+ * Connection State
+ */
+typedef enum {
+  CONN_IDLE = 0,       // Waiting for a client
+  CONN_READING,        // Reading the request up to the blank line
+  CONN_WRITING         // Writing the response, one section per poll
+} ConnState;
+
+/**
+ * Response Sections (written in this order)
+ */
+typedef enum {
+  SECTION_HEADERS = 0,
+  SECTION_DEVICE,
+  SECTION_READINGS,
+  SECTION_RTC,
+  SECTION_PUBLISH,
+  SECTION_LOOP,
+  SECTION_MEMORY,
+  SECTION_DONE
+} Section;
+
+static WiFiServer server(CONFIG_METRICS_PORT);
+static bool listening = false;
+
+static WiFiClient client;
+static ConnState conn_state = CONN_IDLE;
+static uint8_t section = SECTION_HEADERS;
+static bool found = false;           // Request was GET /metrics
+static uint32_t accepted_at = 0;
+
+// Request line, then the last bytes seen (end-of-headers detection)
+static char request[CONFIG_METRICS_REQUEST_MAX_LEN];
+static uint8_t request_len = 0;
+static bool request_line_done = false;
+static uint8_t newlines = 0;         // Consecutive line ends ("\r" ignored)
+
+static const SensorReadings* latest = NULL;
+static MetricsServerStats stats = {0, 0, 0};
+
+// Loop timing (pass = time between two metricsLoopTick() calls)
+static uint32_t last_tick_us = 0;
+static uint32_t loop_passes = 0;
+static uint64_t loop_total_us = 0;
+static uint32_t loop_max_us = 0;     // Since the last scrape
+
+// ============================================================================
+// CHUNKED OUTPUT - Prints into a small buffer, flushed to the client when full
+// ============================================================================
+
+class ChunkWriter : public Print
+{
+public:
+  size_t write(uint8_t c) override
+  {
+    buffer[len++] = c;
+    if (len == sizeof(buffer))
+    {
+      send();
+    }
+    return 1;
+  }
+
+  using Print::write;
+
+  void send()
+  {
+    if (len > 0 && client.write(buffer, len) != len)
+    {
+      failed = true;
+    }
+    len = 0;
+  }
+
+  bool failed = false;
+
+private:
+  uint8_t buffer[CONFIG_METRICS_CHUNK_SIZE];
+  size_t len = 0;
+};
+
+static ChunkWriter out;
+
+// ============================================================================
+// HELPER FUNCTIONS - Exposition format
+// ============================================================================
+
+/**
+ * "# HELP" and "# TYPE" lines of a metric family
+ */
+static void family(const char* prefix, const char* name, const __FlashStringHelper* type,
+                   const __FlashStringHelper* help)
+{
+  out.print(F("# HELP "));
+  out.print(prefix);
+  out.print(name);
+  out.print(' ');
+  out.print(help);
+  out.print(F("\n# TYPE "));
+  out.print(prefix);
+  out.print(name);
+  out.print(' ');
+  out.print(type);
+  out.print('\n');
+}
+
+static void sample(const char* prefix, const char* name, uint32_t value)
+{
+  out.print(prefix);
+  out.print(name);
+  out.print(' ');
+  out.print(value);
+  out.print('\n');
+}
+
+static void metric(const char* name, const __FlashStringHelper* type,
+                   const __FlashStringHelper* help, uint32_t value)
+{
+  family("arduino_", name, type, help);
+  sample("arduino_", name, value);
+}
+
+/**
+ * Microseconds as seconds with 6 decimals (no float, no 64-bit print)
+ */
+static void printSeconds(uint64_t us)
+{
+  char fraction[8];
+  snprintf(fraction, sizeof(fraction), ".%06lu", (unsigned long)(us % 1000000));
+  out.print((unsigned long)(us / 1000000));
+  out.print(fraction);
+}
+
+// ============================================================================
+// HELPER FUNCTIONS - Sections
+// ============================================================================
+
+static void writeHeaders(void)
+{
+  if (found)
+  {
+    out.print(F("HTTP/1.0 200 OK\r\n"
+                "Content-Type: text/plain; version=0.0.4\r\n"
+                "Connection: close\r\n\r\n"));
+  }
+  else
+  {
+    out.print(F("HTTP/1.0 404 Not Found\r\n"
+                "Content-Type: text/plain\r\n"
+                "Connection: close\r\n\r\n"
+                "Only GET /metrics is served\n"));
+  }
+}
+
+static void writeDevice(void)
+{
+  metric("uptime_seconds", F("counter"), F("Time since boot"), millis() / 1000);
+
+  family("arduino_", "device_state", F("gauge"), F("Top-level state (1 = current)"));
+  DeviceState current = deviceStateGet();
+  for (uint8_t i = 0; i < DEVICE_STATE_COUNT; i++)
+  {
+    out.print(F("arduino_device_state{state=\""));
+    out.print(deviceStateName((DeviceState)i));
+    out.print(F("\"} "));
+    out.print(i == current ? 1 : 0);
+    out.print('\n');
+  }
+
+  metric("wifi_reconnects_total", F("counter"), F("WiFi link recoveries"),
+         wifiGetStats()->reconnects);
+  family("arduino_", "wifi_rssi_dbm", F("gauge"), F("Signal strength"));
+  out.print(F("arduino_wifi_rssi_dbm "));
+  out.print((long)WiFi.RSSI());
+  out.print('\n');
+}
+
+static void writeReadings(void)
+{
+  if (!latest || !latest->valid)
+  {
+    return;  // No sample yet: absent, not zero
+  }
+
+  // Same names as the JSON keys; invalid sensors are left out
+  for (uint8_t field = SENSOR_CHANGE_TEMPERATURE; field & SENSOR_CHANGE_ALL; field <<= 1)
+  {
+    float value;
+    if (getSensorField(latest, field, &value))
+    {
+      family("arduino_", sensorFieldName(field), F("gauge"), F("Last sensor reading"));
+      out.print(F("arduino_"));
+      out.print(sensorFieldName(field));
+      out.print(' ');
+      out.print(value, 2);
+      out.print('\n');
+    }
+  }
+
+  metric("reading_timestamp_seconds", F("gauge"), F("Timestamp of the last reading"),
+         latest->timestamp);
+}
+
+static void writeRTC(void)
+{
+  metric("rtc_state", F("gauge"),
+         F("RTC state (0 = uninitialized, 1 = initialized, 2 = synced, 3 = stale)"),
+         getRTCStatus());
+  metric("rtc_time_seconds", F("gauge"), F("RTC time (Unix epoch)"), getRTCTimestamp());
+}
+
+static void writePublish(void)
+{
+  const PublishQueueStats* queue = publishQueueGetStats();
+  metric("mqtt_connected", F("gauge"), F("Transport ready"), isMQTTReady() ? 1 : 0);
+  metric("publish_queued_total", F("counter"), F("Messages accepted by the publish queue"),
+         queue->queued);
+  metric("publish_sent_total", F("counter"), F("Messages handed to the transport"),
+         queue->sent);
+  metric("publish_superseded_total", F("counter"), F("Messages replaced by a newer one"),
+         queue->superseded);
+  metric("publish_dropped_total", F("counter"), F("Messages dropped for lack of room"),
+         queue->dropped);
+  metric("publish_queue_depth", F("gauge"), F("Messages waiting"), queue->depth);
+}
+
+static void writeLoop(void)
+{
+  metric("loop_passes_total", F("counter"), F("loop() passes"), loop_passes);
+
+  family("arduino_", "loop_seconds_total", F("counter"), F("Time spent in loop() passes"));
+  out.print(F("arduino_loop_seconds_total "));
+  printSeconds(loop_total_us);
+  out.print('\n');
+
+  family("arduino_", "loop_max_seconds", F("gauge"), F("Longest loop() pass since the last scrape"));
+  out.print(F("arduino_loop_max_seconds "));
+  printSeconds(loop_max_us);
+  out.print('\n');
+  loop_max_us = 0;
+}
+
+static void writeMemory(void)
+{
+  MemStats mem;
+  memStatsSample(&mem);
+
+  metric("free_ram_bytes", F("gauge"), F("Unclaimed RAM plus free heap"), mem.free_ram);
+  metric("heap_free_bytes", F("gauge"), F("Free heap inside the arena"), mem.heap_free);
+  metric("stack_peak_bytes", F("gauge"), F("Deepest stack use seen"), mem.stack_peak);
+  metric("stack_headroom_bytes", F("gauge"), F("Smallest heap-stack gap seen"),
+         mem.stack_headroom);
+  metric("metrics_scrapes_total", F("counter"), F("Completed /metrics responses"),
+         stats.scrapes + 1);  // Including this one
+}
+
+static void closeClient(bool completed)
+{
+  out.send();
+  client.stop();
+  conn_state = CONN_IDLE;
+
+  if (completed && found && !out.failed)
+  {
+    stats.scrapes++;
+    stats.last_scrape_ms = millis() - accepted_at;
+    LOG_EVENT(LOG_METRICS_SCRAPE, stats.last_scrape_ms);
+  }
+  else
+  {
+    stats.rejected++;
+  }
+}
+
+/**
+ * Read what has arrived of the request; true once the headers are complete
+ */
+static bool readRequest(void)
+{
+  uint8_t buffer[32];
+  int n = client.read(buffer, sizeof(buffer));
+
+  for (int i = 0; i < n; i++)
+  {
+    char c = buffer[i];
+    if (c == '\r')
+    {
+      continue;
+    }
+    if (c == '\n')
+    {
+      request_line_done = true;
+      if (++newlines == 2)
+      {
+        return true;
+      }
+      continue;
+    }
+    newlines = 0;
+
+    if (!request_line_done && request_len < sizeof(request) - 1)
+    {
+      request[request_len++] = c;
+    }
+  }
+  return false;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void metricsLoopTick(void)
+{
+  uint32_t now = micros();
+  if (last_tick_us != 0)
+  {
+    uint32_t pass = now - last_tick_us;
+    loop_passes++;
+    loop_total_us += pass;
+    if (pass > loop_max_us)
+    {
+      loop_max_us = pass;
+    }
+  }
+  last_tick_us = now;
+}
+
+void metricsServerOnLinkChange(bool up)
+{
+  if (!up)
+  {
+    if (conn_state != CONN_IDLE)
+    {
+      closeClient(false);
+    }
+    return;
+  }
+
+  // NINA keeps a listening socket across reconnects; only start a new one
+  // if it is gone (a second begin() would take another socket)
+  if (!listening || server.status() == 0)  // 0 = CLOSED
+  {
+    server.begin();
+    listening = true;
+    DEBUG_PRINT(F("✓ Metrics server listening on port "));
+    DEBUG_PRINTLN(CONFIG_METRICS_PORT);
+  }
+}
+
+void metricsServerPoll(void)
+{
+  if (!listening)
+  {
+    return;
+  }
+
+  switch (conn_state)
+  {
+    case CONN_IDLE:
+      client = server.available();
+      if (!client)
+      {
+        return;
+      }
+      conn_state = CONN_READING;
+      accepted_at = millis();
+      request_len = 0;
+      request_line_done = false;
+      newlines = 0;
+      out.failed = false;
+      // Fall through - the request is usually there already
+
+    case CONN_READING:
+      if (!readRequest())
+      {
+        if (!client.connected() || millis() - accepted_at > CONFIG_METRICS_REQUEST_TIMEOUT_MS)
+        {
+          closeClient(false);
+        }
+        return;
+      }
+
+      request[request_len] = '\0';
+      found = strncmp(request, "GET /metrics", 12) == 0 &&
+              (request[12] == ' ' || request[12] == '?' || request[12] == '\0');
+      conn_state = CONN_WRITING;
+      section = SECTION_HEADERS;
+      return;
+
+    case CONN_WRITING:
+      switch (section)
+      {
+        case SECTION_HEADERS:  writeHeaders();  break;
+        case SECTION_DEVICE:   writeDevice();   break;
+        case SECTION_READINGS: writeReadings(); break;
+        case SECTION_RTC:      writeRTC();      break;
+        case SECTION_PUBLISH:  writePublish();  break;
+        case SECTION_LOOP:     writeLoop();     break;
+        case SECTION_MEMORY:   writeMemory();   break;
+        default:               break;
+      }
+
+      // 404 ends after the headers; a failed write or a slow reader ends early
+      section = found ? section + 1 : SECTION_DONE;
+      if (section == SECTION_DONE || out.failed ||
+          millis() - accepted_at > CONFIG_METRICS_REQUEST_TIMEOUT_MS)
+      {
+        closeClient(section == SECTION_DONE);
+      }
+      return;
+  }
+}
+
+void metricsServerUpdate(const SensorReadings* readings)
+{
+  latest = readings;
+}
+
+const MetricsServerStats* metricsServerGetStats(void)
+{
+  return &stats;
+}
+
+#endif  // CONFIG_METRICS_ENABLED
@@ -0,0 +1,81 @@
+#include <Arduino.h>
+#include "mqtt/broker_client.h"
+#include "log/log.h"
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+int BrokerClient::connect(IPAddress ip, uint16_t port)
+{
+  uint32_t started = millis();
+  int ok = active().connect(ip, port);
+  record(ok, millis() - started);
+  return ok;
+}
+
+int BrokerClient::connect(const char* host, uint16_t port)
+{
+  // With TLS the host name is also the SNI / certificate name
+  uint32_t started = millis();
+  int ok = active().connect(host, port);
+  record(ok, millis() - started);
+  return ok;
+}
+
+int BrokerClient::read()
+{
+  int b = active().read();
+  if (b >= 0)
+  {
+    _rx_bytes++;
+  }
+  return b;
+}
+
+int BrokerClient::read(uint8_t* buf, size_t size)
+{
+  int n = active().read(buf, size);
+  if (n > 0)
+  {
+    _rx_bytes += n;
+  }
+  return n;
+}
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Update connect statistics (connect() covers TCP and, for TLS, the
+ * complete handshake on the NINA module)
+ */
+void BrokerClient::record(bool ok, uint32_t elapsed_ms)
+{
+  _stats.tls = _secure;
+
+  if (!_secure)
+  {
+    if (ok)
+    {
+      _stats.plain_connects++;
+      _stats.last_plain_ms = elapsed_ms;
+    }
+    return;
+  }
+
+  if (!ok)
+  {
+    _stats.tls_failures++;
+    return;
+  }
+
+  _stats.tls_handshakes++;
+  _stats.last_handshake_ms = elapsed_ms;
+  if (elapsed_ms > _stats.max_handshake_ms)
+  {
+    _stats.max_handshake_ms = elapsed_ms;
+  }
+  LOG_EVENT(LOG_MQTT_TLS_HANDSHAKE, elapsed_ms);
+}
@@ -0,0 +1,316 @@
+#include <Arduino.h>
+#include "mqtt/broker_pool.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+#include "settings/settings.h"
+
+// ============================================================================
+// STATIC STATE - Broker list and per-broker health
+// ============================================================================
+
+/**
+ * Broker Health
+ */
+typedef struct {
+  uint32_t connect_ewma_ms;      // Moving average of successful connect time
+  bool has_latency;              // connect_ewma_ms holds a sample
+  uint8_t consecutive_failures;  // Connects/probes failed since the last success
+  uint32_t failed_at;            // millis() of the last failure
+  uint8_t probe_streak;          // Consecutive successful failback probes
+} BrokerHealth;
+
+static MQTTBroker brokers[CONFIG_MQTT_MAX_BROKERS];
+static BrokerHealth health[CONFIG_MQTT_MAX_BROKERS];
+static uint8_t broker_count = 0;
+
+static BrokerPoolStats stats = {BROKER_NONE, 0, 0, 0, CONFIG_MQTT_FAILBACK_HOLDDOWN_MS};
+static int8_t last_session = BROKER_NONE;     // Broker of the previous session
+static uint32_t session_started_at = 0;
+static uint32_t last_probe_at = 0;
+static int8_t failback_pending = BROKER_NONE; // Chosen by brokerPoolFailbackTarget()
+static int8_t failback_broker = BROKER_NONE;  // Session came from a failback...
+static uint32_t failback_at = 0;              // ...at this time (flap detection)
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static bool validIndex(int8_t index)
+{
+  return index >= 0 && index < broker_count;
+}
+
+/**
+ * Retry delay after the broker's consecutive failures (0 if healthy)
+ */
+static uint32_t retryDelay(const BrokerHealth* h)
+{
+  if (h->consecutive_failures == 0)
+  {
+    return 0;
+  }
+
+  uint32_t delay_ms = settingGet<SETTING_BROKER_RETRY_MIN_MS>();
+  uint32_t max_ms = settingGet<SETTING_BROKER_RETRY_MAX_MS>();
+  for (uint8_t i = 1; i < h->consecutive_failures && delay_ms < max_ms; i++)
+  {
+    delay_ms *= 2;
+  }
+  return delay_ms < max_ms ? delay_ms : max_ms;
+}
+
+static bool isAvailable(int8_t index, uint32_t now)
+{
+  const BrokerHealth* h = &health[index];
+  return now - h->failed_at >= retryDelay(h);
+}
+
+static void noteFailure(int8_t index, uint32_t now)
+{
+  BrokerHealth* h = &health[index];
+  if (h->consecutive_failures < 255)
+  {
+    h->consecutive_failures++;
+  }
+  h->failed_at = now;
+  h->probe_streak = 0;
+}
+
+static void noteLatency(int8_t index, uint32_t latency_ms)
+{
+  BrokerHealth* h = &health[index];
+  if (!h->has_latency)
+  {
+    h->connect_ewma_ms = latency_ms;
+    h->has_latency = true;
+  }
+  else
+  {
+    // EWMA with 1/4 weight on the new sample (integer, no float on M0+)
+    h->connect_ewma_ms = (h->connect_ewma_ms * 3 + latency_ms) / 4;
+  }
+}
+
+/**
+ * A failback session that outlived the hold-down: the primary is stable
+ * again, so the next failback starts from the base hold-down
+ */
+static void settleHolddown(uint32_t now)
+{
+  if (failback_broker != BROKER_NONE && stats.current == failback_broker &&
+      now - failback_at >= stats.holddown_ms)
+  {
+    failback_broker = BROKER_NONE;
+    stats.holddown_ms = CONFIG_MQTT_FAILBACK_HOLDDOWN_MS;
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void brokerPoolBegin(const MQTTConfig* config)
+{
+  broker_count = 0;
+  if (config)
+  {
+    broker_count = config->broker_count <= CONFIG_MQTT_MAX_BROKERS ?
+                   config->broker_count : CONFIG_MQTT_MAX_BROKERS;
+    memcpy(brokers, config->brokers, sizeof(MQTTBroker) * broker_count);
+  }
+
+  memset(health, 0, sizeof(health));
+  memset(&stats, 0, sizeof(stats));
+  stats.current = BROKER_NONE;
+  stats.holddown_ms = CONFIG_MQTT_FAILBACK_HOLDDOWN_MS;
+  last_session = BROKER_NONE;
+  failback_pending = BROKER_NONE;
+  failback_broker = BROKER_NONE;
+}
+
+uint8_t brokerPoolCount(void)
+{
+  return broker_count;
+}
+
+const MQTTBroker* brokerPoolGet(int8_t index)
+{
+  return validIndex(index) ? &brokers[index] : NULL;
+}
+
+int8_t brokerPoolSelect(uint32_t now)
+{
+  // A failback in progress goes straight to its target
+  if (validIndex(failback_pending))
+  {
+    return failback_pending;
+  }
+
+  int8_t best = BROKER_NONE;
+  for (int8_t i = 0; i < broker_count; i++)
+  {
+    if (!isAvailable(i, now))
+    {
+      continue;
+    }
+    // List order wins unless a later broker is clearly healthier
+    if (best == BROKER_NONE ||
+        brokerPoolScore(i) >= brokerPoolScore(best) + CONFIG_MQTT_BROKER_SCORE_MARGIN)
+    {
+      best = i;
+    }
+  }
+  return best;
+}
+
+void brokerPoolReportConnect(int8_t index, bool ok, uint32_t latency_ms, uint32_t now)
+{
+  if (!validIndex(index))
+  {
+    return;
+  }
+
+  bool was_failback = (failback_pending == index);
+  failback_pending = BROKER_NONE;
+
+  if (!ok)
+  {
+    noteFailure(index, now);
+    return;
+  }
+
+  health[index].consecutive_failures = 0;
+  noteLatency(index, latency_ms);
+
+  for (uint8_t i = 0; i < broker_count; i++)
+  {
+    health[i].probe_streak = 0;
+  }
+
+  if (was_failback)
+  {
+    stats.failbacks++;
+    failback_broker = index;
+    failback_at = now;
+    LOG_EVENT(LOG_MQTT_FAILBACK, index, stats.holddown_ms);
+  }
+  else if (last_session != BROKER_NONE && last_session != index)
+  {
+    stats.failovers++;
+    LOG_EVENT(LOG_MQTT_FAILOVER, last_session, index, brokerPoolScore(index));
+  }
+
+  stats.current = index;
+  last_session = index;
+  session_started_at = now;
+  last_probe_at = now;
+}
+
+void brokerPoolReportSessionLost(bool broker_fault, uint32_t now)
+{
+  int8_t index = stats.current;
+  if (!validIndex(index))
+  {
+    return;
+  }
+
+  if (broker_fault)
+  {
+    noteFailure(index, now);
+
+    // The broker we failed back to dropped again within the hold-down:
+    // wait longer before trusting it next time
+    if (failback_broker == index && now - failback_at < stats.holddown_ms)
+    {
+      stats.holddown_ms = (stats.holddown_ms * 2 < CONFIG_MQTT_FAILBACK_HOLDDOWN_MAX_MS) ?
+                          stats.holddown_ms * 2 : CONFIG_MQTT_FAILBACK_HOLDDOWN_MAX_MS;
+    }
+  }
+
+  failback_broker = BROKER_NONE;
+  stats.current = BROKER_NONE;
+}
+
+int8_t brokerPoolProbeCandidate(uint32_t now)
+{
+  settleHolddown(now);
+
+  // Nothing to fail back to from the primary (or without a session)
+  if (stats.current <= 0 || now - last_probe_at < CONFIG_MQTT_FAILBACK_PROBE_MS)
+  {
+    return BROKER_NONE;
+  }
+
+  // Most preferred broker not waiting out a retry delay (failed probes back
+  // off like failed connects)
+  for (int8_t i = 0; i < stats.current; i++)
+  {
+    if (isAvailable(i, now))
+    {
+      last_probe_at = now;
+      stats.probes++;
+      return i;
+    }
+  }
+  return BROKER_NONE;
+}
+
+void brokerPoolReportProbe(int8_t index, bool ok, uint32_t latency_ms, uint32_t now)
+{
+  if (!validIndex(index))
+  {
+    return;
+  }
+
+  if (!ok)
+  {
+    noteFailure(index, now);
+    return;
+  }
+
+  BrokerHealth* h = &health[index];
+  h->consecutive_failures = 0;
+  if (h->probe_streak < 255)
+  {
+    h->probe_streak++;
+  }
+  noteLatency(index, latency_ms);
+}
+
+int8_t brokerPoolFailbackTarget(uint32_t now)
+{
+  if (stats.current <= 0 || now - session_started_at < stats.holddown_ms)
+  {
+    return BROKER_NONE;
+  }
+
+  for (int8_t i = 0; i < stats.current; i++)
+  {
+    if (health[i].probe_streak >= CONFIG_MQTT_FAILBACK_PROBES)
+    {
+      failback_pending = i;
+      return i;
+    }
+  }
+  return BROKER_NONE;
+}
+
+uint8_t brokerPoolScore(int8_t index)
+{
+  if (!validIndex(index))
+  {
+    return 0;
+  }
+
+  const BrokerHealth* h = &health[index];
+  uint32_t latency_penalty = h->connect_ewma_ms / 50;
+  uint32_t failure_penalty = 20UL * h->consecutive_failures;
+
+  return 100 - (latency_penalty < 40 ? latency_penalty : 40)
+             - (failure_penalty < 60 ? failure_penalty : 60);
+}
+
+const BrokerPoolStats* brokerPoolGetStats(void)
+{
+  return &stats;
+}
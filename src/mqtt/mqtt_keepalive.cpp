@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include "mqtt/mqtt_keepalive.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+
+// ============================================================================
+// STATIC STATE - Schedule, session idle tracking and NAT limit
+// ============================================================================
+
+static KeepaliveStats stats = {0, 0, 0, 0, 0};
+static uint32_t keepalive_ms = 0;
+static uint32_t ping_ms = 0;
+static uint32_t nat_limit_ms = 0;       // 0 = no idle timeout seen
+static uint32_t nat_ceiling_ms = 0;     // Regrowth stops here (7/8 of the gap that failed)
+static uint32_t last_tx_at = 0;         // Last publish or ping on this session
+static uint32_t last_gap_ms = 0;        // Idle gap ended by that transmission
+static bool gap_unsettled = false;      // It ended a full-limit gap, not yet survived
+static uint8_t gaps_survived = 0;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void applySchedule(void)
+{
+  ping_ms = (nat_limit_ms && nat_limit_ms < keepalive_ms) ? nat_limit_ms : keepalive_ms;
+  stats.ping_sec = ping_ms / 1000;
+  stats.nat_limit_sec = nat_limit_ms / 1000;
+}
+
+/**
+ * A full-limit idle gap whose session outlived the detection window:
+ * count it, and lengthen the NAT limit after enough of them
+ */
+static void settleGap(uint32_t now)
+{
+  if (!gap_unsettled || now - last_tx_at < CONFIG_MQTT_NAT_DETECT_MS)
+  {
+    return;
+  }
+  gap_unsettled = false;
+
+  if (nat_limit_ms == 0 || ++gaps_survived < CONFIG_MQTT_NAT_GROW_AFTER)
+  {
+    return;
+  }
+  gaps_survived = 0;
+
+  nat_limit_ms += nat_limit_ms / 8;
+  if (nat_limit_ms > nat_ceiling_ms)
+  {
+    nat_limit_ms = nat_ceiling_ms;
+  }
+  if (nat_limit_ms >= keepalive_ms)
+  {
+    nat_limit_ms = 0;  // Back to the negotiated keepalive
+  }
+  applySchedule();
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void keepaliveBegin(uint16_t poll_sec, uint16_t heartbeat_sec)
+{
+  // Longest silence in normal operation: a heartbeat is due every
+  // heartbeat_sec but only noticed at the next poll
+  uint32_t sec = (uint32_t)heartbeat_sec + poll_sec + CONFIG_MQTT_KEEPALIVE_SLACK_SEC;
+  if (sec < CONFIG_MQTT_KEEPALIVE_MIN_SEC)
+  {
+    sec = CONFIG_MQTT_KEEPALIVE_MIN_SEC;
+  }
+  if (sec > CONFIG_MQTT_KEEPALIVE_MAX_SEC)
+  {
+    sec = CONFIG_MQTT_KEEPALIVE_MAX_SEC;
+  }
+
+  keepalive_ms = sec * 1000;
+  stats.keepalive_sec = sec;
+  applySchedule();
+}
+
+uint32_t keepaliveNegotiatedMs(void)
+{
+  return keepalive_ms;
+}
+
+void keepaliveOnConnect(uint32_t now)
+{
+  last_tx_at = now;   // CONNECT itself
+  last_gap_ms = 0;
+  gap_unsettled = false;
+}
+
+void keepaliveNoteTraffic(bool is_ping, uint32_t now)
+{
+  settleGap(now);
+
+  last_gap_ms = now - last_tx_at;
+  last_tx_at = now;
+  gap_unsettled = (last_gap_ms >= ping_ms - ping_ms / 8);
+
+  if (is_ping)
+  {
+    stats.pings++;
+  }
+}
+
+bool keepalivePingDue(uint32_t now)
+{
+  settleGap(now);
+  return ping_ms > 0 && now - last_tx_at >= ping_ms;
+}
+
+bool keepaliveOnSessionLost(uint32_t now)
+{
+  bool idle_timeout = (now - last_tx_at < CONFIG_MQTT_NAT_DETECT_MS &&
+                       last_gap_ms >= CONFIG_MQTT_KEEPALIVE_MIN_SEC * 1000UL);
+  gap_unsettled = false;
+
+  if (!idle_timeout)
+  {
+    return false;
+  }
+
+  // The path forgot the session within last_gap_ms; stay well inside it
+  nat_ceiling_ms = last_gap_ms - last_gap_ms / 8;
+  nat_limit_ms = last_gap_ms / 2;
+  if (nat_limit_ms < CONFIG_MQTT_KEEPALIVE_MIN_SEC * 1000UL)
+  {
+    nat_limit_ms = CONFIG_MQTT_KEEPALIVE_MIN_SEC * 1000UL;
+  }
+  gaps_survived = 0;
+  stats.nat_drops++;
+  applySchedule();
+
+  LOG_EVENT(LOG_MQTT_IDLE_TIMEOUT, last_gap_ms / 1000, stats.ping_sec);
+  return true;
+}
+
+const KeepaliveStats* keepaliveGetStats(void)
+{
+  return &stats;
+}
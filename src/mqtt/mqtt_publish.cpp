@@ -1,31 +1,426 @@
 #include <Arduino.h>
 #include "mqtt/mqtt_publish.h"
 #include "arduino_configs.h"
+#include "log/log.h"
+#include "transport/transport.h"
+#include "transport/udp_transport.h"
+#include "mqtt/broker_pool.h"
+#include "mqtt/broker_client.h"
+#include "mqtt/mqtt_keepalive.h"
+#include "diag/watchdog.h"
+#include "settings/settings.h"
 #include <ArduinoMqttClient.h>
 #include <WiFiNINA.h>
+#include <utility/server_drv.h>
+
+#if CONFIG_NETFAULT_ENABLED
+#include "netfault/netfault.h"
+#endif
 
 // ============================================================================
 // STATIC STATE - MQTT Connection and Status
 // ============================================================================
 
-// Use WiFiClient for non-TLS connections (port 1883)
-// For TLS connections (port 8883), certificate validation is required
-static WiFiClient wifiClient;
-static MqttClient mqttClient(wifiClient);
+// Plaintext or TLS (WiFiSSLClient), switched per broker before each connect
+static BrokerClient brokerClient;
+#if CONFIG_NETFAULT_ENABLED
+static NetFaultClient faultyClient(brokerClient);
+static Client& sessionClient = faultyClient;
+#else
+static Client& sessionClient = brokerClient;
+#endif
+static MqttClient mqttClient(sessionClient);
 static MQTTStatus mqtt_status = MQTT_DISCONNECTED;
 static MQTTConfig mqtt_config_copy;
 static bool mqtt_initialized = false;
+static bool link_up = false;            // WiFi link state (from supervisor)
+static const TelemetryTransport* transport = NULL;  // Selected in initMQTT()
+
+// Failback probe: a TCP connect on a NINA socket of its own, started in one
+// loop pass and checked in the following ones (WiFiClient::connect() would
+// wait up to 10 s for the handshake)
+static uint8_t probe_socket = NO_SOCKET_AVAIL;
+static int8_t probe_index = BROKER_NONE;
+static uint32_t probe_started = 0;
+
+// Library pings on its own schedule, ignoring publishes; during a session it
+// gets an interval that never elapses and mqtt_keepalive decides instead.
+// That also switches off the library's receive timeout, so an unanswered
+// PINGREQ is caught here
+#define MQTT_LIBRARY_PING_OFF 0xFFFFFFFFUL
+
+static bool ping_pending = false;
+static uint32_t ping_sent_at = 0;
+static uint32_t ping_rx_mark = 0;       // brokerClient.bytesRead() at the PINGREQ
+
+// ============================================================================
+// BROKER TRANSPORT - MQTT over TCP
+// ============================================================================
+
+/**
+ * Settings command (the only subscription: "<mqtt_topic>/settings/set"),
+ * called from poll()
+ */
+static void brokerOnMessage(int size)
+{
+  char command[CONFIG_SETTINGS_COMMAND_MAX_LEN];
+  if (size <= 0 || size >= (int)sizeof(command))
+  {
+    DEBUG_PRINTLN(F("⚠ Settings command too long, ignored"));
+    while (mqttClient.available())
+    {
+      mqttClient.read();
+    }
+    return;
+  }
+
+  int length = mqttClient.read((uint8_t*)command, size);
+  command[length > 0 ? length : 0] = '\0';
+  settingsApplyCommand(command);
+}
+
+/**
+ * Prepare the MQTT client (connect happens in brokerMaintain)
+ */
+static bool brokerBegin(const MQTTConfig* config)
+{
+  if (config->broker_count == 0)
+  {
+    DEBUG_PRINTLN(F("✗ Invalid MQTT config"));
+    return false;
+  }
+
+  brokerPoolBegin(config);
+  keepaliveBegin(config->poll_frequency_sec, config->heartbeat_frequency_sec);
+
+#if DEBUG
+  for (uint8_t i = 0; i < brokerPoolCount(); i++)
+  {
+    const MQTTBroker* broker = brokerPoolGet(i);
+    DEBUG_PRINT(i == 0 ? F("→ Broker: ") : F("→ Fallback broker: "));
+    DEBUG_PRINT(broker->host);
+    DEBUG_PRINT(F(":"));
+    DEBUG_PRINT(broker->port);
+    DEBUG_PRINTLN(broker->tls ? F(" (TLS)") : F(" (plaintext)"));
+  }
+  if (config->mqtt_tls_fallback)
+  {
+    DEBUG_PRINTLN(F("  ⚠ mqtt_tls_fallback set: TLS brokers may be reached in plaintext"));
+  }
+  DEBUG_PRINT(F("→ Keepalive: "));
+  DEBUG_PRINT(keepaliveGetStats()->keepalive_sec);
+  DEBUG_PRINT(F(" s (ping after "));
+  DEBUG_PRINT(keepaliveGetStats()->ping_sec);
+  DEBUG_PRINTLN(F(" s idle)"));
+#endif
+
+  // Set broker and port
+  mqttClient.setId(F("arduino-mdns-query"));
+  mqttClient.setUsernamePassword(nullptr, nullptr);
+  mqttClient.onMessage(brokerOnMessage);
+
+  return true;
+}
+
+/**
+ * Connect to the broker chosen by the pool
+ */
+static bool brokerConnect(uint32_t now)
+{
+  int8_t index = brokerPoolSelect(now);
+  if (index == BROKER_NONE)
+  {
+    return false;  // Every broker is waiting out its retry delay
+  }
+
+  const MQTTBroker* broker = brokerPoolGet(index);
+
+  // Attempt connection with debug output
+  DEBUG_PRINT(F("→ Connecting to MQTT broker: "));
+  DEBUG_PRINT(broker->host);
+  DEBUG_PRINT(F(":"));
+  DEBUG_PRINT(broker->port);
+  DEBUG_PRINT(F(" (score "));
+  DEBUG_PRINT(brokerPoolScore(index));
+  DEBUG_PRINTLN(F(")"));
+
+  uint16_t port_to_try = broker->port;
+  uint32_t started = millis();
+  mqttClient.setKeepAliveInterval(keepaliveNegotiatedMs());
+  brokerClient.setSecure(broker->tls);
+  watchdogArm(WATCHDOG_TASK_MQTT_CONNECT);
+  bool connected = mqttClient.connect(broker->host, port_to_try);
+
+  // Plaintext retry only when the config explicitly allows it
+  if (!connected && broker->tls && mqtt_config_copy.mqtt_tls_fallback)
+  {
+    DEBUG_PRINTLN(F("  ⚠ TLS connect failed, retrying in plaintext (mqtt_tls_fallback)"));
+
+    port_to_try = CONFIG_MQTT_DEFAULT_PORT;
+    brokerClient.setSecure(false);
+    connected = mqttClient.connect(broker->host, port_to_try);
+    if (connected)
+    {
+      brokerClient.notePlaintextFallback();
+      LOG_EVENT(LOG_MQTT_TLS_FALLBACK, port_to_try);
+      DEBUG_PRINTLN(F("⚠ Connected WITHOUT TLS on port 1883"));
+    }
+  }
+  watchdogDisarm(WATCHDOG_TASK_MQTT_CONNECT);
+
+  brokerPoolReportConnect(index, connected, millis() - started, millis());
+
+  if (!connected)
+  {
+    mqtt_status = MQTT_DISCONNECTED;
+    LOG_EVENT(LOG_MQTT_CONNECT_FAILED, port_to_try);
+    DEBUG_PRINTLN(F("✗ MQTT connection failed"));
+    return false;
+  }
+
+  mqtt_status = MQTT_CONNECTED;
+  mqttClient.setKeepAliveInterval(MQTT_LIBRARY_PING_OFF);
+  keepaliveOnConnect(millis());
+
+  // Runtime settings commands (clean session: subscribe on every connect)
+  char topic[sizeof(mqtt_config_copy.mqtt_topic) + 16];
+  if (buildMQTTSubtopic("settings/set", topic, sizeof(topic)))
+  {
+    mqttClient.subscribe(topic);
+  }
+
+  LOG_EVENT(LOG_MQTT_CONNECTED, port_to_try);
+  if (brokerClient.isSecure())
+  {
+    DEBUG_PRINT(F("✓ Connected to MQTT broker (TLS, "));
+    DEBUG_PRINT(brokerClient.stats()->last_handshake_ms);
+    DEBUG_PRINTLN(F(" ms handshake)"));
+  }
+  else if (port_to_try == broker->port)
+  {
+    DEBUG_PRINTLN(F("✓ Connected to MQTT broker"));
+  }
+  return true;
+}
+
+/**
+ * Drop an unfinished failback probe (session or link gone)
+ */
+static void probeAbort(void)
+{
+  if (probe_socket != NO_SOCKET_AVAIL)
+  {
+    ServerDrv::stopClient(probe_socket);
+    probe_socket = NO_SOCKET_AVAIL;
+  }
+  probe_index = BROKER_NONE;
+}
+
+/**
+ * Start a TCP connect to a preferred broker without waiting for it
+ *
+ * Returns: false if it could not be started (counted as a failed probe)
+ */
+static bool probeStart(int8_t index, uint32_t now)
+{
+  const MQTTBroker* broker = brokerPoolGet(index);
+
+  // Only a hostname needs a (blocking, NINA-bounded) DNS lookup
+  IPAddress ip;
+  if (!ip.fromString(broker->host))
+  {
+    watchdogArm(WATCHDOG_TASK_MQTT_CONNECT);
+    bool resolved = WiFi.hostByName(broker->host, ip) == 1;
+    watchdogDisarm(WATCHDOG_TASK_MQTT_CONNECT);
+    if (!resolved)
+    {
+      return false;
+    }
+  }
+
+  probe_socket = ServerDrv::getSocket();
+  if (probe_socket == NO_SOCKET_AVAIL)
+  {
+    return false;
+  }
+  ServerDrv::startClient(uint32_t(ip), broker->port, probe_socket);
+  probe_index = index;
+  probe_started = now;
+  return true;
+}
+
+/**
+ * While on a fallback broker: probe the preferred one and move back once
+ * the pool says it is healthy (see mqtt/broker_pool.h)
+ */
+static void brokerFailback(uint32_t now)
+{
+  if (probe_index == BROKER_NONE)
+  {
+    // TCP connect only, on a second socket; the session stays up meanwhile
+    int8_t probe = brokerPoolProbeCandidate(now);
+    if (probe != BROKER_NONE && !probeStart(probe, now))
+    {
+      brokerPoolReportProbe(probe, false, 0, now);
+    }
+  }
+  else
+  {
+    bool ok = ServerDrv::getClientState(probe_socket) == ESTABLISHED;
+    if (ok || now - probe_started >= CONFIG_MQTT_FAILBACK_PROBE_TIMEOUT_MS)
+    {
+      int8_t index = probe_index;
+      probeAbort();
+      brokerPoolReportProbe(index, ok, now - probe_started, now);
+    }
+  }
+
+  if (brokerPoolFailbackTarget(now) != BROKER_NONE)
+  {
+    DEBUG_PRINTLN(F("→ Preferred MQTT broker healthy again, failing back"));
+    mqttClient.stop();
+    brokerPoolReportSessionLost(false, now);
+    mqtt_status = MQTT_DISCONNECTED;
+  }
+}
+
+/**
+ * Send a PINGREQ (only when nothing else was sent for the ping interval)
+ */
+static void brokerPing(uint32_t now)
+{
+  static const uint8_t pingreq[2] = {0xC0, 0x00};
+
+  // Written beneath MqttClient (no message in progress); it still parses
+  // the PINGRESP
+  if (sessionClient.write(pingreq, sizeof(pingreq)) != sizeof(pingreq))
+  {
+    mqttClient.stop();
+    return;
+  }
+  keepaliveNoteTraffic(true, now);
+  ping_pending = true;
+  ping_sent_at = now;
+  ping_rx_mark = brokerClient.bytesRead();
+}
+
+/**
+ * Stop a session whose PINGREQ went unanswered (MqttClient consumes the
+ * PINGRESP itself, so any byte received since counts as the answer)
+ */
+static void brokerCheckPing(uint32_t now)
+{
+  if (!ping_pending)
+  {
+    return;
+  }
+  if (brokerClient.bytesRead() != ping_rx_mark)
+  {
+    ping_pending = false;
+    return;
+  }
+  if (now - ping_sent_at >= CONFIG_MQTT_PINGRESP_TIMEOUT_MS)
+  {
+    DEBUG_PRINTLN(F("✗ No PINGRESP from MQTT broker, dropping session"));
+    ping_pending = false;
+    mqttClient.stop();
+  }
+}
+
+/**
+ * Connect if needed and poll the broker session
+ */
+static bool brokerMaintain(void)
+{
+  uint32_t now = millis();
+
+  // Poll for MQTT messages (maintains connection)
+  if (mqttClient.connected())
+  {
+    mqttClient.poll();
+    mqtt_status = MQTT_CONNECTED;
+    brokerCheckPing(now);
+    if (!mqttClient.connected())
+    {
+      return false;  // Reported as lost on the next pass
+    }
+    if (!ping_pending && keepalivePingDue(now))
+    {
+      brokerPing(now);
+    }
+    brokerFailback(now);
+    return mqtt_status == MQTT_CONNECTED;
+  }
+
+  ping_pending = false;
+
+  probeAbort();
+  if (mqtt_status == MQTT_CONNECTED)
+  {
+    LOG_EVENT(LOG_MQTT_CONNECTION_LOST);
+    DEBUG_PRINTLN(F("✗ MQTT connection lost"));
+    // An idle timeout in the path says nothing about the broker
+    brokerPoolReportSessionLost(!keepaliveOnSessionLost(now), now);
+    mqtt_status = MQTT_DISCONNECTED;
+  }
+
+  // Try to connect (next broker per health score)
+  return brokerConnect(now);
+}
+
+/**
+ * Send one message to the broker
+ */
+static bool brokerPublish(const char* topic, const char* message, bool retain)
+{
+  // Use String to avoid ambiguous overload
+  String topic_str = String(topic);
+  if (!mqttClient.beginMessage(topic_str, retain))
+  {
+    LOG_EVENT(LOG_MQTT_PUBLISH_FAILED, 1);
+    return false;
+  }
+
+  mqttClient.print(message);
+  if (!mqttClient.endMessage())
+  {
+    LOG_EVENT(LOG_MQTT_PUBLISH_FAILED, 2);
+    return false;
+  }
+  keepaliveNoteTraffic(false, millis());
+  return true;
+}
+
+static bool brokerReady(void)
+{
+  return mqttClient.connected();
+}
+
+static void brokerStop(void)
+{
+  probeAbort();
+  mqttClient.stop();
+}
+
+static const TelemetryTransport mqttTransport = {
+  "mqtt",
+  brokerBegin,
+  brokerMaintain,
+  brokerReady,
+  brokerPublish,
+  brokerStop
+};
 
 // ============================================================================
-// MQTT CONNECTION MANAGEMENT
+// PUBLIC API IMPLEMENTATION - Dispatch to the selected transport
 // ============================================================================
 
 /**
- * Initialize MQTT connection with broker
+ * Initialize telemetry transport (MQTT broker or UDP)
  */
 MQTTStatus initMQTT(const MQTTConfig* config)
 {
-  if (!config || config->mqtt_broker[0] == '\0')
+  if (!config)
   {
     DEBUG_PRINTLN(F("✗ Invalid MQTT config"));
     mqtt_status = MQTT_ERROR;
@@ -35,29 +430,19 @@ MQTTStatus initMQTT(const MQTTConfig* config)
   // Store configuration
   memcpy(&mqtt_config_copy, config, sizeof(MQTTConfig));
 
+  transport = (config->transport == TRANSPORT_UDP) ? &udpTransport : &mqttTransport;
+
   DEBUG_PRINTLN(F(""));
   DEBUG_PRINTLN(F("=== MQTT INITIALIZATION ==="));
-  DEBUG_PRINT(F("→ Broker: "));
-  DEBUG_PRINT(mqtt_config_copy.mqtt_broker);
-  DEBUG_PRINT(F(":"));
-  DEBUG_PRINTLN(mqtt_config_copy.mqtt_port);
+  DEBUG_PRINT(F("→ Transport: "));
+  DEBUG_PRINTLN(transport->name);
   DEBUG_PRINT(F("→ Topic: "));
   DEBUG_PRINTLN(mqtt_config_copy.mqtt_topic);
 
-  // Set broker and port
-  mqttClient.setId(F("arduino-mdns-query"));
-  mqttClient.setUsernamePassword(nullptr, nullptr);
-
-  // Port selection guidance
-  DEBUG_PRINTLN(F(""));
-  if (mqtt_config_copy.mqtt_port == 8883)
-  {
-    DEBUG_PRINTLN(F("  ⚠ Port 8883 detected (TLS/SSL required)"));
-    DEBUG_PRINTLN(F("  For testing without TLS, modify config to use port 1883"));
-  }
-  else if (mqtt_config_copy.mqtt_port == 1883)
+  if (!transport->begin(&mqtt_config_copy))
   {
-    DEBUG_PRINTLN(F("  ✓ Port 1883 detected (non-TLS, standard MQTT)"));
+    mqtt_status = MQTT_ERROR;
+    return MQTT_ERROR;
   }
 
   mqtt_status = MQTT_CONNECTING;
@@ -68,7 +453,7 @@ MQTTStatus initMQTT(const MQTTConfig* config)
 }
 
 /**
- * Maintain MQTT connection - must be called in loop
+ * Maintain transport - must be called in loop
  */
 MQTTStatus maintainMQTT()
 {
@@ -77,79 +462,41 @@ MQTTStatus maintainMQTT()
     return MQTT_DISCONNECTED;
   }
 
-  // Try to connect if disconnected
-  if (mqtt_status == MQTT_CONNECTING || mqtt_status == MQTT_DISCONNECTED)
+  // No link: don't block in connect attempts that cannot succeed
+  if (!link_up)
   {
-    if (!mqttClient.connected())
-    {
-      // Attempt connection with debug output
-      DEBUG_PRINT(F("→ Connecting to MQTT broker: "));
-      DEBUG_PRINT(mqtt_config_copy.mqtt_broker);
-      DEBUG_PRINT(F(":"));
-      DEBUG_PRINTLN(mqtt_config_copy.mqtt_port);
-
-      uint16_t port_to_try = mqtt_config_copy.mqtt_port;
-
-      if (!mqttClient.connect(
-          mqtt_config_copy.mqtt_broker,
-          port_to_try))
-      {
-        // Fallback: If configured for TLS port (8883), try non-TLS port (1883)
-        if (port_to_try == 8883)
-        {
-          DEBUG_PRINTLN(F("  → Port 8883 failed (requires TLS)"));
-          DEBUG_PRINTLN(F("  → Trying fallback port 1883 (non-TLS)..."));
-
-          port_to_try = 1883;
-          if (!mqttClient.connect(
-              mqtt_config_copy.mqtt_broker,
-              port_to_try))
-          {
-            mqtt_status = MQTT_DISCONNECTED;
-            DEBUG_PRINTLN(F("✗ Connection failed on both ports"));
-            return mqtt_status;
-          }
-
-          DEBUG_PRINTLN(F("✓ Connected on fallback port 1883 (non-TLS)"));
-        }
-        else
-        {
-          mqtt_status = MQTT_DISCONNECTED;
-          DEBUG_PRINTLN(F("✗ MQTT connection failed"));
-          return mqtt_status;
-        }
-      }
-
-      mqtt_status = MQTT_CONNECTED;
-      if (port_to_try == mqtt_config_copy.mqtt_port)
-      {
-        DEBUG_PRINTLN(F("✓ Connected to MQTT broker"));
-      }
-    }
+    mqtt_status = MQTT_DISCONNECTED;
+    return mqtt_status;
   }
 
-  // Poll for MQTT messages (maintains connection)
-  if (mqttClient.connected())
-  {
-    mqttClient.poll();
-    mqtt_status = MQTT_CONNECTED;
-  }
-  else
+  mqtt_status = transport->maintain() ? MQTT_CONNECTED : MQTT_DISCONNECTED;
+  return mqtt_status;
+}
+
+/**
+ * WiFi link callback - drop the session with the link
+ */
+void mqttOnLinkChange(bool up)
+{
+  link_up = up;
+
+  if (!up && mqtt_initialized)
   {
-    if (mqtt_status == MQTT_CONNECTED)
+    if (mqtt_status == MQTT_CONNECTED && transport == &mqttTransport)
     {
-      DEBUG_PRINTLN(F("✗ MQTT connection lost"));
+      LOG_EVENT(LOG_MQTT_CONNECTION_LOST);
+      DEBUG_PRINTLN(F("✗ MQTT connection lost (WiFi down)"));
+      brokerPoolReportSessionLost(false, millis());  // Not the broker's fault
     }
+    transport->stop();
     mqtt_status = MQTT_DISCONNECTED;
   }
-
-  return mqtt_status;
 }
 
 /**
- * Publish message to MQTT
+ * Publish message via the selected transport
  */
-MQTTStatus publishToMQTT(const char* topic, const char* message)
+static MQTTStatus publishMessage(const char* topic, const char* message, bool retain)
 {
   if (!message)
   {
@@ -172,35 +519,64 @@ MQTTStatus publishToMQTT(const char* topic, const char* message)
     return MQTT_ERROR;
   }
 
-  // Publish message
-  DEBUG_PRINT(F("→ Publishing to: "));
-  DEBUG_PRINTLN(publish_topic);
-  DEBUG_PRINT(F("  Message: "));
-  DEBUG_PRINTLN(message);
-
-  // Use String to avoid ambiguous overload
-  String topic_str = String(publish_topic);
-  if (mqttClient.beginMessage(topic_str))
+  if (!transport->publish(publish_topic, message, retain))
   {
-    mqttClient.print(message);
-    if (!mqttClient.endMessage())
-    {
-      DEBUG_PRINTLN(F("✗ Failed to publish"));
-      mqtt_status = MQTT_ERROR;
-      return MQTT_ERROR;
-    }
-  }
-  else
-  {
-    DEBUG_PRINTLN(F("✗ Failed to begin message"));
+#if CONFIG_NETFAULT_ENABLED
+    netFaultNotePublish(false);
+#endif
     mqtt_status = MQTT_ERROR;
     return MQTT_ERROR;
   }
 
-  DEBUG_PRINTLN(F("✓ Message published"));
+#if CONFIG_NETFAULT_ENABLED
+  netFaultNotePublish(true);
+#endif
+  LOG_EVENT(LOG_MQTT_PUBLISH_OK, strlen(message));
   return MQTT_CONNECTED;
 }
 
+/**
+ * Publish message (not retained)
+ */
+MQTTStatus publishToMQTT(const char* topic, const char* message)
+{
+  return publishMessage(topic, message, false);
+}
+
+/**
+ * Publish message as the topic's retained value
+ */
+MQTTStatus publishRetainedToMQTT(const char* topic, const char* message)
+{
+  return publishMessage(topic, message, true);
+}
+
+/**
+ * Build "<mqtt_topic>/<suffix>"
+ */
+char* buildMQTTSubtopic(const char* suffix, char* buffer, size_t buffer_size)
+{
+  if (!mqtt_initialized || !suffix || !buffer || buffer_size == 0)
+  {
+    return NULL;
+  }
+
+  int len = snprintf(buffer, buffer_size, "%s/%s", mqtt_config_copy.mqtt_topic, suffix);
+  if (len < 0 || len >= (int)buffer_size)
+  {
+    return NULL;
+  }
+  return buffer;
+}
+
+/**
+ * Get broker connect (TCP/TLS) statistics
+ */
+const BrokerClientStats* getMQTTClientStats()
+{
+  return brokerClient.stats();
+}
+
 /**
  * Get current MQTT status
  */
@@ -214,7 +590,7 @@ MQTTStatus getMQTTStatus()
  */
 bool isMQTTReady()
 {
-  return mqtt_initialized && mqtt_status == MQTT_CONNECTED && mqttClient.connected();
+  return mqtt_initialized && mqtt_status == MQTT_CONNECTED && transport->ready();
 }
 
 /**
@@ -222,9 +598,9 @@ bool isMQTTReady()
  */
 MQTTStatus disconnectMQTT()
 {
-  if (mqttClient.connected())
+  if (mqtt_initialized)
   {
-    mqttClient.stop();
+    transport->stop();
     DEBUG_PRINTLN(F("✓ Disconnected from MQTT"));
   }
   mqtt_status = MQTT_DISCONNECTED;
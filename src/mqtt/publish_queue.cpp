@@ -0,0 +1,210 @@
+#include <Arduino.h>
+#include "mqtt/publish_queue.h"
+#include "mqtt/mqtt_publish.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// STATIC STATE - Queued messages (insertion order) and their byte pool
+// ============================================================================
+
+/**
+ * Queued Message
+ * Its bytes ("<subtopic>\0<payload>\0") follow those of the message before
+ * it in pool[]
+ */
+typedef struct {
+  uint8_t priority;
+  uint8_t flags;
+  uint16_t len;
+} QueuedMessage;
+
+static QueuedMessage messages[CONFIG_PUBLISH_QUEUE_SLOTS];
+static char pool[CONFIG_PUBLISH_QUEUE_BYTES];
+static uint16_t pool_used = 0;
+static PublishQueueStats stats = {0, 0, 0, 0, 0};
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static char* messageBytes(uint8_t index)
+{
+  uint16_t offset = 0;
+  for (uint8_t i = 0; i < index; i++)
+  {
+    offset += messages[i].len;
+  }
+  return &pool[offset];
+}
+
+static void removeMessage(uint8_t index)
+{
+  char* bytes = messageBytes(index);
+  uint16_t len = messages[index].len;
+  uint16_t tail = pool_used - (uint16_t)(bytes - pool) - len;
+
+  memmove(bytes, bytes + len, tail);
+  pool_used -= len;
+
+  for (uint8_t i = index; i + 1 < stats.depth; i++)
+  {
+    messages[i] = messages[i + 1];
+  }
+  stats.depth--;
+}
+
+/**
+ * Oldest message of the least important priority, if it is not more
+ * important than priority; -1 otherwise
+ */
+static int8_t evictionCandidate(uint8_t priority)
+{
+  int8_t victim = -1;
+  for (uint8_t i = 0; i < stats.depth; i++)
+  {
+    if (messages[i].priority >= priority &&
+        (victim < 0 || messages[i].priority > messages[victim].priority))
+    {
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+/**
+ * Next message to send: most important priority, oldest first
+ */
+static uint8_t nextMessage(void)
+{
+  uint8_t next = 0;
+  for (uint8_t i = 1; i < stats.depth; i++)
+  {
+    if (messages[i].priority < messages[next].priority)
+    {
+      next = i;
+    }
+  }
+  return next;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool publishQueuePush(PublishPriority priority, const char* subtopic,
+                      const char* payload, uint8_t flags)
+{
+  if (!payload)
+  {
+    return false;
+  }
+  if (!subtopic)
+  {
+    subtopic = "";
+  }
+
+  size_t subtopic_len = strlen(subtopic) + 1;
+  size_t payload_len = strlen(payload) + 1;
+  if (subtopic_len + payload_len > sizeof(pool))
+  {
+    stats.dropped++;
+    return false;
+  }
+  uint16_t len = subtopic_len + payload_len;
+
+  // Older messages for the same topic that would go out after this one
+  // (lower priority) are stale; with PUBLISH_SUPERSEDE equal priority too
+  for (uint8_t i = stats.depth; i-- > 0;)
+  {
+    bool stale = messages[i].priority > priority ||
+                 (messages[i].priority == priority && (flags & PUBLISH_SUPERSEDE));
+    if (stale && strcmp(messageBytes(i), subtopic) == 0)
+    {
+      removeMessage(i);
+      stats.superseded++;
+    }
+  }
+
+  // Make room, but never at the expense of a more important message
+  while (stats.depth == CONFIG_PUBLISH_QUEUE_SLOTS || pool_used + len > sizeof(pool))
+  {
+    int8_t victim = evictionCandidate(priority);
+    stats.dropped++;
+    if (victim < 0)
+    {
+      return false;
+    }
+    removeMessage(victim);
+  }
+
+  char* bytes = &pool[pool_used];
+  memcpy(bytes, subtopic, subtopic_len);
+  memcpy(bytes + subtopic_len, payload, payload_len);
+  pool_used += len;
+
+  QueuedMessage* message = &messages[stats.depth++];
+  message->priority = priority;
+  message->flags = flags;
+  message->len = len;
+  stats.queued++;
+  return true;
+}
+
+uint8_t publishQueueService(char* topic, size_t topic_size)
+{
+  uint8_t sent = 0;
+  uint16_t sent_bytes = 0;
+
+  while (stats.depth > 0)
+  {
+    uint8_t index = nextMessage();
+    const QueuedMessage* message = &messages[index];
+
+    // Budget reached: the rest waits for the next pass
+    if (sent > 0 && sent_bytes + message->len > CONFIG_PUBLISH_BUDGET_BYTES)
+    {
+      break;
+    }
+
+    const char* subtopic = messageBytes(index);
+    const char* payload = subtopic + strlen(subtopic) + 1;
+    const char* full_topic = NULL;  // mqtt_topic
+
+    if (subtopic[0] != '\0')
+    {
+      full_topic = buildMQTTSubtopic(subtopic, topic, topic_size);
+      if (!full_topic)
+      {
+        // Can never be sent (topic too long)
+        removeMessage(index);
+        stats.dropped++;
+        continue;
+      }
+    }
+
+    MQTTStatus status = (message->flags & PUBLISH_RETAIN) ?
+                        publishRetainedToMQTT(full_topic, payload) :
+                        publishToMQTT(full_topic, payload);
+    if (status != MQTT_CONNECTED)
+    {
+      break;  // Keep it for the next pass
+    }
+
+    sent_bytes += message->len;
+    sent++;
+    stats.sent++;
+    removeMessage(index);
+  }
+
+  return sent;
+}
+
+uint8_t publishQueueDepth(void)
+{
+  return stats.depth;
+}
+
+const PublishQueueStats* publishQueueGetStats(void)
+{
+  return &stats;
+}
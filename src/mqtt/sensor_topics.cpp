@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include "mqtt/sensor_topics.h"
+#include "arduino_configs.h"
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool topicLayoutParse(const char* name, TopicLayout* layout)
+{
+  if (!name || !layout)
+  {
+    return false;
+  }
+
+  if (strcasecmp(name, "combined") == 0)
+  {
+    *layout = TOPIC_LAYOUT_COMBINED;
+    return true;
+  }
+  if (strcasecmp(name, "per_sensor") == 0)
+  {
+    *layout = TOPIC_LAYOUT_PER_SENSOR;
+    return true;
+  }
+  if (strcasecmp(name, "both") == 0)
+  {
+    *layout = TOPIC_LAYOUT_BOTH;
+    return true;
+  }
+  return false;
+}
+
+bool queueSensorTopics(const SensorReadings* readings, uint8_t fields,
+                       PublishPriority priority)
+{
+  if (!readings)
+  {
+    return false;
+  }
+
+  bool all_queued = true;
+  char value[16];
+
+  for (uint8_t field = SENSOR_CHANGE_TEMPERATURE; field & SENSOR_CHANGE_ALL; field <<= 1)
+  {
+    if (!(fields & field))
+    {
+      continue;
+    }
+
+    // Empty value for an invalid sensor: clears the retained reading
+    if (!formatSensorValue(readings, field, value, sizeof(value)) ||
+        !publishQueuePush(priority, sensorFieldName(field), value,
+                          PUBLISH_RETAIN | PUBLISH_SUPERSEDE))
+    {
+      all_queued = false;
+    }
+  }
+
+  return all_queued;
+}
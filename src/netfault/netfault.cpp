@@ -0,0 +1,503 @@
+#include <Arduino.h>
+#include "netfault/netfault.h"
+#include "arduino_configs.h"
+#include "mdns/network.h"
+#include "mqtt/publish_queue.h"
+
+#if CONFIG_NETFAULT_ENABLED
+
+// ============================================================================
+// SCENARIO TABLE
+// ============================================================================
+// name, loss %, delay ms, truncate bytes, reorder, hang
+
+static const NetFaultProfile scenarios[] = {
+  {"baseline",   0,    0,  0, false, false},
+  {"loss20",    20,    0,  0, false, false},
+  {"rtt2s",      0, 2000,  0, false, false},
+  {"truncate",   0,    0, 64, false, false},
+  {"reorder",    0,  200,  0, true,  false},
+  {"hang",       0,    0,  0, false, true},
+};
+static const uint8_t SCENARIO_COUNT = sizeof(scenarios) / sizeof(scenarios[0]);
+
+static const NetFaultProfile no_faults = {"recovery", 0, 0, 0, false, false};
+
+// ============================================================================
+// STATIC STATE - Schedule, counters and staged datagrams
+// ============================================================================
+
+static uint8_t scenario_index = 0;
+static bool in_recovery = false;
+static uint32_t window_start = 0;
+static NetFaultStats stats;
+static NetFaultStats scenario_stats;   // Snapshot of fault window for report
+static uint32_t queue_dropped_at = 0;  // Publish queue drop count at window start
+
+// Outgoing datagram being built between beginPacket() and endPacket()
+typedef struct {
+  byte data[CONFIG_NETFAULT_MAX_DATAGRAM];
+  uint16_t len;
+  IPAddress ip;
+  uint16_t port;
+  uint32_t release_at;   // millis() when a held datagram may be sent
+  bool used;
+} StagedDatagram;
+
+static StagedDatagram tx_staging;
+static StagedDatagram tx_held;
+static bool tx_passthrough = false;    // Hostname destination: no staging
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static const NetFaultProfile* activeProfile(void)
+{
+  return in_recovery ? &no_faults : &scenarios[scenario_index];
+}
+
+static bool rollLoss(void)
+{
+  uint8_t loss = activeProfile()->loss_percent;
+  return loss > 0 && random(100) < loss;
+}
+
+/**
+ * Clear the counters for a new window
+ */
+static void startWindow(uint32_t now)
+{
+  memset(&stats, 0, sizeof(stats));
+  queue_dropped_at = publishQueueGetStats()->dropped;
+  window_start = now;
+}
+
+static void sendDatagram(UDP& udp, const StagedDatagram& dgram)
+{
+  udp.beginPacket(dgram.ip, dgram.port);
+  udp.write(dgram.data, dgram.len);
+  udp.endPacket();
+  stats.udp_sent++;
+}
+
+/**
+ * Print per-scenario report line
+ */
+static void printReport(void)
+{
+  const NetFaultProfile* p = &scenarios[scenario_index];
+
+  DEBUG_PRINTLN(F(""));
+  DEBUG_PRINT(F("[NETFAULT] scenario="));
+  DEBUG_PRINT(p->name);
+  DEBUG_PRINT(F(" udp_sent="));
+  DEBUG_PRINT(scenario_stats.udp_sent);
+  DEBUG_PRINT(F(" udp_dropped="));
+  DEBUG_PRINT(scenario_stats.udp_dropped);
+  DEBUG_PRINT(F(" udp_truncated="));
+  DEBUG_PRINT(scenario_stats.udp_truncated);
+  DEBUG_PRINT(F(" udp_reordered="));
+  DEBUG_PRINT(scenario_stats.udp_reordered);
+  DEBUG_PRINT(F(" tcp_refused="));
+  DEBUG_PRINT(scenario_stats.tcp_refused);
+  DEBUG_PRINT(F(" tcp_truncated="));
+  DEBUG_PRINT(scenario_stats.tcp_truncated);
+  DEBUG_PRINT(F(" tcp_hung="));
+  DEBUG_PRINT(scenario_stats.tcp_hung);
+  DEBUG_PRINT(F(" publish_ok="));
+  DEBUG_PRINT(scenario_stats.publish_ok);
+  DEBUG_PRINT(F(" publish_retried="));
+  DEBUG_PRINT(scenario_stats.publish_retried);
+  // A backlog built up during the faults can still overflow while it drains
+  DEBUG_PRINT(F(" publish_lost="));
+  DEBUG_PRINT(scenario_stats.publish_dropped + stats.publish_dropped);
+  DEBUG_PRINT(F(" recover_ms="));
+  if (stats.recovered)
+  {
+    DEBUG_PRINTLN(stats.recover_ms);
+  }
+  else
+  {
+    DEBUG_PRINTLN(F("timeout"));
+  }
+}
+
+// ============================================================================
+// NetFaultUDP
+// ============================================================================
+
+int NetFaultUDP::beginPacket(IPAddress ip, uint16_t port)
+{
+  tx_passthrough = false;
+  tx_staging.ip = ip;
+  tx_staging.port = port;
+  tx_staging.len = 0;
+  tx_staging.used = true;
+  return 1;
+}
+
+int NetFaultUDP::beginPacket(const char* host, uint16_t port)
+{
+  tx_passthrough = true;
+  return _inner.beginPacket(host, port);
+}
+
+size_t NetFaultUDP::write(const uint8_t* buf, size_t size)
+{
+  if (tx_passthrough)
+  {
+    return _inner.write(buf, size);
+  }
+
+  size_t room = sizeof(tx_staging.data) - tx_staging.len;
+  size_t n = size < room ? size : room;
+  memcpy(&tx_staging.data[tx_staging.len], buf, n);
+  tx_staging.len += n;
+  return n;
+}
+
+int NetFaultUDP::endPacket()
+{
+  if (tx_passthrough)
+  {
+    tx_passthrough = false;
+    return _inner.endPacket();
+  }
+
+  const NetFaultProfile* p = activeProfile();
+  tx_staging.used = false;
+
+  // Loss: report success to the caller, as a real network would
+  if (rollLoss())
+  {
+    stats.udp_dropped++;
+    return 1;
+  }
+
+  if (p->truncate_bytes > 0 && tx_staging.len > p->truncate_bytes)
+  {
+    tx_staging.len = p->truncate_bytes;
+    stats.udp_truncated++;
+  }
+
+  // Reorder: send the new datagram ahead of the one already held back
+  if (p->reorder && tx_held.used)
+  {
+    sendDatagram(_inner, tx_staging);
+    sendDatagram(_inner, tx_held);
+    tx_held.used = false;
+    stats.udp_reordered++;
+    return 1;
+  }
+
+  // Delay or reorder: hold back until release time
+  if (p->delay_ms > 0 || p->reorder)
+  {
+    if (tx_held.used)
+    {
+      sendDatagram(_inner, tx_held);  // Single slot: flush older datagram first
+    }
+    tx_held = tx_staging;
+    tx_held.used = true;
+    tx_held.release_at = millis() + p->delay_ms;
+    return 1;
+  }
+
+  sendDatagram(_inner, tx_staging);
+  return 1;
+}
+
+int NetFaultUDP::parsePacket()
+{
+  int size = _inner.parsePacket();
+  if (size <= 0)
+  {
+    _rxRemaining = 0;
+    return size;
+  }
+
+  if (rollLoss())
+  {
+    // Drain and discard the datagram
+    while (_inner.available() > 0)
+    {
+      _inner.read();
+    }
+    stats.udp_dropped++;
+    _rxRemaining = 0;
+    return 0;
+  }
+
+  uint16_t limit = activeProfile()->truncate_bytes;
+  if (limit > 0 && size > limit)
+  {
+    stats.udp_truncated++;
+    size = limit;
+  }
+
+  _rxRemaining = size;
+  return size;
+}
+
+int NetFaultUDP::available()
+{
+  int avail = _inner.available();
+  return avail < _rxRemaining ? avail : _rxRemaining;
+}
+
+int NetFaultUDP::read()
+{
+  if (_rxRemaining <= 0)
+  {
+    return -1;
+  }
+  _rxRemaining--;
+  return _inner.read();
+}
+
+int NetFaultUDP::read(unsigned char* buf, size_t len)
+{
+  if (_rxRemaining <= 0)
+  {
+    return 0;
+  }
+
+  size_t want = len < (size_t)_rxRemaining ? len : (size_t)_rxRemaining;
+  int n = _inner.read(buf, want);
+  if (n > 0)
+  {
+    _rxRemaining -= n;
+  }
+  return n;
+}
+
+void NetFaultUDP::poll(void)
+{
+  if (tx_held.used && (int32_t)(millis() - tx_held.release_at) >= 0)
+  {
+    // Reordered datagrams wait for a successor; give up after the hold time
+    if (activeProfile()->reorder &&
+        millis() - tx_held.release_at < CONFIG_NETFAULT_REORDER_HOLD_MS)
+    {
+      return;
+    }
+    sendDatagram(_inner, tx_held);
+    tx_held.used = false;
+  }
+}
+
+// ============================================================================
+// NetFaultClient
+// ============================================================================
+
+bool NetFaultClient::beforeConnect(void)
+{
+  _rxCount = 0;
+  _cut = false;
+  _hung = false;
+
+  if (rollLoss())
+  {
+    stats.tcp_refused++;
+    return false;
+  }
+  return true;
+}
+
+void NetFaultClient::afterConnect(int result)
+{
+  if (result)
+  {
+    _connectedAt = millis();
+    _hung = activeProfile()->hang;
+    if (_hung) stats.tcp_hung++;
+  }
+}
+
+/**
+ * Within one RTT of connect: the connect returned at once (no blocking
+ * delay in the loop), the round trip is taken out of the first byte
+ */
+bool NetFaultClient::inHandshake(void)
+{
+  uint16_t delay_ms = activeProfile()->delay_ms;
+  return delay_ms > 0 && _rxCount == 0 && millis() - _connectedAt < delay_ms;
+}
+
+int NetFaultClient::connect(IPAddress ip, uint16_t port)
+{
+  if (!beforeConnect())
+  {
+    return 0;
+  }
+
+  int result = _inner.connect(ip, port);
+  afterConnect(result);
+  return result;
+}
+
+int NetFaultClient::connect(const char* host, uint16_t port)
+{
+  if (!beforeConnect())
+  {
+    return 0;
+  }
+
+  int result = _inner.connect(host, port);
+  afterConnect(result);
+  return result;
+}
+
+int NetFaultClient::available()
+{
+  const NetFaultProfile* p = activeProfile();
+
+  if (_hung || _cut || inHandshake())
+  {
+    return 0;
+  }
+
+  int avail = _inner.available();
+  if (p->truncate_bytes > 0)
+  {
+    int left = (int)p->truncate_bytes - (int)_rxCount;
+    if (left <= 0)
+    {
+      _cut = true;
+      stats.tcp_truncated++;
+      return 0;
+    }
+    if (avail > left) avail = left;
+  }
+  return avail;
+}
+
+int NetFaultClient::read()
+{
+  if (available() <= 0)
+  {
+    return -1;
+  }
+
+  int c = _inner.read();
+  if (c >= 0)
+  {
+    _rxCount++;
+  }
+  return c;
+}
+
+int NetFaultClient::read(uint8_t* buf, size_t size)
+{
+  int avail = available();
+  if (avail <= 0)
+  {
+    return 0;
+  }
+
+  if (size > (size_t)avail)
+  {
+    size = avail;
+  }
+
+  int n = _inner.read(buf, size);
+  if (n > 0)
+  {
+    _rxCount += n;
+  }
+  return n;
+}
+
+uint8_t NetFaultClient::connected()
+{
+  // A truncated stream looks like the peer closed the connection. During
+  // the handshake the connection stays up (the peer can't have closed it
+  // yet), even if the real one already went away
+  if (_cut)
+  {
+    return 0;
+  }
+  return inHandshake() ? 1 : _inner.connected();
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void netFaultBegin(void)
+{
+  randomSeed(micros());
+  scenario_index = 0;
+  in_recovery = false;
+  startWindow(millis());
+  tx_held.used = false;
+
+  DEBUG_PRINT(F("[NETFAULT] Fault injection active, scenario: "));
+  DEBUG_PRINTLN(scenarios[scenario_index].name);
+}
+
+void netFaultPoll(void)
+{
+  uint32_t now = millis();
+
+  // Flush held-back mDNS datagrams
+  static_cast<NetFaultUDP&>(getUDPSocket()).poll();
+  stats.publish_dropped = publishQueueGetStats()->dropped - queue_dropped_at;
+
+  if (!in_recovery)
+  {
+    if (now - window_start >= CONFIG_NETFAULT_SCENARIO_MS)
+    {
+      // Fault window over: clear faults and start timing recovery
+      scenario_stats = stats;
+      in_recovery = true;
+      startWindow(now);
+
+      DEBUG_PRINT(F("[NETFAULT] Faults cleared after scenario: "));
+      DEBUG_PRINTLN(scenarios[scenario_index].name);
+    }
+    return;
+  }
+
+  if (stats.recovered || now - window_start >= CONFIG_NETFAULT_RECOVERY_TIMEOUT_MS)
+  {
+    printReport();
+
+    scenario_index = (scenario_index + 1) % SCENARIO_COUNT;
+    in_recovery = false;
+    startWindow(now);
+
+    DEBUG_PRINT(F("[NETFAULT] Starting scenario: "));
+    DEBUG_PRINTLN(scenarios[scenario_index].name);
+  }
+}
+
+void netFaultNotePublish(bool ok)
+{
+  if (ok)
+  {
+    stats.publish_ok++;
+    if (in_recovery && !stats.recovered)
+    {
+      stats.recovered = true;
+      stats.recover_ms = millis() - window_start;
+    }
+  }
+  else
+  {
+    stats.publish_retried++;  // Still queued: sent again once it goes through
+  }
+}
+
+const NetFaultProfile* netFaultActiveProfile(void)
+{
+  return activeProfile();
+}
+
+const NetFaultStats* netFaultGetStats(void)
+{
+  return &stats;
+}
+
+#endif  // CONFIG_NETFAULT_ENABLED
@@ -0,0 +1,367 @@
+#include <Arduino.h>
+#include <string.h>
+#include "ota/delta.h"
+#include "arduino_configs.h"
+
+// Widest LZSS symbol (1 + window + 8 count bits) plus a partial byte must
+// fit the 32-bit bit buffer
+static_assert(CONFIG_OTA_DELTA_WINDOW_BITS >= 4 && CONFIG_OTA_DELTA_WINDOW_BITS <= 12,
+              "CONFIG_OTA_DELTA_WINDOW_BITS must be 4..12");
+
+/**
+ * Operations (tag byte)
+ */
+typedef enum {
+  OP_NONE = 0,         // Next byte is a tag
+  OP_COPY,             // offset, length
+  OP_ADD,              // offset, length, diff bytes
+  OP_INSERT            // length, bytes
+} DeltaOp;
+
+// ============================================================================
+// STATIC STATE - Header, LZSS window and the open operation
+// ============================================================================
+
+static DeltaStatus status = {DELTA_HEADER, 0, 0, 0, 0};
+
+static const uint8_t* base = nullptr;
+static uint32_t base_capacity = 0;
+static uint32_t target_size = 0;
+static uint32_t block_align = 1;
+
+static uint8_t header[DELTA_HEADER_SIZE];  // Also a block's length
+static uint8_t header_fill = 0;
+static uint32_t base_size = 0;
+static uint16_t block_size = 0;
+static uint8_t window_bits = 0;
+static uint8_t count_bits = 0;
+
+static uint32_t block_left = 0;       // Compressed bytes left in the block
+static uint32_t block_end = 0;        // Target offset where the block ends
+static uint8_t window[1 << CONFIG_OTA_DELTA_WINDOW_BITS];
+static uint16_t window_pos = 0;
+static uint32_t bit_buffer = 0;
+static uint8_t bit_count = 0;
+static uint16_t ref_distance = 0;     // Back-reference being copied
+static uint16_t ref_left = 0;
+
+static uint8_t op = OP_NONE;
+static uint8_t fields_left = 0;       // Varints still to read
+static uint8_t shift = 0;
+static uint32_t fields[2];
+static uint32_t op_offset = 0;        // Into the running image
+static uint32_t op_left = 0;          // Target bytes left
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void fail(const __FlashStringHelper* reason)
+{
+  (void)reason;  // Only printed in debug builds
+  status.state = DELTA_ERROR;
+  DEBUG_PRINT(F("✗ Patch: "));
+  DEBUG_PRINTLN(reason);
+}
+
+static uint32_t readLE(const uint8_t* p, uint8_t bytes)
+{
+  uint32_t value = 0;
+  for (uint8_t i = bytes; i > 0; i--)
+  {
+    value = (value << 8) | p[i - 1];
+  }
+  return value;
+}
+
+static void parseHeader(void)
+{
+  header_fill = 0;
+  base_size = readLE(header + 8, 4);
+  block_size = (uint16_t)readLE(header + 12, 2);
+  window_bits = header[14];
+  count_bits = header[15];
+
+  if (memcmp(header, "OTD1", 4) != 0)
+  {
+    fail(F("not a patch"));
+  }
+  else if (readLE(header + 4, 4) != target_size || base_size > base_capacity ||
+           block_size == 0 || block_size % block_align != 0 ||
+           window_bits < 4 || window_bits > CONFIG_OTA_DELTA_WINDOW_BITS ||
+           count_bits < 1 || count_bits > 8)
+  {
+    fail(F("unsupported header"));
+  }
+  else
+  {
+    status.state = DELTA_BLOCK_LENGTH;
+  }
+}
+
+static void startBlock(void)
+{
+  block_left = readLE(header, 2);
+  header_fill = 0;
+  if (block_left == 0)
+  {
+    fail(F("empty block"));
+    return;
+  }
+
+  uint32_t left = target_size - status.produced;
+  block_end = status.produced + (left < block_size ? left : block_size);
+
+  // Every block starts from scratch, so decoding can resume at any of them
+  memset(window, 0, sizeof(window));
+  window_pos = 0;
+  bit_buffer = 0;
+  bit_count = 0;
+  ref_left = 0;
+  op = OP_NONE;
+  fields_left = 0;
+  status.state = DELTA_BLOCK;
+}
+
+static void endBlock(void)
+{
+  if (op != OP_NONE || ref_left != 0 || block_left != 0)
+  {
+    fail(F("block length mismatch"));
+    return;
+  }
+
+  status.resume_offset = status.consumed;
+  status.resume_target = status.produced;
+  status.state = status.produced == target_size ? DELTA_DONE : DELTA_BLOCK_LENGTH;
+}
+
+/**
+ * Make at least `n` bits available (false: input used up, or error)
+ */
+static bool needBits(uint8_t n, const uint8_t* in, uint32_t length, uint32_t* used)
+{
+  while (bit_count < n)
+  {
+    if (block_left == 0)
+    {
+      fail(F("block ends early"));
+      return false;
+    }
+    if (*used == length)
+    {
+      return false;
+    }
+    bit_buffer = (bit_buffer << 8) | in[(*used)++];
+    bit_count += 8;
+    block_left--;
+    status.consumed++;
+  }
+  return true;
+}
+
+static uint32_t takeBits(uint8_t n)
+{
+  bit_count -= n;
+  uint32_t value = (bit_buffer >> bit_count) & ((1UL << n) - 1);
+  bit_buffer &= (1UL << bit_count) - 1;
+  return value;
+}
+
+/**
+ * Next byte of the operation stream: a literal or one byte of a back-reference
+ */
+static bool nextByte(uint8_t* byte, const uint8_t* in, uint32_t length, uint32_t* used)
+{
+  uint16_t mask = (1 << window_bits) - 1;
+
+  if (ref_left == 0)
+  {
+    if (!needBits(1, in, length, used))
+    {
+      return false;
+    }
+
+    if ((bit_buffer >> (bit_count - 1)) & 1)
+    {
+      if (!needBits(9, in, length, used))
+      {
+        return false;
+      }
+      *byte = (uint8_t)takeBits(9);
+      window[window_pos++ & mask] = *byte;
+      return true;
+    }
+
+    if (!needBits(1 + window_bits + count_bits, in, length, used))
+    {
+      return false;
+    }
+    uint32_t ref = takeBits(1 + window_bits + count_bits);
+    ref_left = (ref & ((1 << count_bits) - 1)) + 1;
+    ref_distance = ((ref >> count_bits) & mask) + 1;
+  }
+
+  *byte = window[(uint16_t)(window_pos - ref_distance) & mask];
+  window[window_pos++ & mask] = *byte;
+  ref_left--;
+  return true;
+}
+
+static void emit(uint8_t byte, uint8_t* out, uint32_t* produced)
+{
+  out[(*produced)++] = byte;
+  status.produced++;
+  if (--op_left == 0)
+  {
+    op = OP_NONE;
+  }
+  if (status.produced == block_end)
+  {
+    endBlock();
+  }
+}
+
+static void startOperation(void)
+{
+  op_offset = op == OP_INSERT ? 0 : fields[0];
+  op_left = op == OP_INSERT ? fields[0] : fields[1];
+
+  if (op_left == 0 || op_left > block_end - status.produced)
+  {
+    fail(F("operation runs past the block"));
+  }
+  else if (op != OP_INSERT && (op_offset > base_size || op_left > base_size - op_offset))
+  {
+    fail(F("operation runs past the running image"));
+  }
+}
+
+/**
+ * Tag or varint byte of an operation
+ */
+static void operationByte(uint8_t byte)
+{
+  if (op == OP_NONE)
+  {
+    if (byte < OP_COPY || byte > OP_INSERT)
+    {
+      fail(F("bad operation"));
+      return;
+    }
+    op = byte;
+    fields_left = op == OP_INSERT ? 1 : 2;
+    fields[0] = fields[1] = 0;
+    shift = 0;
+    return;
+  }
+
+  if (shift > 28)
+  {
+    fail(F("bad varint"));
+    return;
+  }
+  uint8_t field = (op == OP_INSERT ? 1 : 2) - fields_left;
+  fields[field] |= (uint32_t)(byte & 0x7F) << shift;
+  shift += 7;
+  if (byte & 0x80)
+  {
+    return;
+  }
+
+  shift = 0;
+  if (--fields_left == 0)
+  {
+    startOperation();
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void deltaBegin(const uint8_t* base_image, uint32_t capacity, uint32_t size, uint32_t align)
+{
+  base = base_image;
+  base_capacity = capacity;
+  target_size = size;
+  block_align = align ? align : 1;
+
+  status.state = DELTA_HEADER;
+  status.consumed = 0;
+  status.produced = 0;
+  status.resume_offset = 0;
+  status.resume_target = 0;
+  header_fill = 0;
+}
+
+void deltaRewind(void)
+{
+  status.consumed = status.resume_offset;
+  status.produced = status.resume_target;
+  status.state = status.resume_offset == 0 ? DELTA_HEADER : DELTA_BLOCK_LENGTH;
+  header_fill = 0;
+}
+
+uint32_t deltaDecode(const uint8_t* in, uint32_t length, uint8_t* out, uint32_t space,
+                     uint32_t* produced)
+{
+  uint32_t used = 0;
+  *produced = 0;
+
+  while (status.state != DELTA_DONE && status.state != DELTA_ERROR)
+  {
+    if (status.state != DELTA_BLOCK)
+    {
+      if (used == length)
+      {
+        break;
+      }
+      header[header_fill++] = in[used++];
+      status.consumed++;
+
+      if (status.state == DELTA_HEADER && header_fill == DELTA_HEADER_SIZE)
+      {
+        parseHeader();
+      }
+      else if (status.state == DELTA_BLOCK_LENGTH && header_fill == 2)
+      {
+        startBlock();
+      }
+      continue;
+    }
+
+    // Operation body: one target byte each (COPY needs no patch bytes)
+    bool body = op != OP_NONE && fields_left == 0;
+    if (body && *produced == space)
+    {
+      break;
+    }
+    if (body && op == OP_COPY)
+    {
+      emit(base[op_offset++], out, produced);
+      continue;
+    }
+
+    uint8_t byte;
+    if (!nextByte(&byte, in, length, &used))
+    {
+      break;
+    }
+    if (!body)
+    {
+      operationByte(byte);
+    }
+    else
+    {
+      emit(op == OP_INSERT ? byte : (uint8_t)(base[op_offset++] + byte), out, produced);
+    }
+  }
+
+  return used;
+}
+
+const DeltaStatus* deltaGetStatus(void)
+{
+  return &status;
+}
@@ -0,0 +1,281 @@
+#include <Arduino.h>
+#include <string.h>
+#include "ota/flash_bank.h"
+
+// ============================================================================
+// LAYOUT
+// ============================================================================
+
+static const uint32_t SKETCH_START = 0x2000;            // After the bootloader
+static const uint32_t BANK_SIZE = 0x20000 - SKETCH_START;  // 120 KB
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+static const uint32_t BANK_START = FLASH_SIZE / 2;
+static const uint32_t ROWS_START = BANK_START + BANK_SIZE;  // 0x3E000, past the bank
+static const uint32_t PAGE_WORDS = FLASH_PAGE_SIZE / 4;
+static const uint32_t ROW_PAGES = FLASH_BANK_ROW_SIZE / FLASH_PAGE_SIZE;
+
+static_assert(BANK_START + BANK_SIZE + FLASH_ROW_COUNT * FLASH_BANK_ROW_SIZE <= FLASH_SIZE,
+              "Persisted rows must fit between the bank and the end of flash");
+
+// Linker script symbols: end of code, then .data's initial values
+extern "C" uint32_t __etext;
+extern "C" uint32_t __data_start__;
+extern "C" uint32_t __data_end__;
+
+// ============================================================================
+// NVM CONTROLLER
+// ============================================================================
+
+static void nvmCommand(uint32_t command)
+{
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | command;
+  while (NVMCTRL->INTFLAG.bit.READY == 0);
+}
+
+/**
+ * Word of the image at `offset`, padded with 0xFF past `length`
+ */
+static uint32_t imageWord(const uint8_t* data, uint32_t offset, uint32_t length)
+{
+  uint32_t word = 0xFFFFFFFF;
+  if (offset < length)
+  {
+    uint32_t n = length - offset < 4 ? length - offset : 4;
+    memcpy(&word, data + offset, n);
+  }
+  return word;
+}
+
+/**
+ * Erase, write and read back whole rows at a row-aligned address
+ */
+static bool programRows(uint32_t address, const uint8_t* data, uint32_t length)
+{
+  NVMCTRL->CTRLB.bit.MANW = 1;  // Pages are written by command only
+
+  volatile uint32_t* dst = (volatile uint32_t*)address;
+  for (uint32_t row = 0; row < length; row += FLASH_BANK_ROW_SIZE)
+  {
+    NVMCTRL->ADDR.reg = (address + row) / 2;
+    nvmCommand(NVMCTRL_CTRLA_CMD_ER);
+
+    for (uint32_t page = 0; page < ROW_PAGES; page++)
+    {
+      nvmCommand(NVMCTRL_CTRLA_CMD_PBC);
+      for (uint32_t i = 0; i < PAGE_WORDS; i++)
+      {
+        *dst++ = imageWord(data, row + (page * PAGE_WORDS + i) * 4, length);
+      }
+      nvmCommand(NVMCTRL_CTRLA_CMD_WP);
+    }
+  }
+
+  // Read back through the cache, not stale lines from before the erase
+  nvmCommand(NVMCTRL_CTRLA_CMD_INVALL);
+  return memcmp((const void*)address, data, length) == 0;
+}
+
+/**
+ * Install the bank: runs from RAM (the code in flash is being replaced)
+ * and touches nothing in flash - no calls, no constants outside the
+ * literal pool, interrupts already off
+ */
+__attribute__((long_call, noinline, section(".data.ramfunc")))
+static void copyBankAndReset(uint32_t length)
+{
+  volatile uint32_t* dst = (volatile uint32_t*)SKETCH_START;
+  const volatile uint32_t* src = (const volatile uint32_t*)BANK_START;
+
+  for (uint32_t row = 0; row < length; row += FLASH_BANK_ROW_SIZE)
+  {
+    // Keep the watchdog from firing mid-copy (its interrupt is off)
+    if (!WDT->STATUS.bit.SYNCBUSY)
+    {
+      WDT->CLEAR.reg = WDT_CLEAR_CLEAR_KEY;
+    }
+
+    NVMCTRL->ADDR.reg = (SKETCH_START + row) / 2;  // 16-bit word address
+    NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_ER;
+    while (NVMCTRL->INTFLAG.bit.READY == 0);
+
+    for (uint32_t page = 0; page < ROW_PAGES; page++)
+    {
+      NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_PBC;
+      while (NVMCTRL->INTFLAG.bit.READY == 0);
+      for (uint32_t i = 0; i < PAGE_WORDS; i++)
+      {
+        *dst++ = *src++;
+      }
+      NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_WP;
+      while (NVMCTRL->INTFLAG.bit.READY == 0);
+    }
+  }
+
+  __DSB();
+  SCB->AIRCR = (0x5FAUL << SCB_AIRCR_VECTKEY_Pos) | SCB_AIRCR_SYSRESETREQ_Msk;
+  while (1);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+uint32_t flashBankCapacity(void)
+{
+  uint32_t sketch_end = (uint32_t)&__etext +
+                        ((uint32_t)&__data_end__ - (uint32_t)&__data_start__);
+  return sketch_end <= BANK_START ? BANK_SIZE : 0;
+}
+
+bool flashBankWrite(uint32_t offset, const uint8_t* data, uint32_t length)
+{
+  if (offset % FLASH_BANK_ROW_SIZE != 0 || length == 0 || offset + length > BANK_SIZE ||
+      flashBankCapacity() == 0)
+  {
+    return false;
+  }
+
+  return programRows(BANK_START + offset, data, length);
+}
+
+const uint8_t* flashBankData(void)
+{
+  return (const uint8_t*)BANK_START;
+}
+
+const uint8_t* flashBankSketch(void)
+{
+  return (const uint8_t*)SKETCH_START;
+}
+
+bool flashBankApply(uint32_t length)
+{
+  if (length == 0 || length > flashBankCapacity())
+  {
+    return false;
+  }
+
+  __disable_irq();
+  copyBankAndReset(length);
+  return false;  // Not reached
+}
+
+bool flashRowRead(FlashRow row, void* data, uint32_t length)
+{
+  if (row >= FLASH_ROW_COUNT || length > FLASH_BANK_ROW_SIZE)
+  {
+    memset(data, 0, length);
+    return false;
+  }
+
+  memcpy(data, (const void*)(ROWS_START + row * FLASH_BANK_ROW_SIZE), length);
+  return true;
+}
+
+bool flashRowWrite(FlashRow row, const void* data, uint32_t length)
+{
+  if (row >= FLASH_ROW_COUNT || length == 0 || length > FLASH_BANK_ROW_SIZE)
+  {
+    return false;
+  }
+
+  return programRows(ROWS_START + row * FLASH_BANK_ROW_SIZE, (const uint8_t*)data, length);
+}
+
+#else
+
+// ============================================================================
+// SIMULATED FLASH (host builds: [env:native] tests)
+// ============================================================================
+
+static uint8_t sim_bank[BANK_SIZE];
+static uint8_t sim_sketch[BANK_SIZE];
+static uint8_t sim_rows[FLASH_ROW_COUNT][FLASH_BANK_ROW_SIZE];
+static bool sim_rows_erased = false;  // Rows start erased, like a fresh board
+
+static void simProgram(uint8_t* area, uint32_t offset, const uint8_t* data, uint32_t length)
+{
+  for (uint32_t row = 0; row < length; row += FLASH_BANK_ROW_SIZE)
+  {
+    memset(area + offset + row, 0xFF, FLASH_BANK_ROW_SIZE);  // Erase
+  }
+  for (uint32_t i = 0; i < length; i++)
+  {
+    area[offset + i] &= data[i];  // Programming only clears bits
+  }
+}
+
+static void simRowsInit(void)
+{
+  if (!sim_rows_erased)
+  {
+    memset(sim_rows, 0xFF, sizeof(sim_rows));
+    sim_rows_erased = true;
+  }
+}
+
+uint32_t flashBankCapacity(void)
+{
+  return BANK_SIZE;
+}
+
+bool flashBankWrite(uint32_t offset, const uint8_t* data, uint32_t length)
+{
+  if (offset % FLASH_BANK_ROW_SIZE != 0 || length == 0 || offset + length > BANK_SIZE)
+  {
+    return false;
+  }
+
+  simProgram(sim_bank, offset, data, length);
+  return memcmp(sim_bank + offset, data, length) == 0;
+}
+
+const uint8_t* flashBankData(void)
+{
+  return sim_bank;
+}
+
+const uint8_t* flashBankSketch(void)
+{
+  return sim_sketch;
+}
+
+bool flashBankApply(uint32_t length)
+{
+  if (length == 0 || length > BANK_SIZE)
+  {
+    return false;
+  }
+
+  simProgram(sim_sketch, 0, sim_bank, length);
+  return true;  // Returns instead of resetting into the new sketch
+}
+
+bool flashRowRead(FlashRow row, void* data, uint32_t length)
+{
+  if (row >= FLASH_ROW_COUNT || length > FLASH_BANK_ROW_SIZE)
+  {
+    memset(data, 0, length);
+    return false;
+  }
+
+  simRowsInit();
+  memcpy(data, sim_rows[row], length);
+  return true;
+}
+
+bool flashRowWrite(FlashRow row, const void* data, uint32_t length)
+{
+  if (row >= FLASH_ROW_COUNT || length == 0 || length > FLASH_BANK_ROW_SIZE)
+  {
+    return false;
+  }
+
+  simRowsInit();
+  simProgram(sim_rows[row], 0, (const uint8_t*)data, length);
+  return true;
+}
+
+#endif
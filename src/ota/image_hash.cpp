@@ -0,0 +1,192 @@
+#include <Arduino.h>
+#include <string.h>
+#include "ota/image_hash.h"
+
+#if defined(ARDUINO_ARCH_SAMD)
+
+#include <ArduinoECCX08.h>
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION (ECCX08)
+// ============================================================================
+
+bool imageHashBegin(void)
+{
+  // Also needed after initializeDeviceID() ended the chip
+  return ECCX08.begin() && ECCX08.beginSHA256();
+}
+
+bool imageHashUpdate(const uint8_t* data, uint32_t length)
+{
+  for (uint32_t i = 0; i + IMAGE_HASH_BLOCK_SIZE <= length; i += IMAGE_HASH_BLOCK_SIZE)
+  {
+    if (!ECCX08.updateSHA256(data + i))
+    {
+      return false;
+    }
+  }
+  return length % IMAGE_HASH_BLOCK_SIZE == 0;
+}
+
+bool imageHashFinish(const uint8_t* tail, uint32_t length, uint8_t digest[IMAGE_HASH_SIZE])
+{
+  if (length >= IMAGE_HASH_BLOCK_SIZE)
+  {
+    return false;
+  }
+  return ECCX08.endSHA256(tail, (int)length, digest);
+}
+
+bool imageSignatureVerify(const uint8_t digest[IMAGE_HASH_SIZE], const uint8_t signature[64],
+                          const uint8_t public_key[64])
+{
+  return ECCX08.ecdsaVerify(digest, signature, public_key) == 1;
+}
+
+#else
+
+// ============================================================================
+// SOFTWARE SHA-256 (host builds: [env:native] tests)
+// ============================================================================
+
+static const uint32_t K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static uint32_t state[8];
+static uint32_t hashed = 0;  // Bytes hashed so far
+
+static uint32_t ror(uint32_t x, uint8_t n)
+{
+  return (x >> n) | (x << (32 - n));
+}
+
+static void compress(uint32_t* h, const uint8_t* block)
+{
+  uint32_t w[64];
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    w[i] = (uint32_t)block[i * 4] << 24 | (uint32_t)block[i * 4 + 1] << 16 |
+           (uint32_t)block[i * 4 + 2] << 8 | block[i * 4 + 3];
+  }
+  for (uint8_t i = 16; i < 64; i++)
+  {
+    uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+
+  uint32_t v[8];
+  memcpy(v, h, sizeof(v));
+  for (uint8_t i = 0; i < 64; i++)
+  {
+    uint32_t t1 = v[7] + (ror(v[4], 6) ^ ror(v[4], 11) ^ ror(v[4], 25)) +
+                  ((v[4] & v[5]) ^ (~v[4] & v[6])) + K[i] + w[i];
+    uint32_t t2 = (ror(v[0], 2) ^ ror(v[0], 13) ^ ror(v[0], 22)) +
+                  ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+    memmove(v + 1, v, 7 * sizeof(uint32_t));
+    v[4] += t1;
+    v[0] = t1 + t2;
+  }
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    h[i] += v[i];
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION (software)
+// ============================================================================
+
+bool imageHashBegin(void)
+{
+  static const uint32_t H0[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  };
+  memcpy(state, H0, sizeof(state));
+  hashed = 0;
+  return true;
+}
+
+bool imageHashUpdate(const uint8_t* data, uint32_t length)
+{
+  if (length % IMAGE_HASH_BLOCK_SIZE != 0)
+  {
+    return false;
+  }
+  for (uint32_t i = 0; i < length; i += IMAGE_HASH_BLOCK_SIZE)
+  {
+    compress(state, data + i);
+  }
+  hashed += length;
+  return true;
+}
+
+bool imageHashFinish(const uint8_t* tail, uint32_t length, uint8_t digest[IMAGE_HASH_SIZE])
+{
+  if (length >= IMAGE_HASH_BLOCK_SIZE)
+  {
+    return false;
+  }
+
+  // Padding: 0x80, zeros, 64-bit big-endian bit count (one or two blocks)
+  uint8_t block[IMAGE_HASH_BLOCK_SIZE * 2] = {0};
+  if (length > 0)
+  {
+    memcpy(block, tail, length);
+  }
+  block[length] = 0x80;
+  uint32_t blocks = length < IMAGE_HASH_BLOCK_SIZE - 8 ? 1 : 2;
+  uint64_t bits = (uint64_t)(hashed + length) * 8;
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    block[blocks * IMAGE_HASH_BLOCK_SIZE - 1 - i] = (uint8_t)(bits >> (i * 8));
+  }
+  for (uint32_t i = 0; i < blocks; i++)
+  {
+    compress(state, block + i * IMAGE_HASH_BLOCK_SIZE);
+  }
+
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    digest[i * 4] = state[i] >> 24;
+    digest[i * 4 + 1] = state[i] >> 16;
+    digest[i * 4 + 2] = state[i] >> 8;
+    digest[i * 4 + 3] = state[i];
+  }
+  return true;
+}
+
+bool imageSignatureVerify(const uint8_t digest[IMAGE_HASH_SIZE], const uint8_t signature[64],
+                          const uint8_t public_key[64])
+{
+  // No ECDSA here: a host signature is r = SHA-256(public_key | digest),
+  // s = digest, so tests can sign an offer for a key and still fail a
+  // wrong key, a wrong digest or a damaged signature. Hashing it borrows
+  // the running state, which is put back.
+  uint32_t saved_state[8];
+  uint32_t saved_hashed = hashed;
+  memcpy(saved_state, state, sizeof(saved_state));
+
+  uint8_t message[64 + IMAGE_HASH_SIZE];
+  memcpy(message, public_key, 64);
+  memcpy(message + 64, digest, IMAGE_HASH_SIZE);
+  uint8_t expected[IMAGE_HASH_SIZE];
+  imageHashBegin();
+  imageHashUpdate(message, 64);
+  imageHashFinish(message + 64, IMAGE_HASH_SIZE, expected);
+
+  memcpy(state, saved_state, sizeof(state));
+  hashed = saved_hashed;
+  return memcmp(signature, expected, IMAGE_HASH_SIZE) == 0 &&
+         memcmp(signature + 32, digest, IMAGE_HASH_SIZE) == 0;
+}
+
+#endif
@@ -0,0 +1,744 @@
+#include <Arduino.h>
+#include <string.h>
+#include <WiFiNINA.h>
+#include "ota/ota.h"
+#include "ota/flash_bank.h"
+#include "ota/image_hash.h"
+#include "ota/delta.h"
+#include "log/log.h"
+#include "settings/settings.h"
+#include "diag/watchdog.h"
+#include "arduino_configs.h"
+
+#if CONFIG_NETFAULT_ENABLED
+#include "netfault/netfault.h"
+#endif
+
+#if CONFIG_OTA_ENABLED
+
+static_assert(CONFIG_OTA_CHUNK_SIZE % FLASH_BANK_ROW_SIZE == 0,
+              "CONFIG_OTA_CHUNK_SIZE must be a whole number of flash rows");
+static_assert(CONFIG_OTA_CHUNK_SIZE % IMAGE_HASH_BLOCK_SIZE == 0,
+              "CONFIG_OTA_CHUNK_SIZE must be a whole number of SHA-256 blocks");
+static_assert(32 + 4 + CONFIG_OTA_VERSION_MAX_LEN - 1 < IMAGE_HASH_BLOCK_SIZE,
+              "Signed offer message must fit one SHA-256 block");
+
+/**
+ * Download Steps
+ */
+typedef enum {
+  PHASE_CONNECT = 0,   // Connect and send the request on the next poll
+  PHASE_HEADERS,       // Waiting for the response head
+  PHASE_BODY,          // Streaming the image (or patch) into the bank
+  PHASE_VERIFY         // Hashing the bank, one chunk per poll
+} DownloadPhase;
+
+// ============================================================================
+// STATIC STATE - Offer, connection and the one chunk buffer
+// ============================================================================
+
+#if CONFIG_NETFAULT_ENABLED
+static WiFiClient wifi_client;
+static NetFaultClient client(wifi_client);
+#else
+static WiFiClient client;
+#endif
+
+static OtaStatus status = {OTA_IDLE, OTA_ERROR_NONE, "", 0, 0, 0, 0, false, 0, 0};
+static FirmwareOffer offer;
+static char host[CONFIG_HOSTNAME_MAX_LEN];
+static uint16_t port = 0;
+static const char* path = "/";        // Into offer.url or offer.delta_url
+static char config_host[CONFIG_HOSTNAME_MAX_LEN];  // For relative urls
+static uint16_t config_port = 0;
+
+static DownloadPhase phase = PHASE_CONNECT;
+static uint8_t chunk[CONFIG_OTA_CHUNK_SIZE];  // Request head, response lines, then image
+static uint32_t fill = 0;             // Image bytes in chunk
+static uint32_t line_len = 0;         // Response head: bytes of the line being read
+static int http_code = 0;             // Response head: 0 until the status line is in
+static long content_length = -1;
+static uint8_t input[CONFIG_OTA_DELTA_INPUT_SIZE];  // Patch bytes not decoded yet
+static uint32_t input_len = 0;
+static uint32_t input_pos = 0;
+static uint32_t started_at = 0;
+static uint32_t last_rx = 0;
+static uint32_t failed_at = 0;
+
+// Resuming: the body is requested from `resume_from` (a patch restarts at
+// a block boundary); status.received is the image rebuilt before it
+static uint32_t body_size = 0;        // Image or patch bytes in all
+static uint32_t resume_from = 0;
+static uint32_t attempt_from = 0;     // resume_from when the attempt began
+static bool resumable = false;        // Last failure can resume
+static bool delta_failed = false;     // Patch didn't apply: full image next
+static uint32_t hashed = 0;           // Verify progress
+
+static const char* const state_names[] = {
+  "idle",
+  "downloading",
+  "ready",
+  "failed",
+};
+
+static const char* const error_names[OTA_ERROR_COUNT] = {
+  "none",
+  "too_large",
+  "url",
+  "connect",
+  "http",
+  "stalled",
+  "short",
+  "flash",
+  "hash",
+  "delta",
+  "signature",
+};
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Split a url: "http://host[:port]/path" or "/path" on the config server
+ */
+static bool parseUrl(const char* url)
+{
+  if (url[0] == '/')
+  {
+    strlcpy(host, config_host, sizeof(host));
+    port = config_port;
+    path = url;
+    return host[0] != '\0';
+  }
+
+  if (strncmp(url, "http://", 7) != 0)
+  {
+    return false;  // No TLS client for downloads
+  }
+
+  const char* start = url + 7;
+  const char* slash = strchr(start, '/');
+  path = slash ? slash : "/";
+  size_t len = slash ? (size_t)(slash - start) : strlen(start);
+  if (len == 0 || len >= sizeof(host))
+  {
+    return false;
+  }
+  memcpy(host, start, len);
+  host[len] = '\0';
+
+  port = 80;
+  char* colon = strchr(host, ':');
+  if (colon)
+  {
+    *colon = '\0';
+    port = (uint16_t)atoi(colon + 1);
+  }
+  return host[0] != '\0' && port != 0;
+}
+
+/**
+ * Next numeric part of a version ("1.4.0"); a non-numeric suffix ("-rc1",
+ * "dev") ends the version, later parts count as 0
+ */
+static uint32_t versionPart(const char** p)
+{
+  uint32_t value = 0;
+  const char* s = *p;
+  if (!s)
+  {
+    return 0;
+  }
+  while (isdigit(*s))
+  {
+    value = value * 10 + (*s++ - '0');
+  }
+  *p = (*s == '.') ? s + 1 : NULL;
+  return value;
+}
+
+static bool versionNewer(const char* offered, const char* running)
+{
+  while (offered || running)
+  {
+    uint32_t a = versionPart(&offered);
+    uint32_t b = versionPart(&running);
+    if (a != b)
+    {
+      return a > b;
+    }
+  }
+  return false;
+}
+
+static bool parseHex(const char* hex, uint8_t* out, size_t len)
+{
+  if (strlen(hex) != 2 * len)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++)
+  {
+    char byte[3] = {hex[i * 2], hex[i * 2 + 1], '\0'};
+    char* end;
+    out[i] = (uint8_t)strtoul(byte, &end, 16);
+    if (end != byte + 2)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Check the offer's signature (same message as tools/ota_sign.py):
+ * SHA-256(sha256 | size, little-endian | version)
+ */
+static bool offerSigned(const FirmwareOffer* signed_offer)
+{
+  uint8_t public_key[64];
+  if (!parseHex(CONFIG_OTA_PUBLIC_KEY, public_key, sizeof(public_key)))
+  {
+    return false;  // No key built in: nothing is trusted
+  }
+
+  uint8_t message[32 + 4 + CONFIG_OTA_VERSION_MAX_LEN];
+  size_t version_len = strlen(signed_offer->version);
+  memcpy(message, signed_offer->sha256, 32);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    message[32 + i] = (uint8_t)(signed_offer->size >> (i * 8));
+  }
+  memcpy(message + 36, signed_offer->version, version_len);
+
+  uint8_t digest[IMAGE_HASH_SIZE];
+  return imageHashBegin() && imageHashFinish(message, 36 + version_len, digest) &&
+         imageSignatureVerify(digest, signed_offer->signature, public_key);
+}
+
+static void fail(OtaError error, uint32_t now)
+{
+  client.stop();
+  status.state = OTA_FAILED;
+  status.error = error;
+  failed_at = now;
+
+  // A dropped transfer picks up where it stopped; anything else starts over
+  resumable = error == OTA_ERROR_CONNECT || error == OTA_ERROR_STALLED ||
+              error == OTA_ERROR_SHORT;
+  if (resumable)
+  {
+    resume_from = status.delta ? deltaGetStatus()->resume_offset : status.received;
+  }
+  if (status.delta && (error == OTA_ERROR_DELTA || error == OTA_ERROR_HASH))
+  {
+    delta_failed = true;
+  }
+
+  LOG_EVENT(LOG_OTA_FAILED, error, status.received);
+  DEBUG_PRINT(F("✗ OTA failed ("));
+  DEBUG_PRINT(error_names[error]);
+  DEBUG_PRINT(F(") at byte "));
+  DEBUG_PRINTLN(status.received);
+}
+
+/**
+ * Request the body from the start: the whole image, or the patch
+ */
+static void beginBody(void)
+{
+  resume_from = 0;
+  status.received = 0;
+  if (status.delta)
+  {
+    deltaBegin(flashBankSketch(), flashBankCapacity(), status.size, CONFIG_OTA_CHUNK_SIZE);
+  }
+}
+
+/**
+ * Start an attempt: resume a dropped transfer, otherwise start over (with
+ * the patch if there is one for this build and it hasn't failed)
+ */
+static void startDownload(uint32_t now, bool counted)
+{
+  if (counted)
+  {
+    status.attempts++;
+  }
+  else
+  {
+    status.resumes++;
+  }
+
+  if (resumable)
+  {
+    if (status.delta)
+    {
+      deltaRewind();
+      status.received = deltaGetStatus()->resume_target;
+    }
+  }
+  else
+  {
+    status.delta = !delta_failed && offer.delta_size > 0 &&
+                   strcmp(offer.delta_from, CONFIG_FIRMWARE_VERSION) == 0 &&
+                   parseUrl(offer.delta_url);
+    if (!status.delta)
+    {
+      parseUrl(offer.url);  // Checked by otaOffer()
+    }
+    body_size = status.delta ? offer.delta_size : status.size;
+    started_at = now;
+    beginBody();
+  }
+
+  attempt_from = resume_from;
+  resumable = false;
+  status.state = OTA_DOWNLOADING;
+  status.error = OTA_ERROR_NONE;
+  phase = PHASE_CONNECT;
+  fill = 0;
+  input_len = 0;
+  input_pos = 0;
+  last_rx = now;
+
+  if (resume_from > 0)
+  {
+    LOG_EVENT(LOG_OTA_RESUME, resume_from, body_size);
+    DEBUG_PRINT(F("→ OTA: resuming at byte "));
+    DEBUG_PRINT(resume_from);
+    DEBUG_PRINT(F(" of "));
+    DEBUG_PRINTLN(body_size);
+    return;
+  }
+
+  LOG_EVENT(LOG_OTA_START, body_size, status.attempts);
+  DEBUG_PRINT(F("→ OTA: downloading "));
+  DEBUG_PRINT(status.version);
+  DEBUG_PRINT(status.delta ? F(" (patch, ") : F(" ("));
+  DEBUG_PRINT(body_size);
+  DEBUG_PRINTLN(F(" bytes)"));
+}
+
+static void connectAndRequest(uint32_t now)
+{
+  // DNS lookup and TCP connect block inside NINA (up to 10 s)
+  watchdogArm(WATCHDOG_TASK_NET_CALL);
+  bool connected = client.connect(host, port);
+  watchdogDisarm(WATCHDOG_TASK_NET_CALL);
+  if (!connected)
+  {
+    fail(OTA_ERROR_CONNECT, now);
+    return;
+  }
+
+  char range[32] = "";
+  if (resume_from > 0)
+  {
+    snprintf(range, sizeof(range), "Range: bytes=%lu-\r\n", (unsigned long)resume_from);
+  }
+
+  // Request head goes out of the chunk buffer (the image isn't flowing yet)
+  int len = snprintf((char*)chunk, sizeof(chunk),
+                     "GET %s HTTP/1.1\r\n"
+                     "Host: %s:%u\r\n"
+                     "User-Agent: Arduino/1.0\r\n"
+                     "%s"
+                     "Connection: close\r\n\r\n",
+                     path, host, port, range);
+  if (len < 0 || len >= (int)sizeof(chunk))
+  {
+    fail(OTA_ERROR_URL, now);
+    return;
+  }
+
+  client.write(chunk, len);
+  phase = PHASE_HEADERS;
+  line_len = 0;
+  http_code = 0;
+  content_length = -1;
+  last_rx = millis();
+}
+
+/**
+ * Status line and headers; only Content-Length is checked
+ *
+ * Reads what has arrived, byte by byte, and keeps the partial line in the
+ * chunk buffer across polls; the body starts only after the blank line
+ * (never on a timeout, so no header byte reaches the bank)
+ */
+static void readHeaders(uint32_t now)
+{
+  char* line = (char*)chunk;
+  bool head_done = false;
+
+  while (!head_done && client.available())
+  {
+    int c = client.read();
+    if (c < 0)
+    {
+      break;
+    }
+    if (c != '\n')
+    {
+      if (c != '\r' && line_len < sizeof(chunk) - 1)
+      {
+        line[line_len++] = (char)c;  // Longer lines are cut (only the start matters)
+      }
+      continue;
+    }
+
+    line[line_len] = '\0';
+    if (http_code == 0)
+    {
+      if (sscanf(line, "HTTP/1.%*d %d", &http_code) != 1 || http_code == 0)
+      {
+        http_code = -1;  // Not HTTP: rejected below once the head ends
+      }
+    }
+    else if (line_len == 0)
+    {
+      head_done = true;
+    }
+    else if (strncasecmp(line, "Content-Length:", 15) == 0)
+    {
+      content_length = atol(line + 15);
+    }
+    line_len = 0;
+  }
+
+  if (!head_done)
+  {
+    return;  // Rest of the head on a later poll (stall timeout applies)
+  }
+
+  // A server that ignores Range sends the whole body: start over
+  if (http_code == 200 && resume_from > 0)
+  {
+    DEBUG_PRINTLN(F("⚠ OTA: server can't resume, starting over"));
+    beginBody();
+  }
+
+  bool expected = http_code == (resume_from > 0 ? 206 : 200);
+  if (!expected || (content_length >= 0 && (uint32_t)content_length != body_size - resume_from))
+  {
+    DEBUG_PRINT(F("✗ OTA: HTTP "));
+    DEBUG_PRINT(http_code);
+    DEBUG_PRINT(F(", Content-Length "));
+    DEBUG_PRINTLN(content_length);
+    fail(OTA_ERROR_HTTP, now);
+    return;
+  }
+
+  phase = PHASE_BODY;
+}
+
+/**
+ * Write the chunk to the bank; verify once the whole image is there
+ */
+static void commitChunk(uint32_t now)
+{
+  if (!flashBankWrite(status.received, chunk, fill))
+  {
+    fail(OTA_ERROR_FLASH, now);
+    return;
+  }
+
+  status.received += fill;
+  fill = 0;
+
+  if (status.received % 16384 == 0)
+  {
+    DEBUG_PRINT(F("→ OTA: "));
+    DEBUG_PRINT(status.received);
+    DEBUG_PRINT(F(" / "));
+    DEBUG_PRINTLN(status.size);
+  }
+
+  if (status.received == status.size)
+  {
+    client.stop();
+    hashed = 0;
+    phase = PHASE_VERIFY;
+    if (!imageHashBegin())
+    {
+      fail(OTA_ERROR_HASH, now);
+    }
+  }
+}
+
+/**
+ * Image bytes straight into the chunk, up to the row boundary
+ */
+static void readImage(uint32_t now)
+{
+  uint32_t want = sizeof(chunk) - fill;
+  uint32_t left = status.size - status.received - fill;
+  int n = client.read(chunk + fill, want < left ? want : left);
+  if (n > 0)
+  {
+    fill += n;
+    status.transferred += n;
+  }
+
+  if (fill == sizeof(chunk) || status.received + fill == status.size)
+  {
+    commitChunk(now);
+  }
+}
+
+/**
+ * Patch bytes through the decoder until the chunk is full
+ */
+static void readPatch(uint32_t now)
+{
+  const DeltaStatus* delta = deltaGetStatus();
+  while (fill < sizeof(chunk) && delta->state != DELTA_DONE)
+  {
+    if (input_pos == input_len)
+    {
+      int n = client.available() ? client.read(input, sizeof(input)) : 0;
+      input_len = n > 0 ? n : 0;
+      input_pos = 0;
+      status.transferred += input_len;
+    }
+
+    // Decoded even with no input: a COPY left open when the chunk filled
+    // up needs none (the patch may have ended already)
+    uint32_t produced;
+    uint32_t used = deltaDecode(input + input_pos, input_len - input_pos,
+                                chunk + fill, sizeof(chunk) - fill, &produced);
+    input_pos += used;
+    fill += produced;
+    if (delta->state == DELTA_ERROR)
+    {
+      fail(OTA_ERROR_DELTA, now);
+      return;
+    }
+    if (used == 0 && produced == 0)
+    {
+      break;
+    }
+  }
+
+  if (fill == sizeof(chunk) || (delta->state == DELTA_DONE && fill > 0))
+  {
+    commitChunk(now);
+  }
+}
+
+/**
+ * Hash the bank as written (one chunk per poll) and compare with the offer
+ */
+static void verify(uint32_t now)
+{
+  const uint8_t* image = flashBankData();
+  uint32_t left = status.size - hashed;
+  if (left >= sizeof(chunk))
+  {
+    if (!imageHashUpdate(image + hashed, sizeof(chunk)))
+    {
+      fail(OTA_ERROR_HASH, now);
+    }
+    hashed += sizeof(chunk);
+    return;
+  }
+
+  uint32_t whole = left - left % IMAGE_HASH_BLOCK_SIZE;
+  uint8_t digest[IMAGE_HASH_SIZE];
+  if (!imageHashUpdate(image + hashed, whole) ||
+      !imageHashFinish(image + hashed + whole, left - whole, digest) ||
+      memcmp(digest, offer.sha256, sizeof(digest)) != 0)
+  {
+    fail(OTA_ERROR_HASH, now);
+    return;
+  }
+
+  status.state = OTA_READY;
+  status.download_ms = now - started_at;
+  LOG_EVENT(LOG_OTA_READY, status.size, status.download_ms);
+  DEBUG_PRINT(F("✓ OTA: image verified in "));
+  DEBUG_PRINT(status.download_ms);
+  DEBUG_PRINT(F(" ms, "));
+  DEBUG_PRINT(status.transferred);
+  DEBUG_PRINTLN(F(" bytes transferred"));
+}
+
+static void download(uint32_t now)
+{
+  if (phase == PHASE_CONNECT)
+  {
+    connectAndRequest(now);
+    return;
+  }
+  if (phase == PHASE_VERIFY)
+  {
+    verify(now);
+    return;
+  }
+
+  if (!client.available())
+  {
+    // The decoder has work without new input: bytes already read, and a
+    // COPY from the running image (a trailing one outlasts the patch)
+    if (status.delta && phase == PHASE_BODY)
+    {
+      uint32_t produced = deltaGetStatus()->produced;
+      readPatch(now);
+      if (status.state != OTA_DOWNLOADING || deltaGetStatus()->produced != produced)
+      {
+        last_rx = now;  // Progress: the drop or stall shows once it stops
+        return;
+      }
+    }
+
+    if (!client.connected())
+    {
+      fail(OTA_ERROR_SHORT, now);
+    }
+    else if (now - last_rx > settingGet<SETTING_OTA_STALL_TIMEOUT_MS>())
+    {
+      fail(OTA_ERROR_STALLED, now);
+    }
+    return;
+  }
+  last_rx = now;
+
+  if (phase == PHASE_HEADERS)
+  {
+    readHeaders(now);
+  }
+  else if (status.delta)
+  {
+    readPatch(now);
+  }
+  else
+  {
+    readImage(now);
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool otaOffer(const FirmwareOffer* new_offer, const char* server_host, uint16_t server_port,
+              uint32_t now)
+{
+  // Only upgrades: the same or an older version is ignored
+  if (!new_offer || new_offer->size == 0 ||
+      !versionNewer(new_offer->version, CONFIG_FIRMWARE_VERSION))
+  {
+    return false;
+  }
+
+  // Same image offered again (config refetched): keep going
+  if (status.state != OTA_IDLE && strcmp(new_offer->version, offer.version) == 0 &&
+      memcmp(new_offer->sha256, offer.sha256, sizeof(offer.sha256)) == 0)
+  {
+    return false;
+  }
+
+  client.stop();
+  offer = *new_offer;
+  strlcpy(config_host, server_host, sizeof(config_host));
+  config_port = server_port;
+  strlcpy(status.version, offer.version, sizeof(status.version));
+  status.size = offer.size;
+  status.received = 0;
+  status.attempts = 0;
+  status.resumes = 0;
+  status.transferred = 0;
+  status.download_ms = 0;
+  status.delta = false;
+  resumable = false;
+  delta_failed = false;
+
+  // Not worth retrying
+  if (!offerSigned(&offer))
+  {
+    status.attempts = settingGet<SETTING_OTA_MAX_ATTEMPTS>();
+    fail(OTA_ERROR_SIGNATURE, now);
+    return false;
+  }
+  if (offer.size > flashBankCapacity() || !parseUrl(offer.url))
+  {
+    status.attempts = settingGet<SETTING_OTA_MAX_ATTEMPTS>();
+    fail(offer.size > flashBankCapacity() ? OTA_ERROR_TOO_LARGE : OTA_ERROR_URL, now);
+    return false;
+  }
+
+  startDownload(now, true);
+  return true;
+}
+
+OtaState otaPoll(uint32_t now)
+{
+  switch (status.state)
+  {
+    case OTA_DOWNLOADING:
+      download(now);
+      break;
+
+    case OTA_FAILED:
+      // Dropped after making progress: resume soon, free of charge
+      if (resumable && resume_from > attempt_from &&
+          now - failed_at >= CONFIG_OTA_RESUME_DELAY_MS)
+      {
+        startDownload(now, false);
+      }
+      else if (status.attempts < settingGet<SETTING_OTA_MAX_ATTEMPTS>() &&
+               now - failed_at >= settingGet<SETTING_OTA_RETRY_INTERVAL_MS>())
+      {
+        startDownload(now, true);
+      }
+      break;
+
+    default:
+      break;
+  }
+  return status.state;
+}
+
+bool otaApply(void)
+{
+  if (status.state != OTA_READY)
+  {
+    return false;
+  }
+
+  DEBUG_PRINT(F("→ OTA: installing "));
+  DEBUG_PRINT(status.version);
+  DEBUG_PRINTLN(F(" and restarting"));
+#if DEBUG
+  Serial.flush();
+#endif
+
+  return flashBankApply(status.size);
+}
+
+const OtaStatus* otaGetStatus(void)
+{
+  return &status;
+}
+
+const char* otaStateName(OtaState state)
+{
+  if (state > OTA_FAILED)
+  {
+    return "unknown";
+  }
+  return state_names[state];
+}
+
+const char* otaErrorName(OtaError error)
+{
+  if (error >= OTA_ERROR_COUNT)
+  {
+    return "unknown";
+  }
+  return error_names[error];
+}
+
+#endif  // CONFIG_OTA_ENABLED
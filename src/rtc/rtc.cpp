@@ -2,6 +2,8 @@
 #include <RTCZero.h>
 #include <WiFiNINA.h>
 #include "rtc/rtc.h"
+#include "wifi/wifi_supervisor.h"
+#include "settings/settings.h"
 #include "arduino_configs.h"
 
 // ============================================================================
@@ -13,6 +15,7 @@ static RTCStatus rtc_status = RTC_UNINITIALIZED;
 static uint32_t last_sync_time = 0;
 static uint32_t last_sync_timestamp = 0;
 static uint32_t successful_sync_count = 0;  // Track successful syncs for adaptive interval
+static bool sync_requested = false;         // Link came back: sync ahead of schedule
 
 // Note: Sync intervals and bootstrap timestamp are now in arduino_configs.h
 // CONFIG_RTC_SYNC_INTERVAL_INITIAL_MS, CONFIG_RTC_SYNC_INTERVAL_STABLE_MS,
@@ -63,17 +66,17 @@ RTCStatus syncRTCWithNetwork(void)
     sync_interval_ms = CONFIG_RTC_SYNC_INTERVAL_INITIAL_MS;
   } else {
     // Stable phase: sync infrequently (RTC drift is minimal ~0.036s/30min)
-    sync_interval_ms = CONFIG_RTC_SYNC_INTERVAL_STABLE_MS;
+    sync_interval_ms = settingGet<SETTING_RTC_SYNC_STABLE_MS>();
   }
 
   // Rate-limit sync attempts (adaptive interval)
-  if (now - last_sync_time < sync_interval_ms)
+  if (!sync_requested && now - last_sync_time < sync_interval_ms)
   {
     return rtc_status;  // Too soon to sync again, return current status
   }
 
   // Check if WiFi is connected
-  if (WiFi.status() != WL_CONNECTED)
+  if (!wifiIsUp())
   {
     return rtc_status;  // Can't sync without WiFi, return current status
   }
@@ -94,6 +97,7 @@ RTCStatus syncRTCWithNetwork(void)
   last_sync_timestamp = wifi_time;
   rtc_status = RTC_SYNCED;
   successful_sync_count++;  // Increment successful sync counter
+  sync_requested = false;
 
   DEBUG_PRINT(F("✓ RTC synced with network time: "));
   DEBUG_PRINT(wifi_time);
@@ -108,6 +112,17 @@ RTCStatus syncRTCWithNetwork(void)
   return RTC_SYNCED;
 }
 
+/**
+ * WiFi link callback - resync after every outage
+ */
+void rtcOnLinkChange(bool up)
+{
+  if (up)
+  {
+    sync_requested = true;
+  }
+}
+
 /**
  * Get current Unix timestamp from RTC
  */
@@ -0,0 +1,673 @@
+#include <Arduino.h>
+#include "rules/rules.h"
+#include "mqtt/publish_queue.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+
+// ============================================================================
+// BYTECODE - Stack machine on fixed-point values (thousandths)
+// ============================================================================
+
+#define FIX_ONE 1000L
+#define FIX_DECIMALS 3
+
+/**
+ * Opcodes
+ * OP_CONST is followed by a 4-byte little-endian value, OP_LOAD / OP_DELTA
+ * by a reading index; everything else is one byte
+ */
+typedef enum {
+  OP_CONST = 1,
+  OP_LOAD,
+  OP_DELTA,
+  OP_NEG,
+  OP_NOT,
+  OP_MUL,
+  OP_DIV,
+  OP_ADD,
+  OP_SUB,
+  OP_LT,
+  OP_LE,
+  OP_GT,
+  OP_GE,
+  OP_EQ,
+  OP_NE,
+  OP_AND,
+  OP_OR,
+  OP_PAREN   // Compiler only: open parenthesis on the operator stack
+} RuleOp;
+
+#define SENSOR_FIELD_COUNT 5   // SENSOR_CHANGE_TEMPERATURE .. SENSOR_CHANGE_UV
+
+/**
+ * Compiled Rule
+ */
+typedef struct {
+  char name[CONFIG_RULE_NAME_MAX_LEN];
+  uint8_t action;       // RuleAction
+  uint8_t len;          // Bytes used in code[]
+  bool active;          // Last known result (publish and alarm edges)
+  uint8_t code[CONFIG_RULE_CODE_MAX];
+} Rule;
+
+// ============================================================================
+// STATIC STATE - Loaded rules, previous sample and counters
+// ============================================================================
+
+static Rule rules[CONFIG_RULES_MAX];
+static RuleStats stats = {0, 0, 0, 0, 0, 0};
+
+// Samples in fixed point, one bit per valid reading
+static int32_t previous[SENSOR_FIELD_COUNT];
+static uint8_t previous_valid = 0;
+
+// ============================================================================
+// HELPER FUNCTIONS - Compiler
+// ============================================================================
+
+/**
+ * Precedence of a binary or unary operator (higher binds tighter)
+ */
+static uint8_t precedence(uint8_t op)
+{
+  switch (op)
+  {
+    case OP_NEG:
+    case OP_NOT: return 7;
+    case OP_MUL:
+    case OP_DIV: return 6;
+    case OP_ADD:
+    case OP_SUB: return 5;
+    case OP_LT:
+    case OP_LE:
+    case OP_GT:
+    case OP_GE:  return 4;
+    case OP_EQ:
+    case OP_NE:  return 3;
+    case OP_AND: return 2;
+    case OP_OR:  return 1;
+    default:     return 0;
+  }
+}
+
+/**
+ * Code being compiled and its stack depth at this point
+ */
+typedef struct {
+  Rule* rule;
+  uint8_t depth;
+  bool overflow;        // Code or stack limit exceeded
+} Emitter;
+
+static void emit(Emitter* e, uint8_t op, const void* operand, uint8_t operand_len)
+{
+  if (e->rule->len + 1 + operand_len > CONFIG_RULE_CODE_MAX)
+  {
+    e->overflow = true;
+    return;
+  }
+
+  e->rule->code[e->rule->len++] = op;
+  if (operand_len > 0)
+  {
+    memcpy(&e->rule->code[e->rule->len], operand, operand_len);
+    e->rule->len += operand_len;
+  }
+
+  if (op == OP_CONST || op == OP_LOAD || op == OP_DELTA)
+  {
+    if (++e->depth > CONFIG_RULE_STACK_DEPTH)
+    {
+      e->overflow = true;
+    }
+  }
+  else if (op != OP_NEG && op != OP_NOT)
+  {
+    e->depth--;  // Binary: two in, one out
+  }
+}
+
+/**
+ * Reading index for a name: the JSON key ("temperature_celsius") or the
+ * part before its first '_' ("temperature"); -1 if unknown
+ */
+static int8_t fieldIndex(const char* name, size_t len)
+{
+  for (uint8_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+  {
+    const char* key = sensorFieldName(1 << i);
+    const char* underscore = strchr(key, '_');
+    size_t short_len = underscore ? (size_t)(underscore - key) : strlen(key);
+
+    if ((len == strlen(key) || len == short_len) && strncmp(name, key, len) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * Parse a decimal number as fixed point (extra decimals are truncated)
+ * At least one digit is required ("." alone is not a number)
+ */
+static const char* parseNumber(const char* p, int32_t* value)
+{
+  if (!isdigit(p[0]) && !(p[0] == '.' && isdigit(p[1])))
+  {
+    return NULL;
+  }
+
+  int64_t whole = 0;
+  while (isdigit(*p))
+  {
+    whole = whole * 10 + (*p++ - '0');
+    if (whole > INT32_MAX / FIX_ONE)
+    {
+      return NULL;
+    }
+  }
+
+  int32_t fraction = 0;
+  uint8_t decimals = 0;
+  if (*p == '.')
+  {
+    p++;
+    for (; isdigit(*p); p++)
+    {
+      if (decimals < FIX_DECIMALS)
+      {
+        fraction = fraction * 10 + (*p - '0');
+        decimals++;
+      }
+    }
+  }
+  for (; decimals < FIX_DECIMALS; decimals++)
+  {
+    fraction *= 10;
+  }
+
+  *value = (int32_t)(whole * FIX_ONE + fraction);
+  return p;
+}
+
+/**
+ * Binary operator at p (symbols or and/or keywords), 0 if none
+ */
+static uint8_t parseBinaryOp(const char* p, uint8_t* op_len)
+{
+  static const struct { char text[4]; uint8_t op; } table[] = {
+    {"&&", OP_AND}, {"||", OP_OR}, {"<=", OP_LE}, {">=", OP_GE},
+    {"==", OP_EQ}, {"!=", OP_NE}, {"<", OP_LT}, {">", OP_GT},
+    {"+", OP_ADD}, {"-", OP_SUB}, {"*", OP_MUL}, {"/", OP_DIV},
+    {"and", OP_AND}, {"or", OP_OR}
+  };
+
+  for (uint8_t i = 0; i < sizeof(table) / sizeof(table[0]); i++)
+  {
+    size_t len = strlen(table[i].text);
+    if (strncmp(p, table[i].text, len) == 0 &&
+        (!isalpha(table[i].text[0]) || !isalnum(p[len])))
+    {
+      *op_len = len;
+      return table[i].op;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Infix to bytecode (shunting-yard)
+ *
+ * Returns:
+ *   NULL on success, otherwise the position of the error in expr
+ */
+static const char* compile(const char* expr, Rule* rule)
+{
+  uint8_t ops[CONFIG_RULE_CODE_MAX];
+  uint8_t op_count = 0;
+  bool expect_operand = true;
+  Emitter e = {rule, 0, false};
+  const char* p = expr;
+
+  rule->len = 0;
+
+  while (!e.overflow)
+  {
+    while (*p == ' ' || *p == '\t')
+    {
+      p++;
+    }
+    if (*p == '\0')
+    {
+      break;
+    }
+
+    if (op_count == sizeof(ops))
+    {
+      return p;
+    }
+
+    if (expect_operand)
+    {
+      if (isdigit(*p) || *p == '.')
+      {
+        int32_t value;
+        const char* end = parseNumber(p, &value);
+        if (!end)
+        {
+          return p;
+        }
+        emit(&e, OP_CONST, &value, sizeof(value));
+        p = end;
+        expect_operand = false;
+      }
+      else if (isalpha(*p) || *p == '_')
+      {
+        const char* start = p;
+        while (isalnum(*p) || *p == '_')
+        {
+          p++;
+        }
+
+        if (p - start == 3 && strncmp(start, "not", 3) == 0)
+        {
+          ops[op_count++] = OP_NOT;
+          continue;
+        }
+
+        bool delta = strncmp(start, "d_", 2) == 0;
+        int8_t field = delta ? fieldIndex(start + 2, p - start - 2) : fieldIndex(start, p - start);
+        if (field < 0)
+        {
+          return start;
+        }
+        uint8_t index = field;
+        emit(&e, delta ? OP_DELTA : OP_LOAD, &index, 1);
+        expect_operand = false;
+      }
+      else if (*p == '(')
+      {
+        ops[op_count++] = OP_PAREN;
+        p++;
+      }
+      else if (*p == '-' || *p == '!')
+      {
+        ops[op_count++] = (*p == '-') ? OP_NEG : OP_NOT;
+        p++;
+      }
+      else
+      {
+        return p;
+      }
+      continue;
+    }
+
+    if (*p == ')')
+    {
+      while (op_count > 0 && ops[op_count - 1] != OP_PAREN)
+      {
+        emit(&e, ops[--op_count], NULL, 0);
+      }
+      if (op_count == 0)
+      {
+        return p;  // Unbalanced
+      }
+      op_count--;
+      p++;
+      continue;
+    }
+
+    uint8_t op_len;
+    uint8_t op = parseBinaryOp(p, &op_len);
+    if (op == 0)
+    {
+      return p;
+    }
+
+    // Left-associative: emit pending operators that bind at least as tightly
+    while (op_count > 0 && ops[op_count - 1] != OP_PAREN &&
+           precedence(ops[op_count - 1]) >= precedence(op))
+    {
+      emit(&e, ops[--op_count], NULL, 0);
+    }
+    ops[op_count++] = op;
+    p += op_len;
+    expect_operand = true;
+  }
+
+  if (expect_operand)
+  {
+    return p;  // Empty or ends in an operator
+  }
+
+  while (op_count > 0)
+  {
+    if (ops[op_count - 1] == OP_PAREN)
+    {
+      return p;  // Unbalanced
+    }
+    emit(&e, ops[--op_count], NULL, 0);
+  }
+
+  return (e.overflow || e.depth != 1) ? expr : NULL;
+}
+
+// ============================================================================
+// HELPER FUNCTIONS - Evaluation
+// ============================================================================
+
+static int32_t saturate(int64_t value)
+{
+  if (value > INT32_MAX)
+  {
+    return INT32_MAX;
+  }
+  if (value < -INT32_MAX)
+  {
+    return -INT32_MAX;
+  }
+  return (int32_t)value;
+}
+
+/**
+ * Run one rule
+ *
+ * Returns:
+ *   false if the result is unknown (invalid reading, division by zero)
+ */
+static bool run(const Rule* rule, const int32_t* values, uint8_t valid, int32_t* result)
+{
+  int32_t stack[CONFIG_RULE_STACK_DEPTH];
+  uint8_t sp = 0;
+  uint8_t pc = 0;
+
+  while (pc < rule->len)
+  {
+    uint8_t op = rule->code[pc++];
+
+    if (op == OP_CONST)
+    {
+      memcpy(&stack[sp++], &rule->code[pc], sizeof(int32_t));
+      pc += sizeof(int32_t);
+      continue;
+    }
+    if (op == OP_LOAD || op == OP_DELTA)
+    {
+      uint8_t field = rule->code[pc++];
+      uint8_t need = (op == OP_DELTA) ? (valid & previous_valid) : valid;
+      if (!(need & (1 << field)))
+      {
+        return false;
+      }
+      stack[sp++] = (op == OP_DELTA) ? saturate((int64_t)values[field] - previous[field]) :
+                                       values[field];
+      continue;
+    }
+    if (op == OP_NEG)
+    {
+      stack[sp - 1] = -stack[sp - 1];
+      continue;
+    }
+    if (op == OP_NOT)
+    {
+      stack[sp - 1] = stack[sp - 1] ? 0 : FIX_ONE;
+      continue;
+    }
+
+    int32_t b = stack[--sp];
+    int32_t a = stack[sp - 1];
+    int32_t r;
+    switch (op)
+    {
+      case OP_MUL: r = saturate((int64_t)a * b / FIX_ONE); break;
+      case OP_DIV:
+        if (b == 0)
+        {
+          return false;
+        }
+        r = saturate((int64_t)a * FIX_ONE / b);
+        break;
+      case OP_ADD: r = saturate((int64_t)a + b); break;
+      case OP_SUB: r = saturate((int64_t)a - b); break;
+      case OP_LT:  r = (a < b) ? FIX_ONE : 0; break;
+      case OP_LE:  r = (a <= b) ? FIX_ONE : 0; break;
+      case OP_GT:  r = (a > b) ? FIX_ONE : 0; break;
+      case OP_GE:  r = (a >= b) ? FIX_ONE : 0; break;
+      case OP_EQ:  r = (a == b) ? FIX_ONE : 0; break;
+      case OP_NE:  r = (a != b) ? FIX_ONE : 0; break;
+      case OP_AND: r = (a && b) ? FIX_ONE : 0; break;
+      case OP_OR:  r = (a || b) ? FIX_ONE : 0; break;
+      default:     return false;
+    }
+    stack[sp - 1] = r;
+  }
+
+  *result = stack[0];
+  return true;
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void rulesClear(void)
+{
+  memset(rules, 0, sizeof(rules));
+  stats.count = 0;
+  previous_valid = 0;
+}
+
+bool ruleActionParse(const char* name, RuleAction* action)
+{
+  if (!name || !action)
+  {
+    return false;
+  }
+
+  if (strcmp(name, "publish") == 0)
+  {
+    *action = RULE_PUBLISH;
+  }
+  else if (strcmp(name, "drop") == 0)
+  {
+    *action = RULE_DROP;
+  }
+  else if (strcmp(name, "alarm") == 0)
+  {
+    *action = RULE_ALARM;
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+bool rulesAdd(const char* name, const char* expr, RuleAction action)
+{
+  if (!expr)
+  {
+    return false;
+  }
+  if (stats.count == CONFIG_RULES_MAX)
+  {
+    DEBUG_PRINTLN(F("⚠ Rule ignored (CONFIG_RULES_MAX reached)"));
+    return false;
+  }
+
+  Rule* rule = &rules[stats.count];
+  const char* error = compile(expr, rule);
+  if (error)
+  {
+    DEBUG_PRINT(F("✗ Rule syntax error at column "));
+    DEBUG_PRINT((int)(error - expr) + 1);
+    DEBUG_PRINT(F(" (or too long): "));
+    DEBUG_PRINTLN(expr);
+    memset(rule, 0, sizeof(Rule));
+    return false;
+  }
+
+  // Name becomes a topic level: keep it to [A-Za-z0-9_-]
+  if (name && name[0])
+  {
+    strlcpy(rule->name, name, sizeof(rule->name));
+    for (char* c = rule->name; *c; c++)
+    {
+      if (!isalnum(*c) && *c != '_' && *c != '-')
+      {
+        *c = '_';
+      }
+    }
+  }
+  else
+  {
+    snprintf(rule->name, sizeof(rule->name), "rule%u", stats.count + 1);
+  }
+
+  rule->action = action;
+  rule->active = false;
+  stats.count++;
+
+  DEBUG_PRINT(F("✓ Rule "));
+  DEBUG_PRINT(rule->name);
+  DEBUG_PRINT(F(": "));
+  DEBUG_PRINT(rule->len);
+  DEBUG_PRINTLN(F(" bytes of bytecode"));
+  return true;
+}
+
+uint8_t rulesCount(void)
+{
+  return stats.count;
+}
+
+void rulesEvaluate(const SensorReadings* readings, RuleVerdict* verdict)
+{
+  memset(verdict, 0, sizeof(*verdict));
+  if (!readings || stats.count == 0)
+  {
+    return;
+  }
+
+  uint32_t start = micros();
+
+  // Readings to fixed point once per sample; the rules only do integer math
+  int32_t values[SENSOR_FIELD_COUNT];
+  uint8_t valid = 0;
+  for (uint8_t i = 0; i < SENSOR_FIELD_COUNT; i++)
+  {
+    float value;
+    values[i] = 0;
+    if (getSensorField(readings, 1 << i, &value) && fabsf(value) < (float)(INT32_MAX / FIX_ONE))
+    {
+      values[i] = (int32_t)(value * FIX_ONE + (value < 0 ? -0.5f : 0.5f));
+      valid |= 1 << i;
+    }
+  }
+
+  for (uint8_t i = 0; i < stats.count; i++)
+  {
+    Rule* rule = &rules[i];
+    int32_t result;
+
+    stats.evaluations++;
+    if (!run(rule, values, valid, &result))
+    {
+      stats.unknown++;
+      if (rule->action == RULE_PUBLISH)
+      {
+        verdict->has_publish = true;
+      }
+      continue;  // Unknown: not true, and alarms keep their state
+    }
+
+    bool match = result != 0;
+    if (match)
+    {
+      stats.matches++;
+    }
+
+    switch (rule->action)
+    {
+      case RULE_PUBLISH:
+        // Edge-triggered like alarms: one message when it turns true
+        verdict->has_publish = true;
+        verdict->publish |= match && !rule->active;
+        rule->active = match;
+        break;
+      case RULE_DROP:
+        verdict->suppress |= match;
+        break;
+      case RULE_ALARM:
+        if (match != rule->active)
+        {
+          rule->active = match;
+          if (match)
+          {
+            verdict->raised |= 1 << i;
+          }
+          else
+          {
+            verdict->cleared |= 1 << i;
+          }
+          LOG_EVENT(LOG_RULE_ALARM, i, match);
+        }
+        break;
+    }
+  }
+
+  memcpy(previous, values, sizeof(previous));
+  previous_valid = valid;
+
+  uint32_t elapsed = micros() - start;
+  if (elapsed > stats.max_eval_us)
+  {
+    stats.max_eval_us = elapsed;
+  }
+}
+
+void rulesQueueAlarms(const RuleVerdict* verdict, const SensorReadings* readings,
+                      char* buffer, size_t buffer_size)
+{
+  if (!verdict || !buffer || buffer_size == 0)
+  {
+    return;
+  }
+
+  uint8_t changed = verdict->raised | verdict->cleared;
+  for (uint8_t i = 0; i < stats.count; i++)
+  {
+    if (!(changed & (1 << i)))
+    {
+      continue;
+    }
+
+    char subtopic[sizeof("alarm/") + CONFIG_RULE_NAME_MAX_LEN];
+    snprintf(subtopic, sizeof(subtopic), "alarm/%s", rules[i].name);
+
+    // {"active":true,"readings":{...}}
+    int len = snprintf(buffer, buffer_size, "{\"active\":%s,\"readings\":",
+                       (verdict->raised & (1 << i)) ? "true" : "false");
+    if (len <= 0 || (size_t)len >= buffer_size ||
+        !formatSensorJSON(readings, buffer + len, buffer_size - len - 1))
+    {
+      continue;
+    }
+    len += strlen(buffer + len);
+    buffer[len++] = '}';   // Room kept above
+    buffer[len] = '\0';
+
+    // A newer state replaces an unsent one; retained so subscribers see
+    // the current alarm state
+    if (publishQueuePush(PUBLISH_ALARM, subtopic, buffer, PUBLISH_RETAIN | PUBLISH_SUPERSEDE))
+    {
+      stats.alarms++;
+    }
+  }
+}
+
+const RuleStats* rulesGetStats(void)
+{
+  return &stats;
+}
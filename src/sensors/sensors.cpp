@@ -9,6 +9,8 @@
 // ============================================================================
 
 static bool sensors_initialized = false;
+static SensorInitState init_state = SENSORS_FAILED;
+static uint32_t warmup_started = 0;
 static bool has_uv_sensor = false;
 static SensorReadings last_valid_readings;
 
@@ -16,6 +18,42 @@ static SensorReadings last_valid_readings;
 // HELPER FUNCTIONS - Sensor detection and initialization
 // ============================================================================
 
+/**
+ * Print into a fixed char buffer (for the string formatters)
+ * Stops writing when full and remembers the overflow.
+ */
+class BufferPrint : public Print
+{
+public:
+  BufferPrint(char* buffer, size_t size) : buf(buffer), cap(size), len(0), overflow(false) {}
+
+  size_t write(uint8_t c) override
+  {
+    if (len + 1 >= cap)
+    {
+      overflow = true;
+      return 0;
+    }
+    buf[len++] = (char)c;
+    return 1;
+  }
+
+  /**
+   * NUL-terminate; returns the buffer, or NULL if anything was cut off
+   */
+  char* terminate(void)
+  {
+    buf[len] = '\0';
+    return overflow ? NULL : buf;
+  }
+
+private:
+  char* buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+};
+
 /**
  * Test if a sensor is available by attempting a read
  */
@@ -34,31 +72,11 @@ static bool testSensorAvailable(float (*test_read)(void))
   return !isnan(value);
 }
 
-// ============================================================================
-// PUBLIC API IMPLEMENTATION
-// ============================================================================
-
 /**
- * Initialize all available sensors
+ * Probe each sensor once warmed up
  */
-bool initSensors(void)
+static bool testSensors(void)
 {
-  DEBUG_PRINTLN(F(""));
-  DEBUG_PRINTLN(F("=== SENSOR INITIALIZATION ==="));
-  DEBUG_PRINTLN(F("→ Initializing MKR ENV Shield..."));
-
-  // Initialize the ENV shield (I2C sensors)
-  if (!ENV.begin())
-  {
-    DEBUG_PRINTLN(F("✗ Failed to initialize ENV shield - check I2C connection"));
-    sensors_initialized = false;
-    return false;
-  }
-
-  // Give sensors time to stabilize (2 second warm-up)
-  DEBUG_PRINTLN(F("→ Warming up sensors (2 seconds)..."));
-  delay(2000);
-
   // Initialize readings structure
   memset(&last_valid_readings, 0, sizeof(SensorReadings));
   last_valid_readings.uv_index = -1.0;  // Default UV to unavailable
@@ -141,6 +159,67 @@ bool initSensors(void)
   return false;
 }
 
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+/**
+ * Start the ENV shield; the warm-up runs in the background
+ */
+bool sensorsBegin(void)
+{
+  DEBUG_PRINTLN(F(""));
+  DEBUG_PRINTLN(F("=== SENSOR INITIALIZATION ==="));
+  DEBUG_PRINTLN(F("→ Initializing MKR ENV Shield..."));
+
+  sensors_initialized = false;
+
+  // Initialize the ENV shield (I2C sensors)
+  if (!ENV.begin())
+  {
+    DEBUG_PRINTLN(F("✗ Failed to initialize ENV shield - check I2C connection"));
+    init_state = SENSORS_FAILED;
+    return false;
+  }
+
+  // Give sensors time to stabilize before the first read
+  DEBUG_PRINT(F("→ Warming up sensors ("));
+  DEBUG_PRINT(CONFIG_SENSOR_WARMUP_MS);
+  DEBUG_PRINTLN(F(" ms, in the background)..."));
+  warmup_started = millis();
+  init_state = SENSORS_WARMING;
+  return true;
+}
+
+/**
+ * Finish initialization once the warm-up has elapsed
+ */
+SensorInitState sensorsInitPoll(void)
+{
+  if (init_state == SENSORS_WARMING && millis() - warmup_started >= CONFIG_SENSOR_WARMUP_MS)
+  {
+    init_state = testSensors() ? SENSORS_READY : SENSORS_FAILED;
+  }
+  return init_state;
+}
+
+/**
+ * Initialize all available sensors (blocking)
+ */
+bool initSensors(void)
+{
+  if (!sensorsBegin())
+  {
+    return false;
+  }
+
+  while (sensorsInitPoll() == SENSORS_WARMING)
+  {
+    delay(10);
+  }
+  return init_state == SENSORS_READY;
+}
+
 /**
  * Read all sensor values
  */
@@ -254,15 +333,17 @@ bool areSensorsReady(void)
 }
 
 /**
- * Check if sensor readings have changed significantly
+ * Compute which sensor readings have changed significantly
  */
-bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr)
+uint8_t computeChangeMask(const SensorReadings* prev, const SensorReadings* curr)
 {
   if (!prev || !curr)
   {
-    return true;  // Invalid pointers = treat as significant change (force publish)
+    return SENSOR_CHANGE_ALL;  // Invalid pointers = treat as significant change (force publish)
   }
 
+  uint8_t mask = 0;
+
   // ========================================================================
   // Check Temperature Change
   // ========================================================================
@@ -270,7 +351,7 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
   {
     if (fabs(curr->temperature - prev->temperature) >= CONFIG_TEMP_THRESHOLD_CELSIUS)
     {
-      return true;
+      mask |= SENSOR_CHANGE_TEMPERATURE;
     }
   }
 
@@ -281,7 +362,7 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
   {
     if (fabs(curr->humidity - prev->humidity) >= CONFIG_HUMIDITY_THRESHOLD_PERCENT)
     {
-      return true;
+      mask |= SENSOR_CHANGE_HUMIDITY;
     }
   }
 
@@ -292,7 +373,7 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
   {
     if (fabs(curr->pressure - prev->pressure) >= CONFIG_PRESSURE_THRESHOLD_HPA)
     {
-      return true;
+      mask |= SENSOR_CHANGE_PRESSURE;
     }
   }
 
@@ -305,16 +386,15 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
     float abs_diff = fabs(curr->illuminance - prev->illuminance);
     if (abs_diff >= CONFIG_ILLUMINANCE_THRESHOLD_ABS_LUX)
     {
-      return true;
+      mask |= SENSOR_CHANGE_ILLUMINANCE;
     }
-
     // Check relative percentage change (avoid division by zero)
-    if (prev->illuminance > CONFIG_ILLUMINANCE_THRESHOLD_ABS_LUX)
+    else if (prev->illuminance > CONFIG_ILLUMINANCE_THRESHOLD_ABS_LUX)
     {
       float relative_change = (abs_diff / prev->illuminance) * 100.0;
       if (relative_change >= CONFIG_ILLUMINANCE_THRESHOLD_PERCENT)
       {
-        return true;
+        mask |= SENSOR_CHANGE_ILLUMINANCE;
       }
     }
   }
@@ -329,7 +409,7 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
     {
       if (fabs(curr->uv_index - prev->uv_index) >= CONFIG_UV_THRESHOLD_INDEX)
       {
-        return true;
+        mask |= SENSOR_CHANGE_UV;
       }
     }
   }
@@ -338,245 +418,181 @@ bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr
   // Check Validity Flag Changes (sensor recovery or failure)
   // ========================================================================
   if (prev->temp_valid != curr->temp_valid)
-    return true;
+    mask |= SENSOR_CHANGE_TEMPERATURE;
   if (prev->humidity_valid != curr->humidity_valid)
-    return true;
+    mask |= SENSOR_CHANGE_HUMIDITY;
   if (prev->pressure_valid != curr->pressure_valid)
-    return true;
+    mask |= SENSOR_CHANGE_PRESSURE;
   if (prev->light_valid != curr->light_valid)
-    return true;
+    mask |= SENSOR_CHANGE_ILLUMINANCE;
   if (prev->uv_valid != curr->uv_valid)
-    return true;
+    mask |= SENSOR_CHANGE_UV;
 
-  // ========================================================================
-  // No significant changes detected
-  // ========================================================================
-  return false;
+  return mask;
 }
 
 /**
- * Format sensor readings as JSON
+ * Check if sensor readings have changed significantly
  */
-char* formatSensorJSON(const SensorReadings* readings,
-                       char* buffer, size_t buffer_size)
+bool hasSignificantChange(const SensorReadings* prev, const SensorReadings* curr)
 {
-  if (!readings || !buffer || buffer_size < 50)
-  {
-    return NULL;
-  }
-
-  // Start building JSON (use temp_valid to know if we've added any fields)
-  int offset = 0;
-  buffer[offset++] = '{';
+  return computeChangeMask(prev, curr) != 0;
+}
 
-  // Add temperature if valid
-  if (readings->temp_valid)
+/**
+ * Get the JSON key / subtopic name of one reading
+ */
+const char* sensorFieldName(uint8_t field)
+{
+  switch (field)
   {
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"temperature_celsius\":%.1f,", readings->temperature);
+    case SENSOR_CHANGE_TEMPERATURE: return "temperature_celsius";
+    case SENSOR_CHANGE_HUMIDITY:    return "humidity_percent";
+    case SENSOR_CHANGE_PRESSURE:    return "pressure_millibar";
+    case SENSOR_CHANGE_ILLUMINANCE: return "illuminance_lux";
+    case SENSOR_CHANGE_UV:          return "uv_index";
+    default:                        return NULL;
   }
+}
 
-  // Add humidity if valid
-  if (readings->humidity_valid)
+/**
+ * Get one reading if its sensor is valid
+ */
+bool getSensorField(const SensorReadings* readings, uint8_t field, float* value)
+{
+  if (!readings || !value)
   {
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"humidity_percent\":%.1f,", readings->humidity);
+    return false;
   }
 
-  // Add pressure if valid
-  if (readings->pressure_valid)
-  {
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"pressure_millibar\":%.1f,", readings->pressure);
+  switch (field)
+  {
+    case SENSOR_CHANGE_TEMPERATURE:
+      *value = readings->temperature;
+      return readings->temp_valid;
+    case SENSOR_CHANGE_HUMIDITY:
+      *value = readings->humidity;
+      return readings->humidity_valid;
+    case SENSOR_CHANGE_PRESSURE:
+      *value = readings->pressure;
+      return readings->pressure_valid;
+    case SENSOR_CHANGE_ILLUMINANCE:
+      *value = readings->illuminance;
+      return readings->light_valid;
+    case SENSOR_CHANGE_UV:
+      *value = readings->uv_index;
+      return readings->uv_valid && readings->uv_index >= 0;
+    default:
+      return false;
   }
+}
 
-  // Add illuminance if valid
-  if (readings->light_valid)
+/**
+ * Get the mask of readings whose sensor is valid
+ */
+uint8_t sensorValidMask(const SensorReadings* readings)
+{
+  uint8_t mask = 0;
+  float value;
+  for (uint8_t field = SENSOR_CHANGE_TEMPERATURE; field & SENSOR_CHANGE_ALL; field <<= 1)
   {
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"illuminance_lux\":%.1f,", readings->illuminance);
+    if (getSensorField(readings, field, &value))
+    {
+      mask |= field;
+    }
   }
+  return mask;
+}
 
-  // Add UV index if valid
-  if (readings->uv_valid && readings->uv_index >= 0)
+/**
+ * Format one reading as a plain number
+ */
+char* formatSensorValue(const SensorReadings* readings, uint8_t field,
+                        char* buffer, size_t buffer_size)
+{
+  if (!buffer || buffer_size == 0)
   {
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"uv_index\":%.1f,", readings->uv_index);
+    return NULL;
   }
 
-  // Always add timestamp
-  offset += snprintf(buffer + offset, buffer_size - offset,
-                     "\"timestamp\":%lu", readings->timestamp);
-
-  // Close JSON
-  if (offset + 1 < buffer_size)
+  BufferPrint out(buffer, buffer_size);
+  float value;
+  if (getSensorField(readings, field, &value))
   {
-    buffer[offset++] = '}';
-    buffer[offset] = '\0';
-    return buffer;
+    out.print(value, 1);
   }
-
-  // Buffer overflow
-  return NULL;
+  return out.terminate();
 }
 
 /**
- * Format only changed sensor values as JSON
- *
- * Compares current against previous and includes only fields that changed
- * significantly. Used for optimized change-triggered publishing.
+ * Write sensor readings as JSON to a stream
  */
-char* formatChangedSensorJSON(const SensorReadings* prev, const SensorReadings* curr,
-                              char* buffer, size_t buffer_size)
+size_t writeSensorJSON(Print& out, const SensorReadings* readings, uint8_t fields)
 {
-  if (!prev || !curr || !buffer || buffer_size < 50)
+  if (!readings)
   {
-    return NULL;
+    return 0;
   }
 
-  int offset = 0;
-  buffer[offset++] = '{';
-  bool added_field = false;
-
-  // Helper macro to add comma before field if needed
-  #define ADD_COMMA() if (added_field) { buffer[offset++] = ','; }
+  size_t written = out.print('{');
 
-  // Check Temperature Change
-  if (prev->temp_valid && curr->temp_valid)
+  // Only valid sensors, each followed by a comma (timestamp always closes)
+  for (uint8_t field = SENSOR_CHANGE_TEMPERATURE; field & SENSOR_CHANGE_ALL; field <<= 1)
   {
-    if (fabs(curr->temperature - prev->temperature) >= CONFIG_TEMP_THRESHOLD_CELSIUS)
+    float value;
+    if ((fields & field) && getSensorField(readings, field, &value))
     {
-      ADD_COMMA();
-      offset += snprintf(buffer + offset, buffer_size - offset,
-                         "\"temperature_celsius\":%.1f", curr->temperature);
-      added_field = true;
+      written += out.print('"');
+      written += out.print(sensorFieldName(field));
+      written += out.print(F("\":"));
+      written += out.print(value, 1);
+      written += out.print(',');
     }
   }
-  else if (prev->temp_valid != curr->temp_valid && curr->temp_valid)
-  {
-    // Temperature sensor recovered
-    ADD_COMMA();
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"temperature_celsius\":%.1f", curr->temperature);
-    added_field = true;
-  }
 
-  // Check Humidity Change
-  if (prev->humidity_valid && curr->humidity_valid)
-  {
-    if (fabs(curr->humidity - prev->humidity) >= CONFIG_HUMIDITY_THRESHOLD_PERCENT)
-    {
-      ADD_COMMA();
-      offset += snprintf(buffer + offset, buffer_size - offset,
-                         "\"humidity_percent\":%.1f", curr->humidity);
-      added_field = true;
-    }
-  }
-  else if (prev->humidity_valid != curr->humidity_valid && curr->humidity_valid)
-  {
-    // Humidity sensor recovered
-    ADD_COMMA();
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"humidity_percent\":%.1f", curr->humidity);
-    added_field = true;
-  }
+  // Always add timestamp
+  written += out.print(F("\"timestamp\":"));
+  written += out.print(readings->timestamp);
+  written += out.print('}');
+  return written;
+}
 
-  // Check Pressure Change
-  if (prev->pressure_valid && curr->pressure_valid)
-  {
-    if (fabs(curr->pressure - prev->pressure) >= CONFIG_PRESSURE_THRESHOLD_HPA)
-    {
-      ADD_COMMA();
-      offset += snprintf(buffer + offset, buffer_size - offset,
-                         "\"pressure_millibar\":%.1f", curr->pressure);
-      added_field = true;
-    }
-  }
-  else if (prev->pressure_valid != curr->pressure_valid && curr->pressure_valid)
+/**
+ * Format sensor readings as JSON
+ */
+char* formatSensorJSON(const SensorReadings* readings,
+                       char* buffer, size_t buffer_size)
+{
+  if (!readings || !buffer || buffer_size < 50)
   {
-    // Pressure sensor recovered
-    ADD_COMMA();
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"pressure_millibar\":%.1f", curr->pressure);
-    added_field = true;
+    return NULL;
   }
 
-  // Check Illuminance Change (relative % and absolute thresholds)
-  if (prev->light_valid && curr->light_valid)
-  {
-    float abs_diff = fabs(curr->illuminance - prev->illuminance);
-    bool changed = false;
-
-    if (abs_diff >= CONFIG_ILLUMINANCE_THRESHOLD_ABS_LUX)
-    {
-      changed = true;
-    }
-    else if (prev->illuminance > CONFIG_ILLUMINANCE_THRESHOLD_ABS_LUX)
-    {
-      float relative_change = (abs_diff / prev->illuminance) * 100.0;
-      if (relative_change >= CONFIG_ILLUMINANCE_THRESHOLD_PERCENT)
-      {
-        changed = true;
-      }
-    }
-
-    if (changed)
-    {
-      ADD_COMMA();
-      offset += snprintf(buffer + offset, buffer_size - offset,
-                         "\"illuminance_lux\":%.1f", curr->illuminance);
-      added_field = true;
-    }
-  }
-  else if (prev->light_valid != curr->light_valid && curr->light_valid)
-  {
-    // Light sensor recovered
-    ADD_COMMA();
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"illuminance_lux\":%.1f", curr->illuminance);
-    added_field = true;
-  }
+  BufferPrint out(buffer, buffer_size);
+  writeSensorJSON(out, readings, SENSOR_CHANGE_ALL);
 
-  // Check UV Index Change
-  if (prev->uv_valid && curr->uv_valid)
-  {
-    if (prev->uv_index >= 0 && curr->uv_index >= 0)
-    {
-      if (fabs(curr->uv_index - prev->uv_index) >= CONFIG_UV_THRESHOLD_INDEX)
-      {
-        ADD_COMMA();
-        offset += snprintf(buffer + offset, buffer_size - offset,
-                           "\"uv_index\":%.1f", curr->uv_index);
-        added_field = true;
-      }
-    }
-  }
-  else if (prev->uv_valid != curr->uv_valid && curr->uv_valid)
-  {
-    // UV sensor recovered
-    ADD_COMMA();
-    offset += snprintf(buffer + offset, buffer_size - offset,
-                       "\"uv_index\":%.1f", curr->uv_index);
-    added_field = true;
-  }
+  // NULL on buffer overflow
+  return out.terminate();
+}
 
-  // Always add timestamp
-  if (added_field)
+/**
+ * Format only changed sensor values as JSON
+ *
+ * Compares current against previous and includes only fields that changed
+ * significantly (or whose sensor recovered). Used for optimized
+ * change-triggered publishing.
+ */
+char* formatChangedSensorJSON(const SensorReadings* prev, const SensorReadings* curr,
+                              char* buffer, size_t buffer_size)
+{
+  if (!prev || !curr || !buffer || buffer_size < 50)
   {
-    buffer[offset++] = ',';
+    return NULL;
   }
-  offset += snprintf(buffer + offset, buffer_size - offset,
-                     "\"timestamp\":%lu", curr->timestamp);
 
-  // Close JSON
-  if (offset + 1 < buffer_size)
-  {
-    buffer[offset++] = '}';
-    buffer[offset] = '\0';
-    return buffer;
-  }
+  BufferPrint out(buffer, buffer_size);
+  writeSensorJSON(out, curr, computeChangeMask(prev, curr));
 
-  // Buffer overflow
-  return NULL;
-  #undef ADD_COMMA
+  // NULL on buffer overflow
+  return out.terminate();
 }
@@ -0,0 +1,645 @@
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "settings/settings.h"
+#include "log/log.h"
+#include "ota/flash_bank.h"
+#include "arduino_configs.h"
+
+#define SETTINGS_MAGIC 0x53455431UL  // "SET1"
+
+// Defaults must be valid values of their own entry, and names must fit
+// the command parser
+#define X(key, name, type, def, lo, hi) \
+  static_assert((uint32_t)(def) >= (lo) && (uint32_t)(def) <= (hi) && \
+                (uint64_t)(hi) <= (uint64_t)(type)~(type)0, \
+                "Default or range of setting " #name " is invalid"); \
+  static_assert(sizeof(#name) <= CONFIG_SETTINGS_NAME_MAX_LEN, \
+                "Setting name " #name " exceeds CONFIG_SETTINGS_NAME_MAX_LEN");
+SETTINGS_TABLE(X)
+#undef X
+
+// Ordered pairs must start out ordered
+static constexpr uint32_t defaults[SETTING_COUNT] = {
+#define X(key, name, type, def, ...) (uint32_t)(def),
+  SETTINGS_TABLE(X)
+#undef X
+};
+#define X(low, high) \
+  static_assert(defaults[SETTING_##low] <= defaults[SETTING_##high], \
+                "Defaults of " #low " and " #high " are inverted");
+SETTINGS_ORDER(X)
+#undef X
+
+/**
+ * Entry Descriptor (generated from the table)
+ */
+typedef struct {
+  const char* name;
+  uint8_t offset;              // Into Settings
+  uint8_t size;                // 1, 2 or 4 bytes
+  uint32_t def;
+  uint32_t min;
+  uint32_t max;
+} SettingInfo;
+
+/**
+ * Ordered Pair (generated from SETTINGS_ORDER)
+ */
+typedef struct {
+  uint8_t low;                 // SettingKey kept <= high
+  uint8_t high;
+} SettingOrder;
+
+/**
+ * Changes of one config or command held back because they would invert a
+ * pair; retried once the rest of the batch is in
+ */
+typedef struct {
+  SettingOverride held[SETTING_COUNT];
+  uint8_t count;
+  SettingSource source;
+} SettingBatch;
+
+/**
+ * Saved Overrides (one flash row)
+ */
+typedef struct {
+  uint32_t magic;
+  uint32_t layout;             // Hash of the table's names and sizes
+  uint8_t source[SETTING_COUNT];  // SettingSource; DEFAULT = not overridden
+  Settings values;
+} SettingsStore;
+
+static_assert(sizeof(Settings) <= 255, "Settings offsets must fit a byte");
+static_assert(sizeof(SettingsStore) <= FLASH_BANK_ROW_SIZE, "Saved settings must fit one flash row");
+
+// ============================================================================
+// STATIC STATE - Values, descriptors and the saved row
+// ============================================================================
+
+Settings settings_values = {
+#define X(key, name, type, def, ...) (type)(def),
+  SETTINGS_TABLE(X)
+#undef X
+};
+
+static const SettingInfo info[SETTING_COUNT] = {
+#define X(key, name, type, def, lo, hi) \
+  {#name, (uint8_t)offsetof(Settings, name), (uint8_t)sizeof(type), (def), (lo), (hi)},
+  SETTINGS_TABLE(X)
+#undef X
+};
+
+static const SettingOrder order[] = {
+#define X(low, high) {SETTING_##low, SETTING_##high},
+  SETTINGS_ORDER(X)
+#undef X
+};
+
+static uint8_t sources[SETTING_COUNT];   // SettingSource per key
+static SettingsStore saved;              // What flash holds
+static bool dirty = false;
+static uint32_t changed_at = 0;
+
+static SettingListener listeners[CONFIG_SETTINGS_MAX_LISTENERS];
+static uint8_t listener_count = 0;
+
+static SettingsStats stats = {0, 0, 0, 0, "", SETTING_OK};
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static uint32_t readField(const Settings* values, SettingKey key)
+{
+  const uint8_t* field = (const uint8_t*)values + info[key].offset;
+  switch (info[key].size)
+  {
+    case 1:
+      return *field;
+    case 2:
+    {
+      uint16_t value;
+      memcpy(&value, field, sizeof(value));
+      return value;
+    }
+    default:
+    {
+      uint32_t value;
+      memcpy(&value, field, sizeof(value));
+      return value;
+    }
+  }
+}
+
+static void writeField(Settings* values, SettingKey key, uint32_t value)
+{
+  uint8_t* field = (uint8_t*)values + info[key].offset;
+  switch (info[key].size)
+  {
+    case 1:
+      *field = (uint8_t)value;
+      break;
+    case 2:
+    {
+      uint16_t narrow = (uint16_t)value;
+      memcpy(field, &narrow, sizeof(narrow));
+      break;
+    }
+    default:
+      memcpy(field, &value, sizeof(value));
+      break;
+  }
+}
+
+/**
+ * FNV-1a over every entry's name and size: changes when the table does
+ */
+static uint32_t layoutHash(void)
+{
+  uint32_t hash = 2166136261UL;
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    for (const char* p = info[k].name; *p; p++)
+    {
+      hash = (hash ^ (uint8_t)*p) * 16777619UL;
+    }
+    hash = (hash ^ info[k].size) * 16777619UL;
+  }
+  return hash;
+}
+
+static void countOverrides(void)
+{
+  stats.overrides = 0;
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    if (sources[k] != SETTING_SOURCE_DEFAULT)
+    {
+      stats.overrides++;
+    }
+  }
+}
+
+static SettingResult reject(const char* name, uint8_t key, SettingResult reason)
+{
+  stats.rejected++;
+  stats.last_reason = reason;
+  strlcpy(stats.last_rejected, name, sizeof(stats.last_rejected));
+  LOG_EVENT(LOG_SETTING_REJECTED, key, reason);
+
+  DEBUG_PRINT(F("✗ Setting "));
+  DEBUG_PRINT(name);
+  DEBUG_PRINT(F(" rejected: "));
+  DEBUG_PRINTLN(settingResultName(reason));
+  return reason;
+}
+
+/**
+ * SETTING_CONFLICT if the value would put the key on the wrong side of the
+ * other end of its pair (current value)
+ */
+static SettingResult checkOrder(SettingKey key, uint32_t value)
+{
+  for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++)
+  {
+    if ((key == order[i].low && value > readField(&settings_values, (SettingKey)order[i].high)) ||
+        (key == order[i].high && value < readField(&settings_values, (SettingKey)order[i].low)))
+    {
+      return SETTING_CONFLICT;
+    }
+  }
+  return SETTING_OK;
+}
+
+/**
+ * Apply one change of a batch, or hold it back when it only conflicts
+ * with its pair (the other end may still move in this batch). A key with
+ * a held change holds its later ones too, so they land in order.
+ */
+static SettingResult batchApply(SettingBatch* batch, SettingKey key, bool reset, uint32_t value)
+{
+  bool held = false;
+  for (uint8_t i = 0; i < batch->count; i++)
+  {
+    held = held || batch->held[i].key == key;
+  }
+  if (!held && (reset || settingCheck(key, value) == SETTING_OK))
+  {
+    held = checkOrder(key, reset ? info[key].def : value) == SETTING_CONFLICT;
+  }
+
+  if (held && batch->count < SETTING_COUNT)
+  {
+    SettingOverride* change = &batch->held[batch->count++];
+    change->key = key;
+    change->reset = reset;
+    change->value = value;
+    return SETTING_CONFLICT;  // Not counted as rejected (yet)
+  }
+  return reset ? settingReset(key) : settingSet(key, value, batch->source);
+}
+
+/**
+ * Retry the held changes (refused now if the pair is still inverted)
+ *
+ * Returns:
+ *   Number of settings changed
+ */
+static uint8_t batchFinish(SettingBatch* batch)
+{
+  uint8_t changed = 0;
+  for (uint8_t i = 0; i < batch->count; i++)
+  {
+    const SettingOverride* change = &batch->held[i];
+    SettingResult result = change->reset ? settingReset((SettingKey)change->key) :
+                           settingSet((SettingKey)change->key, change->value, batch->source);
+    if (result == SETTING_OK)
+    {
+      changed++;
+    }
+  }
+  batch->count = 0;
+  return changed;
+}
+
+/**
+ * Store a checked value and tell the listeners
+ */
+static SettingResult store(SettingKey key, uint32_t value, SettingSource source)
+{
+  uint32_t previous = readField(&settings_values, key);
+  if (previous == value && sources[key] == source)
+  {
+    return SETTING_UNCHANGED;
+  }
+
+  writeField(&settings_values, key, value);
+  sources[key] = source;
+  countOverrides();
+  dirty = true;
+  changed_at = millis();
+  LOG_EVENT(LOG_SETTING_CHANGED, key, value, source);
+
+  DEBUG_PRINT(F("→ Setting "));
+  DEBUG_PRINT(info[key].name);
+  DEBUG_PRINT(F(" = "));
+  DEBUG_PRINT(value);
+  DEBUG_PRINT(F(" ("));
+  DEBUG_PRINT(settingSourceName(source));
+  DEBUG_PRINTLN(F(")"));
+
+  if (previous == value)
+  {
+    return SETTING_UNCHANGED;  // Only the source moved (saved, nothing to tell)
+  }
+
+  stats.changes++;
+  for (uint8_t i = 0; i < listener_count; i++)
+  {
+    listeners[i](key);
+  }
+  return SETTING_OK;
+}
+
+/**
+ * Parse one "name=value" command pair
+ */
+static SettingResult applyPair(SettingBatch* batch, const char* pair, size_t length)
+{
+  char name[CONFIG_SETTINGS_NAME_MAX_LEN];
+  const char* equals = (const char*)memchr(pair, '=', length);
+  size_t name_len = equals ? (size_t)(equals - pair) : length;
+  if (name_len >= sizeof(name))
+  {
+    name_len = sizeof(name) - 1;
+  }
+  memcpy(name, pair, name_len);
+  name[name_len] = '\0';
+
+  SettingKey key;
+  if (!settingFind(name, &key))
+  {
+    return reject(name, SETTING_COUNT, SETTING_UNKNOWN_KEY);
+  }
+
+  // Value: digits only, up to the end of the pair
+  char text[12];
+  size_t text_len = equals ? length - name_len - 1 : 0;
+  if (text_len == 0 || text_len >= sizeof(text))
+  {
+    return reject(name, key, SETTING_BAD_VALUE);
+  }
+  memcpy(text, equals + 1, text_len);
+  text[text_len] = '\0';
+
+  if (strcmp(text, "default") == 0)
+  {
+    return batchApply(batch, key, true, 0);
+  }
+
+  char* end;
+  unsigned long value = strtoul(text, &end, 10);
+  if (text[0] < '0' || text[0] > '9' || *end != '\0' || value > 0xFFFFFFFFUL)
+  {
+    return reject(name, key, SETTING_BAD_VALUE);
+  }
+  return batchApply(batch, key, false, (uint32_t)value);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+void settingsBegin(void)
+{
+  flashRowRead(FLASH_ROW_SETTINGS, &saved, sizeof(saved));
+  if (saved.magic != SETTINGS_MAGIC || saved.layout != layoutHash())
+  {
+    // Unset row, or written by a build with another table
+    memset(&saved, 0, sizeof(saved));
+    DEBUG_PRINTLN(F("→ Settings: compile-time defaults"));
+    return;
+  }
+
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    SettingKey key = (SettingKey)k;
+    uint32_t value = readField(&saved.values, key);
+    if (saved.source[k] == SETTING_SOURCE_DEFAULT || saved.source[k] > SETTING_SOURCE_COMMAND)
+    {
+      continue;
+    }
+    if (settingCheck(key, value) != SETTING_OK)
+    {
+      continue;  // Range narrowed since it was saved
+    }
+    writeField(&settings_values, key, value);
+    sources[k] = saved.source[k];
+  }
+  countOverrides();
+
+  DEBUG_PRINT(F("✓ Settings: "));
+  DEBUG_PRINT(stats.overrides);
+  DEBUG_PRINTLN(F(" override(s) loaded from flash"));
+}
+
+void settingsPoll(uint32_t now)
+{
+  if (!dirty || now - changed_at < CONFIG_SETTINGS_SAVE_DELAY_MS)
+  {
+    return;
+  }
+  dirty = false;
+
+  SettingsStore current;
+  memset(&current, 0, sizeof(current));
+  current.magic = SETTINGS_MAGIC;
+  current.layout = layoutHash();
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    current.source[k] = sources[k];
+    if (sources[k] != SETTING_SOURCE_DEFAULT)
+    {
+      writeField(&current.values, (SettingKey)k, readField(&settings_values, (SettingKey)k));
+    }
+  }
+
+  // Only write on change: a flash row survives ~25k erase cycles
+  if (memcmp(&current, &saved, sizeof(current)) == 0)
+  {
+    return;
+  }
+
+  if (!flashRowWrite(FLASH_ROW_SETTINGS, &current, sizeof(current)))
+  {
+    DEBUG_PRINTLN(F("✗ Settings: flash write failed"));
+    return;
+  }
+  saved = current;
+  stats.saves++;
+
+  DEBUG_PRINT(F("✓ Settings saved ("));
+  DEBUG_PRINT(stats.overrides);
+  DEBUG_PRINTLN(F(" overrides)"));
+}
+
+bool settingsAddListener(SettingListener listener)
+{
+  if (!listener || listener_count >= CONFIG_SETTINGS_MAX_LISTENERS)
+  {
+    return false;
+  }
+  listeners[listener_count++] = listener;
+  return true;
+}
+
+SettingResult settingCheck(SettingKey key, uint32_t value)
+{
+  if (key >= SETTING_COUNT)
+  {
+    return SETTING_UNKNOWN_KEY;
+  }
+  if (value < info[key].min || value > info[key].max)
+  {
+    return SETTING_OUT_OF_RANGE;
+  }
+  return SETTING_OK;
+}
+
+SettingResult settingSet(SettingKey key, uint32_t value, SettingSource source)
+{
+  SettingResult result = settingCheck(key, value);
+  if (result == SETTING_OK)
+  {
+    result = checkOrder(key, value);
+  }
+  if (result != SETTING_OK)
+  {
+    return reject(key < SETTING_COUNT ? info[key].name : "?", key, result);
+  }
+  return store(key, value, source);
+}
+
+SettingResult settingReset(SettingKey key)
+{
+  if (key >= SETTING_COUNT)
+  {
+    return reject("?", key, SETTING_UNKNOWN_KEY);
+  }
+  if (checkOrder(key, info[key].def) != SETTING_OK)
+  {
+    return reject(info[key].name, key, SETTING_CONFLICT);
+  }
+  return store(key, info[key].def, SETTING_SOURCE_DEFAULT);
+}
+
+uint8_t settingsApply(const SettingOverride* overrides, uint8_t count, SettingSource source)
+{
+  bool listed[SETTING_COUNT] = {false};
+  SettingBatch batch;
+  batch.count = 0;
+  batch.source = source;
+  uint8_t changed = 0;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    SettingKey key = (SettingKey)overrides[i].key;
+    if (key >= SETTING_COUNT)
+    {
+      continue;
+    }
+    listed[key] = true;
+    if (batchApply(&batch, key, overrides[i].reset, overrides[i].value) == SETTING_OK)
+    {
+      changed++;
+    }
+  }
+
+  // Dropped from this source's list: back to the default
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    if (!listed[k] && sources[k] == source &&
+        batchApply(&batch, (SettingKey)k, true, 0) == SETTING_OK)
+    {
+      changed++;
+    }
+  }
+  return changed + batchFinish(&batch);
+}
+
+uint8_t settingsApplyCommand(const char* command)
+{
+  SettingBatch batch;
+  batch.count = 0;
+  batch.source = SETTING_SOURCE_COMMAND;
+  uint8_t changed = 0;
+  const char* p = command;
+
+  while (*p)
+  {
+    size_t skip = strspn(p, " ,;\t\r\n");
+    p += skip;
+    size_t length = strcspn(p, " ,;\t\r\n");
+    if (length == 0)
+    {
+      break;
+    }
+    if (applyPair(&batch, p, length) == SETTING_OK)
+    {
+      changed++;
+    }
+    p += length;
+  }
+  return changed + batchFinish(&batch);
+}
+
+bool settingFind(const char* name, SettingKey* key)
+{
+  for (uint8_t k = 0; k < SETTING_COUNT; k++)
+  {
+    if (strcmp(name, info[k].name) == 0)
+    {
+      *key = (SettingKey)k;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t settingValue(SettingKey key)
+{
+  return key < SETTING_COUNT ? readField(&settings_values, key) : 0;
+}
+
+SettingSource settingSource(SettingKey key)
+{
+  return key < SETTING_COUNT ? (SettingSource)sources[key] : SETTING_SOURCE_DEFAULT;
+}
+
+const char* settingName(SettingKey key)
+{
+  return key < SETTING_COUNT ? info[key].name : "unknown";
+}
+
+const char* settingSourceName(SettingSource source)
+{
+  switch (source)
+  {
+    case SETTING_SOURCE_SERVER:  return "server";
+    case SETTING_SOURCE_COMMAND: return "command";
+    default:                     return "default";
+  }
+}
+
+const char* settingResultName(SettingResult result)
+{
+  switch (result)
+  {
+    case SETTING_OK:           return "ok";
+    case SETTING_UNCHANGED:    return "unchanged";
+    case SETTING_UNKNOWN_KEY:  return "unknown_key";
+    case SETTING_BAD_VALUE:    return "bad_value";
+    case SETTING_OUT_OF_RANGE: return "out_of_range";
+    case SETTING_CONFLICT:     return "conflict";
+    default:                   return "unknown";
+  }
+}
+
+const SettingsStats* settingsGetStats(void)
+{
+  return &stats;
+}
+
+char* settingsFormatJSON(char* buffer, size_t buffer_size)
+{
+  if (!buffer || buffer_size < 32)
+  {
+    return NULL;
+  }
+
+  int offset = snprintf(buffer, buffer_size, "{\"values\":{");
+  for (uint8_t k = 0; k < SETTING_COUNT && offset < (int)buffer_size; k++)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset, "%s\"%s\":%lu",
+                       k ? "," : "", info[k].name, readField(&settings_values, (SettingKey)k));
+  }
+
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset, "},\"overrides\":{");
+  }
+  bool first = true;
+  for (uint8_t k = 0; k < SETTING_COUNT && offset < (int)buffer_size; k++)
+  {
+    if (sources[k] != SETTING_SOURCE_DEFAULT)
+    {
+      offset += snprintf(buffer + offset, buffer_size - offset, "%s\"%s\":\"%s\"",
+                         first ? "" : ",", info[k].name,
+                         settingSourceName((SettingSource)sources[k]));
+      first = false;
+    }
+  }
+
+  if (offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset, "},\"rejected\":%lu",
+                       stats.rejected);
+  }
+  if (stats.rejected > 0 && offset < (int)buffer_size)
+  {
+    offset += snprintf(buffer + offset, buffer_size - offset,
+                       ",\"last_rejected\":{\"key\":\"%s\",\"reason\":\"%s\"}",
+                       stats.last_rejected, settingResultName(stats.last_reason));
+  }
+
+  if (offset + 1 < (int)buffer_size)
+  {
+    buffer[offset++] = '}';
+    buffer[offset] = '\0';
+    return buffer;
+  }
+  return NULL;
+}
@@ -0,0 +1,26 @@
+#include <Arduino.h>
+#include "transport/transport.h"
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool transportParseType(const char* name, TransportType* type)
+{
+  if (!name || !type)
+  {
+    return false;
+  }
+
+  if (strcasecmp(name, "mqtt") == 0)
+  {
+    *type = TRANSPORT_MQTT;
+    return true;
+  }
+  if (strcasecmp(name, "udp") == 0)
+  {
+    *type = TRANSPORT_UDP;
+    return true;
+  }
+  return false;
+}
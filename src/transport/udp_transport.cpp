@@ -0,0 +1,258 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "transport/udp_transport.h"
+#include "arduino_configs.h"
+#include "log/log.h"
+
+// ============================================================================
+// FRAME CONSTANTS
+// ============================================================================
+
+static const uint8_t FRAME_MAGIC_0 = 0xD7;
+static const uint8_t FRAME_MAGIC_1 = 0x54;
+static const uint8_t FRAME_VERSION = 0x10;       // Version 1 in the high nibble
+static const uint8_t FLAG_ACK_REQUEST = 0x01;
+static const uint8_t FLAG_ACK = 0x02;
+static const uint8_t FLAG_RETRANSMIT = 0x04;
+static const uint8_t FRAME_HEADER_LEN = 8;
+
+// A heartbeat fills the payload buffer; it must fit one frame, and the
+// frame one unfragmented datagram
+static_assert(CONFIG_UDP_TELEMETRY_MAX_FRAME >= 8 + 255 + CONFIG_TELEMETRY_PAYLOAD_SIZE - 1,
+              "CONFIG_UDP_TELEMETRY_MAX_FRAME must hold a full payload");
+static_assert(CONFIG_UDP_TELEMETRY_MAX_FRAME <= 1472,
+              "CONFIG_UDP_TELEMETRY_MAX_FRAME must fit a 1500-byte MTU");
+
+// ============================================================================
+// STATIC STATE - Target, retransmit slot and counters
+// ============================================================================
+
+static char target_host[CONFIG_HOSTNAME_MAX_LEN] = {0};
+static uint16_t target_port = 0;
+static IPAddress target_ip;
+static bool target_resolved = false;
+static bool ack_mode = false;
+
+// Own socket: reading acks must not consume mDNS responses
+static WiFiUDP udp;
+static bool socket_open = false;
+
+static uint32_t next_seq = 1;
+
+// Last frame sent; kept for retransmission while awaiting its ack
+static uint8_t frame[CONFIG_UDP_TELEMETRY_MAX_FRAME];
+static uint16_t frame_len = 0;
+static bool awaiting_ack = false;
+static uint32_t first_sent_at = 0;
+static uint32_t last_sent_at = 0;
+static uint8_t retries = 0;
+
+static UdpTransportStats stats;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void putU32(uint8_t* p, uint32_t v)
+{
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+static uint32_t getU32(const uint8_t* p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static bool resolveTarget(void)
+{
+  if (!target_resolved &&
+      (target_ip.fromString(target_host) || WiFi.hostByName(target_host, target_ip) == 1))
+  {
+    target_resolved = true;
+  }
+  return target_resolved;
+}
+
+static bool sendFrame(void)
+{
+  if (!udp.beginPacket(target_ip, target_port))
+  {
+    return false;
+  }
+  udp.write(frame, frame_len);
+  last_sent_at = millis();
+  return udp.endPacket() == 1;
+}
+
+/**
+ * Consume pending datagrams, matching acks against the retransmit slot
+ */
+static void readAcks(void)
+{
+  uint8_t header[FRAME_HEADER_LEN];
+
+  while (udp.parsePacket() > 0)
+  {
+    int n = udp.read(header, sizeof(header));
+    while (udp.available() > 0)
+    {
+      udp.read();  // Discard anything past the header
+    }
+
+    if (n != FRAME_HEADER_LEN || header[0] != FRAME_MAGIC_0 || header[1] != FRAME_MAGIC_1 ||
+        !(header[2] & FLAG_ACK))
+    {
+      continue;
+    }
+
+    if (awaiting_ack && getU32(&header[4]) == getU32(&frame[4]))
+    {
+      awaiting_ack = false;
+      stats.acked++;
+      stats.last_rtt_ms = millis() - first_sent_at;
+    }
+  }
+}
+
+// ============================================================================
+// TRANSPORT OPERATIONS
+// ============================================================================
+
+static bool udpBegin(const MQTTConfig* config)
+{
+  if (!config->udp_host[0] || config->udp_port == 0)
+  {
+    DEBUG_PRINTLN(F("✗ UDP transport: no target"));
+    return false;
+  }
+
+  strlcpy(target_host, config->udp_host, sizeof(target_host));
+  target_port = config->udp_port;
+  target_resolved = false;
+  ack_mode = config->udp_ack;
+  awaiting_ack = false;
+
+  DEBUG_PRINT(F("✓ UDP telemetry to "));
+  DEBUG_PRINT(target_host);
+  DEBUG_PRINT(F(":"));
+  DEBUG_PRINT(target_port);
+  DEBUG_PRINTLN(ack_mode ? F(" (acked)") : F(" (fire-and-forget)"));
+  return true;
+}
+
+static bool udpMaintain(void)
+{
+  if (!socket_open)
+  {
+    socket_open = udp.begin(CONFIG_UDP_TELEMETRY_LOCAL_PORT);
+  }
+  if (!socket_open || !resolveTarget())
+  {
+    return false;
+  }
+
+  if (!ack_mode)
+  {
+    return true;
+  }
+
+  readAcks();
+
+  if (awaiting_ack && millis() - last_sent_at >= CONFIG_UDP_TELEMETRY_ACK_TIMEOUT_MS)
+  {
+    if (retries >= CONFIG_UDP_TELEMETRY_MAX_RETRIES)
+    {
+      awaiting_ack = false;
+      stats.lost++;
+      LOG_EVENT(LOG_UDP_TELEMETRY_LOST, getU32(&frame[4]));
+    }
+    else
+    {
+      retries++;
+      stats.retransmits++;
+      frame[2] |= FLAG_RETRANSMIT;
+      sendFrame();
+    }
+  }
+  return true;
+}
+
+static bool udpReady(void)
+{
+  return socket_open && target_resolved;
+}
+
+/**
+ * retain is ignored: frames carry no retain flag, the receiver keeps no
+ * per-topic value
+ */
+static bool udpPublish(const char* topic, const char* payload, bool retain)
+{
+  (void)retain;
+
+  size_t topic_len = strlen(topic);
+  size_t payload_len = strlen(payload);
+
+  if (topic_len > 255 || FRAME_HEADER_LEN + topic_len + payload_len > sizeof(frame))
+  {
+    DEBUG_PRINTLN(F("✗ UDP telemetry frame too large"));
+    LOG_EVENT(LOG_MQTT_PUBLISH_FAILED, 3);
+    return false;
+  }
+
+  if (awaiting_ack)
+  {
+    stats.superseded++;
+  }
+
+  frame[0] = FRAME_MAGIC_0;
+  frame[1] = FRAME_MAGIC_1;
+  frame[2] = FRAME_VERSION | (ack_mode ? FLAG_ACK_REQUEST : 0);
+  frame[3] = topic_len;
+  putU32(&frame[4], next_seq++);
+  memcpy(&frame[FRAME_HEADER_LEN], topic, topic_len);
+  memcpy(&frame[FRAME_HEADER_LEN + topic_len], payload, payload_len);
+  frame_len = FRAME_HEADER_LEN + topic_len + payload_len;
+
+  if (!sendFrame())
+  {
+    awaiting_ack = false;
+    LOG_EVENT(LOG_MQTT_PUBLISH_FAILED, 4);
+    return false;
+  }
+
+  stats.sent++;
+  first_sent_at = last_sent_at;
+  retries = 0;
+  awaiting_ack = ack_mode;
+  return true;
+}
+
+static void udpStop(void)
+{
+  // Keep the resolved target: the address does not change with the link
+  awaiting_ack = false;
+  udp.stop();
+  socket_open = false;
+}
+
+const TelemetryTransport udpTransport = {
+  "udp",
+  udpBegin,
+  udpMaintain,
+  udpReady,
+  udpPublish,
+  udpStop
+};
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+const UdpTransportStats* udpTransportGetStats(void)
+{
+  return &stats;
+}
@@ -0,0 +1,108 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "wifi/wifi_cache.h"
+#include "ota/flash_bank.h"
+#include "arduino_configs.h"
+
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+
+#define WIFI_CACHE_MAGIC 0x57434332UL  // "WCC2" (adds leased_at)
+
+static_assert(sizeof(WiFiCache) <= FLASH_BANK_ROW_SIZE, "WiFi cache must fit one flash row");
+
+// ============================================================================
+// STATIC STATE - RAM copy of the flash row
+// ============================================================================
+
+static WiFiCache cached;
+static bool loaded = false;
+static bool invalidated = false;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static uint32_t hashSSID(const char* ssid)
+{
+  uint32_t hash = 2166136261UL;
+  while (*ssid)
+  {
+    hash = (hash ^ (uint8_t)*ssid++) * 16777619UL;
+  }
+  return hash;
+}
+
+static void copyIP(uint8_t* dst, const IPAddress& ip)
+{
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    dst[i] = ip[i];
+  }
+}
+
+static void loadOnce(void)
+{
+  if (!loaded)
+  {
+    flashRowRead(FLASH_ROW_WIFI_CACHE, &cached, sizeof(cached));
+    loaded = true;
+  }
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool wifiCacheLoad(const char* ssid, WiFiCache* cache)
+{
+  loadOnce();
+
+  if (invalidated || cached.magic != WIFI_CACHE_MAGIC ||
+      cached.ssid_hash != hashSSID(ssid) || cached.ip[0] == 0)
+  {
+    return false;
+  }
+
+  *cache = cached;
+  return true;
+}
+
+void wifiCacheCapture(const char* ssid, uint32_t leased_at)
+{
+  loadOnce();
+
+  WiFiCache current;
+  memset(&current, 0, sizeof(current));
+  current.magic = WIFI_CACHE_MAGIC;
+  current.ssid_hash = hashSSID(ssid);
+  WiFi.BSSID(current.bssid);
+  copyIP(current.ip, WiFi.localIP());
+  copyIP(current.gateway, WiFi.gatewayIP());
+  copyIP(current.subnet, WiFi.subnetMask());
+  copyIP(current.dns, WiFi.dnsIP(0));
+  current.leased_at = leased_at;
+
+  invalidated = false;
+
+  // Only write on change: a flash row survives ~25k erase cycles
+  if (memcmp(&current, &cached, sizeof(current)) == 0)
+  {
+    return;
+  }
+
+  if (!flashRowWrite(FLASH_ROW_WIFI_CACHE, &current, sizeof(current)))
+  {
+    return;
+  }
+  cached = current;
+
+  DEBUG_PRINT(F("✓ WiFi join cache updated: "));
+  DEBUG_PRINTLN(WiFi.localIP());
+}
+
+void wifiCacheInvalidate(void)
+{
+  invalidated = true;
+}
+
+#endif  // CONFIG_WIFI_FAST_JOIN_ENABLED
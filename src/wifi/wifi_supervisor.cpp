@@ -0,0 +1,398 @@
+#include <Arduino.h>
+#include <WiFiNINA.h>
+#include "wifi/wifi_supervisor.h"
+#include "wifi/wifi_cache.h"
+#include "rtc/rtc.h"
+#include "arduino_configs.h"
+#include "arduino_secrets.h"
+#include "log/log.h"
+#include "diag/watchdog.h"
+
+// ============================================================================
+// STATIC STATE - Link state machine
+// ============================================================================
+
+// WiFi credentials (from arduino_secrets.h)
+static const char ssid[] = SECRET_SSID;
+static const char pass[] = SECRET_PASS;
+
+static WiFiLinkState state = WIFI_LINK_DOWN;
+static WiFiLinkStats stats;
+static uint32_t state_since = 0;       // millis() of last state change
+static uint32_t join_started = 0;      // millis() of first attempt (fast or DHCP)
+static bool fast_join = false;         // Current attempt uses cached IP settings
+static uint8_t gateway_pings = 0;      // Failed gateway pings of this fast join
+static uint32_t lease_at = 0;          // Unix time of the lease in use (0 = unknown)
+static bool lease_unstamped = false;   // DHCP lease taken before the clock was set
+static uint32_t last_status_poll = 0;
+static uint32_t backoff_ms = CONFIG_WIFI_BACKOFF_MIN_MS;
+static uint32_t backoff_wait = 0;      // Backoff plus jitter for this wait
+static uint32_t link_lost_at = 0;      // millis() the outage was detected
+static bool outage = false;            // Link was up before (measure recovery)
+
+static WiFiLinkCallback listeners[CONFIG_WIFI_MAX_LISTENERS];
+static uint8_t listener_count = 0;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void setState(WiFiLinkState next, uint32_t now)
+{
+  state = next;
+  state_since = now;
+}
+
+static void notifyListeners(bool up)
+{
+  for (uint8_t i = 0; i < listener_count; i++)
+  {
+    listeners[i](up);
+  }
+}
+
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+/**
+ * Unix time, or 0 until the RTC has had network time
+ */
+static uint32_t wallClock(void)
+{
+  RTCStatus rtc_status = getRTCStatus();
+  return rtc_status == RTC_SYNCED || rtc_status == RTC_SYNC_STALE ? getRTCTimestamp() : 0;
+}
+
+/**
+ * Lease from a DHCP join at `leased_at` (0 = never stamped) is past the
+ * reuse bound; false while the clock isn't set
+ */
+static bool leaseTooOld(uint32_t leased_at, uint32_t unix_now)
+{
+  return unix_now != 0 &&
+         (leased_at == 0 || unix_now - leased_at >= CONFIG_WIFI_FAST_JOIN_MAX_AGE_S);
+}
+#endif
+
+/**
+ * Hand credentials to NINA and return immediately
+ *
+ * Parameters:
+ *   - now: Current millis()
+ *   - fallback: DHCP retry of a failed fast join (keeps the join timer)
+ */
+static void startJoin(uint32_t now, bool fallback)
+{
+  stats.join_attempts++;
+  if (!fallback)
+  {
+    join_started = now;
+  }
+
+  DEBUG_PRINT(F("→ WiFi join: "));
+  DEBUG_PRINT(ssid);
+  DEBUG_PRINT(F(" (attempt "));
+  DEBUG_PRINT(stats.join_attempts);
+
+  fast_join = false;
+  lease_unstamped = false;
+  gateway_pings = 0;
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+  WiFiCache cache;
+  if (wifiCacheLoad(ssid, &cache) && !leaseTooOld(cache.leased_at, wallClock()))
+  {
+    // Static settings from the last lease: no DHCP exchange
+    WiFi.config(IPAddress(cache.ip[0], cache.ip[1], cache.ip[2], cache.ip[3]),
+                IPAddress(cache.dns[0], cache.dns[1], cache.dns[2], cache.dns[3]),
+                IPAddress(cache.gateway[0], cache.gateway[1], cache.gateway[2], cache.gateway[3]),
+                IPAddress(cache.subnet[0], cache.subnet[1], cache.subnet[2], cache.subnet[3]));
+    fast_join = true;
+    lease_at = cache.leased_at;
+    DEBUG_PRINT(F(", fast"));
+  }
+#endif
+  DEBUG_PRINTLN(F(")"));
+
+  WiFi.begin(ssid, pass);
+  setState(WIFI_LINK_CONNECTING, now);
+}
+
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+/**
+ * Drop the cached settings for this boot and rejoin with DHCP at once
+ *
+ * Parameters:
+ *   - stage: 1 = not associated in time, 2 = gateway unreachable
+ *            (3 = lease too old, from checkLease())
+ */
+static void fallBackToDHCP(uint32_t now, uint8_t stage)
+{
+  stats.fast_fallbacks++;
+  wifiCacheInvalidate();
+  LOG_EVENT(LOG_WIFI_FAST_JOIN_FAILED, stage);
+  DEBUG_PRINTLN(F("⚠ WiFi fast join failed - retrying with DHCP"));
+
+  // WiFi.end() resets NINA, clearing the static IP configuration
+  WiFi.disconnect();
+  WiFi.end();
+  startJoin(now, true);
+}
+
+/**
+ * Once the clock is set: stamp a DHCP lease taken before it was, and give
+ * up a reused one that got too old (the server may have handed the address
+ * to another host). The link is dropped; the rejoin skips the cache.
+ */
+static void checkLease(uint32_t now)
+{
+  if (!fast_join && !lease_unstamped)
+  {
+    return;  // DHCP link: NINA renews the lease
+  }
+
+  uint32_t unix_now = wallClock();
+  if (unix_now == 0)
+  {
+    return;
+  }
+
+  if (lease_unstamped)
+  {
+    lease_unstamped = false;
+    lease_at = unix_now - (now - state_since) / 1000;  // Joined when the link came up
+    wifiCacheCapture(ssid, lease_at);
+    return;
+  }
+
+  if (!leaseTooOld(lease_at, unix_now))
+  {
+    return;
+  }
+
+  stats.fast_fallbacks++;
+  wifiCacheInvalidate();
+  LOG_EVENT(LOG_WIFI_FAST_JOIN_FAILED, 3);
+  DEBUG_PRINTLN(F("⚠ WiFi cached lease too old - rejoining with DHCP"));
+
+  // Listeners drop sockets before NINA is reset (clearing the static IP)
+  setState(WIFI_LINK_DOWN, now);
+  notifyListeners(false);
+  WiFi.disconnect();
+  WiFi.end();
+}
+#endif
+
+/**
+ * Schedule the next join after the current backoff, then double it
+ */
+static void enterBackoff(uint32_t now)
+{
+  // Up to 25% jitter so devices behind a rebooted AP do not rejoin in lockstep
+  backoff_wait = backoff_ms + random(backoff_ms / 4 + 1);
+  setState(WIFI_LINK_BACKOFF, now);
+
+  backoff_ms *= 2;
+  if (backoff_ms > CONFIG_WIFI_BACKOFF_MAX_MS)
+  {
+    backoff_ms = CONFIG_WIFI_BACKOFF_MAX_MS;
+  }
+}
+
+static void onJoined(uint32_t now)
+{
+  stats.last_join_ms = now - join_started;
+  stats.last_join_fast = fast_join;
+  if (fast_join)
+  {
+    stats.fast_joins++;
+  }
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+  else
+  {
+    lease_at = wallClock();
+    lease_unstamped = lease_at == 0;
+    wifiCacheCapture(ssid, lease_at);
+  }
+#endif
+
+  uint32_t recover_ms = 0;
+  if (outage)
+  {
+    recover_ms = now - link_lost_at;
+    stats.last_recover_ms = recover_ms;
+    if (recover_ms > stats.max_recover_ms)
+    {
+      stats.max_recover_ms = recover_ms;
+    }
+    stats.reconnects++;
+    outage = false;
+  }
+
+  stats.join_attempts = 0;
+  backoff_ms = CONFIG_WIFI_BACKOFF_MIN_MS;
+  setState(WIFI_LINK_UP, now);
+
+  LOG_EVENT(LOG_WIFI_UP, stats.last_join_ms, fast_join, recover_ms, WiFi.RSSI());
+  DEBUG_PRINT(F("✓ WiFi connected! IP: "));
+  DEBUG_PRINT(WiFi.localIP());
+  DEBUG_PRINT(F(" (join "));
+  DEBUG_PRINT(stats.last_join_ms);
+  if (fast_join)
+  {
+    DEBUG_PRINT(F(" ms, fast"));
+  }
+  if (recover_ms > 0)
+  {
+    DEBUG_PRINT(F(" ms, recovered after "));
+    DEBUG_PRINT(recover_ms);
+  }
+  DEBUG_PRINTLN(F(" ms)"));
+
+  notifyListeners(true);
+}
+
+// ============================================================================
+// PUBLIC API IMPLEMENTATION
+// ============================================================================
+
+bool wifiSupervisorAddListener(WiFiLinkCallback callback)
+{
+  if (!callback || listener_count >= CONFIG_WIFI_MAX_LISTENERS)
+  {
+    return false;
+  }
+
+  listeners[listener_count++] = callback;
+  return true;
+}
+
+void wifiSupervisorBegin(void)
+{
+  memset(&stats, 0, sizeof(stats));
+  backoff_ms = CONFIG_WIFI_BACKOFF_MIN_MS;
+  outage = false;
+
+  // begin() returns right after handing over the credentials
+  WiFi.setTimeout(0);
+
+  startJoin(millis(), false);
+}
+
+WiFiLinkState wifiSupervisorPoll(void)
+{
+  uint32_t now = millis();
+
+  if (state == WIFI_LINK_DOWN)
+  {
+    startJoin(now, false);
+    return state;
+  }
+
+  if (state == WIFI_LINK_BACKOFF)
+  {
+    if (now - state_since >= backoff_wait)
+    {
+      startJoin(now, false);
+    }
+    return state;
+  }
+
+  // CONNECTING / UP: rate-limit SPI status queries
+  if (now - last_status_poll < CONFIG_WIFI_POLL_MS)
+  {
+    return state;
+  }
+  last_status_poll = now;
+
+  uint8_t status = WiFi.status();
+
+  if (state == WIFI_LINK_CONNECTING)
+  {
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+    if (fast_join)
+    {
+      if (status == WL_CONNECTED)
+      {
+        // A reused lease may have been handed to another host meanwhile;
+        // a gateway ping proves the address still routes. WiFi.ping()
+        // blocks inside NINA, so one per status poll, a bounded number,
+        // each under the watchdog
+        watchdogArm(WATCHDOG_TASK_NET_CALL);
+        bool routed = WiFi.ping(WiFi.gatewayIP()) >= 0;
+        watchdogDisarm(WATCHDOG_TASK_NET_CALL);
+        if (routed)
+        {
+          onJoined(now);
+        }
+        else if (++gateway_pings >= CONFIG_WIFI_FAST_JOIN_PINGS)
+        {
+          fallBackToDHCP(now, 2);
+        }
+      }
+      else if (status == WL_CONNECT_FAILED || now - state_since >= CONFIG_WIFI_FAST_JOIN_TIMEOUT_MS)
+      {
+        fallBackToDHCP(now, 1);
+      }
+      return state;
+    }
+#endif
+
+    if (status == WL_CONNECTED)
+    {
+      onJoined(now);
+    }
+    else if (status == WL_CONNECT_FAILED || now - state_since >= CONFIG_WIFI_TIMEOUT_MS)
+    {
+      WiFi.disconnect();
+      enterBackoff(now);
+      LOG_EVENT(LOG_WIFI_JOIN_FAILED, stats.join_attempts, status, backoff_wait);
+      DEBUG_PRINT(F("✗ WiFi join failed, retry in "));
+      DEBUG_PRINT(backoff_wait);
+      DEBUG_PRINTLN(F(" ms"));
+    }
+    return state;
+  }
+
+  // WIFI_LINK_UP
+  if (status != WL_CONNECTED)
+  {
+    link_lost_at = now;
+    outage = true;
+    LOG_EVENT(LOG_WIFI_DOWN, status);
+    DEBUG_PRINTLN(F("✗ WiFi link lost"));
+
+    // Listeners drop sockets before NINA is reset for the rejoin
+    setState(WIFI_LINK_DOWN, now);
+    notifyListeners(false);
+    WiFi.disconnect();
+
+    // First rejoin after the minimum backoff
+    backoff_ms = CONFIG_WIFI_BACKOFF_MIN_MS;
+    enterBackoff(now);
+    return state;
+  }
+
+#if CONFIG_WIFI_FAST_JOIN_ENABLED
+  checkLease(now);
+#endif
+  return state;
+}
+
+bool wifiIsUp(void)
+{
+  return state == WIFI_LINK_UP;
+}
+
+const WiFiLinkStats* wifiGetStats(void)
+{
+  return &stats;
+}
+
+const char* wifiLinkStateName(WiFiLinkState link_state)
+{
+  switch (link_state)
+  {
+    case WIFI_LINK_CONNECTING: return "connecting";
+    case WIFI_LINK_UP:         return "up";
+    case WIFI_LINK_BACKOFF:    return "backoff";
+    default:                   return "down";
+  }
+}
@@ -0,0 +1,125 @@
+/**
+ * Minimal Arduino.h for host tests (pio test -e native)
+ *
+ * Only what the modules under test use; built with DEBUG=0, so nothing
+ * is printed. The clock only moves when a test sets native_millis (or
+ * calls delay()), so timeouts are driven step by step.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+// ============================================================================
+// TIME AND RANDOM
+// ============================================================================
+
+inline uint32_t native_millis = 0;
+
+inline unsigned long millis(void)
+{
+  return native_millis;
+}
+
+inline unsigned long micros(void)
+{
+  return native_millis * 1000UL;
+}
+
+inline void delay(unsigned long ms)
+{
+  native_millis += ms;
+}
+
+inline void yield(void)
+{
+}
+
+inline void randomSeed(unsigned long seed)
+{
+  srand((unsigned int)seed);
+}
+
+inline long random(long max)
+{
+  return max > 0 ? rand() % max : 0;
+}
+
+inline long random(long min, long max)
+{
+  return min < max ? min + random(max - min) : min;
+}
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+// In the SAMD newlib, and in glibc only from 2.38
+inline size_t strlcpy(char* dst, const char* src, size_t size)
+{
+  size_t len = strlen(src);
+  if (size > 0)
+  {
+    size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+// ============================================================================
+// PRINT / STREAM / IPADDRESS (the base classes Client and UDP build on)
+// ============================================================================
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* buf, size_t size)
+  {
+    size_t n = 0;
+    while (n < size && write(buf[n]) == 1)
+    {
+      n++;
+    }
+    return n;
+  }
+  size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+  size_t write(const char* buf, size_t size) { return write((const uint8_t*)buf, size); }
+  size_t print(const char* str) { return write(str); }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual void flush() {}
+};
+
+class IPAddress {
+public:
+  IPAddress() : _address(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    : _address((uint32_t)a | (uint32_t)b << 8 | (uint32_t)c << 16 | (uint32_t)d << 24) {}
+  IPAddress(uint32_t address) : _address(address) {}
+
+  operator uint32_t() const { return _address; }
+  uint8_t operator[](int index) const { return (uint8_t)(_address >> (index * 8)); }
+  bool operator==(const IPAddress& other) const { return _address == other._address; }
+
+private:
+  uint32_t _address;
+};
+
+#endif  // NATIVE_ARDUINO_H
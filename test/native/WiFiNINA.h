@@ -0,0 +1,83 @@
+/**
+ * Minimal WiFiNINA.h for host tests: a WiFiClient whose peer is a
+ * NativeServer the test installs in native_server
+ *
+ * With no server installed every connect is refused.
+ */
+
+#ifndef NATIVE_WIFININA_H
+#define NATIVE_WIFININA_H
+
+#include <Arduino.h>
+#include <Client.h>
+
+/**
+ * Scripted peer of a WiFiClient (one connection at a time)
+ */
+class NativeServer {
+public:
+  virtual ~NativeServer() {}
+  virtual bool open(const char* host, uint16_t port) = 0;   // Accept a connect
+  virtual void receive(const uint8_t* buf, size_t size) = 0;  // Bytes the client wrote
+  virtual int available() = 0;                              // Bytes ready to read
+  virtual int read(uint8_t* buf, size_t size) = 0;
+  virtual bool connected() = 0;                             // False once the peer closed
+  virtual void close() = 0;                                 // Client called stop()
+};
+
+inline NativeServer* native_server = nullptr;
+
+class WiFiClient : public Client {
+public:
+  int connect(IPAddress ip, uint16_t port) override
+  {
+    (void)ip;
+    return connect("ip", port);
+  }
+  int connect(const char* host, uint16_t port) override
+  {
+    _open = native_server != nullptr && native_server->open(host, port);
+    return _open ? 1 : 0;
+  }
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t* buf, size_t size) override
+  {
+    if (!_open)
+    {
+      return 0;
+    }
+    native_server->receive(buf, size);
+    return size;
+  }
+  using Print::write;
+  int available() override { return _open ? native_server->available() : 0; }
+  int read() override
+  {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+  }
+  int read(uint8_t* buf, size_t size) override
+  {
+    return _open && available() > 0 ? native_server->read(buf, size) : 0;
+  }
+  int peek() override { return -1; }
+  void flush() override {}
+  void stop() override
+  {
+    if (_open)
+    {
+      native_server->close();
+    }
+    _open = false;
+  }
+  uint8_t connected() override
+  {
+    return _open && (native_server->connected() || native_server->available() > 0);
+  }
+  operator bool() override { return _open; }
+
+private:
+  bool _open = false;
+};
+
+#endif  // NATIVE_WIFININA_H
@@ -0,0 +1,1005 @@
+// Generated by tools/ota_delta.py fixture -- do not edit
+
+#ifndef DELTA_FIXTURES_H
+#define DELTA_FIXTURES_H
+
+#include <stdint.h>
+
+#define FIXTURE_BLOCK_SIZE 1024
+
+static const uint8_t fixture_base[7451] = {
+  0xc1, 0x20, 0x00, 0x00, 0xd5, 0x21, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x65, 0x25, 0x00, 0x00,
+  0xa9, 0x27, 0x00, 0x00, 0xa7, 0x29, 0x00, 0x00, 0x1b, 0x2b, 0x00, 0x00, 0xbb, 0x2c, 0x00, 0x00,
+  0xf9, 0x2e, 0x00, 0x00, 0xb7, 0x30, 0x00, 0x00, 0x6f, 0x32, 0x00, 0x00, 0x57, 0x33, 0x00, 0x00,
+  0xa3, 0x35, 0x00, 0x00, 0x19, 0x36, 0x00, 0x00, 0xa1, 0x37, 0x00, 0x00, 0x63, 0x39, 0x00, 0x00,
+  0xc1, 0x20, 0x00, 0x00, 0xd5, 0x21, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x65, 0x25, 0x00, 0x00,
+  0xa9, 0x27, 0x00, 0x00, 0xa7, 0x29, 0x00, 0x00, 0x1b, 0x2b, 0x00, 0x00, 0xbb, 0x2c, 0x00, 0x00,
+  0xf9, 0x2e, 0x00, 0x00, 0xb7, 0x30, 0x00, 0x00, 0x6f, 0x32, 0x00, 0x00, 0x57, 0x33, 0x00, 0x00,
+  0xa3, 0x35, 0x00, 0x00, 0x19, 0x36, 0x00, 0x00, 0xa1, 0x37, 0x00, 0x00, 0x63, 0x39, 0x00, 0x00,
+  0xc1, 0x20, 0x00, 0x00, 0xd5, 0x21, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x65, 0x25, 0x00, 0x00,
+  0xa9, 0x27, 0x00, 0x00, 0xa7, 0x29, 0x00, 0x00, 0x1b, 0x2b, 0x00, 0x00, 0xbb, 0x2c, 0x00, 0x00,
+  0xf9, 0x2e, 0x00, 0x00, 0xb7, 0x30, 0x00, 0x00, 0x6f, 0x32, 0x00, 0x00, 0x57, 0x33, 0x00, 0x00,
+  0xa3, 0x35, 0x00, 0x00, 0x19, 0x36, 0x00, 0x00, 0xa1, 0x37, 0x00, 0x00, 0x63, 0x39, 0x00, 0x00,
+  0x96, 0x61, 0x80, 0x05, 0xd6, 0x08, 0x27, 0xf9, 0x99, 0x30, 0x2b, 0x55, 0x0f, 0x6c, 0xbd, 0xaf,
+  0xe5, 0x78, 0x19, 0x70, 0xf2, 0x1e, 0xcd, 0xc2, 0x2e, 0x61, 0x99, 0x30, 0xf4, 0xd5, 0xa8, 0x75,
+  0xdf, 0xf0, 0x0f, 0x6c, 0xbd, 0xaf, 0x1a, 0x3b, 0x9b, 0xf7, 0x61, 0xcd, 0xab, 0x3b, 0x27, 0x10,
+  0xb6, 0x05, 0x10, 0xb6, 0x5a, 0x81, 0x97, 0x2f, 0x14, 0xec, 0x73, 0x8e, 0x0f, 0x6c, 0x25, 0xdc,
+  0xca, 0x63, 0xca, 0x63, 0x02, 0x38, 0x2e, 0x44, 0xb7, 0x91, 0x99, 0xab, 0x64, 0xc4, 0x2f, 0xed,
+  0x7f, 0x67, 0xc8, 0x96, 0x80, 0x05, 0x2e, 0x44, 0xd1, 0xb9, 0xcd, 0xc2, 0x6c, 0xf0, 0x5a, 0x81,
+  0x90, 0xea, 0x98, 0xe1, 0xed, 0x7e, 0x22, 0xcc, 0xfd, 0xf1, 0xf2, 0x1e, 0x80, 0x05, 0x99, 0x19,
+  0x9b, 0xf7, 0x65, 0x22, 0x13, 0xf8, 0xa9, 0x4d, 0xb2, 0x64, 0xd6, 0x7f, 0xf0, 0x7a, 0x0f, 0x6c,
+  0xcd, 0xc2, 0x34, 0xf9, 0x07, 0x18, 0xa8, 0x75, 0x99, 0x30, 0x8a, 0x6a, 0x8a, 0x00, 0xc0, 0x38,
+  0x2f, 0x1e, 0x7f, 0x58, 0x71, 0xda, 0x96, 0x61, 0x6b, 0xd6, 0x80, 0x05, 0x64, 0xc4, 0x02, 0x38,
+  0x6f, 0x07, 0x1a, 0x3b, 0xea, 0xe1, 0x98, 0xe1, 0x12, 0x87, 0x6c, 0xf0, 0x65, 0x22, 0x2f, 0x4a,
+  0x2f, 0xed, 0x1d, 0xa1, 0xa9, 0x4d, 0x97, 0x2f, 0x9a, 0x8a, 0xed, 0x7e, 0x6d, 0xa4, 0x61, 0xcd,
+  0x6b, 0x96, 0x2e, 0x44, 0x40, 0xb9, 0xc9, 0x6e, 0x80, 0x05, 0x73, 0x8e, 0x81, 0x9b, 0xc8, 0x96,
+  0xe5, 0x78, 0x6b, 0x96, 0x80, 0x05, 0x6b, 0x96, 0x5a, 0x81, 0xea, 0xe1, 0x2c, 0xaa, 0x90, 0x3a,
+  0x86, 0xc3, 0xdf, 0xf0, 0x2b, 0x55, 0xce, 0xc2, 0x11, 0x73, 0x71, 0xda, 0xf1, 0xd8, 0x6d, 0xf0,
+  0xb7, 0x91, 0x7d, 0xd4, 0x7d, 0xd4, 0x2b, 0x1a, 0x44, 0xcd, 0xfd, 0xf1, 0xe9, 0xc9, 0x6b, 0x96,
+  0x57, 0x33, 0x00, 0x00, 0x5f, 0x3b, 0x00, 0x00, 0xa7, 0x29, 0x00, 0x00, 0x74, 0x3b, 0x00, 0x00,
+  0x90, 0x3b, 0x00, 0x00, 0x27, 0xf9, 0x48, 0xa6, 0x45, 0xad, 0xab, 0x3b, 0xe9, 0xc9, 0x61, 0xcd,
+  0xb6, 0x05, 0x13, 0xf8, 0x5b, 0x02, 0x12, 0x87, 0xbe, 0x48, 0x24, 0xc3, 0x55, 0x97, 0x2e, 0x61,
+  0x90, 0x3a, 0x65, 0xbe, 0x9b, 0xf7, 0xcd, 0xc2, 0x8a, 0x00, 0x99, 0x19, 0x81, 0xc3, 0xea, 0xe1,
+  0xf1, 0xd8, 0x04, 0x72, 0xf1, 0xd8, 0x0f, 0x6c, 0x41, 0x07, 0x86, 0xc3, 0xba, 0xef, 0xf4, 0xd5,
+  0x6d, 0xf0, 0x10, 0xb6, 0x02, 0x38, 0x2b, 0x55, 0xc0, 0x38, 0x2f, 0xed, 0xa0, 0xd8, 0x04, 0x72,
+  0x17, 0xfe, 0x6b, 0x96, 0xb3, 0xb8, 0xa8, 0x75, 0x6d, 0xf0, 0x04, 0x72, 0xc6, 0xf3, 0xe0, 0x4b,
+  0x61, 0xcd, 0x0f, 0x6c, 0x2b, 0x55, 0x90, 0xea, 0x6b, 0x96, 0x48, 0xa6, 0xf2, 0x1e, 0x17, 0xfe,
+  0xc0, 0x38, 0x2f, 0x1e, 0x0f, 0x6c, 0xd4, 0x07, 0x07, 0x18, 0x22, 0xb2, 0xd6, 0x08, 0x4c, 0x41,
+  0xb6, 0x05, 0xce, 0xc2, 0xb2, 0x64, 0xce, 0xc2, 0xb6, 0x05, 0x7f, 0x67, 0xd4, 0x07, 0xf9, 0x81,
+  0xf4, 0xd5, 0x12, 0x87, 0x6b, 0xd6, 0x90, 0x3a, 0x07, 0x18, 0xb7, 0x91, 0x8a, 0x6a, 0xd6, 0x08,
+  0x5a, 0x81, 0x86, 0xc3, 0x14, 0xec, 0xea, 0xe1, 0x22, 0xb2, 0x65, 0xbe, 0x6b, 0xd6, 0xed, 0x7e,
+  0xca, 0x63, 0xd6, 0x7f, 0x71, 0xda, 0x71, 0xda, 0x99, 0x30, 0x10, 0xb6, 0x1d, 0xa1, 0xcd, 0xc2,
+  0x86, 0xc3, 0x73, 0x37, 0x64, 0xc4, 0x6c, 0xf0, 0xce, 0xa6, 0x8a, 0x00, 0x90, 0xea, 0x2b, 0x55,
+  0x24, 0x3e, 0x81, 0xc3, 0x14, 0xec, 0x24, 0xc3, 0x45, 0xad, 0x2e, 0x61, 0x3e, 0xbe, 0x13, 0xf8,
+  0x43, 0x51, 0x02, 0x38, 0x45, 0xad, 0xf1, 0xd8, 0x48, 0xa6, 0x97, 0x2f, 0x71, 0xda, 0xd1, 0xb9,
+  0x65, 0xbe, 0xc3, 0xe6, 0xf1, 0xd8, 0xf4, 0xd5, 0x64, 0xc4, 0xb2, 0x64, 0x48, 0xa6, 0x34, 0xf9,
+  0x6b, 0xd6, 0xa9, 0x4d, 0xe4, 0x7c, 0x5b, 0x02, 0xc0, 0x38, 0x22, 0xb2, 0xfd, 0xf1, 0x2b, 0x55,
+  0xce, 0xa6, 0xdf, 0xf0, 0x73, 0x37, 0x2c, 0xaa, 0x80, 0x05, 0x6c, 0xf0, 0x7f, 0x67, 0xd6, 0x08,
+  0xdf, 0xf0, 0x44, 0xe5, 0x2f, 0x4a, 0x1a, 0x3b, 0x99, 0xab, 0x2f, 0x4a, 0xb6, 0xb8, 0xd4, 0x7e,
+  0xba, 0xef, 0x27, 0x10, 0x11, 0x73, 0xe4, 0x7c, 0xca, 0x63, 0xca, 0x63, 0x22, 0xcc, 0x2f, 0x4a,
+  0x22, 0xb2, 0xfd, 0xf1, 0x01, 0xe9, 0x9a, 0x8a, 0x6d, 0xa4, 0x02, 0x38, 0xdf, 0xf0, 0x90, 0x3a,
+  0xbd, 0xaf, 0x5b, 0x02, 0x5b, 0x02, 0xe9, 0xc9, 0x43, 0x51, 0xb6, 0xb8, 0x71, 0xda, 0x99, 0x19,
+  0x99, 0x30, 0x34, 0x80, 0xf0, 0x7a, 0x1a, 0x3b, 0xe4, 0x7c, 0x73, 0x8e, 0x80, 0x05, 0x99, 0xab,
+  0x2e, 0x61, 0x48, 0xa6, 0x27, 0x10, 0x6f, 0x07, 0xce, 0xc2, 0x73, 0x37, 0xc8, 0x96, 0xa9, 0x4d,
+  0x41, 0x07, 0xa0, 0xd8, 0x07, 0x18, 0x5b, 0x02, 0xe9, 0xc9, 0x97, 0x2f, 0x14, 0xec, 0xa9, 0x4d,
+  0x10, 0x6a, 0x73, 0x37, 0xce, 0xc2, 0x90, 0xea, 0x80, 0x05, 0x04, 0x72, 0x6b, 0xd6, 0x11, 0x73,
+  0xfd, 0xf1, 0x96, 0x61, 0x24, 0x3e, 0x43, 0x51, 0x6b, 0xd6, 0x2f, 0x4a, 0x10, 0x6a, 0xe9, 0xc9,
+  0xed, 0x7e, 0x24, 0x3e, 0x2b, 0x1a, 0x2e, 0x61, 0xa9, 0x4d, 0x27, 0x10, 0xd6, 0x7f, 0x43, 0x51,
+  0xb7, 0x91, 0x97, 0x2f, 0x3e, 0xbe, 0xb7, 0x91, 0xe5, 0x78, 0x6f, 0x07, 0xe9, 0xc9, 0xd6, 0x7f,
+  0xf0, 0x7a, 0xbe, 0x48, 0x27, 0x10, 0x24, 0xc3, 0xb6, 0xb8, 0xa9, 0x4d, 0x14, 0xec, 0x12, 0x87,
+  0xf4, 0xd5, 0xe9, 0xc9, 0x6d, 0xf0, 0xca, 0x63, 0x44, 0xe5, 0xb6, 0xb8, 0xf4, 0xd5, 0xf9, 0x81,
+  0x5a, 0x81, 0x2e, 0x61, 0x81, 0xc3, 0x22, 0xcc, 0x73, 0x37, 0x34, 0xf9, 0x2f, 0xed, 0x22, 0xcc,
+  0xea, 0xe1, 0x43, 0x51, 0x80, 0x05, 0x90, 0x3a, 0x34, 0x80, 0x7f, 0x58, 0x83, 0x06, 0xce, 0xa6,
+  0x8a, 0x00, 0xe0, 0x4b, 0x83, 0x06, 0x27, 0x10, 0x61, 0xcd, 0xb7, 0x91, 0xa9, 0x4d, 0x10, 0x6a,
+  0x43, 0x51, 0xba, 0xef, 0xb4, 0x3b, 0x00, 0x00, 0x96, 0x3b, 0x00, 0x00, 0x5f, 0x3b, 0x00, 0x00,
+  0x6f, 0x32, 0x00, 0x00, 0x65, 0x3b, 0x00, 0x00, 0x22, 0xb2, 0xa9, 0x4d, 0x1d, 0xa1, 0x99, 0x30,
+  0x24, 0x3e, 0x2f, 0xed, 0x71, 0xda, 0xb3, 0xb8, 0xab, 0x3b, 0xf2, 0x1e, 0x98, 0xe1, 0x55, 0x97,
+  0x81, 0x9b, 0x2f, 0xed, 0x8a, 0x00, 0xb6, 0x05, 0x64, 0xc4, 0x44, 0xcd, 0x96, 0x61, 0x11, 0x73,
+  0xea, 0xe1, 0x2b, 0x1a, 0xe5, 0x78, 0x7d, 0xd4, 0x6d, 0xf0, 0xe5, 0x78, 0xe0, 0x4b, 0x90, 0xea,
+  0x25, 0xdc, 0x5b, 0x02, 0x2e, 0x44, 0x13, 0xf8, 0xb6, 0x05, 0x27, 0x10, 0x48, 0xa6, 0x81, 0x9b,
+  0x83, 0x06, 0xbe, 0x48, 0x5a, 0x81, 0x73, 0x8e, 0x24, 0x3e, 0x7f, 0x67, 0xd4, 0x07, 0x44, 0xcd,
+  0x9a, 0x8a, 0xce, 0xa6, 0x2f, 0xed, 0x97, 0x2f, 0x73, 0x8e, 0x34, 0xf9, 0x6d, 0xa4, 0xe5, 0x78,
+  0x44, 0xcd, 0x04, 0x72, 0xf1, 0xd8, 0x34, 0xf9, 0x44, 0xcd, 0xd1, 0xb9, 0xce, 0xc2, 0xfd, 0xf1,
+  0x80, 0x05, 0x71, 0xda, 0xce, 0xc2, 0x9b, 0xf7, 0xce, 0xc2, 0xf1, 0xd8, 0x40, 0xb9, 0xb7, 0x91,
+  0x43, 0x51, 0x7d, 0xd4, 0xbe, 0x48, 0x98, 0xe1, 0x45, 0xad, 0xab, 0x3b, 0xc8, 0x96, 0xb2, 0x64,
+  0xb0, 0xe4, 0xce, 0xa6, 0x02, 0x38, 0x99, 0x30, 0xbe, 0x48, 0x48, 0xa6, 0xce, 0xc2, 0xcd, 0xc2,
+  0x3e, 0xbe, 0xc9, 0x6e, 0xc9, 0x6e, 0x99, 0x30, 0xb0, 0xe4, 0x41, 0x07, 0xd6, 0x7f, 0xc8, 0x96,
+  0x83, 0x06, 0xb6, 0x05, 0x2e, 0x61, 0x10, 0xb6, 0xcd, 0xc2, 0xa0, 0xd8, 0x7f, 0x67, 0x99, 0x19,
+  0x43, 0x51, 0x07, 0x18, 0x24, 0x3e, 0x8a, 0x00, 0x41, 0x07, 0x2f, 0xed, 0x22, 0xcc, 0xba, 0xef,
+  0x86, 0xc3, 0x99, 0x30, 0x83, 0x06, 0xd6, 0x7f, 0x65, 0xbe, 0x1d, 0xa1, 0x6b, 0x96, 0x2b, 0x55,
+  0x22, 0xcc, 0x80, 0x05, 0xdf, 0xf0, 0xf9, 0x81, 0xb3, 0xb8, 0x8a, 0x00, 0xc9, 0x6e, 0xd4, 0x07,
+  0x81, 0xc3, 0x2f, 0x4a, 0xf4, 0xd5, 0x4c, 0x41, 0x34, 0x80, 0xc8, 0x96, 0x3e, 0xbe, 0x44, 0xcd,
+  0x90, 0x3a, 0x99, 0x30, 0xd4, 0x7e, 0x44, 0xe5, 0x6d, 0xf0, 0x34, 0xf9, 0x81, 0xc3, 0x80, 0x05,
+  0x90, 0x3a, 0x2f, 0xed, 0x19, 0x70, 0x5a, 0x81, 0x2f, 0x4a, 0xed, 0x7e, 0xb7, 0x91, 0x0f, 0x6c,
+  0xdf, 0xf0, 0x5b, 0x02, 0xca, 0x63, 0x55, 0x97, 0x1a, 0x3b, 0x61, 0xcd, 0xbe, 0x48, 0x25, 0xdc,
+  0x2c, 0xaa, 0x12, 0x87, 0x90, 0xea, 0xf1, 0xd8, 0x2f, 0x1e, 0xb3, 0xb8, 0x98, 0xe1, 0x73, 0x8e,
+  0xe4, 0x7c, 0x14, 0xec, 0x07, 0x18, 0xe4, 0x7c, 0xa5, 0x3b, 0x00, 0x00, 0x74, 0x3b, 0x00, 0x00,
+  0xbb, 0x2c, 0x00, 0x00, 0x65, 0x22, 0xc9, 0x6e, 0xc6, 0xf3, 0x83, 0x06, 0x02, 0x38, 0x24, 0x3e,
+  0xe0, 0x4b, 0x7f, 0x67, 0x19, 0x70, 0x2c, 0xaa, 0x44, 0xe5, 0x40, 0xb9, 0x9b, 0xf7, 0x04, 0x72,
+  0xb6, 0xb8, 0x83, 0x06, 0x45, 0xad, 0x44, 0xe5, 0x7f, 0x58, 0x04, 0x72, 0x34, 0x80, 0x6f, 0x07,
+  0x5b, 0x02, 0x8a, 0x6a, 0x97, 0x2f, 0x22, 0xcc, 0x9b, 0xf7, 0x7f, 0x67, 0xe0, 0x4b, 0x2b, 0x1a,
+  0x25, 0xdc, 0x04, 0x72, 0x4c, 0x41, 0x7f, 0x67, 0xce, 0xc2, 0x01, 0xe9, 0xcd, 0xc2, 0x25, 0xdc,
+  0xd6, 0x08, 0xbd, 0xaf, 0xf4, 0xd5, 0xcd, 0xc2, 0x99, 0xab, 0xbe, 0x48, 0xf0, 0x7a, 0x8a, 0x00,
+  0xb6, 0x05, 0xd4, 0x07, 0xb3, 0xb8, 0xd4, 0x07, 0x5a, 0x81, 0x80, 0x05, 0xbd, 0xaf, 0xca, 0x63,
+  0x27, 0xf9, 0x27, 0xf9, 0x0f, 0x6c, 0x88, 0x8d, 0x6d, 0xa4, 0x11, 0x73, 0xb2, 0x64, 0xbf, 0x35,
+  0x24, 0x3e, 0x99, 0x19, 0xcd, 0xc2, 0x90, 0xea, 0x73, 0x37, 0xc9, 0x6e, 0xb0, 0xe4, 0x90, 0x3a,
+  0xc0, 0x38, 0x22, 0xb2, 0x6b, 0xd6, 0xba, 0xef, 0x7d, 0xd4, 0xa9, 0x4d, 0x4c, 0x41, 0x45, 0xad,
+  0x44, 0xe5, 0x0f, 0x6c, 0x34, 0x80, 0x40, 0xb9, 0x6c, 0xf0, 0x13, 0xf8, 0xcd, 0xc2, 0x5a, 0x81,
+  0xca, 0x63, 0x2f, 0xed, 0x9b, 0xf7, 0x27, 0x10, 0xc6, 0xf3, 0xe5, 0x78, 0x34, 0xf9, 0x90, 0x3a,
+  0x17, 0xfe, 0xce, 0xa6, 0xfd, 0xf1, 0x0f, 0x6c, 0x22, 0xcc, 0x11, 0x73, 0xe4, 0x7c, 0x99, 0x30,
+  0x97, 0x2f, 0xdf, 0xf0, 0xf2, 0x1e, 0x44, 0xe5, 0x27, 0xf9, 0x11, 0x73, 0x19, 0x70, 0x5a, 0x81,
+  0x10, 0x6a, 0xb6, 0xb8, 0x5a, 0x81, 0x73, 0x37, 0x6b, 0x96, 0x65, 0xbe, 0x81, 0xc3, 0x0f, 0x6c,
+  0xca, 0x63, 0x22, 0xcc, 0x48, 0xa6, 0x19, 0x70, 0x07, 0x18, 0x1d, 0xa1, 0x22, 0xcc, 0x1a, 0x3b,
+  0x22, 0xb2, 0xbf, 0x35, 0x81, 0xc3, 0x6d, 0xa4, 0x2f, 0x4a, 0x6f, 0x07, 0x22, 0xcc, 0xbf, 0x35,
+  0xf2, 0x1e, 0x43, 0x51, 0x2b, 0x1a, 0x44, 0xcd, 0x73, 0x37, 0xf9, 0x81, 0x8a, 0x6a, 0x65, 0x22,
+  0x24, 0xc3, 0xc6, 0xf3, 0x19, 0x70, 0x73, 0x8e, 0xf1, 0xd8, 0x61, 0xcd, 0x17, 0xfe, 0x99, 0x19,
+  0x44, 0xcd, 0xa0, 0xd8, 0x55, 0x97, 0x8a, 0x00, 0xc9, 0x6e, 0xc3, 0xe6, 0x41, 0x07, 0x2f, 0xed,
+  0x64, 0xc4, 0xfd, 0xf1, 0xb6, 0x05, 0x73, 0x8e, 0x7d, 0xd4, 0x90, 0x3a, 0xa0, 0xd8, 0x44, 0xe5,
+  0x6d, 0xf0, 0xbe, 0x48, 0xc8, 0x96, 0x34, 0xf9, 0xb2, 0x64, 0xca, 0x63, 0x2f, 0xed, 0x98, 0xe1,
+  0x1a, 0x3b, 0x12, 0x87, 0xb2, 0x64, 0xbf, 0x35, 0x99, 0xab, 0x8a, 0x00, 0x90, 0xea, 0xd6, 0x08,
+  0x13, 0xf8, 0x8a, 0x00, 0xc3, 0xe6, 0x34, 0xf9, 0x2e, 0x61, 0x65, 0xbe, 0x34, 0xf9, 0x61, 0xcd,
+  0xbf, 0x35, 0x6b, 0xd6, 0xf9, 0x81, 0xb7, 0x91, 0x2f, 0xed, 0x43, 0x51, 0x2b, 0x55, 0x01, 0xe9,
+  0xba, 0xef, 0xe0, 0x4b, 0xe4, 0x7c, 0xce, 0xc2, 0x02, 0x38, 0xbd, 0xaf, 0x90, 0xea, 0x34, 0xf9,
+  0xb6, 0x05, 0x81, 0xc3, 0x02, 0x38, 0x2b, 0x55, 0x98, 0xe1, 0x01, 0xe9, 0xc6, 0xf3, 0x48, 0xa6,
+  0x65, 0x22, 0xbf, 0x35, 0x19, 0x70, 0x34, 0x80, 0x6d, 0xf0, 0x6c, 0xf0, 0xb6, 0x05, 0x2f, 0xed,
+  0xd1, 0xb9, 0x5b, 0x02, 0xa9, 0x4d, 0x9b, 0xf7, 0x44, 0xe5, 0x90, 0xea, 0x45, 0xad, 0xe9, 0xc9,
+  0x25, 0xdc, 0x7f, 0x67, 0x73, 0x37, 0x73, 0x37, 0x8a, 0x00, 0x8a, 0x6a, 0x65, 0x22, 0x2b, 0x1a,
+  0x40, 0xb9, 0x6d, 0xa4, 0xba, 0xef, 0xd6, 0x08, 0x0f, 0x6c, 0xa0, 0xd8, 0x9b, 0xf7, 0xcd, 0xc2,
+  0x64, 0xc4, 0x10, 0x6a, 0x88, 0x8d, 0x6d, 0xa4, 0xa0, 0xd8, 0xa8, 0x75, 0x6f, 0x07, 0x2c, 0xaa,
+  0xf9, 0x81, 0x34, 0x80, 0xb6, 0x05, 0x27, 0xf9, 0xca, 0x63, 0x6d, 0xf0, 0x1d, 0xa1, 0x3e, 0xbe,
+  0xc6, 0xf3, 0x64, 0xc4, 0x96, 0x61, 0xc6, 0xf3, 0x65, 0x22, 0x2b, 0x55, 0x13, 0xf8, 0x73, 0x8e,
+  0xc0, 0x38, 0xd1, 0xb9, 0x5b, 0x02, 0xc8, 0x96, 0x1d, 0xa1, 0x73, 0x8e, 0x9b, 0xf7, 0x27, 0xf9,
+  0x24, 0x3e, 0xf9, 0x81, 0xd4, 0x7e, 0x45, 0xad, 0xf9, 0x81, 0x44, 0xcd, 0x40, 0xb9, 0xe0, 0x4b,
+  0x43, 0x51, 0x17, 0xfe, 0x6b, 0x3b, 0x00, 0x00, 0xa9, 0x4d, 0xfd, 0xf1, 0x5a, 0x81, 0xc9, 0x6e,
+  0x99, 0xab, 0xce, 0xc2, 0xea, 0xe1, 0x99, 0x30, 0x99, 0x19, 0xb7, 0x91, 0x6c, 0xf0, 0x22, 0xcc,
+  0x55, 0x97, 0x6b, 0x96, 0x10, 0xb6, 0x6f, 0x07, 0x71, 0xda, 0x44, 0xe5, 0x2f, 0xed, 0xd4, 0x07,
+  0xb0, 0xe4, 0x88, 0x8d, 0xa0, 0xd8, 0x55, 0x97, 0x1a, 0x3b, 0xca, 0x63, 0x88, 0x8d, 0xcd, 0xc2,
+  0x27, 0x10, 0xfd, 0xf1, 0xcd, 0xc2, 0xce, 0xa6, 0xf9, 0x81, 0x14, 0xec, 0xc0, 0x38, 0xd4, 0x7e,
+  0x98, 0xe1, 0xd4, 0x7e, 0xf2, 0x1e, 0x19, 0x70, 0xf1, 0xd8, 0xca, 0x63, 0x02, 0x38, 0x10, 0xb6,
+  0xf4, 0xd5, 0xb3, 0xb8, 0xe5, 0x78, 0xd1, 0xb9, 0x40, 0xb9, 0xb3, 0xb8, 0x2b, 0x1a, 0x99, 0x19,
+  0xd4, 0x07, 0x8a, 0x00, 0xc6, 0xf3, 0x8a, 0x00, 0xb6, 0xb8, 0xf0, 0x7a, 0x9a, 0x8a, 0xfd, 0xf1,
+  0xd4, 0x7e, 0xce, 0xc2, 0x27, 0xf9, 0xa0, 0xd8, 0x22, 0xcc, 0xa8, 0x75, 0xf2, 0x1e, 0xbd, 0xaf,
+  0x88, 0x8d, 0xcd, 0xc2, 0x8a, 0x6a, 0x0f, 0x6c, 0x4c, 0x41, 0xca, 0x63, 0xd4, 0x07, 0xe0, 0x4b,
+  0x0f, 0x6c, 0x34, 0x80, 0xea, 0xe1, 0x8a, 0x6a, 0xfd, 0xf1, 0x98, 0xe1, 0x97, 0x2f, 0x0f, 0x6c,
+  0x2e, 0x44, 0x0f, 0x6c, 0x8a, 0x6a, 0xd1, 0xb9, 0xc9, 0x6e, 0x7f, 0x58, 0xbe, 0x48, 0x55, 0x97,
+  0xc8, 0x96, 0x97, 0x2f, 0x9a, 0x8a, 0x34, 0x80, 0x04, 0x72, 0x55, 0x97, 0x97, 0x2f, 0x10, 0xb6,
+  0x44, 0xcd, 0x5a, 0x81, 0xf2, 0x1e, 0x61, 0xcd, 0xb2, 0x64, 0x65, 0xbe, 0x71, 0xda, 0x1d, 0xa1,
+  0xd1, 0xb9, 0x83, 0x06, 0x10, 0x6a, 0x81, 0xc3, 0x2c, 0xaa, 0x01, 0xe9, 0x44, 0xcd, 0xa9, 0x4d,
+  0xfd, 0xf1, 0x24, 0xc3, 0xce, 0xc2, 0x17, 0xfe, 0x9b, 0xf7, 0xca, 0x63, 0x71, 0xda, 0x73, 0x8e,
+  0x19, 0x70, 0x73, 0x8e, 0x22, 0xcc, 0x2c, 0xaa, 0x9b, 0xf7, 0x41, 0x07, 0x99, 0x19, 0x55, 0x97,
+  0xed, 0x7e, 0xc6, 0xf3, 0xf4, 0xd5, 0xe4, 0x7c, 0x99, 0x30, 0xe4, 0x7c, 0x24, 0x3e, 0x34, 0x80,
+  0x19, 0x70, 0x96, 0x61, 0xb6, 0x05, 0x7d, 0xd4, 0xd1, 0xb9, 0xb6, 0xb8, 0xe9, 0xc9, 0x34, 0x80,
+  0x8a, 0x00, 0x34, 0x80, 0x44, 0xe5, 0xb6, 0x05, 0xd4, 0x7e, 0x2e, 0x61, 0x2e, 0x44, 0x0f, 0x6c,
+  0x48, 0xa6, 0x45, 0xad, 0x10, 0x6a, 0xce, 0xa6, 0x81, 0x9b, 0x27, 0x10, 0x2f, 0x1e, 0x34, 0xf9,
+  0x6d, 0xa4, 0xf1, 0xd8, 0xf0, 0x7a, 0x7d, 0xd4, 0x22, 0xb2, 0x44, 0xe5, 0x86, 0xc3, 0x45, 0xad,
+  0x10, 0xb6, 0xc6, 0xf3, 0xea, 0xe1, 0xba, 0xef, 0xf0, 0x7a, 0x97, 0x2f, 0x19, 0x70, 0x5b, 0x02,
+  0xf2, 0x1e, 0xdf, 0xf0, 0x2b, 0x1a, 0xbf, 0x35, 0x97, 0x2f, 0xb3, 0xb8, 0xc9, 0x6e, 0xce, 0xa6,
+  0x04, 0x72, 0xd1, 0xb9, 0x2e, 0x44, 0x45, 0xad, 0x6d, 0xf0, 0x73, 0x37, 0x7d, 0xd4, 0xca, 0x63,
+  0x2e, 0x44, 0xb6, 0xb8, 0xea, 0xe1, 0xc3, 0xe6, 0x88, 0x8d, 0x80, 0x05, 0x73, 0x8e, 0x13, 0xf8,
+  0x22, 0xb2, 0x6d, 0xf0, 0x34, 0x80, 0x55, 0x97, 0x9a, 0x8a, 0x45, 0xad, 0x14, 0xec, 0xe9, 0xc9,
+  0x22, 0xcc, 0x22, 0xb2, 0x11, 0x73, 0x27, 0x10, 0xb7, 0x91, 0x6b, 0x96, 0x65, 0x22, 0xb2, 0x64,
+  0x7f, 0x58, 0x83, 0x06, 0xf0, 0x7a, 0x13, 0xf8, 0x5a, 0x81, 0x73, 0x8e, 0xc3, 0xe6, 0x7f, 0x67,
+  0x64, 0xc4, 0xd1, 0xb9, 0xf4, 0xd5, 0xd6, 0x08, 0xd6, 0x7f, 0x01, 0xe9, 0x25, 0xdc, 0xb0, 0xe4,
+  0xbe, 0x48, 0x22, 0xcc, 0x61, 0xcd, 0xb7, 0x91, 0x13, 0xf8, 0x41, 0x07, 0xd6, 0x08, 0xa3, 0x35,
+  0x00, 0x00, 0x6b, 0x3b, 0x00, 0x00, 0xa1, 0x37, 0x00, 0x00, 0x52, 0x3b, 0x00, 0x00, 0xd5, 0x21,
+  0x00, 0x00, 0xd5, 0x21, 0x00, 0x00, 0x99, 0x30, 0xbf, 0x35, 0x81, 0xc3, 0xe5, 0x78, 0x24, 0xc3,
+  0x61, 0xcd, 0x45, 0xad, 0x40, 0xb9, 0x07, 0x18, 0xf9, 0x81, 0x2b, 0x1a, 0x44, 0xe5, 0xea, 0xe1,
+  0x5a, 0x81, 0x24, 0xc3, 0xf2, 0x1e, 0x6d, 0xf0, 0x13, 0xf8, 0x9a, 0x8a, 0x17, 0xfe, 0xfd, 0xf1,
+  0x55, 0x97, 0x25, 0xdc, 0x40, 0xb9, 0x44, 0xcd, 0x44, 0xcd, 0x2f, 0x1e, 0x14, 0xec, 0x2c, 0xaa,
+  0xa9, 0x4d, 0x14, 0xec, 0xc9, 0x6e, 0x6c, 0xf0, 0xc0, 0x38, 0x99, 0x19, 0x27, 0xf9, 0x8a, 0x6a,
+  0x40, 0xb9, 0xa8, 0x75, 0x2f, 0x1e, 0x65, 0xbe, 0x98, 0xe1, 0x80, 0x05, 0x6f, 0x07, 0x2f, 0x4a,
+  0x64, 0xc4, 0x34, 0x80, 0xd6, 0x08, 0x2f, 0x4a, 0xc0, 0x38, 0x7f, 0x67, 0xf2, 0x1e, 0xd4, 0x7e,
+  0x34, 0x80, 0xfd, 0xf1, 0xf9, 0x81, 0x97, 0x2f, 0xba, 0xef, 0x7d, 0xd4, 0xce, 0xc2, 0x90, 0x3a,
+  0xc9, 0x6e, 0xce, 0xa6, 0xb0, 0xe4, 0x2f, 0x1e, 0x7f, 0x67, 0x8a, 0x00, 0xb2, 0x64, 0xc0, 0x38,
+  0xb2, 0x64, 0x27, 0x10, 0x4c, 0x41, 0x40, 0xb9, 0xe5, 0x78, 0x22, 0xcc, 0xea, 0xe1, 0xcd, 0xc2,
+  0xab, 0x3b, 0x02, 0x38, 0xbd, 0xaf, 0xce, 0xa6, 0x83, 0x06, 0x27, 0x10, 0x07, 0x18, 0x2f, 0x4a,
+  0x86, 0xc3, 0x19, 0x70, 0x3e, 0xbe, 0x07, 0x18, 0x24, 0x3e, 0x0f, 0x6c, 0x01, 0xe9, 0x10, 0xb6,
+  0x65, 0xbe, 0xd6, 0x08, 0x6d, 0xf0, 0x61, 0xcd, 0x0f, 0x6c, 0xc6, 0xf3, 0xfd, 0xf1, 0xe5, 0x78,
+  0x90, 0x3a, 0x6b, 0x96, 0x48, 0xa6, 0x11, 0x73, 0xd4, 0x07, 0x86, 0xc3, 0xc8, 0x96, 0x13, 0xf8,
+  0x2f, 0x1e, 0x9b, 0xf7, 0x55, 0x97, 0x83, 0x06, 0x0f, 0x6c, 0x07, 0x18, 0x55, 0x97, 0xbe, 0x48,
+  0x73, 0x37, 0x34, 0xf9, 0xe9, 0xc9, 0xb2, 0x64, 0x2b, 0x55, 0xd4, 0x07, 0xce, 0xa6, 0xc0, 0x38,
+  0xdf, 0xf0, 0x44, 0xcd, 0x02, 0x38, 0x8a, 0x6a, 0x8a, 0x00, 0x9a, 0x8a, 0x10, 0x6a, 0x5b, 0x02,
+  0xcd, 0xc2, 0xa9, 0x4d, 0x0f, 0x6c, 0x24, 0x3e, 0x73, 0x8e, 0x7f, 0x58, 0x2e, 0x61, 0x07, 0x18,
+  0xe0, 0x4b, 0xea, 0xe1, 0x6d, 0xf0, 0xc6, 0xf3, 0x8a, 0x6a, 0xba, 0xef, 0x5a, 0x81, 0xa0, 0xd8,
+  0x73, 0x8e, 0x27, 0xf9, 0xa8, 0x75, 0x2f, 0x4a, 0x61, 0xcd, 0x24, 0x3e, 0xa0, 0xd8, 0x43, 0x51,
+  0xf9, 0x81, 0xf4, 0xd5, 0x64, 0xc4, 0xbd, 0xaf, 0x13, 0xf8, 0xa8, 0x75, 0x48, 0xa6, 0xce, 0xa6,
+  0x6f, 0x07, 0x6c, 0xf0, 0x07, 0x18, 0x90, 0xea, 0xd4, 0x7e, 0x27, 0x10, 0xd4, 0x07, 0xea, 0xe1,
+  0x6b, 0x96, 0xe0, 0x4b, 0x2f, 0x4a, 0x83, 0x06, 0x12, 0x87, 0xd4, 0x07, 0x83, 0x06, 0x96, 0x3b,
+  0x00, 0x00, 0x65, 0x25, 0x00, 0x00, 0x6f, 0x32, 0x00, 0x00, 0xa9, 0x4d, 0x48, 0xa6, 0x90, 0xea,
+  0xd4, 0x7e, 0x6d, 0xf0, 0x2b, 0x1a, 0x7f, 0x58, 0xed, 0x7e, 0x22, 0xcc, 0x96, 0x61, 0x10, 0x6a,
+  0x0f, 0x6c, 0x73, 0x37, 0xea, 0xe1, 0xf0, 0x7a, 0x10, 0x6a, 0x11, 0x73, 0x10, 0x6a, 0x73, 0x8e,
+  0x6b, 0x96, 0x2f, 0x1e, 0xe4, 0x7c, 0x4c, 0x41, 0xc6, 0xf3, 0x1a, 0x3b, 0x90, 0xea, 0xb2, 0x64,
+  0x90, 0x3a, 0xa9, 0x4d, 0x44, 0xcd, 0x27, 0xf9, 0x90, 0xea, 0xf9, 0x81, 0x5b, 0x02, 0x96, 0x61,
+  0x6b, 0x96, 0x25, 0xdc, 0xbd, 0xaf, 0xd1, 0xb9, 0xb6, 0x05, 0x88, 0x8d, 0x6d, 0xa4, 0x5b, 0x02,
+  0x2f, 0x4a, 0x02, 0x38, 0xca, 0x63, 0x61, 0xcd, 0x41, 0x07, 0x90, 0x3a, 0x44, 0xe5, 0x04, 0x72,
+  0x6b, 0xd6, 0xe4, 0x7c, 0x22, 0xcc, 0xe9, 0xc9, 0x81, 0x9b, 0x99, 0xab, 0x6f, 0x07, 0x9b, 0xf7,
+  0x1d, 0xa1, 0x4c, 0x41, 0x34, 0xf9, 0xce, 0xa6, 0x2f, 0xed, 0x44, 0xe5, 0xfd, 0xf1, 0x34, 0x80,
+  0x2e, 0x61, 0x8a, 0x00, 0x55, 0x97, 0xd4, 0x7e, 0x17, 0xfe, 0x90, 0xea, 0xc6, 0xf3, 0x25, 0xdc,
+  0x11, 0x73, 0xb2, 0x64, 0xce, 0xc2, 0xbe, 0x48, 0x5a, 0x81, 0x22, 0xb2, 0x25, 0xdc, 0xdf, 0xf0,
+  0xc9, 0x6e, 0xcd, 0xc2, 0xc8, 0x96, 0x81, 0xc3, 0xf1, 0xd8, 0x14, 0xec, 0xbd, 0xaf, 0x65, 0xbe,
+  0x5a, 0x81, 0x1a, 0x3b, 0x10, 0xb6, 0x34, 0xf9, 0xc3, 0xe6, 0x04, 0x72, 0x24, 0x3e, 0x64, 0xc4,
+  0x6d, 0xa4, 0x45, 0xad, 0xc8, 0x96, 0x65, 0xbe, 0x24, 0x3e, 0xb6, 0xb8, 0xc0, 0x38, 0x6d, 0xf0,
+  0x2b, 0x55, 0x96, 0x61, 0x2f, 0xed, 0x22, 0xcc, 0x24, 0xc3, 0x6b, 0x96, 0x7f, 0x58, 0xba, 0xef,
+  0xce, 0xc2, 0xea, 0xe1, 0xdf, 0xf0, 0x90, 0x3a, 0x6f, 0x07, 0x64, 0xc4, 0xb7, 0x91, 0xf9, 0x81,
+  0x2f, 0x4a, 0x99, 0xab, 0x73, 0x37, 0xcd, 0xc2, 0xd6, 0x08, 0x1a, 0x3b, 0xce, 0xc2, 0xd1, 0xb9,
+  0x97, 0x2f, 0xd6, 0x08, 0xcd, 0xc2, 0xbe, 0x48, 0x73, 0x8e, 0x73, 0x8e, 0xc0, 0x38, 0x27, 0x10,
+  0x98, 0xe1, 0x5a, 0x81, 0xed, 0x7e, 0x65, 0x22, 0x24, 0xc3, 0xd4, 0x07, 0x27, 0xf9, 0xb3, 0xb8,
+  0x25, 0xdc, 0x65, 0x22, 0x2f, 0xed, 0xbf, 0x35, 0xd6, 0x7f, 0xd4, 0x07, 0xcd, 0xc2, 0xf0, 0x7a,
+  0xf9, 0x81, 0x83, 0x06, 0x99, 0x30, 0x2f, 0xed, 0x25, 0xdc, 0x90, 0xea, 0x80, 0x05, 0xc3, 0xe6,
+  0xc6, 0xf3, 0x6f, 0x07, 0x2f, 0xed, 0xea, 0xe1, 0x10, 0x6a, 0xa8, 0x75, 0x6f, 0x07, 0x99, 0x19,
+  0x17, 0xfe, 0x73, 0x8e, 0xb6, 0x05, 0x6d, 0xf0, 0xd4, 0x07, 0x07, 0x18, 0x02, 0x38, 0x19, 0x70,
+  0x14, 0xec, 0xe4, 0x7c, 0x80, 0x05, 0x99, 0xab, 0xf4, 0xd5, 0x90, 0x3a, 0x40, 0xb9, 0xb7, 0x91,
+  0xc0, 0x38, 0x0f, 0x6c, 0xf2, 0x1e, 0x6b, 0xd6, 0x86, 0xc3, 0xbd, 0xaf, 0x12, 0x87, 0xd1, 0xb9,
+  0xc3, 0xe6, 0x2c, 0xaa, 0xf2, 0x1e, 0x24, 0x3e, 0x7d, 0xd4, 0x3e, 0xbe, 0xf1, 0xd8, 0x65, 0xbe,
+  0xe5, 0x78, 0x10, 0x6a, 0xe5, 0x78, 0x87, 0x3b, 0x00, 0x00, 0xfd, 0xf1, 0xbe, 0x48, 0xa9, 0x4d,
+  0xbd, 0xaf, 0x40, 0xb9, 0xf9, 0x81, 0xb2, 0x64, 0x7f, 0x58, 0x99, 0xab, 0x5b, 0x02, 0x13, 0xf8,
+  0xed, 0x7e, 0x6b, 0x96, 0xe9, 0xc9, 0x7f, 0x58, 0x98, 0xe1, 0x41, 0x07, 0x12, 0x87, 0x41, 0x07,
+  0xf1, 0xd8, 0xc9, 0x6e, 0xea, 0xe1, 0x55, 0x97, 0xbd, 0xaf, 0xb2, 0x64, 0x07, 0x18, 0x14, 0xec,
+  0xa9, 0x4d, 0xc3, 0xe6, 0x6f, 0x07, 0x55, 0x97, 0xcd, 0xc2, 0xc3, 0xe6, 0x0f, 0x6c, 0x12, 0x87,
+  0xb3, 0xb8, 0x2b, 0x1a, 0x81, 0xc3, 0x9a, 0x8a, 0x99, 0x30, 0x22, 0xcc, 0x1a, 0x3b, 0x22, 0xb2,
+  0x34, 0x80, 0xa0, 0xd8, 0x1a, 0x3b, 0xd1, 0xb9, 0x34, 0x80, 0xc0, 0x38, 0xe5, 0x78, 0xd4, 0x7e,
+  0x07, 0x18, 0x8a, 0x00, 0xb0, 0xe4, 0x2e, 0x44, 0x9b, 0xf7, 0x61, 0xcd, 0x2e, 0x61, 0x90, 0x3a,
+  0xb0, 0xe4, 0x7f, 0x58, 0x99, 0x30, 0xce, 0xa6, 0xd1, 0xb9, 0xe0, 0x4b, 0xba, 0xef, 0x81, 0x9b,
+  0xa0, 0xd8, 0x65, 0x22, 0xe5, 0x78, 0xc0, 0x38, 0x97, 0x2f, 0x4c, 0x41, 0x80, 0x05, 0x22, 0xb2,
+  0x2f, 0x4a, 0xc0, 0x38, 0x6c, 0xf0, 0x4c, 0x41, 0xe0, 0x4b, 0x10, 0x6a, 0x2e, 0x61, 0x0f, 0x6c,
+  0x80, 0x05, 0x2b, 0x55, 0x12, 0x87, 0xa0, 0xd8, 0x3e, 0xbe, 0x0f, 0x6c, 0xbf, 0x35, 0x55, 0x97,
+  0x44, 0xe5, 0x2b, 0x1a, 0xc9, 0x6e, 0x7f, 0x58, 0x34, 0xf9, 0xbe, 0x48, 0x10, 0xb6, 0xb2, 0x64,
+  0x4c, 0x41, 0xa9, 0x4d, 0x22, 0xb2, 0x2b, 0x55, 0x25, 0xdc, 0xe5, 0x78, 0xc8, 0x96, 0x13, 0xf8,
+  0xbf, 0x35, 0x3e, 0xbe, 0x6d, 0xf0, 0x43, 0x51, 0x44, 0xe5, 0xcd, 0xc2, 0x45, 0xad, 0x65, 0xbe,
+  0x0f, 0x6c, 0xe9, 0xc9, 0x99, 0x19, 0xb2, 0x64, 0x7f, 0x58, 0x2e, 0x61, 0xb0, 0xe4, 0x13, 0xf8,
+  0x97, 0x2f, 0x65, 0xbe, 0x27, 0xf9, 0x64, 0xc4, 0xca, 0x63, 0xa8, 0x75, 0x90, 0x3a, 0x12, 0x87,
+  0xf9, 0x81, 0xf0, 0x7a, 0x2c, 0xaa, 0x2f, 0x4a, 0xc3, 0xe6, 0x71, 0xda, 0x45, 0xad, 0x40, 0xb9,
+  0x24, 0x3e, 0x34, 0xf9, 0x2f, 0xed, 0x22, 0xcc, 0x22, 0xb2, 0xa9, 0x4d, 0x01, 0xe9, 0x1d, 0xa1,
+  0x5b, 0x02, 0xc8, 0x96, 0x1a, 0x3b, 0x2e, 0x61, 0xb7, 0x91, 0x7d, 0xd4, 0x9b, 0xf7, 0xf2, 0x1e,
+  0x6c, 0xf0, 0x10, 0x6a, 0xf0, 0x7a, 0x10, 0xb6, 0xfd, 0xf1, 0x2f, 0x1e, 0x2f, 0xed, 0x17, 0xfe,
+  0x19, 0x70, 0xd4, 0x07, 0x01, 0xe9, 0x65, 0xbe, 0xdf, 0xf0, 0xce, 0xa6, 0x2e, 0x44, 0xcd, 0xc2,
+  0x2b, 0x1a, 0xfd, 0xf1, 0x10, 0xb6, 0x44, 0xcd, 0x6f, 0x07, 0x41, 0x07, 0x07, 0x18, 0x90, 0x3a,
+  0x24, 0xc3, 0x6f, 0x07, 0x8a, 0x6a, 0x17, 0xfe, 0x6d, 0xa4, 0x65, 0xbe, 0x2f, 0x1e, 0x2f, 0x4a,
+  0xa0, 0xd8, 0x99, 0x19, 0xcd, 0xc2, 0xb0, 0xe4, 0x6f, 0x07, 0xfd, 0xf1, 0x2b, 0x1a, 0x7f, 0x58,
+  0x27, 0xf9, 0xb6, 0x05, 0xfd, 0xf1, 0x1a, 0x3b, 0x22, 0xb2, 0x45, 0xad, 0xbd, 0xaf, 0x6d, 0xa4,
+  0xab, 0x3b, 0xb6, 0xb8, 0x5b, 0x02, 0xc9, 0x6e, 0x99, 0x19, 0x01, 0xe9, 0x81, 0x9b, 0x0f, 0x6c,
+  0xd6, 0x08, 0x73, 0x8e, 0xb3, 0xb8, 0x6d, 0xf0, 0x2f, 0x4a, 0xb0, 0xe4, 0x2f, 0x1e, 0x02, 0x38,
+  0x48, 0xa6, 0xc6, 0xf3, 0xb3, 0xb8, 0xe4, 0x7c, 0x25, 0xdc, 0x01, 0xe9, 0x34, 0xf9, 0x24, 0x3e,
+  0x22, 0xb2, 0x83, 0x06, 0x1d, 0xa1, 0x45, 0xad, 0x7f, 0x58, 0x9a, 0x8a, 0xbf, 0x35, 0x07, 0x18,
+  0xf0, 0x7a, 0xe4, 0x7c, 0x27, 0xf9, 0x90, 0x3a, 0x04, 0x72, 0xe5, 0x78, 0x40, 0xb9, 0x2f, 0x4a,
+  0xa0, 0xd8, 0x27, 0xf9, 0x4c, 0x41, 0x6b, 0xd6, 0xc9, 0x6e, 0x44, 0xe5, 0xe9, 0xc9, 0x04, 0x72,
+  0x6b, 0xd6, 0x64, 0xc4, 0x02, 0x38, 0x6b, 0xd6, 0xf2, 0x1e, 0xf0, 0x7a, 0xb6, 0x05, 0xc0, 0x38,
+  0x48, 0xa6, 0x65, 0x22, 0x99, 0x30, 0xf1, 0xd8, 0xd6, 0x7f, 0xb6, 0x05, 0xd6, 0x7f, 0x97, 0x2f,
+  0x04, 0x72, 0x11, 0x73, 0xf9, 0x81, 0x04, 0x72, 0x2b, 0x1a, 0x44, 0xe5, 0x17, 0xfe, 0xc8, 0x96,
+  0x5b, 0x02, 0xfd, 0xf1, 0x52, 0x3b, 0x00, 0x00, 0x6f, 0x32, 0x00, 0x00, 0x6b, 0x3b, 0x00, 0x00,
+  0xf9, 0x2e, 0x00, 0x00, 0xd5, 0x21, 0x00, 0x00, 0xce, 0xc2, 0xe5, 0x78, 0xba, 0xef, 0x2e, 0x61,
+  0xd4, 0x07, 0x83, 0x06, 0x44, 0xcd, 0xfd, 0xf1, 0xc6, 0xf3, 0x4c, 0x41, 0x96, 0x61, 0x61, 0xcd,
+  0x11, 0x73, 0xe4, 0x7c, 0x10, 0x6a, 0xd1, 0xb9, 0xbd, 0xaf, 0x2c, 0xaa, 0xba, 0xef, 0x40, 0xb9,
+  0xb3, 0xb8, 0xb6, 0xb8, 0xce, 0xa6, 0x2b, 0x55, 0x9a, 0x8a, 0x2b, 0x1a, 0xb7, 0x91, 0xcd, 0xc2,
+  0xf0, 0x7a, 0x48, 0xa6, 0xe9, 0xc9, 0x98, 0xe1, 0x10, 0x6a, 0x6b, 0x96, 0xbe, 0x48, 0x25, 0xdc,
+  0xba, 0xef, 0xdf, 0xf0, 0x07, 0x18, 0x99, 0x19, 0x10, 0x6a, 0x71, 0xda, 0xfd, 0xf1, 0xd1, 0xb9,
+  0xe5, 0x78, 0x2b, 0x55, 0x90, 0xea, 0x1d, 0xa1, 0xba, 0xef, 0xc6, 0xf3, 0xab, 0x3b, 0x6b, 0xd6,
+  0x12, 0x87, 0x2f, 0x4a, 0x2c, 0xaa, 0x0f, 0x6c, 0xd4, 0x07, 0x24, 0x3e, 0x04, 0x72, 0x17, 0xfe,
+  0xd4, 0x07, 0x80, 0x05, 0xe4, 0x7c, 0x4c, 0x41, 0x6d, 0xa4, 0xcd, 0xc2, 0xe9, 0xc9, 0xc9, 0x6e,
+  0xb6, 0xb8, 0x22, 0xb2, 0x24, 0x3e, 0x81, 0xc3, 0x2b, 0x1a, 0x2f, 0xed, 0xf1, 0xd8, 0x90, 0x3a,
+  0x2f, 0x4a, 0xfd, 0xf1, 0xc6, 0xf3, 0x55, 0x97, 0xab, 0x3b, 0x07, 0x18, 0xd1, 0xb9, 0x10, 0xb6,
+  0x2e, 0x61, 0xf9, 0x81, 0xbd, 0xaf, 0xd4, 0x7e, 0xe0, 0x4b, 0x2f, 0xed, 0x96, 0x61, 0x2f, 0xed,
+  0x8a, 0x6a, 0x5a, 0x81, 0x6b, 0x96, 0xba, 0xef, 0x02, 0x38, 0x44, 0xe5, 0x73, 0x8e, 0x61, 0xcd,
+  0x1d, 0xa1, 0xb6, 0x05, 0x6d, 0xf0, 0x44, 0xe5, 0x07, 0x18, 0xb0, 0xe4, 0xce, 0xc2, 0x22, 0xcc,
+  0x73, 0x8e, 0x41, 0x07, 0x2b, 0x55, 0xd6, 0x08, 0xd6, 0x7f, 0x22, 0xb2, 0x7f, 0x58, 0xdf, 0xf0,
+  0x6b, 0x96, 0x5a, 0x81, 0x99, 0xab, 0x9a, 0x8a, 0x96, 0x61, 0xf0, 0x7a, 0x43, 0x51, 0xf4, 0xd5,
+  0xb0, 0xe4, 0x5a, 0x81, 0xbe, 0x48, 0x73, 0x37, 0xa0, 0xd8, 0x19, 0x70, 0xd1, 0xb9, 0xbf, 0x35,
+  0x6d, 0xa4, 0x41, 0x07, 0xfd, 0xf1, 0x43, 0x51, 0x3e, 0xbe, 0x44, 0xe5, 0x6b, 0x96, 0x40, 0xb9,
+  0x99, 0x19, 0xb7, 0x91, 0x2f, 0x4a, 0xb7, 0x91, 0x7f, 0x67, 0xea, 0xe1, 0x25, 0xdc, 0x07, 0x18,
+  0x73, 0x37, 0xf9, 0x81, 0x8a, 0x6a, 0xd6, 0x08, 0xce, 0xa6, 0xed, 0x7e, 0x61, 0xcd, 0x99, 0x30,
+  0x81, 0xc3, 0x6d, 0xa4, 0x2b, 0x55, 0xc0, 0x38, 0x2b, 0x1a, 0x2c, 0xaa, 0xbd, 0xaf, 0x6f, 0x07,
+  0xd1, 0xb9, 0x99, 0x19, 0x88, 0x8d, 0x4c, 0x41, 0xce, 0xa6, 0xab, 0x3b, 0x99, 0x30, 0x86, 0xc3,
+  0x25, 0xdc, 0x10, 0xb6, 0x27, 0xf9, 0x65, 0x22, 0x34, 0xf9, 0x27, 0x10, 0xa0, 0xd8, 0xe9, 0xc9,
+  0x14, 0xec, 0xe4, 0x7c, 0xc6, 0xf3, 0xcd, 0xc2, 0x01, 0xe9, 0x98, 0xe1, 0x80, 0x05, 0xfd, 0xf1,
+  0xa9, 0x4d, 0x6b, 0xd6, 0x22, 0xcc, 0xe0, 0x4b, 0x98, 0xe1, 0x6b, 0x96, 0xab, 0x3b, 0xea, 0xe1,
+  0x27, 0xf9, 0x44, 0xcd, 0x10, 0x6a, 0x34, 0xf9, 0x1d, 0xa1, 0xb6, 0xb8, 0x2e, 0x61, 0x8a, 0x6a,
+  0x98, 0xe1, 0x71, 0xda, 0xf4, 0xd5, 0xe9, 0xc9, 0x99, 0x30, 0x27, 0x10, 0x7f, 0x67, 0x10, 0xb6,
+  0x83, 0x06, 0xc0, 0x38, 0xd6, 0x08, 0x9b, 0xf7, 0x6c, 0xf0, 0x19, 0x36, 0x00, 0x00, 0xa5, 0x3b,
+  0x00, 0x00, 0x90, 0x3b, 0x00, 0x00, 0x19, 0x70, 0x6b, 0x96, 0x27, 0xf9, 0xb6, 0xb8, 0x40, 0xb9,
+  0x97, 0x2f, 0xa8, 0x75, 0x41, 0x07, 0x2f, 0x1e, 0x5b, 0x02, 0x2b, 0x55, 0xe9, 0xc9, 0x24, 0x3e,
+  0xcd, 0xc2, 0xc9, 0x6e, 0x2f, 0xed, 0x25, 0xdc, 0x17, 0xfe, 0x1a, 0x3b, 0x24, 0x3e, 0x5b, 0x02,
+  0x7d, 0xd4, 0x10, 0xb6, 0xbf, 0x35, 0x73, 0x8e, 0xf1, 0xd8, 0x7f, 0x58, 0x24, 0x3e, 0x8a, 0x00,
+  0x13, 0xf8, 0x17, 0xfe, 0xa0, 0xd8, 0xc9, 0x6e, 0x0f, 0x6c, 0x34, 0x80, 0x2e, 0x44, 0xce, 0xa6,
+  0x44, 0xcd, 0x9a, 0x8a, 0x9a, 0x8a, 0xf2, 0x1e, 0x44, 0xcd, 0xa9, 0x4d, 0x2b, 0x55, 0x88, 0x8d,
+  0xf9, 0x81, 0xab, 0x3b, 0xbd, 0xaf, 0x45, 0xad, 0xe0, 0x4b, 0x99, 0xab, 0xf2, 0x1e, 0xba, 0xef,
+  0x2c, 0xaa, 0x24, 0xc3, 0x81, 0xc3, 0x19, 0x70, 0xd1, 0xb9, 0x2f, 0xed, 0xbf, 0x35, 0x90, 0xea,
+  0x1a, 0x3b, 0x10, 0x6a, 0xfd, 0xf1, 0xdf, 0xf0, 0x07, 0x18, 0xb0, 0xe4, 0xb7, 0x91, 0x73, 0x37,
+  0x12, 0x87, 0x2e, 0x61, 0x6b, 0x96, 0x61, 0xcd, 0xe0, 0x4b, 0xce, 0xc2, 0x81, 0x9b, 0xed, 0x7e,
+  0x99, 0xab, 0x73, 0x37, 0x3e, 0xbe, 0x02, 0x38, 0x6b, 0x96, 0xea, 0xe1, 0xc3, 0xe6, 0x7f, 0x67,
+  0xb0, 0xe4, 0xb0, 0xe4, 0xc6, 0xf3, 0xd6, 0x7f, 0x2e, 0x61, 0x90, 0x3a, 0xf1, 0xd8, 0x88, 0x8d,
+  0x0f, 0x6c, 0x34, 0xf9, 0x40, 0xb9, 0x10, 0xb6, 0x0f, 0x6c, 0xbe, 0x48, 0x22, 0xcc, 0x2e, 0x44,
+  0x2f, 0x4a, 0x27, 0xf9, 0x0f, 0x6c, 0x65, 0x22, 0x2f, 0xed, 0x6b, 0x96, 0x44, 0xcd, 0xc0, 0x38,
+  0x22, 0xcc, 0xf4, 0xd5, 0xf2, 0x1e, 0xc9, 0x6e, 0x5b, 0x02, 0xf2, 0x1e, 0xb6, 0xb8, 0xce, 0xc2,
+  0x99, 0x30, 0x2f, 0x4a, 0x2c, 0xaa, 0x8a, 0x6a, 0xf4, 0xd5, 0xc9, 0x6e, 0x73, 0x37, 0x73, 0x8e,
+  0xf1, 0xd8, 0xcd, 0xc2, 0x22, 0xb2, 0xc0, 0x38, 0xb6, 0xb8, 0xbe, 0x48, 0x27, 0x10, 0x2c, 0xaa,
+  0xa8, 0x75, 0xba, 0xef, 0x24, 0xc3, 0x27, 0xf9, 0x02, 0x38, 0xb3, 0xb8, 0x97, 0x2f, 0xe0, 0x4b,
+  0x2f, 0x4a, 0xce, 0xc2, 0x44, 0xcd, 0x0f, 0x6c, 0x99, 0x30, 0x88, 0x8d, 0xbf, 0x35, 0x6b, 0xd6,
+  0x25, 0xdc, 0x4c, 0x41, 0x13, 0xf8, 0xe5, 0x78, 0x8a, 0x6a, 0xce, 0xa6, 0x25, 0xdc, 0xea, 0xe1,
+  0x7f, 0x58, 0x27, 0x10, 0xa8, 0x75, 0xb6, 0xb8, 0x99, 0x30, 0xb7, 0x91, 0xf1, 0xd8, 0xb2, 0x64,
+  0xb6, 0x05, 0x88, 0x8d, 0x2b, 0x1a, 0xba, 0xef, 0x12, 0x87, 0xca, 0x63, 0x6d, 0xa4, 0xe4, 0x7c,
+  0x8a, 0x6a, 0x10, 0xb6, 0xd6, 0x7f, 0x83, 0x06, 0x99, 0xab, 0x2f, 0x4a, 0x40, 0xb9, 0x6d, 0xf0,
+  0x02, 0x38, 0x6b, 0x96, 0x12, 0x87, 0x80, 0x05, 0xca, 0x63, 0x27, 0xf9, 0x0f, 0x6c, 0x27, 0xf9,
+  0x13, 0xf8, 0x34, 0xf9, 0x64, 0xc4, 0x45, 0xad, 0xea, 0xe1, 0x2b, 0x1a, 0x96, 0x61, 0x10, 0x6a,
+  0xb0, 0xe4, 0x55, 0x97, 0x6b, 0xd6, 0x2b, 0x1a, 0x5a, 0x81, 0xc9, 0x6e, 0x99, 0x30, 0xba, 0xef,
+  0x1d, 0xa1, 0x11, 0x73, 0x9b, 0xf7, 0x96, 0x61, 0x5b, 0x02, 0x10, 0x6a, 0x41, 0x07, 0x55, 0x97,
+  0x90, 0x3a, 0xa5, 0x3b, 0x00, 0x00, 0xb4, 0x3b, 0x00, 0x00, 0xa9, 0x27, 0x00, 0x00, 0x90, 0x3a,
+  0x04, 0x72, 0x64, 0xc4, 0xce, 0xc2, 0x6b, 0x96, 0x73, 0x8e, 0x2f, 0x4a, 0x1d, 0xa1, 0x64, 0xc4,
+  0x2f, 0xed, 0xc0, 0x38, 0x34, 0x80, 0x71, 0xda, 0xb6, 0xb8, 0x90, 0xea, 0xe4, 0x7c, 0x80, 0x05,
+  0xed, 0x7e, 0x0f, 0x6c, 0x34, 0x80, 0x64, 0xc4, 0x11, 0x73, 0x17, 0xfe, 0x2c, 0xaa, 0xce, 0xc2,
+  0xb0, 0xe4, 0xa9, 0x4d, 0x3e, 0xbe, 0x2f, 0x1e, 0x61, 0xcd, 0xf9, 0x81, 0xd1, 0xb9, 0x73, 0x37,
+  0x12, 0x87, 0x44, 0xe5, 0xe4, 0x7c, 0x14, 0xec, 0x6d, 0xa4, 0x07, 0x18, 0x2b, 0x55, 0x2f, 0x4a,
+  0x2f, 0xed, 0xce, 0xc2, 0x10, 0x6a, 0xb6, 0xb8, 0x5a, 0x81, 0x73, 0x37, 0xe4, 0x7c, 0xc3, 0xe6,
+  0x64, 0xc4, 0xf2, 0x1e, 0xba, 0xef, 0x0f, 0x6c, 0x98, 0xe1, 0xf9, 0x81, 0xdf, 0xf0, 0xc9, 0x6e,
+  0x04, 0x72, 0xd4, 0x07, 0x10, 0xb6, 0x41, 0x07, 0x6c, 0xf0, 0x1a, 0x3b, 0x2f, 0x4a, 0x43, 0x51,
+  0xe5, 0x78, 0xcd, 0xc2, 0xd6, 0x7f, 0xd4, 0x07, 0x8a, 0x00, 0x10, 0xb6, 0x88, 0x8d, 0xf1, 0xd8,
+  0x43, 0x51, 0x6b, 0x96, 0x34, 0xf9, 0x1d, 0xa1, 0x14, 0xec, 0x2e, 0x61, 0x97, 0x2f, 0xbd, 0xaf,
+  0x7d, 0xd4, 0x19, 0x70, 0x90, 0x3a, 0x1d, 0xa1, 0x2f, 0x1e, 0x4c, 0x41, 0xa0, 0xd8, 0xa9, 0x4d,
+  0x83, 0x06, 0xf4, 0xd5, 0x34, 0xf9, 0x07, 0x18, 0x10, 0x6a, 0x17, 0xfe, 0xd6, 0x7f, 0x2e, 0x61,
+  0xe9, 0xc9, 0xb2, 0x64, 0x81, 0xc3, 0x40, 0xb9, 0x14, 0xec, 0x44, 0xcd, 0xf9, 0x81, 0x8a, 0x00,
+  0x02, 0x38, 0x65, 0x3b, 0x00, 0x00, 0xa3, 0x35, 0x00, 0x00, 0xf9, 0x2e, 0x00, 0x00, 0x65, 0x25,
+  0x00, 0x00, 0xa3, 0x35, 0x00, 0x00, 0x2f, 0xed, 0x97, 0x2f, 0x2e, 0x44, 0xfd, 0xf1, 0x86, 0xc3,
+  0x40, 0xb9, 0xca, 0x63, 0x3e, 0xbe, 0x3e, 0xbe, 0x7f, 0x67, 0x80, 0x05, 0x02, 0x38, 0x2e, 0x44,
+  0xb2, 0x64, 0x6f, 0x07, 0x2b, 0x1a, 0x99, 0xab, 0xf2, 0x1e, 0x12, 0x87, 0xd1, 0xb9, 0xfd, 0xf1,
+  0x45, 0xad, 0xce, 0xa6, 0x3e, 0xbe, 0xa0, 0xd8, 0xa0, 0xd8, 0x07, 0x18, 0x81, 0x9b, 0x8a, 0x6a,
+  0xf1, 0xd8, 0xed, 0x7e, 0x7d, 0xd4, 0x27, 0x10, 0x1a, 0x3b, 0x22, 0xb2, 0x0f, 0x6c, 0xd6, 0x7f,
+  0x9b, 0xf7, 0x2f, 0x4a, 0xd6, 0x7f, 0x10, 0x6a, 0x5b, 0x02, 0x22, 0xcc, 0x44, 0xcd, 0xce, 0xa6,
+  0xce, 0xc2, 0x2b, 0x55, 0xf9, 0x81, 0x27, 0x10, 0x5a, 0x81, 0xc0, 0x38, 0xa0, 0xd8, 0x19, 0x70,
+  0x24, 0xc3, 0xc9, 0x6e, 0x6d, 0xa4, 0x02, 0x38, 0x24, 0xc3, 0x5a, 0x81, 0xcd, 0xc2, 0x13, 0xf8,
+  0xa8, 0x75, 0x96, 0x61, 0x64, 0xc4, 0x2e, 0x44, 0x96, 0x61, 0xf2, 0x1e, 0xd6, 0x08, 0x14, 0xec,
+  0x7d, 0xd4, 0x99, 0x30, 0xd4, 0x7e, 0x5b, 0x02, 0x65, 0xbe, 0x4c, 0x41, 0xed, 0x7e, 0x27, 0x10,
+  0xa0, 0xd8, 0x97, 0x2f, 0xc9, 0x6e, 0x24, 0x3e, 0x41, 0x07, 0xb2, 0x64, 0x22, 0xcc, 0xc3, 0xe6,
+  0xab, 0x3b, 0x27, 0x10, 0x73, 0x8e, 0x02, 0x38, 0xd4, 0x7e, 0xc8, 0x96, 0xa0, 0xd8, 0x6b, 0xd6,
+  0x0f, 0x6c, 0xe5, 0x78, 0xd1, 0xb9, 0xbe, 0x48, 0xcd, 0xc2, 0xdf, 0xf0, 0x90, 0xea, 0x25, 0xdc,
+  0xd4, 0x07, 0x0f, 0x6c, 0xfd, 0xf1, 0x65, 0xbe, 0x98, 0xe1, 0xab, 0x3b, 0x2c, 0xaa, 0x4c, 0x41,
+  0x80, 0x05, 0x22, 0xcc, 0x71, 0xda, 0x7f, 0x58, 0xf1, 0xd8, 0xc0, 0x38, 0xd4, 0x07, 0x14, 0xec,
+  0xf9, 0x81, 0x83, 0x06, 0xbe, 0x48, 0xb0, 0xe4, 0x6d, 0xa4, 0x14, 0xec, 0x8a, 0x6a, 0x5a, 0x81,
+  0x2b, 0x1a, 0xd4, 0x7e, 0xc8, 0x96, 0x99, 0x19, 0xa9, 0x4d, 0xbe, 0x48, 0x99, 0x30, 0x96, 0x61,
+  0x12, 0x87, 0x0f, 0x6c, 0xa8, 0x75, 0xbe, 0x48, 0x61, 0xcd, 0x90, 0xea, 0x73, 0x8e, 0xe9, 0xc9,
+  0x86, 0xc3, 0x90, 0xea, 0xc6, 0xf3, 0xb7, 0x91, 0xce, 0xa6, 0x65, 0xbe, 0x9a, 0x8a, 0x5b, 0x02,
+  0x2c, 0xaa, 0xbd, 0xaf, 0x7d, 0xd4, 0x80, 0x05, 0x86, 0xc3, 0x40, 0xb9, 0xbd, 0xaf, 0x73, 0x8e,
+  0xce, 0xc2, 0x1a, 0x3b, 0x24, 0x3e, 0x40, 0xb9, 0x11, 0x73, 0x5a, 0x81, 0x2f, 0xed, 0x6d, 0xf0,
+  0x9a, 0x8a, 0x02, 0x38, 0x7f, 0x67, 0x34, 0xf9, 0x2f, 0xed, 0x65, 0x22, 0x10, 0x6a, 0xf4, 0xd5,
+  0x22, 0xcc, 0x48, 0xa6, 0x96, 0x61, 0x22, 0xb2, 0x41, 0x07, 0x24, 0x3e, 0x73, 0x8e, 0x41, 0x07,
+  0x14, 0xec, 0x2e, 0x61, 0xd1, 0xb9, 0x83, 0x06, 0xc8, 0x96, 0xcd, 0xc2, 0x12, 0x87, 0xd6, 0x7f,
+  0x96, 0x61, 0x5b, 0x02, 0xb2, 0x64, 0x55, 0x97, 0x99, 0x19, 0xbd, 0xaf, 0x86, 0xc3, 0x34, 0x80,
+  0xd4, 0x7e, 0x99, 0xab, 0x17, 0xfe, 0x44, 0xcd, 0xea, 0xe1, 0xbe, 0x48, 0x55, 0x97, 0x7d, 0xd4,
+  0x0f, 0x6c, 0x80, 0x05, 0xc3, 0xe6, 0x90, 0xea, 0xa9, 0x4d, 0x1d, 0xa1, 0x11, 0x73, 0xce, 0xc2,
+  0x10, 0xb6, 0xca, 0x63, 0x65, 0xbe, 0x2c, 0xaa, 0xfd, 0xf1, 0x6f, 0x07, 0x11, 0x73, 0x07, 0x18,
+  0xc3, 0xe6, 0x80, 0x05, 0xba, 0xef, 0x25, 0xdc, 0x55, 0x97, 0xb6, 0xb8, 0x8a, 0x00, 0xce, 0xa6,
+  0x2b, 0x1a, 0xba, 0xef, 0x7f, 0x58, 0x4c, 0x41, 0x0f, 0x6c, 0xcd, 0xc2, 0xd4, 0x07, 0xa9, 0x4d,
+  0x71, 0xda, 0x34, 0xf9, 0x8a, 0x00, 0xd6, 0x7f, 0x2f, 0xed, 0xce, 0xc2, 0x80, 0x05, 0x83, 0x06,
+  0x5b, 0x02, 0x10, 0x6a, 0x43, 0x51, 0xc8, 0x96, 0xa8, 0x75, 0xe4, 0x7c, 0x86, 0xc3, 0x19, 0x70,
+  0xea, 0xe1, 0x96, 0x61, 0x6b, 0x96, 0xf9, 0x81, 0x86, 0xc3, 0x61, 0xcd, 0x83, 0x06, 0x12, 0x87,
+  0xf9, 0x81, 0xf4, 0xd5, 0xf0, 0x7a, 0x8a, 0x6a, 0x27, 0x10, 0x10, 0xb6, 0x14, 0xec, 0x27, 0xf9,
+  0xf2, 0x1e, 0x17, 0xfe, 0x71, 0xda, 0xc6, 0xf3, 0xc0, 0x38, 0x81, 0x9b, 0x65, 0xbe, 0x64, 0xc4,
+  0x2e, 0x44, 0xe9, 0xc9, 0x14, 0xec, 0x07, 0x18, 0x14, 0xec, 0x02, 0x38, 0xbf, 0x35, 0xba, 0xef,
+  0xfd, 0xf1, 0xd5, 0x21, 0x00, 0x00, 0xb4, 0x3b, 0x00, 0x00, 0x9e, 0x3b, 0x00, 0x00, 0xc1, 0x20,
+  0x00, 0x00, 0x1a, 0x3b, 0x86, 0xc3, 0xca, 0x63, 0x90, 0x3a, 0x65, 0xbe, 0x80, 0x05, 0x27, 0x10,
+  0xb7, 0x91, 0x2e, 0x44, 0x01, 0xe9, 0xf0, 0x7a, 0x11, 0x73, 0xc6, 0xf3, 0xea, 0xe1, 0xc9, 0x6e,
+  0x86, 0xc3, 0xc6, 0xf3, 0x64, 0xc4, 0x8a, 0x00, 0x19, 0x70, 0xc3, 0xe6, 0x44, 0xcd, 0x1a, 0x3b,
+  0x02, 0x38, 0xbd, 0xaf, 0x48, 0xa6, 0x0f, 0x6c, 0xe0, 0x4b, 0xce, 0xc2, 0x24, 0xc3, 0x6d, 0xa4,
+  0x81, 0x9b, 0x24, 0xc3, 0x44, 0xe5, 0x1d, 0xa1, 0xd4, 0x07, 0x2c, 0xaa, 0x73, 0x8e, 0xc0, 0x38,
+  0x97, 0x2f, 0xab, 0x3b, 0x96, 0x61, 0xf1, 0xd8, 0x1a, 0x3b, 0xf1, 0xd8, 0x2c, 0xaa, 0x2e, 0x61,
+  0x96, 0x3b, 0x00, 0x00, 0x5f, 0x3b, 0x00, 0x00, 0x7a, 0x3b, 0x00, 0x00, 0xbb, 0x3b, 0x00, 0x00,
+  0xbb, 0x3b, 0x00, 0x00, 0xf9, 0x2e, 0x00, 0x00, 0x6b, 0xd6, 0x01, 0xe9, 0x34, 0xf9, 0x0f, 0x6c,
+  0x99, 0x19, 0x2f, 0xed, 0x55, 0x97, 0x90, 0x3a, 0xb6, 0x05, 0xb7, 0x91, 0x99, 0x19, 0x7d, 0xd4,
+  0x27, 0x10, 0xa9, 0x4d, 0xed, 0x7e, 0xed, 0x7e, 0x24, 0x3e, 0x98, 0xe1, 0x2e, 0x44, 0xcd, 0xc2,
+  0x19, 0x70, 0x8a, 0x00, 0x27, 0xf9, 0xab, 0x3b, 0x10, 0x6a, 0x9a, 0x8a, 0x27, 0xf9, 0x17, 0xfe,
+  0x41, 0x07, 0x13, 0xf8, 0xc8, 0x96, 0x81, 0xc3, 0x4c, 0x41, 0x25, 0xdc, 0xe9, 0xc9, 0x98, 0xe1,
+  0x71, 0xda, 0xa9, 0x4d, 0x7f, 0x67, 0xb7, 0x91, 0x90, 0x3a, 0x7d, 0xd4, 0x2f, 0xed, 0x0f, 0x6c,
+  0x4c, 0x41, 0xb6, 0x05, 0x73, 0x37, 0xb7, 0x91, 0x48, 0xa6, 0x5b, 0x02, 0xb6, 0x05, 0x14, 0xec,
+  0xd6, 0x08, 0xa9, 0x4d, 0xd6, 0x7f, 0x71, 0xda, 0x4c, 0x41, 0x8a, 0x00, 0x34, 0x80, 0x11, 0x73,
+  0x9a, 0x8a, 0xbf, 0x35, 0x3e, 0xbe, 0xd6, 0x7f, 0x25, 0xdc, 0xd4, 0x7e, 0x07, 0x18, 0x99, 0x30,
+  0xb3, 0xb8, 0x43, 0x51, 0x6f, 0x07, 0x99, 0x19, 0x5b, 0x02, 0x2e, 0x44, 0x61, 0xcd, 0x25, 0xdc,
+  0x27, 0xf9, 0xb3, 0xb8, 0x81, 0x9b, 0x7d, 0xd4, 0x99, 0xab, 0x7d, 0xd4, 0x02, 0x38, 0xf9, 0x81,
+  0x90, 0xea, 0x25, 0xdc, 0x96, 0x61, 0xd4, 0x07, 0x43, 0x51, 0x73, 0x37, 0x12, 0x87, 0x10, 0x6a,
+  0xc6, 0xf3, 0x88, 0x8d, 0x34, 0xf9, 0xc8, 0x96, 0xb2, 0x64, 0xce, 0xc2, 0x64, 0xc4, 0x6f, 0x07,
+  0x2e, 0x44, 0x99, 0x19, 0x27, 0x10, 0x1d, 0xa1, 0xb6, 0xb8, 0x17, 0xfe, 0x04, 0x72, 0x44, 0xcd,
+  0x34, 0x80, 0x0f, 0x6c, 0x73, 0x37, 0x8a, 0x00, 0x1d, 0xa1, 0xb0, 0xe4, 0xba, 0xef, 0xd4, 0x07,
+  0xf9, 0x81, 0xba, 0xef, 0xd6, 0x08, 0x96, 0x61, 0x65, 0x22, 0x34, 0x80, 0x10, 0xb6, 0x44, 0xe5,
+  0xb6, 0x05, 0x19, 0x70, 0x45, 0xad, 0xca, 0x63, 0x2b, 0x55, 0x41, 0x07, 0x61, 0xcd, 0xbd, 0xaf,
+  0x81, 0xc3, 0x80, 0x05, 0x5b, 0x02, 0x71, 0xda, 0x6b, 0x96, 0xcd, 0xc2, 0x1a, 0x3b, 0x83, 0x06,
+  0x99, 0x19, 0xe9, 0xc9, 0x73, 0x8e, 0x25, 0xdc, 0x43, 0x51, 0x34, 0xf9, 0x80, 0x05, 0xf2, 0x1e,
+  0x2b, 0x1a, 0xc0, 0x38, 0xb7, 0x91, 0xdf, 0xf0, 0xb6, 0x05, 0x7d, 0xd4, 0xe5, 0x78, 0x40, 0xb9,
+  0x1a, 0x3b, 0xe9, 0xc9, 0x02, 0x38, 0x04, 0x72, 0x71, 0xda, 0x99, 0x19, 0xf9, 0x81, 0x25, 0xdc,
+  0xf9, 0x81, 0x10, 0x6a, 0x55, 0x97, 0x81, 0xc3, 0xbd, 0xaf, 0xa9, 0x4d, 0x2e, 0x44, 0x4c, 0x41,
+  0x2e, 0x61, 0x6d, 0xa4, 0xcd, 0xc2, 0xcd, 0xc2, 0xcd, 0xc2, 0xf4, 0xd5, 0x07, 0x18, 0x43, 0x51,
+  0x10, 0x6a, 0x4c, 0x41, 0xf0, 0x7a, 0xd4, 0x7e, 0x22, 0xb2, 0x65, 0x22, 0x2b, 0x55, 0x2f, 0x1e,
+  0xc0, 0x38, 0x9b, 0xf7, 0x34, 0x80, 0xb2, 0x64, 0xf1, 0xd8, 0xd4, 0x7e, 0xd5, 0x21, 0x00, 0x00,
+  0x9a, 0x8a, 0xa9, 0x4d, 0xf1, 0xd8, 0x97, 0x2f, 0xb7, 0x91, 0x8a, 0x6a, 0x22, 0xb2, 0xab, 0x3b,
+  0x64, 0xc4, 0xfd, 0xf1, 0x43, 0x51, 0x73, 0x8e, 0x80, 0x05, 0xa8, 0x75, 0x90, 0x3a, 0xf0, 0x7a,
+  0x2e, 0x44, 0x81, 0x9b, 0x8a, 0x00, 0x0f, 0x6c, 0xf0, 0x7a, 0x2f, 0x1e, 0xb6, 0xb8, 0x8a, 0x6a,
+  0x27, 0xf9, 0x6d, 0xf0, 0x86, 0xc3, 0x9a, 0x8a, 0x48, 0xa6, 0x6f, 0x07, 0xbf, 0x35, 0xf1, 0xd8,
+  0x6b, 0xd6, 0x81, 0x9b, 0x02, 0x38, 0x40, 0xb9, 0xe5, 0x78, 0x01, 0xe9, 0x81, 0x9b, 0x22, 0xb2,
+  0x04, 0x72, 0xc9, 0x6e, 0xd4, 0x07, 0x65, 0xbe, 0x34, 0xf9, 0xce, 0xa6, 0x2f, 0x1e, 0xbe, 0x48,
+  0x83, 0x06, 0xd6, 0x08, 0xba, 0xef, 0x41, 0x07, 0xd4, 0x7e, 0xa0, 0xd8, 0x19, 0x70, 0xb0, 0xe4,
+  0x2e, 0x44, 0x27, 0x10, 0xf9, 0x81, 0xc3, 0xe6, 0x6c, 0xf0, 0x2f, 0x1e, 0x14, 0xec, 0xe5, 0x78,
+  0x19, 0x70, 0x64, 0xc4, 0xbe, 0x48, 0x2e, 0x44, 0x3e, 0xbe, 0x81, 0x9b, 0xbf, 0x35, 0x2f, 0x1e,
+  0x64, 0xc4, 0x4c, 0x41, 0xf9, 0x81, 0x9b, 0xf7, 0xe9, 0xc9, 0xe5, 0x78, 0xa9, 0x4d, 0x34, 0xf9,
+  0xf9, 0x81, 0x04, 0x72, 0xc3, 0xe6, 0x34, 0x80, 0x90, 0x3a, 0xc6, 0xf3, 0xc0, 0x38, 0x71, 0xda,
+  0x44, 0xcd, 0xba, 0xef, 0x86, 0xc3, 0xba, 0xef, 0x90, 0x3a, 0x01, 0xe9, 0x24, 0xc3, 0x48, 0xa6,
+  0x6c, 0xf0, 0x98, 0xe1, 0xed, 0x7e, 0x01, 0xe9, 0x71, 0xda, 0x10, 0x6a, 0xf2, 0x1e, 0x71, 0xda,
+  0x97, 0x2f, 0x73, 0x37, 0xc8, 0x96, 0x2b, 0x55, 0x13, 0xf8, 0xe5, 0x78, 0xc0, 0x38, 0x2c, 0xaa,
+  0x44, 0xcd, 0xa0, 0xd8, 0xa0, 0xd8, 0x1a, 0x3b, 0xd6, 0x08, 0x5b, 0x02, 0x22, 0xcc, 0xc9, 0x6e,
+  0x99, 0x19, 0xe0, 0x4b, 0xe9, 0xc9, 0xb6, 0xb8, 0xce, 0xc2, 0x99, 0xab, 0x6b, 0x96, 0x81, 0xc3,
+  0xf0, 0x7a, 0x2b, 0x1a, 0x2f, 0x4a, 0xd4, 0x07, 0x7f, 0x67, 0x2c, 0xaa, 0x9a, 0x8a, 0x7d, 0xd4,
+  0xa0, 0xd8, 0xbd, 0xaf, 0x6f, 0x07, 0xed, 0x7e, 0x96, 0x61, 0x98, 0xe1, 0x83, 0x06, 0x0f, 0x6c,
+  0xab, 0x3b, 0xcd, 0xc2, 0xf1, 0xd8, 0xbd, 0xaf, 0x07, 0x18, 0xd4, 0x07, 0xca, 0x63, 0xd4, 0x07,
+  0x6b, 0xd6, 0x07, 0x18, 0x71, 0xda, 0x80, 0x05, 0x34, 0x80, 0x9b, 0xf7, 0xb0, 0xe4, 0xca, 0x63,
+  0xed, 0x7e, 0x25, 0xdc, 0x17, 0xfe, 0xb0, 0xe4, 0xe4, 0x7c, 0xf4, 0xd5, 0x11, 0x73, 0xea, 0xe1,
+  0x97, 0x2f, 0x90, 0x3a, 0xb6, 0xb8, 0x98, 0xe1, 0x25, 0xdc, 0x83, 0x06, 0xca, 0x63, 0x2b, 0x1a,
+  0xb2, 0x64, 0xab, 0x3b, 0xb6, 0x05, 0xce, 0xc2, 0xc0, 0x38, 0xb0, 0xe4, 0x80, 0x05, 0x98, 0xe1,
+  0xf0, 0x7a, 0x6d, 0xf0, 0x7f, 0x67, 0x2e, 0x61, 0x5a, 0x81, 0xb0, 0xe4, 0x44, 0xe5, 0x83, 0x06,
+  0xd4, 0x7e, 0x44, 0xe5, 0x81, 0x9b, 0x7f, 0x58, 0x2f, 0x4a, 0x86, 0xc3, 0x27, 0x10, 0xba, 0xef,
+  0x24, 0xc3, 0xe0, 0x4b, 0x98, 0xe1, 0x0f, 0x6c, 0x96, 0x61, 0x02, 0x38, 0x2c, 0xaa, 0x71, 0xda,
+  0x98, 0xe1, 0xb2, 0x64, 0x5a, 0x81, 0xa9, 0x4d, 0x02, 0x38, 0x96, 0x3b, 0x00, 0x00, 0xa7, 0x29,
+  0x00, 0x00, 0x59, 0x3b, 0x00, 0x00, 0x7a, 0x3b, 0x00, 0x00, 0xbb, 0x2c, 0x00, 0x00, 0x96, 0x3b,
+  0x00, 0x00, 0x44, 0xcd, 0x96, 0x61, 0x99, 0xab, 0x4c, 0x41, 0x2e, 0x44, 0x43, 0x51, 0x27, 0xf9,
+  0x6b, 0xd6, 0x65, 0x22, 0x64, 0xc4, 0xce, 0xa6, 0xe4, 0x7c, 0x04, 0x72, 0xbd, 0xaf, 0x02, 0x38,
+  0xf0, 0x7a, 0xfd, 0xf1, 0x41, 0x07, 0xf4, 0xd5, 0x2e, 0x44, 0xce, 0xc2, 0xb6, 0x05, 0x90, 0xea,
+  0xcd, 0xc2, 0xcd, 0xc2, 0x65, 0xbe, 0xf0, 0x7a, 0x2f, 0xed, 0x6d, 0xa4, 0x65, 0xbe, 0xc8, 0x96,
+  0x2f, 0xed, 0xbe, 0x48, 0x81, 0xc3, 0xc8, 0x96, 0x71, 0xda, 0x19, 0x70, 0x73, 0x8e, 0xcd, 0xc2,
+  0xab, 0x3b, 0x81, 0x9b, 0xcd, 0xc2, 0xc8, 0x96, 0x98, 0xe1, 0x64, 0xc4, 0x81, 0xc3, 0x6b, 0x96,
+  0xce, 0xc2, 0x2b, 0x1a, 0x8a, 0x00, 0x2e, 0x44, 0x01, 0xe9, 0x41, 0x07, 0xe4, 0x7c, 0x99, 0xab,
+  0x8a, 0x00, 0xf1, 0xd8, 0xf4, 0xd5, 0x1a, 0x3b, 0x96, 0x61, 0x81, 0x9b, 0x4c, 0x41, 0xa9, 0x4d,
+  0x96, 0x61, 0x11, 0x73, 0x97, 0x2f, 0xb6, 0xb8, 0x2b, 0x55, 0x27, 0xf9, 0x71, 0xda, 0x22, 0xb2,
+  0xe5, 0x78, 0x19, 0x70, 0x25, 0xdc, 0xe0, 0x4b, 0x64, 0xc4, 0x99, 0x19, 0x5b, 0x02, 0xca, 0x63,
+  0x90, 0xea, 0xb3, 0xb8, 0xdf, 0xf0, 0xa0, 0xd8, 0x3e, 0xbe, 0x10, 0xb6, 0x10, 0x6a, 0xf1, 0xd8,
+  0x22, 0xb2, 0x83, 0x06, 0xf0, 0x7a, 0x7f, 0x58, 0x80, 0x05, 0x86, 0xc3, 0x65, 0xbe, 0x4c, 0x41,
+  0xb2, 0x64, 0x96, 0x61, 0x45, 0xad, 0x8a, 0x6a, 0x6c, 0xf0, 0xe4, 0x7c, 0x1a, 0x3b, 0xd4, 0x7e,
+  0xcd, 0xc2, 0x83, 0x06, 0x3e, 0xbe, 0x0f, 0x6c, 0x2c, 0xaa, 0x6b, 0xd6, 0x3e, 0xbe, 0xb6, 0x05,
+  0x99, 0x19, 0x83, 0x06, 0xf0, 0x7a, 0xa9, 0x4d, 0x90, 0xea, 0xe5, 0x78, 0x7f, 0x58, 0x5b, 0x02,
+  0x12, 0x87, 0x5a, 0x81, 0xce, 0xc2, 0x55, 0x97, 0xd4, 0x7e, 0xf2, 0x1e, 0x25, 0xdc, 0xb2, 0x64,
+  0x48, 0xa6, 0xf1, 0xd8, 0x81, 0x9b, 0x22, 0xcc, 0x48, 0xa6, 0x04, 0x72, 0x83, 0x06, 0x55, 0x97,
+  0xa0, 0xd8, 0xea, 0xe1, 0x90, 0x3a, 0x71, 0xda, 0xb6, 0x05, 0x1a, 0x3b, 0x12, 0x87, 0xb7, 0x91,
+  0x43, 0x51, 0xf4, 0xd5, 0x40, 0xb9, 0x43, 0x51, 0x4c, 0x41, 0xe9, 0xc9, 0x81, 0xc3, 0x81, 0xc3,
+  0x10, 0x6a, 0x97, 0x2f, 0x22, 0xb2, 0x2b, 0x1a, 0x98, 0xe1, 0x99, 0xab, 0xe0, 0x4b, 0xba, 0xef,
+  0x6b, 0xd6, 0x45, 0xad, 0x90, 0xea, 0xc3, 0xe6, 0x99, 0x19, 0x90, 0x3a, 0x2b, 0x55, 0xc9, 0x6e,
+  0x48, 0xa6, 0x41, 0x07, 0x98, 0xe1, 0xce, 0xa6, 0x0f, 0x6c, 0x98, 0xe1, 0xa8, 0x75, 0xf9, 0x81,
+  0x6b, 0xd6, 0x27, 0xf9, 0x71, 0xda, 0x24, 0xc3, 0x0f, 0x6c, 0x6d, 0xf0, 0xb0, 0xe4, 0xa0, 0xd8,
+  0x7f, 0x58, 0x27, 0xf9, 0x44, 0xcd, 0x86, 0xc3, 0x9b, 0xf7, 0x40, 0xb9, 0x44, 0xcd, 0x11, 0x73,
+  0x0f, 0x6c, 0xce, 0xc2, 0x86, 0xc3, 0xa8, 0x75, 0x02, 0x38, 0xab, 0x3b, 0x6b, 0xd6, 0x7f, 0x58,
+  0x27, 0xf9, 0x48, 0xa6, 0x7f, 0x67, 0xa8, 0x75, 0xbe, 0x48, 0xca, 0x63, 0x6b, 0xd6, 0x10, 0xb6,
+  0x45, 0xad, 0x0f, 0x6c, 0xb7, 0x91, 0x13, 0xf8, 0x80, 0x05, 0xba, 0xef, 0x8a, 0x6a, 0xa0, 0xd8,
+  0x0f, 0x6c, 0x6d, 0xf0, 0xca, 0x63, 0x14, 0xec, 0x14, 0xec, 0xbd, 0xaf, 0x4c, 0x41, 0xdf, 0xf0,
+  0xba, 0xef, 0xbd, 0xaf, 0xd6, 0x7f, 0x98, 0xe1, 0x19, 0x70, 0xb6, 0xb8, 0xb3, 0xb8, 0x25, 0xdc,
+  0xf2, 0x1e, 0x2f, 0xed, 0xd4, 0x07, 0x5a, 0x81, 0xe5, 0x78, 0x19, 0x70, 0x01, 0xe9, 0x71, 0xda,
+  0x98, 0xe1, 0x24, 0xc3, 0xf4, 0xd5, 0xe4, 0x7c, 0x19, 0x70, 0x2c, 0xaa, 0xa0, 0xd8, 0x96, 0x3b,
+  0x00, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x30, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x31, 0x00, 0x72,
+  0x74, 0x63, 0x20, 0x32, 0x00, 0x72, 0x74, 0x63, 0x20, 0x33, 0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f,
+  0x72, 0x20, 0x34, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x35, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x36,
+  0x00, 0x6f, 0x74, 0x61, 0x20, 0x37, 0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x38, 0x00,
+  0x72, 0x74, 0x63, 0x20, 0x39, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x31, 0x30, 0x00, 0x6f, 0x74,
+  0x61, 0x20, 0x31, 0x31, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x31, 0x32, 0x00, 0x72, 0x74, 0x63,
+  0x20, 0x31, 0x33, 0x00, 0x72, 0x74, 0x63, 0x20, 0x31, 0x34, 0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f,
+  0x72, 0x20, 0x31, 0x35, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20, 0x31, 0x36, 0x00, 0x77, 0x69, 0x66,
+  0x69, 0x20, 0x31, 0x37, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x31, 0x38, 0x00, 0x6d, 0x71, 0x74,
+  0x74, 0x20, 0x31, 0x39, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20, 0x32, 0x30, 0x00, 0x6d, 0x71, 0x74,
+  0x74, 0x20, 0x32, 0x31, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x32, 0x32, 0x00, 0x6f, 0x74, 0x61,
+  0x20, 0x32, 0x33, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x32, 0x34, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20,
+  0x32, 0x35, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x32, 0x36, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x32,
+  0x37, 0x00, 0x72, 0x74, 0x63, 0x20, 0x32, 0x38, 0x00, 0x72, 0x74, 0x63, 0x20, 0x32, 0x39, 0x00,
+  0x72, 0x74, 0x63, 0x20, 0x33, 0x30, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x33, 0x31, 0x00, 0x6f, 0x74,
+  0x61, 0x20, 0x33, 0x32, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20, 0x33, 0x33, 0x00, 0x6d, 0x71, 0x74,
+  0x74, 0x20, 0x33, 0x34, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x33, 0x35, 0x00, 0x6f, 0x74, 0x61, 0x20,
+  0x33, 0x36, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x33, 0x37, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20, 0x33,
+  0x38, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x33, 0x39, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x34, 0x30,
+  0x00, 0x77, 0x69, 0x66, 0x69, 0x20, 0x34, 0x31, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x34, 0x32,
+  0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x34, 0x33, 0x00, 0x77, 0x69, 0x66, 0x69, 0x20,
+  0x34, 0x34, 0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x34, 0x35, 0x00, 0x72, 0x74, 0x63,
+  0x20, 0x34, 0x36, 0x00, 0x72, 0x74, 0x63, 0x20, 0x34, 0x37, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x34,
+  0x38, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x34, 0x39, 0x00, 0x6f, 0x74, 0x61, 0x20, 0x35, 0x30,
+  0x00, 0x72, 0x74, 0x63, 0x20, 0x35, 0x31, 0x00, 0x72, 0x74, 0x63, 0x20, 0x35, 0x32, 0x00, 0x6f,
+  0x74, 0x61, 0x20, 0x35, 0x33, 0x00, 0x72, 0x74, 0x63, 0x20, 0x35, 0x34, 0x00, 0x77, 0x69, 0x66,
+  0x69, 0x20, 0x35, 0x35, 0x00, 0x6d, 0x71, 0x74, 0x74, 0x20, 0x35, 0x36, 0x00, 0x73, 0x65, 0x6e,
+  0x73, 0x6f, 0x72, 0x20, 0x35, 0x37, 0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x35, 0x38,
+  0x00, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x20, 0x35, 0x39, 0x00,
+};
+
+static const uint8_t fixture_bug_fix_patch[300] = {
+  0x4f, 0x54, 0x44, 0x31, 0x1d, 0x1d, 0x00, 0x00, 0x1b, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04,
+  0x1c, 0x00, 0x80, 0xc0, 0x38, 0x90, 0x38, 0x10, 0x08, 0x61, 0xb0, 0x20, 0x7b, 0x01, 0xce, 0x05,
+  0x01, 0xe8, 0xc0, 0xf4, 0x70, 0x48, 0x17, 0xd2, 0x0f, 0x0c, 0x06, 0xa0, 0x0d, 0x80, 0x21, 0x00,
+  0x81, 0x60, 0x21, 0x10, 0x50, 0x3a, 0x40, 0x70, 0xb0, 0x8e, 0x9c, 0x0a, 0x05, 0xd8, 0x85, 0x41,
+  0x60, 0x40, 0xd4, 0xee, 0xc2, 0xb8, 0xf0, 0x48, 0x16, 0x92, 0x1f, 0x01, 0x04, 0x8e, 0x96, 0x1f,
+  0x5b, 0x1b, 0x00, 0x80, 0xe0, 0x22, 0x19, 0x28, 0x1c, 0x0b, 0x25, 0x13, 0x80, 0xc0, 0xa0, 0x39,
+  0x38, 0x9f, 0xee, 0x05, 0x02, 0xc7, 0x45, 0x81, 0x25, 0x8f, 0x8b, 0x7c, 0x60, 0x20, 0x39, 0x00,
+  0x80, 0xe0, 0x23, 0x1b, 0x68, 0x0c, 0x0b, 0x6d, 0x19, 0x01, 0x8c, 0x07, 0x6f, 0x19, 0xda, 0xc1,
+  0x20, 0x5e, 0xc8, 0xe8, 0x24, 0xbd, 0xb1, 0xd8, 0xfc, 0x0b, 0x19, 0x1e, 0x81, 0x4e, 0x28, 0xb0,
+  0x1c, 0x74, 0x7a, 0x19, 0x02, 0xcd, 0x02, 0x46, 0x07, 0xa0, 0x80, 0xe7, 0x01, 0x25, 0xa8, 0x04,
+  0x8d, 0xe6, 0xdd, 0x01, 0xd5, 0x47, 0xba, 0xd0, 0x10, 0x28, 0x00, 0x80, 0xe0, 0x24, 0x1a, 0xe8,
+  0x0c, 0x0b, 0x5d, 0x21, 0x82, 0xc0, 0x81, 0x85, 0x02, 0x80, 0xec, 0xe4, 0x3a, 0xf8, 0x1c, 0x0b,
+  0xc5, 0x24, 0x06, 0xb7, 0x9e, 0x49, 0xdb, 0x0d, 0x8f, 0x0a, 0x4c, 0x03, 0x18, 0x0f, 0x0e, 0x4d,
+  0xbd, 0x80, 0x80, 0x20, 0x00, 0x80, 0xe0, 0x25, 0x19, 0x68, 0x1c, 0x0b, 0x2d, 0x2b, 0x82, 0xc0,
+  0x81, 0x85, 0x02, 0x80, 0xe6, 0xe5, 0x76, 0x58, 0x16, 0x02, 0x59, 0x11, 0x06, 0x20, 0x0e, 0xe0,
+  0x39, 0x19, 0x67, 0xbe, 0x06, 0x2d, 0x00, 0x80, 0xe0, 0x26, 0x1c, 0xa8, 0x14, 0x0b, 0x95, 0x32,
+  0x8a, 0xc0, 0x82, 0x0c, 0x07, 0x30, 0x5c, 0x40, 0x7b, 0xf3, 0x2f, 0x7c, 0x0e, 0x05, 0xce, 0x9b,
+  0x41, 0x02, 0x27, 0x03, 0x84, 0x59, 0xae, 0xf2, 0x09, 0x8c, 0xba, 0x69, 0x2e, 0x98, 0xc0, 0x7b,
+  0x13, 0x6d, 0x34, 0x04, 0x06, 0x00, 0x80, 0xff, 0xa6, 0xf9, 0xd8, 0x10,
+};
+
+static const uint8_t fixture_new_function_patch[745] = {
+  0x4f, 0x54, 0x44, 0x31, 0x19, 0x1e, 0x00, 0x00, 0x1b, 0x1d, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04,
+  0xa0, 0x00, 0x80, 0xc0, 0x23, 0x10, 0x28, 0xc6, 0x9a, 0x03, 0x78, 0xff, 0x82, 0x86, 0x98, 0x0e,
+  0x2d, 0x90, 0x1c, 0xa6, 0x40, 0x32, 0x9c, 0x00, 0xca, 0x10, 0x0f, 0x2d, 0x20, 0x1c, 0xaf, 0x40,
+  0x72, 0xb4, 0x00, 0xca, 0x5c, 0x0b, 0x2c, 0x94, 0x68, 0x06, 0x3e, 0xc0, 0x39, 0x73, 0x3f, 0xa1,
+  0xb5, 0xde, 0x7f, 0x80, 0x63, 0x02, 0x01, 0x96, 0x30, 0x06, 0x5d, 0x80, 0x19, 0x43, 0x80, 0x65,
+  0xf4, 0x0d, 0x95, 0xe8, 0x06, 0x55, 0x00, 0x59, 0x07, 0xce, 0x5c, 0x03, 0x2f, 0x90, 0xac, 0xb4,
+  0xc0, 0x72, 0xe8, 0x46, 0x00, 0x63, 0x7e, 0x8c, 0x80, 0xc7, 0x71, 0xfc, 0x01, 0x8d, 0xc0, 0x06,
+  0x56, 0x01, 0x39, 0x6f, 0x80, 0xe5, 0x8e, 0x01, 0x97, 0xb0, 0x16, 0x59, 0xa0, 0x39, 0x54, 0x00,
+  0x65, 0x3c, 0xfd, 0x9a, 0xc8, 0x0e, 0x50, 0x40, 0x19, 0x51, 0x82, 0xe5, 0xa6, 0x01, 0x94, 0xc3,
+  0xfb, 0x01, 0xdf, 0x40, 0x70, 0x50, 0x28, 0x17, 0x02, 0x07, 0x12, 0x4d, 0x1f, 0xc9, 0x74, 0x20,
+  0x04, 0x03, 0x98, 0x0c, 0x60, 0x3d, 0x28, 0x1e, 0x8a, 0x09, 0x02, 0xfa, 0x41, 0xe1, 0x80, 0xe5,
+  0x01, 0xa8, 0x2a, 0x00, 0x81, 0x60, 0x21, 0x10, 0x69, 0xc7, 0xfc, 0x0e, 0x3f, 0x28, 0x0c, 0x07,
+  0x0d, 0x08, 0xe9, 0x40, 0xa0, 0x5d, 0x88, 0x54, 0x24, 0x14, 0x20, 0xe3, 0x01, 0x8d, 0x32, 0x03,
+  0xe1, 0x85, 0x70, 0xe0, 0x90, 0x2d, 0x24, 0x3e, 0x04, 0x1c, 0x2d, 0x34, 0x3e, 0xb4, 0x14, 0x01,
+  0x80, 0xe0, 0x22, 0x18, 0xe8, 0x1c, 0x0b, 0x1d, 0x13, 0x8c, 0x69, 0x3f, 0xe0, 0xc1, 0xf9, 0x40,
+  0x40, 0x63, 0x68, 0x0a, 0x17, 0xc0, 0x0e, 0x40, 0x07, 0x81, 0xfa, 0xa0, 0x31, 0x9b, 0x84, 0x3e,
+  0xd9, 0x81, 0xcd, 0xea, 0xe7, 0x76, 0xdf, 0x86, 0xa2, 0xeb, 0xb2, 0xb2, 0x45, 0x3d, 0x98, 0x6e,
+  0x18, 0x0c, 0x64, 0x80, 0x32, 0x07, 0x8c, 0x6a, 0x77, 0x13, 0xfc, 0x50, 0xea, 0x32, 0x2e, 0x65,
+  0xb3, 0xe1, 0x99, 0x98, 0x5f, 0x7a, 0x9c, 0x9b, 0x77, 0x7f, 0xe1, 0x6d, 0xd2, 0x7f, 0x7e, 0x22,
+  0xb1, 0xeb, 0x42, 0x01, 0xe3, 0x61, 0xe6, 0xe2, 0xad, 0x52, 0xf8, 0xf5, 0xaf, 0x2d, 0x3e, 0xdf,
+  0x75, 0x2f, 0xd1, 0x0b, 0x56, 0x02, 0x0b, 0x2e, 0xa2, 0x0b, 0xc6, 0xb5, 0x81, 0xc1, 0xc1, 0x89,
+  0xa3, 0x9a, 0xc5, 0x7c, 0x2f, 0x5f, 0x9c, 0x0c, 0xba, 0xc2, 0x3b, 0x1a, 0x65, 0x04, 0x0e, 0x38,
+  0x8c, 0x6c, 0xae, 0x35, 0x2c, 0xd5, 0x5b, 0xe0, 0xe0, 0x71, 0x0b, 0x8c, 0x0a, 0x71, 0xce, 0xd3,
+  0x72, 0xac, 0x7d, 0x1d, 0xcc, 0xbf, 0xdb, 0xc8, 0xcb, 0x70, 0x27, 0x02, 0x51, 0x00, 0x8e, 0x5e,
+  0x5e, 0x7b, 0x13, 0x98, 0xdf, 0xeb, 0x01, 0x91, 0xd8, 0x79, 0x07, 0x63, 0x41, 0x83, 0x9a, 0x47,
+  0xc9, 0x7c, 0x09, 0x89, 0xf4, 0x60, 0x97, 0x2d, 0x4d, 0x36, 0x69, 0xf9, 0x91, 0x6c, 0x84, 0x23,
+  0xed, 0xbf, 0x78, 0x29, 0x66, 0xf1, 0x0e, 0x89, 0x3c, 0x64, 0xff, 0x90, 0x18, 0x8d, 0x44, 0xa6,
+  0x21, 0x11, 0x06, 0x8e, 0xf7, 0x5e, 0x7d, 0x1a, 0x46, 0x98, 0xb2, 0x23, 0xd1, 0xdb, 0xe4, 0x4c,
+  0xe2, 0xa7, 0x19, 0xa6, 0x00, 0xfa, 0x3d, 0x48, 0x38, 0x34, 0x40, 0xe2, 0x05, 0x19, 0x2f, 0x72,
+  0xe6, 0xf0, 0x1f, 0xc1, 0x34, 0x51, 0xa2, 0xb3, 0x1b, 0x2c, 0x95, 0xc4, 0x36, 0x69, 0xe0, 0x0c,
+  0x6b, 0xa0, 0x32, 0xd3, 0xca, 0x60, 0x3a, 0x48, 0x9f, 0xaa, 0x05, 0x02, 0xc7, 0x45, 0xa0, 0xdf,
+  0x28, 0x0b, 0xec, 0xc0, 0x3a, 0x00, 0x81, 0x65, 0x22, 0xd0, 0x40, 0x28, 0xce, 0x3f, 0xf0, 0x1c,
+  0xc4, 0x5b, 0x3d, 0x03, 0x81, 0xc1, 0xaf, 0x33, 0xc0, 0x60, 0xe9, 0xe5, 0x30, 0x1d, 0xc4, 0x67,
+  0x59, 0x04, 0x81, 0x79, 0x23, 0xb0, 0xef, 0x84, 0x04, 0x36, 0x60, 0x31, 0xf9, 0x01, 0xcb, 0x64,
+  0x23, 0x1f, 0x94, 0x76, 0x35, 0x02, 0xc6, 0x47, 0xa0, 0x53, 0x8a, 0x2c, 0x07, 0x1c, 0x05, 0x10,
+  0x37, 0x00, 0x80, 0xe4, 0x23, 0xd0, 0xa8, 0x16, 0x6a, 0x3d, 0x02, 0x81, 0xe8, 0x20, 0x39, 0xc8,
+  0xf4, 0x32, 0x05, 0xa8, 0x04, 0x8d, 0xe6, 0xdd, 0x01, 0xd5, 0x47, 0xb0, 0x10, 0x38, 0x16, 0xaa,
+  0x43, 0x0a, 0xbd, 0x08, 0x0b, 0xe5, 0x01, 0x01, 0x9c, 0x07, 0x69, 0x21, 0xd7, 0x04, 0x87, 0xc5,
+  0x24, 0x83, 0x03, 0x9b, 0xd1, 0x24, 0xd4, 0x40, 0x40, 0x38, 0x00, 0x80, 0xe4, 0x24, 0xd3, 0x28,
+  0x17, 0x0a, 0x4d, 0x12, 0xf9, 0x40, 0x41, 0x63, 0xa4, 0xff, 0x80, 0xc7, 0x64, 0x03, 0x20, 0x01,
+  0x82, 0xc6, 0x03, 0xd4, 0x93, 0x70, 0xa0, 0x90, 0x2c, 0xb4, 0xae, 0x0c, 0x1a, 0x30, 0x18, 0xc0,
+  0x73, 0x92, 0xbb, 0x24, 0x0b, 0x01, 0x2c, 0x8b, 0x03, 0x54, 0x07, 0xa3, 0x41, 0x80, 0xe5, 0xa5,
+  0x9f, 0xa8, 0x08, 0x1a, 0x00, 0x80, 0xe4, 0x25, 0xdb, 0xa8, 0x24, 0x0b, 0x95, 0x32, 0x8b, 0x7c,
+  0xa0, 0x21, 0x05, 0x03, 0x98, 0x0c, 0xe9, 0x80, 0xb4, 0x80, 0xf8, 0x26, 0x5b, 0x08, 0x18, 0x28,
+  0x00, 0x80, 0xe4, 0x26, 0xd3, 0xe8, 0x1c, 0x33, 0x11, 0x3c, 0x04, 0x8d, 0x9a, 0xef, 0x20, 0x98,
+  0xcb, 0xa6, 0x92, 0xe9, 0x8c, 0x07, 0xb1, 0x36, 0xe1, 0xc0, 0xc2, 0x43, 0x6e, 0xb2, 0x83, 0xc6,
+  0xcd, 0x65, 0xb0, 0xdd, 0x2e, 0xb7, 0x2b, 0x2c, 0x00,
+};
+
+static const uint8_t fixture_no_base_patch[6972] = {
+  0x4f, 0x54, 0x44, 0x31, 0x19, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x04,
+  0x5a, 0x03, 0x81, 0xe0, 0x21, 0x1c, 0x19, 0x00, 0x18, 0x7a, 0xb2, 0x10, 0x18, 0xc2, 0x64, 0x80,
+  0x31, 0xb2, 0xc9, 0x40, 0x63, 0xa9, 0x93, 0x80, 0xc7, 0x4f, 0x29, 0x01, 0x8e, 0x4e, 0x54, 0x03,
+  0x18, 0x3c, 0xb0, 0x06, 0x3a, 0xb9, 0x68, 0x0c, 0x7d, 0x32, 0xf0, 0x99, 0x4c, 0x40, 0x63, 0x5f,
+  0x99, 0x80, 0xc6, 0x8f, 0x34, 0x0d, 0x94, 0xd8, 0x5e, 0x53, 0x70, 0x18, 0xe4, 0x67, 0x00, 0x31,
+  0xa9, 0xce, 0x80, 0x62, 0x43, 0xf2, 0x1f, 0x90, 0xfc, 0x87, 0xe4, 0x3f, 0x21, 0xf9, 0x0f, 0xc8,
+  0x77, 0x96, 0xb0, 0xe0, 0x20, 0xbd, 0x68, 0x44, 0x9f, 0xf3, 0x99, 0x98, 0x4a, 0xea, 0xb0, 0xfb,
+  0x66, 0xf7, 0x5f, 0xe5, 0xbc, 0x46, 0x6e, 0x1f, 0x28, 0xf7, 0x37, 0x85, 0x2e, 0xb0, 0x84, 0x47,
+  0xe9, 0xd5, 0xd4, 0x5d, 0x7b, 0xff, 0x00, 0xa9, 0xc6, 0xa7, 0x79, 0xbf, 0xbd, 0x87, 0x9b, 0xab,
+  0x9d, 0xc9, 0xe2, 0x1b, 0x68, 0x28, 0x08, 0x6b, 0x58, 0x1c, 0xbc, 0xbe, 0x29, 0xec, 0xb9, 0xe3,
+  0x83, 0x23, 0x25, 0xee, 0x72, 0xac, 0x60, 0x11, 0x81, 0x4e, 0x25, 0xd4, 0x4d, 0xbe, 0x47, 0x33,
+  0xab, 0xb2, 0x71, 0x25, 0xfe, 0xdb, 0xfd, 0x9f, 0x91, 0x96, 0x28, 0x88, 0x3c, 0x7a, 0x3b, 0x92,
+  0x18, 0xdb, 0x3e, 0x02, 0x91, 0xc8, 0x7a, 0xb3, 0x1e, 0x1f, 0x6d, 0xfa, 0x45, 0xcc, 0xfe, 0xfc,
+  0x4a, 0xa2, 0x17, 0x1c, 0xcc, 0x64, 0x8e, 0x36, 0x59, 0x14, 0x4f, 0xf1, 0xa9, 0xa6, 0xec, 0xac,
+  0x9d, 0x6b, 0xff, 0xc2, 0xf4, 0x41, 0x11, 0x28, 0xcd, 0x3f, 0x30, 0x78, 0xc1, 0x9c, 0x4d, 0xa3,
+  0x8a, 0xb5, 0x62, 0xa0, 0x1c, 0x09, 0xc4, 0xbe, 0x3d, 0x7f, 0xac, 0x5c, 0x7b, 0x49, 0x51, 0xb5,
+  0xf5, 0x85, 0xa2, 0x4f, 0x12, 0xc8, 0xdb, 0xe0, 0xe7, 0xb1, 0xf5, 0x78, 0x48, 0x63, 0x12, 0xc3,
+  0x93, 0x44, 0x72, 0x32, 0xfa, 0x51, 0x84, 0x63, 0xba, 0x11, 0xe8, 0x9f, 0xc7, 0x35, 0x8a, 0x2a,
+  0x8d, 0xb7, 0x48, 0x93, 0x1b, 0x5e, 0x58, 0xd6, 0x34, 0x0d, 0xcf, 0x26, 0xdc, 0x2d, 0x14, 0x78,
+  0xe0, 0x73, 0x67, 0xb1, 0x5f, 0x88, 0x44, 0x41, 0x62, 0x03, 0x13, 0xc8, 0x8d, 0x46, 0x59, 0xaa,
+  0xc8, 0x4e, 0xb0, 0xdc, 0x36, 0x08, 0xb6, 0x47, 0x9d, 0xc2, 0x88, 0xdc, 0xca, 0xa3, 0xf1, 0xec,
+  0x5b, 0x7e, 0x0a, 0x71, 0xbe, 0xf5, 0x00, 0x23, 0x2b, 0x8d, 0x51, 0x39, 0xa9, 0x11, 0xf4, 0xf2,
+  0x44, 0xe3, 0x5f, 0x99, 0xc0, 0x20, 0x15, 0x19, 0xe0, 0x0c, 0x74, 0xf2, 0x90, 0x18, 0xd9, 0x80,
+  0xe5, 0x82, 0x01, 0x94, 0x9f, 0xf3, 0x48, 0xd3, 0x51, 0x75, 0xae, 0xd1, 0x0f, 0x89, 0x7c, 0x5d,
+  0xe2, 0xad, 0x1a, 0xdc, 0x08, 0xfa, 0x3b, 0xea, 0x44, 0x93, 0x87, 0x55, 0xcb, 0xcb, 0xac, 0x25,
+  0x11, 0xb2, 0xef, 0x98, 0x62, 0xb5, 0x15, 0x58, 0xb2, 0xc7, 0x03, 0xc3, 0x31, 0x89, 0x4c, 0x60,
+  0x97, 0x20, 0x18, 0xb1, 0xc6, 0x83, 0x07, 0x34, 0x8e, 0xeb, 0xdf, 0xf4, 0xea, 0x98, 0x46, 0x21,
+  0xb6, 0x5a, 0x89, 0xc4, 0x59, 0x25, 0xed, 0xd0, 0x06, 0xca, 0x2f, 0xfe, 0x31, 0x8e, 0xcf, 0x70,
+  0xdf, 0x10, 0xb8, 0x82, 0xc7, 0x8d, 0xf3, 0xf0, 0x52, 0xca, 0x22, 0x2b, 0x10, 0xe8, 0xe4, 0x3d,
+  0x41, 0x51, 0x31, 0x8f, 0xca, 0x3c, 0x1d, 0x17, 0x89, 0x84, 0x47, 0xa9, 0x07, 0x83, 0xc6, 0x24,
+  0x5b, 0x2e, 0xb4, 0x22, 0x99, 0x41, 0x37, 0x8a, 0xac, 0x76, 0x56, 0x40, 0x18, 0x81, 0xc6, 0xff,
+  0x67, 0x0a, 0x8f, 0xe7, 0x02, 0x51, 0x13, 0xd8, 0xda, 0xfa, 0xc7, 0x51, 0x0f, 0x8a, 0xe4, 0x71,
+  0x56, 0xa1, 0x08, 0xb5, 0xc4, 0xce, 0x31, 0x4f, 0x61, 0xdc, 0x45, 0xa2, 0x87, 0x10, 0xb8, 0xfb,
+  0x6f, 0xdc, 0xab, 0x1f, 0x5a, 0xfe, 0xd9, 0x10, 0x08, 0xe6, 0x66, 0x07, 0x71, 0x8e, 0xe8, 0x52,
+  0xe2, 0x1d, 0x1b, 0x9c, 0xde, 0xc9, 0xc4, 0xb6, 0x7c, 0x39, 0xda, 0x65, 0x08, 0x99, 0x44, 0xd2,
+  0x32, 0x49, 0xf2, 0x94, 0x45, 0xe2, 0xbb, 0x16, 0x78, 0xae, 0xc6, 0x7d, 0xbe, 0x65, 0x8d, 0x0e,
+  0xa2, 0x9d, 0x10, 0x58, 0xac, 0x44, 0xfa, 0x39, 0x79, 0x78, 0xd4, 0x7a, 0x3b, 0x92, 0x28, 0xf0,
+  0xfc, 0xc0, 0xd1, 0x32, 0x88, 0xcc, 0x4e, 0xa2, 0x13, 0x19, 0xa7, 0xe4, 0xa6, 0x3a, 0x9a, 0x6f,
+  0x92, 0xf8, 0xf1, 0x14, 0xb8, 0x98, 0x47, 0xfb, 0xf1, 0x1f, 0x89, 0x1c, 0x7b, 0xff, 0x02, 0x88,
+  0xcb, 0x35, 0x58, 0x08, 0x29, 0x4c, 0x52, 0x22, 0x7f, 0x10, 0x68, 0xd1, 0x3c, 0xb2, 0xfa, 0x54,
+  0x6a, 0x77, 0x99, 0xd5, 0x81, 0x47, 0x6d, 0xb8, 0xea, 0x5f, 0x9e, 0x63, 0x27, 0x88, 0x44, 0x6e,
+  0x63, 0x11, 0x43, 0x88, 0x04, 0x64, 0x5c, 0xc0, 0x98, 0x8d, 0x4e, 0x03, 0xe9, 0xcd, 0x62, 0xad,
+  0xba, 0x43, 0x38, 0x8a, 0xc5, 0x6e, 0x3b, 0xdd, 0x79, 0x2c, 0x40, 0x23, 0xe9, 0xe4, 0x9d, 0xc4,
+  0x5a, 0x2a, 0x52, 0x8c, 0xa9, 0xc6, 0x69, 0x80, 0xf8, 0x5e, 0x87, 0xe2, 0x31, 0x1b, 0x9e, 0x38,
+  0xa6, 0x24, 0x51, 0x4a, 0x89, 0xd4, 0x48, 0x23, 0x6f, 0x83, 0xbc, 0x44, 0xca, 0x3c, 0x8c, 0xb1,
+  0xec, 0x68, 0x30, 0x7d, 0x07, 0x61, 0xd6, 0x23, 0x13, 0x4f, 0x8a, 0xdc, 0x41, 0xe3, 0x10, 0xb5,
+  0x05, 0xc4, 0x36, 0x2c, 0x91, 0x15, 0x8c, 0x12, 0xe4, 0x9b, 0x13, 0x48, 0x97, 0x47, 0x2d, 0x61,
+  0x69, 0x89, 0x34, 0x41, 0x62, 0x6b, 0x10, 0xd8, 0x89, 0x47, 0xdb, 0x7e, 0x06, 0x8c, 0xae, 0x34,
+  0x45, 0x11, 0x48, 0x91, 0x47, 0xad, 0x7f, 0x0b, 0x8e, 0xdf, 0x22, 0x37, 0x17, 0x38, 0x81, 0x47,
+  0xcb, 0x78, 0x29, 0x88, 0x74, 0x42, 0x22, 0x6b, 0x1d, 0xf5, 0x20, 0x32, 0x2f, 0xf1, 0x3e, 0x88,
+  0x84, 0x49, 0xe3, 0x12, 0xc3, 0xba, 0x44, 0x2a, 0x36, 0xdf, 0x82, 0xac, 0x58, 0xa2, 0x11, 0x10,
+  0x58, 0xfe, 0x70, 0x35, 0xac, 0x08, 0xec, 0x70, 0x3c, 0x35, 0xc8, 0x99, 0x45, 0xf6, 0x32, 0xff,
+  0x68, 0x1c, 0x7d, 0x5e, 0x12, 0x18, 0x9a, 0xc5, 0x6e, 0x2a, 0x51, 0xbf, 0xd6, 0x30, 0x70, 0x67,
+  0xe8, 0xe2, 0xa0, 0x1e, 0x0a, 0x58, 0x1c, 0x48, 0x23, 0x61, 0xe6, 0x94, 0xc5, 0x1a, 0x61, 0xd1,
+  0x78, 0x8e, 0x9a, 0x79, 0x00, 0x80, 0x62, 0x00, 0x65, 0x51, 0x01, 0x90, 0xc6, 0x03, 0x81, 0xe0,
+  0x21, 0x1a, 0x79, 0x88, 0x18, 0x6a, 0xf3, 0xc0, 0x18, 0xc8, 0xb6, 0x5a, 0x9a, 0x6c, 0x77, 0x43,
+  0x99, 0x98, 0x49, 0x27, 0xd2, 0xff, 0x6d, 0xc7, 0xb5, 0xb3, 0xdc, 0x6a, 0xe7, 0x7f, 0x28, 0xf6,
+  0x63, 0xc3, 0x55, 0xcb, 0xe0, 0x73, 0x60, 0xf1, 0xc5, 0x40, 0x36, 0xd0, 0x5b, 0x27, 0x12, 0x89,
+  0xcd, 0xcb, 0x58, 0x62, 0x37, 0x3f, 0x57, 0x86, 0x57, 0x1a, 0xf2, 0xde, 0x2f, 0xbd, 0x4b, 0x6f,
+  0xc0, 0x0a, 0x3e, 0x0a, 0x5e, 0x43, 0xd5, 0x25, 0xee, 0x56, 0xe0, 0x52, 0xea, 0x24, 0x4f, 0xf0,
+  0x21, 0x19, 0x3c, 0x42, 0x91, 0xa6, 0x16, 0x8e, 0x0e, 0x0d, 0xbe, 0xa4, 0x56, 0xb0, 0x37, 0x3c,
+  0x71, 0x1c, 0x6f, 0xf6, 0x7e, 0xa4, 0x1c, 0x66, 0x39, 0xac, 0x57, 0x3b, 0x4c, 0x41, 0x1c, 0xbc,
+  0xbc, 0x22, 0x33, 0x4f, 0xcd, 0xb7, 0x48, 0x33, 0x10, 0x88, 0xc1, 0x2e, 0x5f, 0x1e, 0xc0, 0x2c,
+  0x40, 0xe3, 0xd1, 0xdc, 0xf3, 0xb8, 0x5f, 0xdf, 0x8e, 0x02, 0x0a, 0x6d, 0x10, 0x38, 0xe6, 0xfe,
+  0xe0, 0x31, 0x0a, 0x8d, 0x03, 0x73, 0xb7, 0xc8, 0xd0, 0xea, 0x25, 0xb1, 0x20, 0x89, 0xe4, 0x68,
+  0xba, 0xd4, 0x08, 0xf2, 0x32, 0xdb, 0x2b, 0x26, 0xc3, 0xc8, 0x3f, 0x18, 0x14, 0xe1, 0x2e, 0x21,
+  0x31, 0x2e, 0x88, 0x8c, 0x79, 0xbc, 0x29, 0xf6, 0xfb, 0x93, 0x6e, 0x00, 0x88, 0x3c, 0x42, 0xe3,
+  0x41, 0x83, 0xf5, 0xaf, 0xe2, 0x11, 0x37, 0x89, 0xe4, 0x65, 0xd6, 0x18, 0x86, 0xd8, 0x32, 0x3a,
+  0x0e, 0xc1, 0xc4, 0x73, 0x31, 0x91, 0xf8, 0xc1, 0xe3, 0x07, 0xb1, 0x58, 0x88, 0x74, 0x4e, 0xa3,
+  0x22, 0xe6, 0x6e, 0xbd, 0xf8, 0x6e, 0x18, 0xac, 0x44, 0x62, 0x29, 0x1b, 0x2e, 0xf9, 0xba, 0x36,
+  0xbc, 0xb4, 0xae, 0xaa, 0x13, 0x13, 0x88, 0xf7, 0xfe, 0x1f, 0x9c, 0x0b, 0x84, 0x44, 0x62, 0x47,
+  0x15, 0x08, 0xe0, 0x78, 0x72, 0xfa, 0x57, 0xd3, 0xab, 0x4c, 0xa0, 0xcd, 0x30, 0x04, 0xb1, 0x2d,
+  0x8a, 0x54, 0x72, 0x13, 0xa1, 0x78, 0xf5, 0x2f, 0xd4, 0x4f, 0x2b, 0x7c, 0x54, 0x62, 0x1b, 0x11,
+  0x58, 0x83, 0xc4, 0x8e, 0x31, 0x9b, 0x83, 0x44, 0x44, 0xa3, 0xed, 0xbf, 0x27, 0x46, 0x1f, 0x6c,
+  0x1d, 0x8b, 0xbc, 0x79, 0x56, 0x3a, 0xae, 0x5e, 0x35, 0x3b, 0xb0, 0xf3, 0x52, 0x62, 0xfd, 0x19,
+  0x66, 0xaa, 0x25, 0x87, 0xc8, 0x7a, 0x97, 0x63, 0x2f, 0x8f, 0x14, 0x45, 0x6a, 0x2e, 0x51, 0xf2,
+  0x5f, 0x22, 0x9e, 0xc4, 0x08, 0x81, 0x47, 0x2f, 0x3c, 0x80, 0x40, 0x2c, 0xc0, 0x32, 0x83, 0xcb,
+  0x00, 0x63, 0x65, 0x91, 0x1a, 0x47, 0x8d, 0xf3, 0x42, 0x8b, 0x1c, 0x53, 0x23, 0xe0, 0xa5, 0xa9,
+  0x44, 0x9e, 0x23, 0x51, 0x30, 0x8b, 0xb4, 0x5e, 0xa3, 0x04, 0xb9, 0x6d, 0xb7, 0x01, 0x71, 0x75,
+  0x88, 0x34, 0x6f, 0xf5, 0x80, 0x58, 0xa0, 0xc6, 0xdf, 0x07, 0x2e, 0x8e, 0x2a, 0xd5, 0x97, 0x97,
+  0xa9, 0x44, 0x36, 0x22, 0x71, 0x15, 0x8c, 0xae, 0x34, 0x61, 0x10, 0xb8, 0xa7, 0x44, 0x16, 0x2f,
+  0xb1, 0x80, 0xfa, 0x5c, 0x62, 0x0d, 0x1e, 0xb4, 0x23, 0x7b, 0xaf, 0x57, 0x88, 0x24, 0x73, 0x3a,
+  0xb3, 0xe8, 0xfc, 0x2f, 0x4c, 0x31, 0x7e, 0x8b, 0x0c, 0x4f, 0x22, 0x03, 0x15, 0x08, 0xaa, 0xc4,
+  0x32, 0x29, 0x91, 0x93, 0xfe, 0x40, 0x22, 0xa5, 0x1c, 0x46, 0x36, 0xdb, 0xa4, 0x88, 0xdc, 0xf6,
+  0x56, 0x4d, 0xfc, 0xd4, 0xe2, 0x39, 0x98, 0xc8, 0xb4, 0x54, 0x23, 0x73, 0x9b, 0xa0, 0xc7, 0x61,
+  0xe4, 0x66, 0x8f, 0x02, 0x71, 0x22, 0xd9, 0x5a, 0xfa, 0xdb, 0xaf, 0x7d, 0xf7, 0xa9, 0xa9, 0xa6,
+  0x95, 0xc4, 0xf2, 0x62, 0xd1, 0x3b, 0x8a, 0x2c, 0x6d, 0x9f, 0x08, 0x9f, 0xe0, 0x4e, 0x24, 0x51,
+  0x20, 0x8b, 0xbc, 0x4f, 0x63, 0x27, 0x88, 0x2b, 0xc7, 0xcb, 0x78, 0x9a, 0x7e, 0x45, 0xe3, 0x17,
+  0xff, 0x73, 0xb4, 0xdf, 0xdf, 0x88, 0x8c, 0x52, 0x22, 0x4f, 0x16, 0xa8, 0xe6, 0x66, 0x09, 0xb1,
+  0xef, 0xfc, 0x3e, 0x51, 0xe1, 0xa8, 0x99, 0x44, 0x1e, 0x2c, 0x71, 0x17, 0x8c, 0x42, 0xd4, 0xc1,
+  0x10, 0x28, 0x97, 0x46, 0xd7, 0x96, 0xb2, 0xef, 0xb0, 0x3c, 0x31, 0x38, 0x8f, 0xc4, 0x52, 0x34,
+  0x8d, 0x30, 0x64, 0x60, 0xf1, 0x88, 0xee, 0x84, 0x12, 0x31, 0xa9, 0xd9, 0xb4, 0x50, 0x62, 0x17,
+  0x14, 0x68, 0xcb, 0xe9, 0x4d, 0xb1, 0x07, 0x88, 0x2c, 0x47, 0x63, 0x43, 0xa8, 0xb5, 0x46, 0x89,
+  0xcd, 0x18, 0x8f, 0xe7, 0x02, 0xe9, 0x1b, 0x2c, 0x8a, 0x49, 0xc3, 0x34, 0x88, 0xb4, 0x6e, 0x78,
+  0xef, 0x8f, 0x62, 0xc3, 0xcd, 0x35, 0x8a, 0xac, 0x43, 0x23, 0xa0, 0xec, 0x55, 0x72, 0xed, 0x71,
+  0x56, 0x8f, 0x0f, 0xcd, 0x41, 0x83, 0xa2, 0xc6, 0xc9, 0xc4, 0x3e, 0x8b, 0x8c, 0x43, 0xe2, 0xaf,
+  0x14, 0x58, 0x86, 0x44, 0xee, 0x36, 0xdf, 0x83, 0xdc, 0x79, 0x19, 0x64, 0xc8, 0xb6, 0xc5, 0x52,
+  0x79, 0x8f, 0x09, 0x84, 0x62, 0x58, 0x77, 0x39, 0xe6, 0x75, 0x63, 0x31, 0x72, 0x8f, 0x5a, 0x10,
+  0xc5, 0x10, 0x38, 0x8e, 0x44, 0x3e, 0x32, 0xeb, 0x0a, 0x3c, 0x40, 0xa2, 0x53, 0x10, 0xc8, 0xbb,
+  0x44, 0xd2, 0x3b, 0x7c, 0x88, 0xac, 0x4e, 0xe5, 0x55, 0x80, 0xfa, 0x5f, 0x23, 0xe0, 0xa5, 0xb1,
+  0xc7, 0x9d, 0xc2, 0x81, 0x4e, 0x37, 0xba, 0xf1, 0x78, 0x88, 0x44, 0xb6, 0x29, 0xd1, 0x05, 0x88,
+  0x64, 0x49, 0x22, 0x1b, 0x14, 0x48, 0xae, 0x45, 0x22, 0x23, 0x11, 0x47, 0x8c, 0xd3, 0x00, 0x67,
+  0x1b, 0x67, 0xc0, 0x36, 0x23, 0x51, 0xe8, 0xee, 0x6b, 0x70, 0x2d, 0x4d, 0x37, 0x37, 0xf7, 0x3c,
+  0x88, 0xb4, 0x68, 0xba, 0xdf, 0x4f, 0x26, 0x4b, 0xdc, 0xbf, 0xd9, 0xd7, 0x62, 0x01, 0x13, 0x28,
+  0xaf, 0x4d, 0x92, 0x34, 0x0d, 0xcb, 0x6c, 0x4a, 0x62, 0x77, 0x17, 0xc8, 0xa7, 0x44, 0x4a, 0x3c,
+  0xde, 0x12, 0xbc, 0x62, 0x16, 0xac, 0x46, 0x34, 0x26, 0x20, 0xd1, 0xd4, 0x5d, 0x5e, 0x23, 0x2c,
+  0xd5, 0x1e, 0xc4, 0x96, 0x24, 0x71, 0x93, 0xfe, 0x55, 0xa2, 0x51, 0x18, 0xee, 0x86, 0x7d, 0xbe,
+  0x31, 0x88, 0x84, 0x72, 0xd6, 0x10, 0x28, 0x8e, 0xca, 0xaa, 0xab, 0x16, 0xb8, 0xf0, 0x27, 0x06,
+  0x13, 0x68, 0x88, 0x6c, 0x41, 0x62, 0x3f, 0x11, 0x38, 0xc9, 0x27, 0xc3, 0x11, 0xea, 0x5f, 0x8d,
+  0x22, 0x05, 0x1a, 0x27, 0x34, 0xb6, 0x2a, 0xb1, 0x5a, 0x8c, 0x5f, 0xfd, 0x5d, 0x9e, 0x40, 0x20,
+  0x08, 0x31, 0xfe, 0xfc, 0x6b, 0x58, 0x1e, 0x4d, 0xb9, 0xce, 0x2b, 0xb1, 0xf5, 0x78, 0x73, 0x33,
+  0x0c, 0xcc, 0x65, 0xa6, 0x2a, 0x11, 0x91, 0x73, 0x2a, 0xb9, 0x7b, 0x5e, 0x5a, 0x21, 0xb6, 0x34,
+  0x8d, 0xc7, 0xb4, 0xa1, 0x15, 0x68, 0xf5, 0x20, 0xfb, 0x0f, 0x21, 0xf4, 0x4f, 0x62, 0x15, 0x18,
+  0xd4, 0xec, 0xe2, 0x20, 0x91, 0x47, 0x8c, 0x9e, 0x20, 0x37, 0x10, 0x28, 0xf3, 0xb4, 0xc4, 0xf1,
+  0x8a, 0x7b, 0x0d, 0x62, 0x59, 0x17, 0x38, 0x80, 0xc7, 0xe5, 0x1e, 0x70, 0x8f, 0xc7, 0xb0, 0x1f,
+  0x17, 0xb8, 0x8e, 0x44, 0xbc, 0x03, 0x81, 0xe0, 0x21, 0x1f, 0x4e, 0xae, 0xcf, 0x71, 0xe5, 0xbc,
+  0x74, 0x77, 0x34, 0x0d, 0xc8, 0x1c, 0x65, 0x71, 0xac, 0xcc, 0x67, 0xa9, 0x07, 0xc5, 0x40, 0x38,
+  0xdf, 0x30, 0x18, 0xed, 0xb7, 0x1f, 0x0b, 0xd6, 0x6b, 0x15, 0xfd, 0xf8, 0xf5, 0x2f, 0xdc, 0xee,
+  0x14, 0x9f, 0xf3, 0xa0, 0xec, 0x48, 0xb9, 0x9a, 0x8b, 0xaf, 0xca, 0x3d, 0xbd, 0xd7, 0xe2, 0x31,
+  0xbc, 0xde, 0x16, 0x2a, 0xd5, 0x0f, 0xb6, 0x53, 0x28, 0x3c, 0xab, 0x18, 0xac, 0x7c, 0x14, 0xb0,
+  0x48, 0xcd, 0x30, 0x1e, 0xaf, 0x08, 0x44, 0x45, 0x23, 0x98, 0xf0, 0xe5, 0xe5, 0xe0, 0xd1, 0x97,
+  0x51, 0x00, 0x62, 0x0d, 0x12, 0x78, 0xf2, 0x6d, 0xd7, 0xfa, 0xc6, 0xfa, 0x91, 0x55, 0xcb, 0xf2,
+  0x32, 0xc1, 0x51, 0x23, 0x88, 0x8c, 0x60, 0x97, 0x20, 0x58, 0x82, 0x46, 0x21, 0xb6, 0xa2, 0x73,
+  0x6b, 0x58, 0x12, 0x38, 0xd8, 0x79, 0xbb, 0x2b, 0x25, 0x97, 0x7d, 0x71, 0xed, 0x47, 0x74, 0x22,
+  0x91, 0xc1, 0xc1, 0xa2, 0x16, 0xac, 0x0f, 0x0e, 0x59, 0xaa, 0x80, 0xfa, 0x43, 0x63, 0xa9, 0xa6,
+  0x91, 0xc6, 0x49, 0xc3, 0x38, 0x8c, 0x5f, 0xfd, 0x9b, 0xfb, 0x97, 0xc4, 0x3e, 0x37, 0x3c, 0x74,
+  0x66, 0xe0, 0x03, 0x13, 0xd8, 0x87, 0x44, 0x1e, 0x34, 0x18, 0x3a, 0x74, 0x48, 0x63, 0xed, 0xbf,
+  0x27, 0x45, 0x66, 0x3e, 0x4b, 0xe6, 0x66, 0x60, 0x03, 0x19, 0x24, 0xf8, 0xae, 0x21, 0xf1, 0xcb,
+  0x58, 0x76, 0xd0, 0x5b, 0xef, 0x50, 0x8e, 0x2b, 0x11, 0xf4, 0xf2, 0x41, 0xe2, 0xb9, 0x10, 0x18,
+  0xd1, 0x3c, 0xa1, 0x11, 0x5b, 0x8c, 0xba, 0xc2, 0x8b, 0x3a, 0x46, 0x9a, 0x8b, 0xad, 0x2f, 0x8f,
+  0x3b, 0x4d, 0x81, 0xcd, 0xc9, 0xe2, 0x12, 0xf8, 0xf4, 0xd3, 0xf3, 0x6d, 0xd2, 0x7c, 0x7b, 0x0d,
+  0x91, 0x17, 0x8c, 0x8b, 0x64, 0x25, 0x1c, 0x37, 0x0c, 0x36, 0x5b, 0x62, 0x78, 0xaf, 0xc7, 0x75,
+  0xef, 0x09, 0x8a, 0x74, 0x49, 0x63, 0x5b, 0x81, 0x26, 0xc7, 0xbf, 0xf0, 0x95, 0xc6, 0xb7, 0xf3,
+  0x50, 0x68, 0xec, 0xf7, 0x0c, 0x31, 0x1b, 0x8a, 0xdc, 0x4b, 0x22, 0x47, 0x11, 0x38, 0xdb, 0x7e,
+  0x17, 0x39, 0xb8, 0xd4, 0x52, 0x62, 0x0b, 0x13, 0x38, 0x8b, 0xc7, 0x87, 0xe6, 0xc4, 0x63, 0x70,
+  0x10, 0x54, 0xc8, 0xc4, 0xff, 0x04, 0x71, 0x0c, 0x89, 0xc4, 0x52, 0xe2, 0xe3, 0x11, 0x18, 0xc5,
+  0x3d, 0x88, 0x11, 0x55, 0x88, 0x44, 0x62, 0x37, 0x33, 0x58, 0xed, 0xf2, 0x36, 0xbc, 0xb5, 0x94,
+  0x14, 0x36, 0x4b, 0xfd, 0x61, 0xbe, 0x25, 0xb1, 0x13, 0x8b, 0xd4, 0x45, 0xa2, 0x35, 0x1b, 0xfd,
+  0x9e, 0xc9, 0xc4, 0x27, 0x8a, 0xfc, 0x7a, 0xd0, 0x8e, 0xb5, 0xfd, 0xde, 0x32, 0x5e, 0xe6, 0xc3,
+  0xc9, 0xbe, 0xa4, 0x0c, 0x46, 0xc3, 0xcd, 0x16, 0x88, 0x84, 0x5b, 0xe2, 0x15, 0x1a, 0x3c, 0xd2,
+  0x01, 0x00, 0xae, 0xcf, 0x00, 0x63, 0x09, 0x9b, 0x80, 0xc6, 0x84, 0x07, 0x2e, 0xac, 0x84, 0x06,
+  0xa9, 0x91, 0x64, 0x8b, 0x04, 0x75, 0x73, 0xb3, 0x58, 0xea, 0x2e, 0xa5, 0x31, 0x33, 0x8a, 0xe4,
+  0x40, 0x63, 0x24, 0x01, 0x90, 0x3c, 0x63, 0x53, 0xb1, 0xc8, 0xd0, 0xea, 0x24, 0x31, 0xb6, 0x7c,
+  0x33, 0x33, 0x04, 0xf8, 0xac, 0x45, 0x7a, 0x2e, 0x11, 0xfe, 0xfc, 0x45, 0x62, 0x4b, 0x10, 0x78,
+  0x95, 0xc7, 0x15, 0x6a, 0x79, 0x8a, 0x1c, 0x67, 0xdb, 0xee, 0xa5, 0xfa, 0x21, 0x6a, 0x57, 0x8a,
+  0xec, 0x45, 0xe2, 0x87, 0x14, 0x78, 0x93, 0x45, 0x5a, 0x29, 0x31, 0xfc, 0xe0, 0x65, 0xd6, 0x11,
+  0xd8, 0xd3, 0x28, 0x20, 0x71, 0x65, 0x8b, 0xc4, 0x65, 0x9a, 0xab, 0x7c, 0x1c, 0x0e, 0x21, 0x71,
+  0x81, 0x4e, 0x1e, 0x62, 0xe5, 0x15, 0x18, 0xcb, 0xfd, 0xbc, 0x8c, 0xb7, 0x02, 0x70, 0x25, 0x10,
+  0x08, 0xe5, 0xe5, 0xe7, 0xb1, 0x63, 0x98, 0x64, 0x55, 0xa2, 0x3b, 0x15, 0x28, 0x9a, 0x47, 0xc9,
+  0x7c, 0x09, 0x89, 0xf4, 0x60, 0x97, 0x2d, 0x4d, 0x36, 0x69, 0xf9, 0x71, 0x08, 0x84, 0x7d, 0xb7,
+  0xef, 0x05, 0x2c, 0xde, 0x21, 0xd1, 0x27, 0x8c, 0x9f, 0xf2, 0x03, 0x11, 0xa8, 0x94, 0xc4, 0x22,
+  0x20, 0xd1, 0xde, 0xeb, 0xcf, 0xa3, 0x48, 0xd3, 0x16, 0x44, 0x7a, 0x2d, 0xd3, 0x53, 0x8c, 0xd3,
+  0x00, 0x7d, 0x1e, 0xa4, 0x1c, 0x1a, 0x20, 0x71, 0x02, 0x8b, 0xe4, 0x6e, 0x78, 0xe0, 0x98, 0x93,
+  0x45, 0x1a, 0x2b, 0x31, 0xb2, 0xc9, 0x5b, 0xe3, 0x66, 0x75, 0x93, 0xdc, 0xf4, 0xf2, 0x90, 0x18,
+  0xad, 0xc7, 0x7f, 0x35, 0xc0, 0xf0, 0xfc, 0xb7, 0x83, 0x08, 0xaf, 0xc6, 0x8b, 0xad, 0xa0, 0x6e,
+  0x60, 0xf1, 0x85, 0x08, 0x91, 0x46, 0x89, 0xe5, 0xf5, 0x78, 0x45, 0xa2, 0x13, 0x1f, 0x94, 0x78,
+  0x8a, 0x23, 0x91, 0x53, 0x8c, 0x5f, 0xfc, 0xe5, 0x1a, 0xae, 0x5c, 0x8e, 0x21, 0xf1, 0xa2, 0x73,
+  0x40, 0x22, 0xe5, 0x18, 0xa7, 0xb1, 0x82, 0x28, 0xf1, 0x02, 0x8f, 0x26, 0xdc, 0x9f, 0x14, 0x08,
+  0xe6, 0x63, 0x28, 0x91, 0x3e, 0x88, 0x6c, 0x75, 0x17, 0x50, 0xc8, 0xd9, 0x77, 0xd9, 0x8f, 0x0b,
+  0xec, 0x5b, 0xa3, 0x2f, 0xa5, 0x59, 0x38, 0x87, 0xb1, 0x53, 0x88, 0x1c, 0x43, 0xe3, 0x7f, 0xb3,
+  0x91, 0xc7, 0xa9, 0x7e, 0x06, 0x89, 0x0c, 0x4b, 0x62, 0xcb, 0x1d, 0xd7, 0xbd, 0x0a, 0x3c, 0xee,
+  0x16, 0x42, 0x74, 0x3b, 0x17, 0xd8, 0xad, 0xc4, 0x62, 0x21, 0xd1, 0xc5, 0x40, 0x1e, 0x22, 0x25,
+  0x10, 0x18, 0xc9, 0xe2, 0x0c, 0xb1, 0x22, 0x8a, 0x2c, 0x64, 0x5c, 0xc3, 0xe8, 0xf3, 0x78, 0x5a,
+  0xb9, 0xdc, 0x0a, 0x70, 0xd5, 0x11, 0x18, 0xad, 0xc4, 0x2e, 0x29, 0x51, 0x23, 0x8e, 0x1b, 0x87,
+  0x19, 0xb8, 0x4f, 0xb7, 0xc0, 0x91, 0x92, 0x4f, 0x9a, 0xa3, 0x01, 0xf4, 0xc4, 0x36, 0xc6, 0x91,
+  0x2e, 0x8a, 0x74, 0x56, 0xa2, 0x0d, 0x1e, 0x37, 0xcc, 0xb2, 0x23, 0x51, 0x28, 0x8d, 0xaf, 0x2d,
+  0x48, 0xd3, 0x44, 0x6e, 0x6e, 0xf1, 0x14, 0x8f, 0x23, 0x2c, 0xb5, 0x12, 0xc8, 0xe6, 0xfe, 0xeb,
+  0x31, 0x1e, 0x88, 0x7c, 0x46, 0x62, 0x07, 0x1d, 0xf5, 0x22, 0xe7, 0x37, 0x9a, 0x7e, 0x7d, 0x3c,
+  0x93, 0x28, 0xca, 0xea, 0xa2, 0x11, 0x2a, 0x89, 0xbc, 0x7b, 0xff, 0x06, 0x48, 0x98, 0x45, 0x6e,
+  0x27, 0xd1, 0x6f, 0x8c, 0x42, 0xd5, 0x5b, 0x81, 0x1c, 0x45, 0xa2, 0x22, 0xb1, 0x2e, 0x8d, 0xcf,
+  0x1d, 0x7f, 0xac, 0x4b, 0xac, 0x23, 0x31, 0xf0, 0x52, 0xd0, 0xa2, 0x5f, 0x12, 0xd8, 0x88, 0x45,
+  0x62, 0x35, 0xac, 0x0e, 0x83, 0xb0, 0x17, 0x17, 0x28, 0xb8, 0x4a, 0x94, 0x71, 0x11, 0x18, 0x83,
+  0x46, 0x87, 0x51, 0x65, 0x8f, 0xd3, 0xaa, 0xe3, 0x15, 0x08, 0x9a, 0x44, 0x2a, 0x27, 0x71, 0x28,
+  0x8b, 0xcc, 0x6d, 0x9f, 0x01, 0xa8, 0xe4, 0x3d, 0x4e, 0x91, 0x57, 0x89, 0x84, 0x47, 0x62, 0x8d,
+  0x12, 0x08, 0x8b, 0x44, 0xfe, 0x31, 0x2c, 0x38, 0x34, 0x40, 0xa3, 0x88, 0x9e, 0x40, 0x20, 0x16,
+  0x59, 0x28, 0xc9, 0x03, 0x81, 0xe0, 0x21, 0x00, 0x41, 0xd3, 0xcc, 0x40, 0x63, 0xa9, 0xa6, 0xd2,
+  0x34, 0xd9, 0x0f, 0x57, 0x52, 0xfd, 0x6d, 0xf8, 0x4a, 0xe3, 0x57, 0xfa, 0xc7, 0xb6, 0xfd, 0x22,
+  0xe6, 0x65, 0xac, 0x31, 0x0b, 0x54, 0x3e, 0xd9, 0x73, 0x9b, 0xfa, 0xbc, 0x3f, 0x0b, 0xd0, 0x24,
+  0x62, 0x37, 0x30, 0x18, 0xdc, 0xf1, 0xd6, 0xbc, 0xb4, 0xbe, 0x3d, 0xe4, 0xbe, 0x53, 0x28, 0x3c,
+  0x6f, 0x9c, 0x6a, 0x76, 0x2d, 0x1d, 0x95, 0x93, 0x21, 0x3a, 0x1b, 0x8d, 0x13, 0x9b, 0x27, 0xfc,
+  0x82, 0xc7, 0xf3, 0x81, 0xad, 0xc0, 0x86, 0x22, 0x1f, 0x19, 0x2f, 0x73, 0x7b, 0xaf, 0xe8, 0xee,
+  0x76, 0xd0, 0x5c, 0x46, 0x36, 0xdb, 0xa4, 0x08, 0x8c, 0xbe, 0x95, 0x02, 0x9c, 0x72, 0xac, 0x76,
+  0x1e, 0x6d, 0x06, 0x0e, 0x29, 0x1a, 0x27, 0x96, 0x09, 0x72, 0xb5, 0xf5, 0x87, 0xa2, 0x59, 0x1f,
+  0x4f, 0x27, 0x03, 0x9b, 0xcc, 0xea, 0xed, 0xf0, 0x7c, 0xdf, 0xde, 0x3b, 0xa1, 0x25, 0x8c, 0xd3,
+  0xf3, 0xce, 0xd3, 0x4b, 0xfd, 0xa1, 0xd1, 0xfe, 0xfc, 0x66, 0x98, 0x09, 0x75, 0x87, 0x15, 0x00,
+  0xaa, 0xe5, 0xd0, 0xa3, 0x17, 0xff, 0x14, 0x44, 0xc6, 0x24, 0xb1, 0x3a, 0x89, 0x8c, 0x79, 0xdc,
+  0x2d, 0xf5, 0x22, 0xb5, 0x81, 0x91, 0x6c, 0x81, 0xa3, 0xdf, 0xf8, 0x72, 0x6d, 0xdc, 0xde, 0x17,
+  0x23, 0x2d, 0x81, 0xe1, 0xfc, 0x7b, 0x11, 0x4f, 0x61, 0x9c, 0x6c, 0xbb, 0xe0, 0xb8, 0xa1, 0xc6,
+  0x21, 0xb6, 0x20, 0x8f, 0x0f, 0xcc, 0x5b, 0x19, 0x24, 0xfa, 0xc9, 0xc4, 0x39, 0x8d, 0x17, 0x5a,
+  0x1f, 0x10, 0xb8, 0x82, 0xc7, 0x6d, 0xb8, 0xe0, 0x4e, 0x19, 0x65, 0x55, 0x49, 0x89, 0x6c, 0x4e,
+  0x23, 0x24, 0xe1, 0xa6, 0x45, 0xaa, 0x3b, 0xaf, 0x79, 0x2c, 0x59, 0xa2, 0x45, 0x14, 0x58, 0x9e,
+  0xc4, 0x56, 0x3b, 0x7c, 0x8a, 0xcc, 0x53, 0xe2, 0x87, 0x17, 0x08, 0x94, 0xc7, 0xad, 0x08, 0x23,
+  0x88, 0x6c, 0x56, 0xe3, 0x97, 0x97, 0x82, 0x44, 0x1a, 0x26, 0xf1, 0x74, 0x88, 0x04, 0x47, 0xe3,
+  0x27, 0x88, 0x66, 0x3c, 0x26, 0x11, 0xf6, 0xdf, 0xac, 0xb2, 0x21, 0xf8, 0xf5, 0x20, 0xee, 0x51,
+  0xd9, 0xee, 0x10, 0x62, 0x0b, 0x12, 0x78, 0xef, 0xe6, 0xbd, 0x6b, 0xf8, 0x3c, 0x44, 0xe3, 0xf0,
+  0xbd, 0x10, 0x47, 0x07, 0x06, 0xcc, 0xcc, 0x02, 0x22, 0x17, 0x15, 0x78, 0xe0, 0x20, 0xa8, 0x51,
+  0x59, 0x89, 0x64, 0x41, 0xa2, 0x63, 0x18, 0x85, 0xab, 0x51, 0x75, 0x04, 0x8e, 0x66, 0x32, 0xc7,
+  0x12, 0x38, 0xed, 0xa0, 0xa8, 0x71, 0x16, 0x8c, 0x1e, 0x31, 0x02, 0x9c, 0x46, 0x6e, 0x0b, 0x51,
+  0x7f, 0x88, 0x9c, 0x4e, 0x63, 0xf4, 0xea, 0xa0, 0xc6, 0x81, 0xb9, 0x40, 0x89, 0x8c, 0x61, 0xf6,
+  0xcf, 0x94, 0x7a, 0xd7, 0xd6, 0xc3, 0x70, 0xd9, 0xa3, 0x12, 0xc3, 0x9f, 0xc4, 0x82, 0x32, 0xcd,
+  0x50, 0x3c, 0x57, 0xa3, 0x7d, 0xea, 0x4f, 0xb7, 0xce, 0x31, 0x63, 0x8f, 0x96, 0xf0, 0x49, 0x10,
+  0x18, 0xde, 0x67, 0x90, 0x08, 0x06, 0x9e, 0x52, 0x03, 0x1f, 0xef, 0xc5, 0x32, 0x3a, 0x9a, 0x68,
+  0xa4, 0x47, 0x22, 0x77, 0x1d, 0x95, 0x91, 0x9e, 0x24, 0x71, 0xad, 0xc0, 0xa2, 0x7f, 0x84, 0xf8,
+  0xb6, 0xc7, 0xd3, 0xc9, 0x06, 0x8a, 0xac, 0x68, 0x30, 0x72, 0x18, 0x80, 0xc4, 0x6e, 0x3c, 0x9b,
+  0x72, 0x04, 0x6a, 0xb9, 0x71, 0x38, 0x88, 0xc4, 0xea, 0x27, 0x11, 0x18, 0x89, 0x54, 0x51, 0x62,
+  0x0f, 0x15, 0x78, 0x81, 0xc4, 0xda, 0x22, 0x11, 0x62, 0x8c, 0xae, 0x35, 0x81, 0xe1, 0xe6, 0xb1,
+  0x4b, 0x71, 0x91, 0x73, 0x1e, 0xa3, 0x22, 0xd9, 0x4d, 0x30, 0x1a, 0x0e, 0xc0, 0x1c, 0x4f, 0x62,
+  0x07, 0x14, 0x68, 0x9a, 0xc7, 0xa9, 0x7e, 0x19, 0x8e, 0x2a, 0x01, 0xb0, 0xf2, 0x4b, 0xa8, 0x99,
+  0xbf, 0xbd, 0x87, 0x9b, 0x2e, 0xb0, 0xa9, 0xc4, 0x16, 0x26, 0x92, 0x98, 0x73, 0xb4, 0xc2, 0x11,
+  0xf0, 0x52, 0xf7, 0x5e, 0xfc, 0x0e, 0x6c, 0x5a, 0x36, 0x59, 0x10, 0x9c, 0x45, 0x63, 0x97, 0x97,
+  0xd3, 0x28, 0x2c, 0xb1, 0x1f, 0x8c, 0xbe, 0x94, 0x0b, 0x1b, 0x67, 0xc0, 0x16, 0x21, 0xd1, 0x55,
+  0x88, 0xbc, 0x4c, 0x22, 0x13, 0x19, 0x5d, 0x54, 0xca, 0x22, 0x51, 0x60, 0x88, 0x2c, 0x77, 0xf3,
+  0x53, 0xb8, 0xd1, 0x3c, 0xa6, 0xf1, 0x48, 0x89, 0x0c, 0x66, 0x9f, 0x95, 0xe8, 0xc4, 0x36, 0xc9,
+  0x31, 0x14, 0x8a, 0x44, 0x46, 0xa2, 0x23, 0x19, 0x2f, 0x70, 0x8a, 0x3c, 0x8c, 0xb2, 0xfc, 0x44,
+  0x62, 0x29, 0x1b, 0x6f, 0xc2, 0x87, 0x51, 0x13, 0x8a, 0x84, 0x68, 0xba, 0xd7, 0x98, 0x8d, 0x45,
+  0x9a, 0x39, 0x98, 0xcb, 0x7c, 0xc9, 0xa2, 0x7b, 0x10, 0xf8, 0x99, 0xc4, 0x26, 0x32, 0x7f, 0xcd,
+  0x93, 0x89, 0xca, 0xb1, 0xea, 0x2e, 0xa8, 0xd1, 0x2c, 0x8b, 0xec, 0x7e, 0x17, 0xa9, 0x66, 0xa8,
+  0xea, 0x2c, 0xd1, 0xb8, 0xf6, 0x85, 0xe3, 0x40, 0xdc, 0xc9, 0x27, 0xc5, 0x91, 0x97, 0xfb, 0x59,
+  0x62, 0x53, 0x12, 0xb8, 0xc0, 0x7d, 0x31, 0xdd, 0x0d, 0x6e, 0x04, 0x55, 0x16, 0x78, 0x8e, 0xc7,
+  0x6f, 0x91, 0xbe, 0xf5, 0x18, 0x63, 0xf2, 0x8f, 0x26, 0xc5, 0x2e, 0x23, 0x11, 0x3c, 0x8f, 0xf7,
+  0xe3, 0x2f, 0x8f, 0x09, 0xc6, 0x2f, 0xfe, 0x8c, 0xdc, 0x3a, 0x90, 0x71, 0x38, 0x94, 0xc7, 0xbf,
+  0xf0, 0x69, 0x8b, 0x94, 0x4e, 0x62, 0x9d, 0x10, 0xc8, 0x87, 0x44, 0x10, 0x36, 0xf8, 0x3d, 0x06,
+  0x0e, 0xfb, 0x13, 0x08, 0xc9, 0x38, 0x60, 0x91, 0xc5, 0x5a, 0x84, 0xe3, 0x6d, 0xd2, 0x08, 0xc4,
+  0x62, 0x54, 0xa6, 0x48, 0xa3, 0x44, 0x4a, 0x28, 0x91, 0x0a, 0x88, 0x9c, 0x45, 0x62, 0x95, 0x14,
+  0x58, 0xed, 0xa0, 0xa0, 0x91, 0x30, 0x89, 0xbc, 0x4f, 0xa3, 0xbd, 0xd7, 0x89, 0x47, 0x57, 0x3b,
+  0xdb, 0x6e, 0x0e, 0x62, 0xe1, 0x11, 0x28, 0x95, 0x47, 0x03, 0x9b, 0x5e, 0x8f, 0x5a, 0x11, 0x73,
+  0xc7, 0x6c, 0xf7, 0x0d, 0x11, 0x1c, 0x88, 0xcc, 0x47, 0xe3, 0x02, 0x9c, 0x52, 0x34, 0xdc, 0x6f,
+  0x98, 0x3c, 0x7c, 0x97, 0xc7, 0x78, 0x87, 0xc5, 0x52, 0x2a, 0xd1, 0x1b, 0x8e, 0x0e, 0x0c, 0xa5,
+  0x11, 0xd8, 0x92, 0x47, 0x35, 0x8a, 0x7d, 0x89, 0xc4, 0x53, 0x62, 0x1b, 0x12, 0x98, 0x9d, 0xc6,
+  0x09, 0x72, 0xf2, 0xde, 0x19, 0xa2, 0x6f, 0x30, 0x68, 0xd3, 0x28, 0x36, 0xbe, 0xb1, 0x44, 0x68,
+  0x9e, 0x5f, 0x4f, 0x24, 0x2a, 0x20, 0x91, 0x7d, 0x89, 0x14, 0x40, 0xa2, 0xc9, 0x11, 0x48, 0x9e,
+  0x47, 0x80, 0x4f, 0x2b, 0x2c, 0x8b, 0x33, 0x30, 0xf8, 0xf6, 0x3a, 0xd7, 0xf0, 0x68, 0x80, 0xc7,
+  0x2f, 0x2f, 0x10, 0x8c, 0x46, 0xe7, 0xf9, 0xc0, 0x81, 0x45, 0x36, 0x22, 0xf1, 0x5a, 0x8b, 0xec,
+  0x51, 0x62, 0x9d, 0x1a, 0x14, 0xf2, 0x01, 0x00, 0xd3, 0xcc, 0x40, 0x63, 0x5d, 0x03, 0x96, 0xae,
+  0x5a, 0x03, 0x1e, 0xac, 0x84, 0x06, 0x3c, 0xee, 0x11, 0x7c, 0x77, 0x5e, 0xf9, 0x75, 0x85, 0xfa,
+  0x27, 0xf1, 0x76, 0x88, 0x8c, 0x52, 0xa2, 0x65, 0x1e, 0x76, 0x9a, 0xc3, 0xcd, 0xc4, 0x03, 0x81,
+  0xe0, 0x21, 0x11, 0x1b, 0x9f, 0x92, 0xf9, 0x10, 0xb5, 0x74, 0x77, 0x3b, 0xdd, 0x7c, 0xbe, 0x95,
+  0xba, 0xf7, 0xd0, 0x37, 0x3b, 0x3d, 0xc6, 0xdb, 0x71, 0xce, 0xd3, 0x4a, 0xea, 0xb1, 0x3f, 0xc4,
+  0xae, 0x35, 0xb7, 0xc8, 0xf3, 0x78, 0x5f, 0x0b, 0xd5, 0x23, 0x4d, 0xe9, 0xe4, 0xe6, 0x3c, 0x22,
+  0x31, 0xb5, 0xe5, 0xb7, 0xd4, 0x89, 0x2f, 0x70, 0x46, 0x3d, 0xff, 0x84, 0x1e, 0x31, 0x99, 0x8c,
+  0x83, 0xc6, 0xe3, 0xda, 0xfe, 0xfc, 0x46, 0xe3, 0xe5, 0xbc, 0x0a, 0xc7, 0x21, 0xea, 0x8e, 0xe8,
+  0x42, 0xe3, 0xc6, 0xf9, 0xea, 0xe7, 0x76, 0xbe, 0xb4, 0x4b, 0x0e, 0x47, 0x19, 0x66, 0xaa, 0x1f,
+  0x6c, 0xea, 0x41, 0xe4, 0x93, 0xe8, 0x25, 0xca, 0x2f, 0xfe, 0x03, 0x8e, 0x02, 0x0a, 0x61, 0x1a,
+  0x65, 0x06, 0xdb, 0xa4, 0x25, 0x89, 0x1c, 0x79, 0x36, 0xe2, 0xe8, 0xc8, 0xb6, 0x41, 0x91, 0xc0,
+  0xf0, 0xcb, 0xa3, 0x2f, 0xf6, 0xfc, 0x7b, 0x19, 0x09, 0xd0, 0xb4, 0x48, 0xa2, 0x39, 0x1a, 0xae,
+  0x5c, 0x76, 0x25, 0x51, 0x26, 0x8c, 0x43, 0x6d, 0x2e, 0xb0, 0xfe, 0x70, 0x28, 0xb1, 0xea, 0x5f,
+  0xbc, 0x14, 0xb0, 0xf8, 0xe5, 0xac, 0x20, 0x31, 0xc5, 0x5a, 0xab, 0x58, 0x13, 0xc8, 0x97, 0x46,
+  0x05, 0x38, 0xa2, 0x79, 0x6e, 0x78, 0xeb, 0x0f, 0x34, 0xd2, 0x3b, 0x68, 0x2d, 0xb7, 0xe0, 0x0b,
+  0x11, 0x68, 0xec, 0x3c, 0x9c, 0xee, 0x14, 0x8b, 0x98, 0x13, 0x1a, 0x0c, 0x1d, 0x02, 0x3d, 0x68,
+  0x47, 0x5a, 0xfe, 0x57, 0x1b, 0xfd, 0x61, 0x36, 0x22, 0xb1, 0x17, 0x8e, 0x67, 0x57, 0x9a, 0xc5,
+  0x0e, 0xc5, 0x72, 0x34, 0x3a, 0x8f, 0xd3, 0xaa, 0x25, 0x10, 0x78, 0xad, 0xc6, 0xe7, 0x37, 0xd0,
+  0x76, 0x23, 0x37, 0x02, 0xf8, 0xef, 0xe6, 0xa8, 0x71, 0x17, 0x89, 0xc4, 0x43, 0x23, 0x3e, 0xdf,
+  0x10, 0xc4, 0x56, 0x2e, 0xf1, 0x64, 0x8b, 0x94, 0x50, 0x62, 0x03, 0x1b, 0xfd, 0x9f, 0xd5, 0xe1,
+  0x6e, 0x89, 0x54, 0x45, 0x22, 0x7f, 0x13, 0x98, 0x93, 0xc7, 0x9d, 0xa6, 0xf6, 0xdf, 0x8d, 0xa3,
+  0x99, 0x98, 0x2a, 0x44, 0x62, 0x25, 0xf1, 0xe0, 0x4e, 0x15, 0xe2, 0xd5, 0x14, 0xb8, 0xdb, 0xe0,
+  0xe4, 0x31, 0x18, 0x8e, 0x23, 0x1a, 0xcf, 0x10, 0xf8, 0xac, 0x44, 0x3a, 0x38, 0x6e, 0x18, 0xcc,
+  0x56, 0x63, 0x27, 0xfc, 0xd9, 0x64, 0x53, 0x4f, 0xcc, 0x9e, 0x20, 0x63, 0x17, 0x08, 0xc5, 0x3d,
+  0x8e, 0xd1, 0x67, 0x8b, 0xac, 0x60, 0x3e, 0x9c, 0xc7, 0x85, 0xf2, 0x26, 0x91, 0xd4, 0xd3, 0x6d,
+  0x7d, 0x65, 0x28, 0xb3, 0x44, 0x1a, 0x26, 0xd1, 0x18, 0x89, 0x8c, 0x45, 0x63, 0x44, 0xe6, 0xc4,
+  0x2d, 0x42, 0xd1, 0x63, 0x96, 0xe1, 0xd6, 0x26, 0x91, 0x0b, 0x8d, 0xc7, 0xb4, 0xa5, 0x11, 0xb8,
+  0x92, 0xc4, 0x7e, 0x28, 0x31, 0x25, 0x8e, 0x0e, 0x0c, 0x6b, 0x13, 0xe8, 0xe6, 0xfe, 0xf6, 0xcf,
+  0x86, 0x4e, 0x6d, 0x00, 0x80, 0x65, 0xe7, 0x80, 0x31, 0xc1, 0x00, 0xc9, 0x76, 0x23, 0xd1, 0x1c,
+  0x88, 0xc4, 0x55, 0xe3, 0x97, 0x97, 0xea, 0x2e, 0xac, 0x11, 0x97, 0xc7, 0xab, 0x70, 0x24, 0xa8,
+  0x8d, 0x46, 0x49, 0x3e, 0x34, 0x8f, 0x26, 0xdd, 0x2f, 0xf6, 0xa1, 0x46, 0x2f, 0xfe, 0x8d, 0x4e,
+  0xc1, 0xa2, 0x15, 0x1b, 0xef, 0x50, 0x86, 0x2e, 0x51, 0xb9, 0xe3, 0xbe, 0x3d, 0x8b, 0xfd, 0x60,
+  0x1e, 0x38, 0xa8, 0x04, 0x4f, 0xf0, 0x19, 0x14, 0xb8, 0x88, 0xc6, 0x1f, 0x6c, 0x9a, 0x60, 0x25,
+  0xd4, 0x45, 0xa8, 0x9f, 0x47, 0x35, 0x8a, 0x00, 0x8f, 0xca, 0x3c, 0x07, 0x14, 0xc8, 0x90, 0x45,
+  0x92, 0x2e, 0xd1, 0x4a, 0x8b, 0x5c, 0x68, 0xba, 0xd5, 0x08, 0xe6, 0x75, 0x61, 0x51, 0xdd, 0x7b,
+  0xdc, 0xa3, 0x24, 0xe1, 0xbc, 0xc4, 0xde, 0x2e, 0x71, 0x2a, 0x89, 0x1c, 0x72, 0x1e, 0xa2, 0xa8,
+  0xab, 0x45, 0x8a, 0x3d, 0xff, 0x84, 0x1e, 0x31, 0xb0, 0xf2, 0x6d, 0xf2, 0x37, 0x39, 0xbc, 0x4b,
+  0x0e, 0xb5, 0x14, 0x58, 0xd8, 0x79, 0xa2, 0xf1, 0xe7, 0x70, 0xb0, 0x39, 0xbf, 0x6d, 0xf8, 0x6a,
+  0x21, 0x31, 0x9f, 0x6f, 0xa0, 0x53, 0x80, 0x98, 0xb6, 0xc7, 0x87, 0xe6, 0x60, 0x88, 0x94, 0x40,
+  0x22, 0xff, 0x1e, 0xb5, 0xfc, 0x4a, 0x39, 0x09, 0xd2, 0x0c, 0x4b, 0xe2, 0x77, 0x2f, 0xca, 0xd4,
+  0x52, 0x62, 0x07, 0x1d, 0xf5, 0x22, 0x45, 0xcc, 0x40, 0x8c, 0xbe, 0x94, 0xc7, 0x10, 0x58, 0xd9,
+  0x64, 0x45, 0xd1, 0x18, 0x8a, 0x0c, 0x5d, 0x62, 0x13, 0x17, 0xe8, 0x9d, 0xc5, 0x3e, 0x2b, 0x91,
+  0x02, 0x8b, 0x7c, 0x4a, 0x63, 0x99, 0x98, 0x08, 0x45, 0x06, 0x38, 0xab, 0x50, 0x54, 0x42, 0x62,
+  0x59, 0x16, 0x39, 0xb8, 0x46, 0x45, 0xb2, 0x13, 0x88, 0x6c, 0x47, 0xe3, 0x27, 0x88, 0x06, 0x45,
+  0xfa, 0x2a, 0x31, 0x50, 0x89, 0x0c, 0x4e, 0x23, 0xb3, 0xdc, 0x65, 0xe5, 0xe8, 0x51, 0x16, 0x88,
+  0xcc, 0x48, 0xe2, 0x51, 0x11, 0xb8, 0x9a, 0xc5, 0x5e, 0x36, 0xbe, 0xb4, 0x97, 0xb9, 0x4c, 0xa0,
+  0xbc, 0xc7, 0xcb, 0x78, 0x20, 0x8b, 0xac, 0x41, 0x62, 0x93, 0x1b, 0xfd, 0x60, 0x6a, 0x23, 0x31,
+  0x1e, 0x88, 0x7c, 0x57, 0xa2, 0x4b, 0x1d, 0x95, 0x93, 0x6d, 0x05, 0x13, 0x8c, 0xae, 0x34, 0x43,
+  0x16, 0x38, 0xf2, 0xac, 0x76, 0xdd, 0x27, 0x92, 0xf8, 0x27, 0x14, 0xd8, 0xab, 0x47, 0x07, 0x06,
+  0x63, 0x89, 0x24, 0x54, 0xe3, 0x6d, 0xf8, 0x32, 0x4c, 0x36, 0x38, 0x08, 0x28, 0x74, 0x54, 0xe6,
+  0x03, 0x12, 0x58, 0xaf, 0xc6, 0xc9, 0xc4, 0xa2, 0xeb, 0x49, 0x22, 0x35, 0x17, 0xb0, 0xc4, 0x2d,
+  0x4d, 0xd1, 0xaa, 0xe5, 0xcc, 0xa2, 0x0b, 0x1a, 0xd6, 0x05, 0x3e, 0x25, 0x31, 0x23, 0x8c, 0x77,
+  0x43, 0x11, 0xb9, 0xe6, 0xfe, 0xe1, 0x91, 0x5f, 0x88, 0x6c, 0x68, 0x30, 0x70, 0xd8, 0xbd, 0x47,
+  0x2f, 0x3c, 0x80, 0x40, 0x34, 0xc0, 0x32, 0xd4, 0xc9, 0xc0, 0x62, 0x0d, 0x18, 0x25, 0xc8, 0x7a,
+  0x2a, 0x11, 0x29, 0x8b, 0x24, 0x4b, 0xe2, 0x2b, 0x10, 0x58, 0xbd, 0xc5, 0x96, 0x33, 0x4c, 0x05,
+  0xc7, 0xb4, 0x91, 0x1c, 0x87, 0xa8, 0xfa, 0x26, 0x71, 0xf6, 0xdf, 0x8c, 0xa2, 0x0f, 0x10, 0xb8,
+  0x91, 0x46, 0x2f, 0xfe, 0x6e, 0x88, 0xa4, 0x4b, 0xe3, 0xa9, 0xa6, 0xcf, 0xb7, 0xd2, 0xf8, 0xf5,
+  0x87, 0x9b, 0xf9, 0xc0, 0xf4, 0x77, 0x37, 0x39, 0xba, 0x2c, 0x68, 0x9e, 0x51, 0x38, 0xc5, 0x3d,
+  0x8a, 0xb1, 0x83, 0xc6, 0x25, 0x75, 0x52, 0x18, 0x8f, 0xc4, 0x46, 0x26, 0x91, 0x1e, 0x89, 0xfc,
+  0x43, 0x62, 0x17, 0x1e, 0x1f, 0x98, 0x72, 0x3f, 0x28, 0xf2, 0x14, 0x48, 0x63, 0x98, 0xf0, 0x8b,
+  0xc7, 0xbf, 0xf0, 0x49, 0x89, 0xbc, 0x7a, 0x90, 0x76, 0x88, 0xa2, 0x46, 0xd9, 0xf0, 0x8d, 0x4e,
+  0xc5, 0xa3, 0x43, 0xa8, 0xf9, 0x6f, 0x1c, 0xde, 0x13, 0x7c, 0x42, 0x63, 0x8a, 0x80, 0x05, 0x45,
+  0xf2, 0x3f, 0x1e, 0xc0, 0x44, 0x51, 0x62, 0xd1, 0x14, 0x48, 0x94, 0x46, 0x5d, 0x61, 0xcb, 0xcb,
+  0xf7, 0xba, 0xf0, 0xbe, 0x03, 0x81, 0xe0, 0x21, 0x17, 0xde, 0xa4, 0x66, 0xe1, 0x90, 0x9d, 0x47,
+  0x74, 0x32, 0xf8, 0xf5, 0x32, 0x83, 0xa0, 0xec, 0x6a, 0x69, 0xb8, 0x38, 0x37, 0xd3, 0xab, 0x34,
+  0xfc, 0xc1, 0xe3, 0x11, 0x0b, 0x54, 0x5f, 0xfd, 0xd6, 0xbf, 0xcb, 0xac, 0x3e, 0x9e, 0x4e, 0xca,
+  0xc9, 0x81, 0xe1, 0xd0, 0x37, 0x31, 0x4f, 0x65, 0x13, 0x9b, 0xf9, 0xc0, 0xe2, 0xa0, 0x10, 0x29,
+  0xc5, 0x5e, 0x78, 0x38, 0x1a, 0x3c, 0xd0, 0x06, 0x3a, 0xb9, 0x68, 0x0c, 0x6c, 0xb2, 0x50, 0x5a,
+  0xcb, 0xfd, 0xb9, 0x79, 0x7c, 0xba, 0x89, 0xfd, 0xf8, 0xe1, 0x85, 0x25, 0xca, 0xb1, 0xcf, 0xb7,
+  0xc0, 0x11, 0xbf, 0xd9, 0xf0, 0x10, 0x51, 0x58, 0x84, 0xc4, 0x7a, 0x36, 0xf8, 0x3c, 0xae, 0x35,
+  0x99, 0xd5, 0xfc, 0xa3, 0xd1, 0x2c, 0x3f, 0x47, 0x72, 0x21, 0x1a, 0x2e, 0xb7, 0x9d, 0xa6, 0x0e,
+  0x89, 0xa4, 0x40, 0x22, 0x63, 0x1c, 0x0e, 0x6f, 0x15, 0x6a, 0xf8, 0xf6, 0x3d, 0xb7, 0xe4, 0x18,
+  0xc9, 0xe2, 0x11, 0xa9, 0xdc, 0x8b, 0x65, 0x0f, 0xb6, 0x1c, 0x47, 0x37, 0xf7, 0x97, 0xd2, 0x80,
+  0xa2, 0x7d, 0x1a, 0xdc, 0x0a, 0x45, 0xcc, 0x38, 0x88, 0xac, 0x79, 0xdc, 0x29, 0x5d, 0x54, 0xee,
+  0x21, 0xf1, 0xad, 0x60, 0x78, 0x13, 0x81, 0x98, 0xaa, 0xc6, 0x49, 0xc3, 0xe4, 0xdb, 0xad, 0xba,
+  0x42, 0xc8, 0x81, 0xc4, 0x22, 0x3c, 0xde, 0x14, 0x4f, 0xf1, 0xa8, 0xba, 0xe5, 0xac, 0x36, 0x4e,
+  0x21, 0x9c, 0x40, 0xa2, 0x61, 0x1e, 0xb4, 0x21, 0x4a, 0x24, 0xb1, 0xcc, 0xcc, 0x3a, 0x97, 0xe1,
+  0xe8, 0xd9, 0x77, 0xcc, 0xf1, 0x2c, 0x88, 0xdc, 0x46, 0x62, 0x99, 0x11, 0x88, 0xc9, 0x27, 0xd4,
+  0x18, 0x3a, 0x24, 0x4a, 0x23, 0xc3, 0xf3, 0x6a, 0xe7, 0x61, 0x31, 0xb9, 0xe3, 0x87, 0xe2, 0x23,
+  0x1e, 0x46, 0x58, 0x36, 0x36, 0xbe, 0xb1, 0xcc, 0x7c, 0xb7, 0x84, 0xb8, 0xef, 0xa9, 0x04, 0xb1,
+  0xef, 0xfc, 0x32, 0x1e, 0xa9, 0x2f, 0x73, 0xa9, 0x07, 0x08, 0x8a, 0x94, 0x47, 0xa3, 0x98, 0xf0,
+  0x8a, 0x46, 0x59, 0xaa, 0x21, 0x8b, 0x14, 0x46, 0xa3, 0x71, 0xed, 0x5f, 0xeb, 0x0a, 0x71, 0x3f,
+  0x88, 0x6c, 0x4b, 0xe2, 0x8b, 0x1c, 0x1c, 0x18, 0x5a, 0x3b, 0x0f, 0x22, 0x0c, 0x41, 0x62, 0xbd,
+  0x14, 0x18, 0xb6, 0xc4, 0x92, 0x79, 0x98, 0xce, 0xa6, 0x9a, 0x15, 0x13, 0xc8, 0xa1, 0x45, 0xca,
+  0x23, 0xf1, 0x49, 0x88, 0x2c, 0x6c, 0x3c, 0xd2, 0x68, 0x99, 0xc7, 0xd3, 0xc9, 0xc3, 0x70, 0xc0,
+  0xe3, 0xc6, 0xf9, 0xed, 0xf2, 0x2c, 0x91, 0x29, 0x8e, 0x6b, 0x14, 0x97, 0x12, 0x98, 0xef, 0x75,
+  0xea, 0x31, 0x2a, 0x88, 0x5c, 0x68, 0x1b, 0x90, 0x48, 0x88, 0x45, 0xbe, 0x2f, 0x91, 0x4e, 0x88,
+  0x2c, 0x62, 0x37, 0x32, 0x58, 0xcb, 0xfd, 0xb6, 0xdf, 0x80, 0x8c, 0x53, 0x63, 0x7f, 0xb3, 0xcd,
+  0x3f, 0x20, 0xb1, 0xb2, 0xc8, 0xa2, 0x16, 0xaf, 0xa7, 0x54, 0xfa, 0x34, 0x8d, 0x31, 0x54, 0x64,
+  0x5b, 0x25, 0xf8, 0x89, 0x44, 0x5a, 0x20, 0x51, 0x3a, 0x8c, 0xba, 0xc2, 0xaf, 0x14, 0x18, 0x9c,
+  0xc5, 0x62, 0x26, 0xb1, 0xeb, 0x5f, 0xc3, 0x62, 0x53, 0x16, 0xc8, 0xd5, 0x72, 0xe8, 0x11, 0x26,
+  0x89, 0x4c, 0x66, 0x98, 0x04, 0x68, 0xe6, 0x75, 0x71, 0x7f, 0xf5, 0x13, 0x9b, 0xea, 0xf0, 0xa0,
+  0xc4, 0x2a, 0x26, 0x91, 0x46, 0x89, 0xac, 0x5e, 0xa2, 0x83, 0x14, 0xf8, 0xc7, 0x74, 0x26, 0x31,
+  0x36, 0x8c, 0x43, 0x6d, 0xca, 0xb1, 0xa2, 0x45, 0x0a, 0x2e, 0x31, 0xb7, 0xc1, 0xc1, 0xe3, 0x07,
+  0x8c, 0x06, 0xc4, 0x3e, 0x3b, 0xaf, 0x7b, 0xdc, 0x45, 0x63, 0xb6, 0xdc, 0x62, 0xa0, 0x0a, 0x51,
+  0x67, 0x88, 0x34, 0x5d, 0xa2, 0xf7, 0x11, 0xb8, 0x97, 0xc5, 0xde, 0x23, 0x51, 0x7d, 0x8a, 0x2c,
+  0x42, 0xe2, 0x67, 0x14, 0x78, 0x8e, 0xc4, 0x52, 0x27, 0x71, 0x36, 0x8a, 0x54, 0x68, 0x75, 0x13,
+  0xe8, 0xb8, 0xc7, 0xc9, 0x7c, 0x37, 0x8c, 0x66, 0xe0, 0x67, 0x14, 0x08, 0xda, 0xf2, 0xdf, 0x9c,
+  0x08, 0x2c, 0x5e, 0x22, 0x1d, 0x14, 0x88, 0x82, 0x45, 0x66, 0x3f, 0x0b, 0xd6, 0x2a, 0xd5, 0x27,
+  0x88, 0x1a, 0x45, 0x56, 0x32, 0x7f, 0xcf, 0xca, 0x3c, 0x8d, 0x12, 0x18, 0xf1, 0xbe, 0x7c, 0x09,
+  0xc6, 0x07, 0x36, 0x77, 0x1b, 0x27, 0x12, 0x5d, 0x44, 0xf4, 0xf2, 0x42, 0xe2, 0x77, 0x10, 0x18,
+  0xb9, 0xc7, 0x7f, 0x35, 0x35, 0x8a, 0x1c, 0x7a, 0xb2, 0x18, 0x04, 0x03, 0x4d, 0x3c, 0x01, 0x8e,
+  0x40, 0x06, 0x5c, 0x19, 0x00, 0x0c, 0x63, 0x53, 0xb2, 0x58, 0xa8, 0xc7, 0x21, 0x3a, 0x16, 0x89,
+  0xbc, 0x48, 0xa3, 0xb7, 0xc8, 0x8c, 0x46, 0x03, 0xe9, 0x28, 0x8a, 0xac, 0x48, 0x62, 0x6b, 0x1e,
+  0x4d, 0xb8, 0x36, 0x20, 0x71, 0x22, 0x8a, 0x44, 0x4f, 0x22, 0xb9, 0x17, 0x28, 0x8a, 0xc4, 0x8a,
+  0x2f, 0x71, 0xa4, 0x69, 0x95, 0xa3, 0xe0, 0xa5, 0xa7, 0xc6, 0x49, 0xc3, 0xb6, 0xe9, 0x0c, 0xa2,
+  0x05, 0x1a, 0x27, 0x95, 0xd6, 0x2b, 0xb1, 0x71, 0x8d, 0xcf, 0x1c, 0x75, 0x1c, 0xbc, 0xbf, 0x57,
+  0x3b, 0x50, 0x8f, 0xc7, 0xb0, 0x29, 0x10, 0x18, 0x84, 0x46, 0x5d, 0x61, 0xc4, 0x19, 0x4a, 0xa2,
+  0x03, 0x2b, 0x60, 0x0c, 0xb5, 0xa0, 0x36, 0xd5, 0xcb, 0x40, 0x63, 0x6b, 0xeb, 0x19, 0x45, 0xd2,
+  0x24, 0x71, 0xcc, 0xc6, 0x5d, 0x23, 0x55, 0xcb, 0x9f, 0x47, 0x6d, 0x05, 0x3c, 0x88, 0x2c, 0x6f,
+  0xbd, 0x44, 0x08, 0xea, 0x69, 0xbe, 0xdb, 0xf0, 0x04, 0x64, 0x93, 0xec, 0xc7, 0x85, 0x12, 0x3c,
+  0xde, 0x11, 0xdc, 0x4f, 0x62, 0xd5, 0x12, 0x98, 0xc4, 0x2d, 0x59, 0xac, 0x50, 0x1c, 0x5b, 0x63,
+  0x41, 0x83, 0xc4, 0xff, 0x1c, 0x8c, 0xb6, 0x07, 0x87, 0x4c, 0xa0, 0xc9, 0x7b, 0x8d, 0x91, 0x11,
+  0x8b, 0xac, 0x45, 0xe3, 0x7f, 0xb3, 0x8e, 0xc4, 0x82, 0x23, 0xb1, 0x24, 0x89, 0x3c, 0x42, 0xe2,
+  0x49, 0x1b, 0x9c, 0xdc, 0x1e, 0x2a, 0x31, 0xad, 0xc0, 0x81, 0x22, 0xf5, 0x1e, 0xb4, 0x20, 0x3e,
+  0x3d, 0x6b, 0xf8, 0x94, 0x42, 0xe2, 0x47, 0x19, 0xa6, 0x01, 0xaa, 0x24, 0x51, 0xdf, 0xcd, 0x67,
+  0xdb, 0xe0, 0x88, 0x8f, 0x47, 0xa9, 0x7e, 0x83, 0xc6, 0x33, 0x33, 0x0d, 0x9e, 0xe2, 0x87, 0x51,
+  0xb7, 0xc1, 0xcf, 0x22, 0x2d, 0x13, 0x68, 0xd8, 0x79, 0xa1, 0x51, 0x31, 0x88, 0x44, 0x5a, 0x62,
+  0x4b, 0x1c, 0xce, 0xac, 0x06, 0x2e, 0xb1, 0xfc, 0xe0, 0x72, 0x1e, 0xa0, 0x98, 0xb3, 0xc5, 0xba,
+  0x22, 0x51, 0x2a, 0x8c, 0x4b, 0x0e, 0x85, 0x1e, 0x37, 0xcf, 0x11, 0x8d, 0x5b, 0x8a, 0x04, 0x76,
+  0x56, 0x47, 0xf8, 0xd9, 0x38, 0x83, 0x91, 0x1a, 0x88, 0xec, 0x56, 0x62, 0xff, 0x1d, 0xb6, 0xe1,
+  0x36, 0x30, 0x4b, 0x92, 0xc0, 0x4c, 0x62, 0x83, 0x11, 0x48, 0x9a, 0xc4, 0x22, 0x3b, 0x0f, 0x26,
+  0xeb, 0xde, 0x37, 0x12, 0x08, 0x81, 0x45, 0x06, 0x24, 0x11, 0xb2, 0xc8, 0x83, 0x23, 0x10, 0xdb,
+  0x51, 0x3c, 0xa0, 0xb9, 0x03, 0x81, 0xe0, 0x21, 0x1b, 0x68, 0x2c, 0x66, 0xe1, 0x45, 0xd6, 0xf2,
+  0xac, 0x72, 0xba, 0xad, 0x06, 0x0f, 0x61, 0xe6, 0xef, 0x75, 0xf8, 0x1e, 0x1e, 0x02, 0x0b, 0x5b,
+  0x81, 0x5c, 0x7b, 0x56, 0xbc, 0xb7, 0x37, 0x85, 0x1a, 0x9d, 0xe0, 0xe0, 0xd9, 0x98, 0xcf, 0xa7,
+  0x93, 0x73, 0xc7, 0x49, 0x7b, 0x94, 0x3a, 0x8c, 0xd3, 0xf2, 0x19, 0x1f, 0x94, 0x7a, 0x57, 0x1a,
+  0xe0, 0x4e, 0x36, 0xf9, 0x1e, 0xff, 0xc0, 0x6e, 0x37, 0xde, 0xa7, 0x96, 0xf1, 0x40, 0xdc, 0x88,
+  0xc4, 0x3e, 0x30, 0x29, 0xc4, 0x12, 0xe4, 0x31, 0x11, 0x48, 0xfe, 0x70, 0x22, 0x71, 0x01, 0x8c,
+  0x42, 0xd5, 0x55, 0xcb, 0x91, 0x44, 0x92, 0x3a, 0x9a, 0x6c, 0xba, 0x89, 0x4c, 0xa0, 0xcb, 0xac,
+  0x36, 0xdd, 0x21, 0x24, 0x40, 0x27, 0xf4, 0xea, 0xc1, 0xe3, 0x04, 0x51, 0x0e, 0x88, 0x4c, 0x7e,
+  0x17, 0xae, 0xa5, 0xfa, 0x45, 0xb2, 0xb2, 0xc8, 0x8e, 0x63, 0x2f, 0x8f, 0x13, 0x47, 0x37, 0xf7,
+  0x9a, 0x60, 0x36, 0x56, 0x4f, 0x8f, 0x60, 0x26, 0x3d, 0x59, 0x0a, 0x48, 0x73, 0x58, 0xa1, 0xb8,
+  0x82, 0xc7, 0x2f, 0x2f, 0x31, 0x8e, 0x2a, 0xd4, 0x23, 0x1d, 0x5c, 0xee, 0xc9, 0xc4, 0xfe, 0xfc,
+  0x46, 0xa2, 0x81, 0x13, 0xd8, 0xea, 0x2e, 0xb9, 0x09, 0xd0, 0xe4, 0x4a, 0x63, 0x81, 0xcd, 0xe2,
+  0xa0, 0x10, 0xfb, 0x60, 0x24, 0x47, 0x63, 0xb6, 0xdc, 0x08, 0xc6, 0x4f, 0xf9, 0xb6, 0xfc, 0x30,
+  0xdc, 0x31, 0xa8, 0xd2, 0x34, 0xd6, 0xf8, 0x3e, 0xfe, 0x6a, 0x39, 0x1b, 0x5f, 0x58, 0x3e, 0x28,
+  0xf1, 0x4b, 0x8a, 0x6c, 0x60, 0x3e, 0x90, 0x48, 0x90, 0x45, 0x32, 0x3c, 0x9b, 0x77, 0x52, 0x0f,
+  0x65, 0xdf, 0x2f, 0x47, 0x9d, 0xa6, 0x18, 0x8e, 0xfa, 0x90, 0xd1, 0x1e, 0xb4, 0x23, 0x75, 0xef,
+  0x75, 0x89, 0xb4, 0x74, 0x1d, 0x87, 0xc8, 0xec, 0x3c, 0x84, 0xf1, 0x93, 0xc4, 0x16, 0x63, 0xc3,
+  0xf3, 0x14, 0x04, 0x3a, 0x31, 0x4f, 0x60, 0xd4, 0x42, 0x62, 0x71, 0x11, 0x28, 0x85, 0x46, 0x7d,
+  0xbe, 0x1e, 0x89, 0x3c, 0x42, 0x62, 0x0d, 0x15, 0x78, 0x87, 0xc5, 0x46, 0x2e, 0x51, 0x0d, 0x8a,
+  0x64, 0x48, 0xa2, 0x0b, 0x12, 0x88, 0x8b, 0x45, 0x62, 0x28, 0xb1, 0xe3, 0x7c, 0xd7, 0x62, 0xf5,
+  0x1a, 0x27, 0x34, 0x9a, 0x27, 0xf1, 0x01, 0x88, 0x3c, 0x4d, 0xe3, 0x24, 0xe1, 0xa1, 0x44, 0x8e,
+  0x39, 0x8f, 0x0f, 0xb6, 0xfc, 0x0b, 0x10, 0xc8, 0xba, 0x47, 0xe5, 0x1e, 0x02, 0x8b, 0x24, 0x6e,
+  0x73, 0x7e, 0x46, 0x59, 0xd2, 0x31, 0x3f, 0xc0, 0xfc, 0x45, 0xe3, 0x2c, 0xd5, 0x0b, 0xc4, 0xee,
+  0x20, 0x11, 0x8d, 0x4e, 0xd0, 0xa3, 0x5b, 0x81, 0x48, 0xb9, 0x89, 0xb1, 0xcc, 0xc6, 0x7c, 0x14,
+  0xb2, 0xd8, 0xb2, 0x47, 0x9d, 0xc2, 0xcc, 0xea, 0xed, 0x79, 0x64, 0x40, 0xb5, 0xc6, 0x57, 0x1a,
+  0x97, 0xd2, 0x96, 0x23, 0x7f, 0xb3, 0x8a, 0xc5, 0xaa, 0x37, 0xde, 0xa0, 0xac, 0x77, 0xba, 0xf6,
+  0xc8, 0x94, 0x47, 0x2d, 0x61, 0x2b, 0x8a, 0xec, 0x5e, 0xe3, 0xab, 0x9d, 0xf3, 0x78, 0x4e, 0x51,
+  0x09, 0x8c, 0x1e, 0x30, 0x23, 0x1e, 0x55, 0x8c, 0x06, 0x2e, 0xf1, 0x04, 0x89, 0x94, 0x70, 0x10,
+  0x54, 0x88, 0xa8, 0xc5, 0x9a, 0x21, 0x11, 0x14, 0x8c, 0x97, 0xb9, 0x17, 0xff, 0x02, 0x47, 0xc9,
+  0x7c, 0xfa, 0x75, 0x62, 0x37, 0x3f, 0x57, 0x84, 0xfe, 0x29, 0x91, 0x2e, 0x88, 0xec, 0x42, 0xa2,
+  0x3d, 0x10, 0xe8, 0x96, 0xc7, 0x65, 0x64, 0x20, 0x8e, 0xda, 0x0a, 0x6d, 0x14, 0x58, 0x88, 0xc4,
+  0x6a, 0x21, 0x71, 0x37, 0x8d, 0xb7, 0xe0, 0x6b, 0x19, 0x75, 0x86, 0xb5, 0x81, 0x07, 0x8d, 0x13,
+  0xca, 0x23, 0x1e, 0xa5, 0xf8, 0x0a, 0x2e, 0xe1, 0xbf, 0xd6, 0x10, 0x62, 0xd5, 0x19, 0x3c, 0x41,
+  0xae, 0x2d, 0x31, 0x4f, 0x88, 0x94, 0x4e, 0xe2, 0x7f, 0x18, 0x12, 0xf4, 0x8d, 0x22, 0x0b, 0x12,
+  0x08, 0x8a, 0xc7, 0x53, 0x4d, 0x06, 0x8e, 0x22, 0x79, 0x00, 0x80, 0x69, 0xe5, 0x20, 0x31, 0xa5,
+  0x81, 0xca, 0xd8, 0x03, 0x28, 0x3c, 0xb0, 0x06, 0x21, 0x33, 0x70, 0x88, 0xac, 0x59, 0x63, 0x4c,
+  0xa0, 0xcb, 0xa8, 0x94, 0x3a, 0x8c, 0x9f, 0xf2, 0x9f, 0x1b, 0x2c, 0x8a, 0xc9, 0xc4, 0xe7, 0x69,
+  0x91, 0xe3, 0x04, 0xb9, 0x2d, 0x44, 0x6a, 0x26, 0xf1, 0xfe, 0xfc, 0x68, 0x30, 0x74, 0xd8, 0x87,
+  0x45, 0x06, 0x28, 0x71, 0xc8, 0x7a, 0x99, 0xa2, 0x01, 0x1b, 0x2e, 0xf8, 0x2a, 0x32, 0xff, 0x6d,
+  0xb7, 0x48, 0x07, 0x1e, 0x46, 0x58, 0x0e, 0x3b, 0xea, 0x46, 0x07, 0x86, 0x07, 0x13, 0x48, 0xc6,
+  0x6e, 0x17, 0x3c, 0x70, 0x6c, 0x55, 0xa2, 0x8d, 0x10, 0x28, 0x83, 0xc4, 0xee, 0x24, 0x51, 0x0b,
+  0x8d, 0xaf, 0x2c, 0x35, 0x16, 0x18, 0xe2, 0xa0, 0x03, 0xd1, 0x80, 0xfa, 0x48, 0xa2, 0x53, 0x13,
+  0x38, 0x82, 0xc7, 0xe3, 0xd8, 0x26, 0x8c, 0x6a, 0x76, 0x73, 0x11, 0x38, 0x9c, 0xc5, 0x2e, 0x20,
+  0x71, 0x7a, 0x8b, 0xcc, 0x5e, 0x23, 0x2b, 0xaa, 0x9e, 0xc4, 0x86, 0x32, 0x2d, 0x97, 0x96, 0xf0,
+  0x47, 0x17, 0xd8, 0xb0, 0xc4, 0x7a, 0x39, 0x98, 0xcd, 0x6e, 0x05, 0xca, 0xb1, 0x9c, 0x47, 0x67,
+  0xb8, 0xef, 0xfc, 0x34, 0x1d, 0x89, 0xf6, 0xfa, 0x21, 0xb6, 0x88, 0x5a, 0x87, 0x62, 0x21, 0x17,
+  0x98, 0x9f, 0x45, 0xde, 0x38, 0x08, 0x2b, 0xbc, 0x4f, 0xe2, 0x41, 0x16, 0xe8, 0x90, 0x46, 0x8b,
+  0xad, 0xc5, 0x5a, 0xad, 0x9f, 0x02, 0xe8, 0x95, 0x47, 0xa9, 0x7e, 0x3d, 0x88, 0x7c, 0x45, 0x62,
+  0xff, 0x17, 0xd8, 0xb2, 0x44, 0x0e, 0x2b, 0x11, 0x22, 0x88, 0xbc, 0xcc, 0xe2, 0x47, 0x12, 0xc8,
+  0x8d, 0x44, 0xa2, 0x31, 0x2c, 0x3d, 0x6b, 0x02, 0x93, 0x1a, 0xae, 0x5c, 0x52, 0x3f, 0x28, 0xf1,
+  0x9c, 0x47, 0xa3, 0x48, 0xd3, 0x14, 0xc5, 0x12, 0x32, 0x2e, 0x60, 0x1c, 0x5d, 0xe2, 0x29, 0x10,
+  0xb8, 0x9a, 0x47, 0xd5, 0xe1, 0xc8, 0x4e, 0x91, 0x22, 0x39, 0x12, 0x68, 0x8a, 0xc7, 0x6f, 0x91,
+  0xa1, 0xd4, 0x55, 0xa3, 0x40, 0xdc, 0x81, 0x44, 0xd2, 0x3e, 0x9e, 0x4b, 0x3c, 0x40, 0x22, 0x83,
+  0x15, 0x68, 0xa0, 0xc5, 0xa6, 0x2d, 0xf1, 0x65, 0x8a, 0x94, 0x77, 0x5e, 0xf3, 0x28, 0x9f, 0x44,
+  0xb6, 0x3c, 0x3f, 0x31, 0x9c, 0x46, 0xa2, 0xc3, 0x1e, 0x4d, 0xb8, 0x8e, 0x2e, 0x71, 0x0d, 0x8f,
+  0x3b, 0x4c, 0x81, 0x10, 0x28, 0xea, 0x2e, 0xbf, 0x9c, 0x08, 0x7c, 0x5a, 0xe7, 0x24, 0xe1, 0x83,
+  0xc6, 0xdb, 0xf0, 0xd8, 0x79, 0x0b, 0xa2, 0x83, 0x10, 0x78, 0xd1, 0x39, 0xab, 0xb1, 0xcd, 0xfd,
+  0xca, 0xa2, 0x07, 0x17, 0xd8, 0x85, 0xc5, 0x1a, 0x20, 0xd1, 0x14, 0x8c, 0x0a, 0x71, 0xab, 0x9d,
+  0x8a, 0xc4, 0x3a, 0x64, 0x11, 0xbf, 0xd9, 0xc1, 0xe3, 0xbe, 0xa4, 0x3e, 0xc4, 0x1e, 0x2f, 0x31,
+  0x2e, 0x88, 0x84, 0x50, 0xa3, 0x13, 0xfc, 0x3b, 0xc4, 0xd6, 0x2e, 0x51, 0x1f, 0x88, 0x3c, 0x01,
+  0x81, 0xe6, 0x60, 0x90, 0xfb, 0x65, 0xb7, 0xe1, 0xca, 0xb1, 0xc5, 0x3d, 0x80, 0x11, 0xde, 0xeb,
+  0xe9, 0x94, 0x1e, 0xff, 0xc3, 0x75, 0xef, 0x03, 0x8f, 0x5a, 0xff, 0x98, 0xf0, 0xc6, 0x6e, 0x1b,
+  0x6d, 0xc6, 0xcf, 0x71, 0x25, 0xee, 0x7c, 0xa3, 0xd2, 0xff, 0x6f, 0x52, 0x0f, 0x5a, 0xc0, 0xf9,
+  0x6f, 0x01, 0x11, 0x80, 0xfa, 0x6e, 0x3d, 0xa0, 0xc8, 0xc9, 0x38, 0x7f, 0x4e, 0xaf, 0x92, 0xf8,
+  0x0d, 0x19, 0x66, 0xab, 0x41, 0xd8, 0xc4, 0x4f, 0x08, 0x83, 0x66, 0xbb, 0xc8, 0x26, 0x32, 0xe9,
+  0xa4, 0xba, 0x63, 0x00, 0xb7, 0xdd, 0x2c, 0x20, 0x91, 0x80, 0x5c, 0xae, 0x96, 0x39, 0x04, 0xc8,
+  0x0a, 0x93, 0x38, 0x05, 0xce, 0xcb, 0x6e, 0xb9, 0xdb, 0xee, 0x52, 0x09, 0xa0, 0x69, 0x26, 0xb0,
+  0x0b, 0x6d, 0xc6, 0xe9, 0x74, 0x90, 0x4d, 0x81, 0x89, 0x37, 0x0d, 0xbc, 0xe0, 0x54, 0x93, 0x90,
+  0xda, 0xcc, 0x66, 0x04, 0x45, 0x22, 0x88, 0x39, 0x48, 0xeb, 0x31, 0x24, 0x08, 0x19, 0x08, 0xc2,
+  0x33, 0x69, 0x89, 0x28, 0x6e, 0xf6, 0x9b, 0x35, 0xa4, 0x0e, 0x24, 0xb1, 0x03, 0xa9, 0x34, 0x45,
+  0xea, 0x4c, 0x10, 0x3a, 0x93, 0x84, 0x2e, 0x93, 0x22, 0x70, 0x83, 0xd2, 0x64, 0x4f, 0x69, 0x91,
+  0x3c, 0x4b, 0xc7, 0x32, 0x27, 0x88, 0x19, 0x09, 0xe2, 0x25, 0x54, 0xc3, 0x4c, 0x93, 0x2b, 0x32,
+  0x26, 0x0b, 0x09, 0x13, 0x0b, 0x32, 0x25, 0x0b, 0x29, 0x13, 0x0b, 0x33, 0x72, 0x2c, 0xcc, 0x8e,
+  0x23, 0x94, 0x99, 0x92, 0x04, 0x72, 0x93, 0x37, 0x02, 0xcc, 0xc9, 0x02, 0x06, 0x42, 0x3a, 0xcc,
+  0xc8, 0xe2, 0x24, 0x52, 0x40, 0x83, 0x91, 0xc4, 0xd3, 0x42, 0x48, 0x85, 0x92, 0x68, 0x93, 0x69,
+  0xa1, 0x2c, 0x5a, 0xad, 0x34, 0x26, 0x88, 0x65, 0x5c, 0xf1, 0x34, 0x28, 0x09, 0xf0, 0xe6, 0x85,
+  0x01, 0x03, 0x21, 0x40, 0x49, 0x07, 0x34, 0x72, 0x34, 0xd0, 0xa0, 0x20, 0xe3, 0x9a, 0x93, 0xc4,
+  0x38, 0x73, 0x52, 0x70, 0x81, 0x91, 0xc2, 0xb3, 0x52, 0x50, 0x83, 0x51, 0xc2, 0xd3, 0x57, 0x0b,
+  0x4d, 0x49, 0x02, 0x59, 0x69, 0xa9, 0x2c, 0x41, 0x2e, 0x4e, 0x10, 0x4b, 0x94, 0x06, 0xdd, 0x65,
+  0xbb, 0xc8, 0x2c, 0xd6, 0x5b, 0x0d, 0xd2, 0xeb, 0x72, 0xb2, 0xc0, 0x00,
+};
+
+typedef struct {
+  const char* name;
+  uint32_t base_size;
+  const uint8_t* patch;
+  uint32_t patch_size;
+  uint32_t target_size;
+  uint32_t target_fnv1a;
+} DeltaFixture;
+
+static const DeltaFixture fixtures[] = {
+  {"bug fix", 7451, fixture_bug_fix_patch, sizeof(fixture_bug_fix_patch), 7453, 0x7e22b9a0UL},
+  {"new function", 7451, fixture_new_function_patch, sizeof(fixture_new_function_patch), 7705, 0x903cef7cUL},
+  {"no base", 0, fixture_no_base_patch, sizeof(fixture_no_base_patch), 7705, 0x903cef7cUL},
+};
+
+#endif  // DELTA_FIXTURES_H
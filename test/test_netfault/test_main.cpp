@@ -0,0 +1,360 @@
+/**
+ * Host test of the fault-injection layer (src/netfault/netfault.cpp)
+ *
+ * Wraps fake inner UDP and Client objects, steps the scenario schedule on
+ * the test clock, and checks what each scenario does to the traffic:
+ * loss, added round trip, truncation, reordering and hangs, and that data
+ * loss is counted from publish queue drops rather than failed publishes.
+ *
+ * Run: pio test -e native_netfault
+ */
+
+#include <unity.h>
+#include <string.h>
+#include "netfault/netfault.h"
+#include "mdns/network.h"
+#include "mqtt/publish_queue.h"
+
+#define SENT_MAX 2048
+#define STEP_MS 100
+
+// ============================================================================
+// FAKE INNER SOCKETS
+// ============================================================================
+
+/**
+ * Records what reaches the network; delivers one scripted datagram
+ */
+class FakeUDP : public UDP {
+public:
+  uint8_t sent_first[SENT_MAX];   // First byte of each datagram sent
+  uint16_t sent_len[SENT_MAX];
+  uint32_t sent = 0;
+  uint8_t rx[CONFIG_NETFAULT_MAX_DATAGRAM];
+  int rx_len = 0;
+  int rx_pos = 0;
+
+  uint8_t begin(uint16_t port) override { (void)port; return 1; }
+  uint8_t beginMulticast(IPAddress ip, uint16_t port) override { (void)ip; (void)port; return 1; }
+  void stop() override {}
+
+  int beginPacket(IPAddress ip, uint16_t port) override { (void)ip; (void)port; len = 0; return 1; }
+  int beginPacket(const char* host, uint16_t port) override { (void)host; (void)port; len = 0; return 1; }
+  int endPacket() override
+  {
+    if (sent < SENT_MAX)
+    {
+      sent_first[sent] = first;
+      sent_len[sent] = len;
+    }
+    sent++;
+    return 1;
+  }
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t* buf, size_t size) override
+  {
+    if (len == 0 && size > 0)
+    {
+      first = buf[0];
+    }
+    len += size;
+    return size;
+  }
+  using Print::write;
+
+  int parsePacket() override
+  {
+    rx_pos = 0;
+    return rx_len;
+  }
+  int available() override { return rx_len - rx_pos; }
+  int read() override { return rx_pos < rx_len ? rx[rx_pos++] : -1; }
+  int read(unsigned char* buf, size_t size) override
+  {
+    size_t n = size < (size_t)available() ? size : (size_t)available();
+    memcpy(buf, rx + rx_pos, n);
+    rx_pos += n;
+    return (int)n;
+  }
+  int read(char* buf, size_t size) override { return read((unsigned char*)buf, size); }
+  int peek() override { return rx_pos < rx_len ? rx[rx_pos] : -1; }
+  void flush() override {}
+  IPAddress remoteIP() override { return IPAddress(192, 168, 1, 2); }
+  uint16_t remotePort() override { return 5353; }
+
+private:
+  uint16_t len = 0;
+  uint8_t first = 0;
+};
+
+/**
+ * Peer that accepts every connect and has `rx_len` bytes ready
+ */
+class FakeClient : public Client {
+public:
+  uint8_t rx[256];
+  int rx_len = 0;
+  int rx_pos = 0;
+  bool open = false;
+  uint32_t connects = 0;
+
+  int connect(IPAddress ip, uint16_t port) override { (void)ip; (void)port; return accept(); }
+  int connect(const char* host, uint16_t port) override { (void)host; (void)port; return accept(); }
+  size_t write(uint8_t b) override { (void)b; return 1; }
+  size_t write(const uint8_t* buf, size_t size) override { (void)buf; return size; }
+  using Print::write;
+  int available() override { return open ? rx_len - rx_pos : 0; }
+  int read() override { return available() > 0 ? rx[rx_pos++] : -1; }
+  int read(uint8_t* buf, size_t size) override
+  {
+    size_t n = size < (size_t)available() ? size : (size_t)available();
+    memcpy(buf, rx + rx_pos, n);
+    rx_pos += n;
+    return (int)n;
+  }
+  int peek() override { return available() > 0 ? rx[rx_pos] : -1; }
+  void flush() override {}
+  void stop() override { open = false; }
+  uint8_t connected() override { return open; }
+  operator bool() override { return open; }
+
+private:
+  int accept(void)
+  {
+    connects++;
+    open = true;
+    rx_pos = 0;
+    return 1;
+  }
+};
+
+static FakeUDP inner_udp;
+static NetFaultUDP udp(inner_udp);
+static FakeClient inner_client;
+static NetFaultClient client(inner_client);
+static PublishQueueStats queue_stats;
+
+// Provided by mdns/network.cpp and mqtt/publish_queue.cpp in the firmware
+UDP& getUDPSocket(void)
+{
+  return udp;
+}
+
+const PublishQueueStats* publishQueueGetStats(void)
+{
+  return &queue_stats;
+}
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+/**
+ * Step the schedule to the start of a scenario (recovery windows end with
+ * a good publish)
+ */
+static void runUntil(const char* name)
+{
+  netFaultBegin();
+  for (uint32_t i = 0; i < 100000 && strcmp(netFaultActiveProfile()->name, name) != 0; i++)
+  {
+    native_millis += STEP_MS;
+    netFaultPoll();
+    if (strcmp(netFaultActiveProfile()->name, "recovery") == 0)
+    {
+      netFaultNotePublish(true);
+    }
+  }
+  TEST_ASSERT_EQUAL_STRING(name, netFaultActiveProfile()->name);
+}
+
+static void sendDatagram(uint8_t first, uint16_t length)
+{
+  uint8_t data[CONFIG_NETFAULT_MAX_DATAGRAM];
+  memset(data, first, sizeof(data));
+  udp.beginPacket(IPAddress(224, 0, 0, 251), 5353);
+  udp.write(data, length);
+  udp.endPacket();
+}
+
+static void connectWith(const char* reply)
+{
+  strlcpy((char*)inner_client.rx, reply, sizeof(inner_client.rx));
+  inner_client.rx_len = (int)strlen(reply);
+  client.connect("broker.local", 1883);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void setUp(void)
+{
+  inner_udp = FakeUDP();
+  inner_client = FakeClient();
+  memset(&queue_stats, 0, sizeof(queue_stats));
+}
+
+void tearDown(void)
+{
+}
+
+void test_baseline_passes_through(void)
+{
+  runUntil("baseline");
+  sendDatagram('a', 100);
+  TEST_ASSERT_EQUAL_UINT32(1, inner_udp.sent);
+  TEST_ASSERT_EQUAL(100, inner_udp.sent_len[0]);
+
+  connectWith("CONNACK");
+  TEST_ASSERT_EQUAL(7, client.available());
+}
+
+void test_loss(void)
+{
+  runUntil("loss20");
+  for (uint32_t i = 0; i < 1000; i++)
+  {
+    sendDatagram('a', 10);
+  }
+
+  // Dropped ones still look sent to the caller
+  const NetFaultStats* stats = netFaultGetStats();
+  TEST_ASSERT_EQUAL_UINT32(1000, stats->udp_sent + stats->udp_dropped);
+  TEST_ASSERT_EQUAL_UINT32(stats->udp_sent, inner_udp.sent);
+  TEST_ASSERT_TRUE(stats->udp_dropped > 120 && stats->udp_dropped < 280);
+
+  uint32_t refused = 0;
+  for (uint32_t i = 0; i < 200; i++)
+  {
+    refused += client.connect("broker.local", 1883) ? 0 : 1;
+  }
+  TEST_ASSERT_EQUAL_UINT32(refused, stats->tcp_refused);
+  TEST_ASSERT_EQUAL_UINT32(200 - refused, inner_client.connects);
+  TEST_ASSERT_TRUE(refused > 10 && refused < 80);
+}
+
+void test_round_trip_does_not_block(void)
+{
+  runUntil("rtt2s");
+  uint32_t start = native_millis;
+  connectWith("CONNACK");
+
+  // Connect returned at once; the reply waits one round trip
+  TEST_ASSERT_EQUAL_UINT32(start, native_millis);
+  TEST_ASSERT_EQUAL(0, client.available());
+  TEST_ASSERT_EQUAL(-1, client.read());
+  TEST_ASSERT_TRUE(client.connected());
+
+  native_millis += 1999;
+  TEST_ASSERT_EQUAL(0, client.available());
+  native_millis += 1;
+  TEST_ASSERT_EQUAL(7, client.available());
+  TEST_ASSERT_EQUAL('C', client.read());
+
+  // Later bytes are not held back again
+  TEST_ASSERT_EQUAL(6, client.available());
+}
+
+void test_truncate(void)
+{
+  runUntil("truncate");
+
+  sendDatagram('a', 200);
+  TEST_ASSERT_EQUAL_UINT32(1, inner_udp.sent);
+  TEST_ASSERT_EQUAL(64, inner_udp.sent_len[0]);
+
+  memset(inner_udp.rx, 'b', 200);
+  inner_udp.rx_len = 200;
+  TEST_ASSERT_EQUAL(64, udp.parsePacket());
+  uint8_t buf[256];
+  TEST_ASSERT_EQUAL(64, udp.read(buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, udp.available());
+
+  // A stream cut after 64 bytes looks closed by the peer
+  memset(inner_client.rx, 'c', sizeof(inner_client.rx));
+  inner_client.rx_len = 200;
+  client.connect("broker.local", 1883);
+  TEST_ASSERT_EQUAL(64, client.read(buf, sizeof(buf)));
+  TEST_ASSERT_EQUAL(0, client.available());
+  TEST_ASSERT_FALSE(client.connected());
+  TEST_ASSERT_EQUAL_UINT32(2, netFaultGetStats()->udp_truncated);
+  TEST_ASSERT_EQUAL_UINT32(1, netFaultGetStats()->tcp_truncated);
+}
+
+void test_reorder(void)
+{
+  runUntil("reorder");
+
+  // The first is held back, the second overtakes it
+  sendDatagram('a', 10);
+  TEST_ASSERT_EQUAL_UINT32(0, inner_udp.sent);
+  sendDatagram('b', 10);
+  TEST_ASSERT_EQUAL_UINT32(2, inner_udp.sent);
+  TEST_ASSERT_EQUAL('b', inner_udp.sent_first[0]);
+  TEST_ASSERT_EQUAL('a', inner_udp.sent_first[1]);
+  TEST_ASSERT_EQUAL_UINT32(1, netFaultGetStats()->udp_reordered);
+
+  // One with no successor goes out after the delay and the hold time
+  sendDatagram('c', 10);
+  native_millis += 200 + CONFIG_NETFAULT_REORDER_HOLD_MS - STEP_MS;
+  netFaultPoll();
+  TEST_ASSERT_EQUAL_UINT32(2, inner_udp.sent);
+  native_millis += STEP_MS;
+  netFaultPoll();
+  TEST_ASSERT_EQUAL_UINT32(3, inner_udp.sent);
+  TEST_ASSERT_EQUAL('c', inner_udp.sent_first[2]);
+}
+
+void test_hang(void)
+{
+  runUntil("hang");
+  connectWith("CONNACK");
+
+  // Connected, data waiting in the real socket, none delivered
+  native_millis += 60000;
+  TEST_ASSERT_TRUE(client.connected());
+  TEST_ASSERT_EQUAL(0, client.available());
+  TEST_ASSERT_EQUAL(-1, client.read());
+  TEST_ASSERT_EQUAL_UINT32(1, netFaultGetStats()->tcp_hung);
+}
+
+void test_loss_is_queue_drops(void)
+{
+  runUntil("loss20");
+  queue_stats.dropped = 5;   // Before the window
+  netFaultBegin();           // Back to "baseline", counted from here
+
+  netFaultNotePublish(false);
+  netFaultNotePublish(false);
+  netFaultNotePublish(true);
+  queue_stats.dropped += 3;
+  netFaultPoll();
+
+  const NetFaultStats* stats = netFaultGetStats();
+  TEST_ASSERT_EQUAL_UINT32(2, stats->publish_retried);
+  TEST_ASSERT_EQUAL_UINT32(1, stats->publish_ok);
+  TEST_ASSERT_EQUAL_UINT32(3, stats->publish_dropped);
+
+  // Each window counts its own drops
+  native_millis += CONFIG_NETFAULT_SCENARIO_MS;
+  netFaultPoll();
+  TEST_ASSERT_EQUAL_STRING("recovery", netFaultActiveProfile()->name);
+  TEST_ASSERT_EQUAL_UINT32(0, netFaultGetStats()->publish_dropped);
+  queue_stats.dropped++;
+  netFaultPoll();
+  TEST_ASSERT_EQUAL_UINT32(1, netFaultGetStats()->publish_dropped);
+}
+
+int main(void)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_baseline_passes_through);
+  RUN_TEST(test_loss);
+  RUN_TEST(test_round_trip_does_not_block);
+  RUN_TEST(test_truncate);
+  RUN_TEST(test_reorder);
+  RUN_TEST(test_hang);
+  RUN_TEST(test_loss_is_queue_drops);
+  return UNITY_END();
+}
@@ -0,0 +1,387 @@
+/**
+ * Host test of the OTA download (src/ota/ota.cpp)
+ *
+ * Runs otaOffer()/otaPoll() against a scripted HTTP server behind the
+ * WiFiClient of test/native/WiFiNINA.h, into the RAM flash bank and the
+ * software SHA-256 of the host build. Offers are signed with the host
+ * stand-in signature (ota/image_hash.h) for CONFIG_OTA_PUBLIC_KEY, which
+ * [env:native] sets to a test key.
+ *
+ * Run: pio test -e native
+ */
+
+#include <unity.h>
+#include <string.h>
+#include <WiFiNINA.h>
+#include "ota/ota.h"
+#include "ota/flash_bank.h"
+#include "ota/image_hash.h"
+#include "ota/delta.h"
+#include "../test_delta/delta_fixtures.h"  // Patches from tools/ota_delta.py
+
+#define IMAGE_SIZE 5000          // Not a whole number of rows
+#define RESPONSE_MAX 16384
+#define POLL_STEP_MS 10
+#define TARGET_MAX 8192
+
+static uint8_t image[IMAGE_SIZE];
+static uint8_t target[TARGET_MAX];
+static uint8_t public_key[64];
+static uint8_t version_counter = 0;
+
+// ============================================================================
+// SCRIPTED HTTP SERVER
+// ============================================================================
+
+/**
+ * Serves one body per connection from the start or from a Range offset,
+ * closing when it's sent (Connection: close)
+ */
+class FakeHttpServer : public NativeServer {
+public:
+  const uint8_t* body = NULL;
+  uint32_t body_size = 0;
+  uint32_t cut_at = 0;      // Close the next connection at this body offset (0 = off)
+  uint32_t per_poll = 0;    // Most bytes readable at once (0 = all)
+  bool refuse = false;      // Refuse connects
+
+  uint32_t connects = 0;
+  uint32_t last_range = 0;  // Range start of the last request (0 = none)
+
+  bool open(const char* host, uint16_t port) override
+  {
+    (void)host;
+    (void)port;
+    if (refuse)
+    {
+      return false;
+    }
+    connects++;
+    request_len = 0;
+    response_len = 0;
+    sent = 0;
+    closed = false;
+    return true;
+  }
+
+  void receive(const uint8_t* buf, size_t size) override
+  {
+    size_t n = size < sizeof(request) - 1 - request_len ? size : sizeof(request) - 1 - request_len;
+    memcpy(request + request_len, buf, n);
+    request_len += n;
+    request[request_len] = '\0';
+    if (strstr(request, "\r\n\r\n"))
+    {
+      respond();
+    }
+  }
+
+  int available() override
+  {
+    uint32_t left = response_len - sent;
+    return (int)(per_poll > 0 && left > per_poll ? per_poll : left);
+  }
+
+  int read(uint8_t* buf, size_t size) override
+  {
+    uint32_t n = (uint32_t)available();
+    if (n > size)
+    {
+      n = size;
+    }
+    memcpy(buf, response + sent, n);
+    sent += n;
+    return (int)n;
+  }
+
+  bool connected() override
+  {
+    return !closed && (response_len == 0 || sent < response_len);
+  }
+
+  void close() override
+  {
+    closed = true;
+  }
+
+private:
+  void respond(void)
+  {
+    const char* range = strstr(request, "Range: bytes=");
+    last_range = range ? (uint32_t)atol(range + 13) : 0;
+
+    uint32_t end = body_size;
+    if (cut_at > last_range && cut_at < body_size)
+    {
+      end = cut_at;  // Dropped mid-body
+      cut_at = 0;
+    }
+
+    response_len = snprintf((char*)response, sizeof(response),
+                            "HTTP/1.1 %s\r\nContent-Length: %lu\r\n\r\n",
+                            range ? "206 Partial Content" : "200 OK",
+                            (unsigned long)(body_size - last_range));
+    memcpy(response + response_len, body + last_range, end - last_range);
+    response_len += end - last_range;
+  }
+
+  char request[512];
+  uint32_t request_len = 0;
+  uint8_t response[RESPONSE_MAX];
+  uint32_t response_len = 0;
+  uint32_t sent = 0;
+  bool closed = false;
+};
+
+static FakeHttpServer server;
+
+// ============================================================================
+// HELPER FUNCTIONS
+// ============================================================================
+
+static void sha256(const uint8_t* data, uint32_t length, uint8_t digest[IMAGE_HASH_SIZE])
+{
+  uint32_t whole = length - length % IMAGE_HASH_BLOCK_SIZE;
+  imageHashBegin();
+  imageHashUpdate(data, whole);
+  imageHashFinish(data + whole, length - whole, digest);
+}
+
+/**
+ * Host stand-in signature (ota/image_hash.h) over what offerSigned() checks
+ */
+static void sign(FirmwareOffer* offer)
+{
+  uint8_t message[64 + IMAGE_HASH_SIZE];
+  size_t version_len = strlen(offer->version);
+  memcpy(message, offer->sha256, 32);
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    message[32 + i] = (uint8_t)(offer->size >> (i * 8));
+  }
+  memcpy(message + 36, offer->version, version_len);
+
+  uint8_t digest[IMAGE_HASH_SIZE];
+  sha256(message, 36 + version_len, digest);
+  memcpy(message, public_key, 64);
+  memcpy(message + 64, digest, IMAGE_HASH_SIZE);
+  sha256(message, sizeof(message), offer->signature);
+  memcpy(offer->signature + 32, digest, IMAGE_HASH_SIZE);
+}
+
+/**
+ * Signed offer of `image`, with a version newer than the last one
+ */
+static FirmwareOffer makeOffer(void)
+{
+  FirmwareOffer offer;
+  memset(&offer, 0, sizeof(offer));
+  snprintf(offer.version, sizeof(offer.version), "2.0.%u", ++version_counter);
+  strlcpy(offer.url, "/firmware/image.bin", sizeof(offer.url));
+  offer.size = IMAGE_SIZE;
+  sha256(image, IMAGE_SIZE, offer.sha256);
+  sign(&offer);
+  return offer;
+}
+
+/**
+ * Image a fixture patch rebuilds from fixture_base
+ */
+static void rebuild(const DeltaFixture* fixture)
+{
+  deltaBegin(fixture_base, sizeof(fixture_base), fixture->target_size, FLASH_BANK_ROW_SIZE);
+  uint32_t offset = 0;
+  while (deltaGetStatus()->state != DELTA_DONE && deltaGetStatus()->state != DELTA_ERROR)
+  {
+    uint32_t produced;
+    uint32_t used = deltaDecode(fixture->patch + offset, fixture->patch_size - offset,
+                                target + deltaGetStatus()->produced,
+                                TARGET_MAX - deltaGetStatus()->produced, &produced);
+    offset += used;
+    if (used == 0 && produced == 0)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * Poll until the state is `until` or `ms` of simulated time pass
+ */
+static OtaState pump(OtaState until, uint32_t ms)
+{
+  uint32_t end = native_millis + ms;
+  OtaState state = otaGetStatus()->state;
+  while (state != until && native_millis < end)
+  {
+    native_millis += POLL_STEP_MS;
+    state = otaPoll(native_millis);
+  }
+  return state;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void setUp(void)
+{
+  server = FakeHttpServer();
+  server.body = image;
+  server.body_size = IMAGE_SIZE;
+  native_server = &server;
+}
+
+void tearDown(void)
+{
+  native_server = NULL;
+}
+
+void test_software_sha256(void)
+{
+  // FIPS 180-2 example: SHA-256("abc")
+  static const uint8_t expected[IMAGE_HASH_SIZE] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+    0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad,
+  };
+  uint8_t digest[IMAGE_HASH_SIZE];
+  sha256((const uint8_t*)"abc", 3, digest);
+  TEST_ASSERT_EQUAL_MEMORY(expected, digest, IMAGE_HASH_SIZE);
+}
+
+void test_whole_image(void)
+{
+  FirmwareOffer offer = makeOffer();
+  server.per_poll = 700;
+  TEST_ASSERT_TRUE(otaOffer(&offer, "config.local", 8080, native_millis));
+  TEST_ASSERT_EQUAL(OTA_READY, pump(OTA_READY, 60000));
+
+  const OtaStatus* status = otaGetStatus();
+  TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, status->received);
+  TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, status->transferred);
+  TEST_ASSERT_EQUAL(1, status->attempts);
+  TEST_ASSERT_EQUAL(0, status->resumes);
+  TEST_ASSERT_EQUAL(1, server.connects);
+  TEST_ASSERT_EQUAL_MEMORY(image, flashBankData(), IMAGE_SIZE);
+
+  TEST_ASSERT_TRUE(otaApply());
+  TEST_ASSERT_EQUAL_MEMORY(image, flashBankSketch(), IMAGE_SIZE);
+}
+
+void test_range_resume(void)
+{
+  FirmwareOffer offer = makeOffer();
+  server.cut_at = 3000;
+  TEST_ASSERT_TRUE(otaOffer(&offer, "config.local", 8080, native_millis));
+
+  TEST_ASSERT_EQUAL(OTA_FAILED, pump(OTA_FAILED, 60000));
+  TEST_ASSERT_EQUAL(OTA_ERROR_SHORT, otaGetStatus()->error);
+  TEST_ASSERT_EQUAL(OTA_READY, pump(OTA_READY, 60000));
+
+  // Picked up at the last row written, without counting an attempt
+  const OtaStatus* status = otaGetStatus();
+  TEST_ASSERT_EQUAL(2, server.connects);
+  TEST_ASSERT_EQUAL_UINT32(3000 - 3000 % FLASH_BANK_ROW_SIZE, server.last_range);
+  TEST_ASSERT_EQUAL(1, status->attempts);
+  TEST_ASSERT_EQUAL(1, status->resumes);
+  TEST_ASSERT_EQUAL_UINT32(3000 + IMAGE_SIZE - server.last_range, status->transferred);
+  TEST_ASSERT_EQUAL_MEMORY(image, flashBankData(), IMAGE_SIZE);
+}
+
+void test_bad_hash(void)
+{
+  // Signed as offered, but the image served is not the one signed
+  FirmwareOffer offer = makeOffer();
+  offer.sha256[0] ^= 0x01;
+  sign(&offer);
+  TEST_ASSERT_TRUE(otaOffer(&offer, "config.local", 8080, native_millis));
+
+  TEST_ASSERT_EQUAL(OTA_FAILED, pump(OTA_FAILED, 60000));
+  TEST_ASSERT_EQUAL(OTA_ERROR_HASH, otaGetStatus()->error);
+  TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, otaGetStatus()->received);
+  TEST_ASSERT_FALSE(otaApply());
+
+  // Retried from the start, not resumed
+  TEST_ASSERT_EQUAL(OTA_DOWNLOADING, pump(OTA_DOWNLOADING, CONFIG_OTA_RETRY_INTERVAL_MS + 1000));
+  TEST_ASSERT_EQUAL(2, otaGetStatus()->attempts);
+  TEST_ASSERT_EQUAL(0, otaGetStatus()->resumes);
+}
+
+void test_bad_signature(void)
+{
+  FirmwareOffer offer = makeOffer();
+
+  // Signed, then changed
+  offer.size = IMAGE_SIZE - 1;
+  TEST_ASSERT_FALSE(otaOffer(&offer, "config.local", 8080, native_millis));
+  TEST_ASSERT_EQUAL(OTA_FAILED, otaGetStatus()->state);
+  TEST_ASSERT_EQUAL(OTA_ERROR_SIGNATURE, otaGetStatus()->error);
+
+  // Damaged signature
+  offer = makeOffer();
+  offer.signature[63] ^= 0x80;
+  TEST_ASSERT_FALSE(otaOffer(&offer, "config.local", 8080, native_millis));
+  TEST_ASSERT_EQUAL(OTA_ERROR_SIGNATURE, otaGetStatus()->error);
+
+  // Never downloaded, nor retried
+  TEST_ASSERT_EQUAL(OTA_FAILED, pump(OTA_DOWNLOADING, CONFIG_OTA_RETRY_INTERVAL_MS + 1000));
+  TEST_ASSERT_EQUAL(0, server.connects);
+}
+
+void test_patch_decoded_after_close(void)
+{
+  // The server sends the whole patch at once and closes: the decoder is
+  // still copying from the running image when the socket has nothing left
+  for (const DeltaFixture& fixture : fixtures)
+  {
+    rebuild(&fixture);
+    TEST_ASSERT_EQUAL(DELTA_DONE, deltaGetStatus()->state);
+    memcpy((uint8_t*)flashBankSketch(), fixture_base, sizeof(fixture_base));
+
+    FirmwareOffer offer;
+    memset(&offer, 0, sizeof(offer));
+    snprintf(offer.version, sizeof(offer.version), "2.0.%u", ++version_counter);
+    strlcpy(offer.url, "/firmware/image.bin", sizeof(offer.url));
+    offer.size = fixture.target_size;
+    sha256(target, fixture.target_size, offer.sha256);
+    sign(&offer);
+    strlcpy(offer.delta_url, "/firmware/image.otd", sizeof(offer.delta_url));
+    strlcpy(offer.delta_from, CONFIG_FIRMWARE_VERSION, sizeof(offer.delta_from));
+    offer.delta_size = fixture.patch_size;
+
+    server = FakeHttpServer();
+    server.body = fixture.patch;
+    server.body_size = fixture.patch_size;
+    TEST_ASSERT_TRUE(otaOffer(&offer, "config.local", 8080, native_millis));
+    TEST_ASSERT_EQUAL_MESSAGE(OTA_READY, pump(OTA_READY, 60000), fixture.name);
+
+    const OtaStatus* status = otaGetStatus();
+    TEST_ASSERT_TRUE(status->delta);
+    TEST_ASSERT_EQUAL(0, status->resumes);
+    TEST_ASSERT_EQUAL(1, server.connects);
+    TEST_ASSERT_EQUAL_UINT32(fixture.patch_size, status->transferred);
+    TEST_ASSERT_EQUAL_MEMORY(target, flashBankData(), fixture.target_size);
+  }
+}
+
+int main(void)
+{
+  for (uint32_t i = 0; i < IMAGE_SIZE; i++)
+  {
+    image[i] = (uint8_t)((i * 2654435761UL) >> 13);
+  }
+  for (uint8_t i = 0; i < sizeof(public_key); i++)
+  {
+    char hex[3] = {CONFIG_OTA_PUBLIC_KEY[i * 2], CONFIG_OTA_PUBLIC_KEY[i * 2 + 1], '\0'};
+    public_key[i] = (uint8_t)strtoul(hex, NULL, 16);
+  }
+
+  UNITY_BEGIN();
+  RUN_TEST(test_software_sha256);
+  RUN_TEST(test_whole_image);
+  RUN_TEST(test_range_resume);
+  RUN_TEST(test_bad_hash);
+  RUN_TEST(test_bad_signature);
+  RUN_TEST(test_patch_decoded_after_close);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Boot-to-first-publish model for the startup order in src/main.cpp, run in
+virtual time: the sequential boot (everything in setup() one after the
+other, first config fetch gated by CONFIG_FETCH_RETRY_INTERVAL) against the
+overlapped boot (WiFi join and sensor warm-up in the background, config
+fetched as soon as the server is discovered).
+
+Each step is either blocking (runs on the single loop thread, in the order
+listed) or background (runs on its own once its inputs are done: the NINA
+module joining, the sensors warming up, the network answering). A step
+starts when the thread is free (blocking steps only) and all of its inputs
+are done.
+
+The durations are assumptions (command-line options), not measurements, and
+the model does not run the firmware: it only shows how the order of the
+steps adds up. Most of the default saving comes from dropping the 30 s gate
+on the first config fetch, not from the overlap; the saving is printed split
+into the two (the gate alone is the sequential boot with the fetch on
+discovery). Check the real sequencing against a published timeline with
+--measured.
+
+Milestones use the names of the boot timeline (include/diag/boot_timeline.h).
+With --measured, a timeline published on "<mqtt_topic>/boot" is printed next
+to the overlapped model.
+
+Usage:
+  tools/boot_model.py
+  tools/boot_model.py --join-ms 6000 --serial-wait-ms 0
+  tools/boot_model.py --measured boot.json
+"""
+
+import argparse
+import json
+
+# (milestone, blocking, inputs, duration option)
+SEQUENTIAL = [
+    ("serial",        True,  [],                          "serial_wait_ms"),
+    ("wifi_begin",    True,  [],                          "spi_ms"),
+    ("device_id",     True,  [],                          "device_id_ms"),
+    ("sensors",       True,  [],                          "warmup_ms"),
+    ("rtc",           True,  [],                          "rtc_ms"),
+    ("setup",         True,  [],                          None),
+    ("wifi_up",       False, ["wifi_begin"],              "join_ms"),
+    ("query",         True,  ["setup", "wifi_up"],        "spi_ms"),
+    ("discovered",    False, ["query"],                   "mdns_ms"),
+    ("fetch_gate",    False, [],                          "fetch_interval_ms"),
+    ("config",        True,  ["discovered", "fetch_gate"], "fetch_ms"),
+    ("transport",     True,  ["config"],                  "connect_ms"),
+    ("first_publish", True,  ["transport", "sensors"],    "publish_ms"),
+]
+
+OVERLAPPED = [
+    ("wifi_begin",    True,  [],                          "spi_ms"),
+    ("device_id",     True,  [],                          "device_id_ms"),
+    ("sensors_begin", True,  [],                          "sensor_begin_ms"),
+    ("serial",        True,  [],                          "serial_wait_ms"),
+    ("rtc",           True,  [],                          "rtc_ms"),
+    ("setup",         True,  [],                          None),
+    ("warm",          False, ["sensors_begin"],           "warmup_ms"),
+    ("sensors",       True,  ["setup", "warm"],           "sensor_probe_ms"),
+    ("wifi_up",       False, ["wifi_begin"],              "join_ms"),
+    ("query",         True,  ["setup", "wifi_up"],        "spi_ms"),
+    ("discovered",    False, ["query"],                   "mdns_ms"),
+    ("config",        True,  ["discovered"],              "fetch_ms"),
+    ("transport",     True,  ["config"],                  "connect_ms"),
+    ("first_publish", True,  ["transport", "sensors"],    "publish_ms"),
+]
+
+# Sequential order with the config fetched on discovery: separates the gate
+# from the overlap
+UNGATED = [(name, blocking, [i for i in inputs if i != "fetch_gate"], option)
+           for name, blocking, inputs, option in SEQUENTIAL if name != "fetch_gate"]
+
+HIDDEN = ("fetch_gate", "sensors_begin", "warm")
+
+
+def run(steps, args):
+    """Return {milestone: virtual ms at which it is reached}."""
+    done = {}
+    thread_free = 0.0
+    pending = list(steps)
+    while pending:
+        for step in pending:
+            name, blocking, inputs, option = step
+            if all(i in done for i in inputs):
+                break
+        else:
+            raise ValueError("unresolvable inputs: %s" % [s[0] for s in pending])
+        pending.remove(step)
+
+        ready = max([done[i] for i in inputs] or [0.0])
+        duration = getattr(args, option) if option else 0.0
+        if blocking:
+            start = max(ready, thread_free)
+            thread_free = start + duration
+            done[name] = thread_free
+        else:
+            done[name] = ready + duration
+    return done
+
+
+def print_timeline(label, marks):
+    shown = sorted((t, n) for n, t in marks.items() if n not in HIDDEN)
+    print("%s: first_publish at %.0f ms" % (label, marks["first_publish"]))
+    previous = 0.0
+    for t, name in shown:
+        print("  %-14s %7.0f ms  (+%.0f)" % (name, t, t - previous))
+        previous = t
+
+
+def print_measured(path, model):
+    with open(path, encoding="utf-8") as handle:
+        timeline = json.load(handle)
+    marks = timeline.get("marks_ms", {})
+    print("measured vs overlapped model:")
+    for name, t in sorted(marks.items(), key=lambda item: item[1]):
+        expected = model.get(name)
+        delta = "" if expected is None else "  (model %+.0f ms)" % (expected - t)
+        print("  %-14s %7d ms%s" % (name, t, delta))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--serial-wait-ms", type=float, default=5000,
+                        help="CONFIG_SERIAL_WAIT_TIMEOUT (no USB host; 0 for release builds)")
+    parser.add_argument("--spi-ms", type=float, default=30,
+                        help="NINA SPI hand-off per WiFi call")
+    parser.add_argument("--device-id-ms", type=float, default=140,
+                        help="ECCX08 wake-up and serial read")
+    parser.add_argument("--sensor-begin-ms", type=float, default=15, help="ENV.begin()")
+    parser.add_argument("--warmup-ms", type=float, default=2000, help="CONFIG_SENSOR_WARMUP_MS")
+    parser.add_argument("--sensor-probe-ms", type=float, default=10,
+                        help="one read of each sensor after the warm-up")
+    parser.add_argument("--rtc-ms", type=float, default=25)
+    parser.add_argument("--join-ms", type=float, default=2600,
+                        help="WiFi join (see tools/wifi_join_model.py)")
+    parser.add_argument("--mdns-ms", type=float, default=170, help="query to answer")
+    parser.add_argument("--fetch-interval-ms", type=float, default=30000,
+                        help="CONFIG_FETCH_RETRY_INTERVAL (first fetch gate, sequential)")
+    parser.add_argument("--fetch-ms", type=float, default=870, help="HTTP config fetch")
+    parser.add_argument("--connect-ms", type=float, default=800, help="broker connect")
+    parser.add_argument("--publish-ms", type=float, default=400, help="first read + publish")
+    parser.add_argument("--measured", metavar="JSON",
+                        help="boot timeline published by the device")
+    args = parser.parse_args()
+
+    sequential = run(SEQUENTIAL, args)
+    ungated = run(UNGATED, args)
+    overlapped = run(OVERLAPPED, args)
+    print_timeline("sequential", sequential)
+    print_timeline("overlapped", overlapped)
+    saved = sequential["first_publish"] - overlapped["first_publish"]
+    gate = sequential["first_publish"] - ungated["first_publish"]
+    print("saved %.0f ms (%.0f%%): %.0f ms first-fetch gate, %.0f ms overlap"
+          % (saved, 100.0 * saved / sequential["first_publish"], gate, saved - gate))
+
+    if args.measured:
+        print_measured(args.measured, overlapped)
+
+
+if __name__ == "__main__":
+    main()
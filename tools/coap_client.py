@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Minimal CoAP client for the device's CoAP server
+(include/coap/coap_server.h), standard library only.
+
+GETs a resource and prints the response code, options and payload. With
+--observe it registers as an observer of /sensors, prints each
+notification (acking confirmable ones) and deregisters on Ctrl-C.
+
+Any RFC 7252 client works as well, e.g. libcoap's coap-client or aiocoap:
+  coap-client -m get coap://192.168.1.50/sensors -s 60
+  aiocoap-client coap://192.168.1.50/sensors --observe
+
+Usage:
+  tools/coap_client.py 192.168.1.50                  # GET /sensors
+  tools/coap_client.py 192.168.1.50 --path status
+  tools/coap_client.py 192.168.1.50 --path .well-known/core
+  tools/coap_client.py 192.168.1.50 --observe
+"""
+
+import argparse
+import os
+import random
+import socket
+import struct
+import sys
+import time
+
+CON, NON, ACK, RST = 0, 1, 2, 3
+GET = 0x01
+
+OPT_OBSERVE = 6
+OPT_URI_PATH = 11
+OPT_CONTENT_FORMAT = 12
+OPT_MAX_AGE = 14
+
+OPTION_NAMES = {OPT_OBSERVE: "Observe", OPT_CONTENT_FORMAT: "Content-Format",
+                OPT_MAX_AGE: "Max-Age"}
+
+
+def code_str(code):
+    return "%d.%02d" % (code >> 5, code & 0x1F)
+
+
+def encode_uint(value):
+    out = b""
+    while value:
+        out = bytes([value & 0xFF]) + out
+        value >>= 8
+    return out
+
+
+def encode_option(delta, value):
+    """Option header + value (extended delta/length as needed)."""
+    def nibble(n):
+        if n < 13:
+            return n, b""
+        if n < 269:
+            return 13, bytes([n - 13])
+        return 14, struct.pack(">H", n - 269)
+    d, d_ext = nibble(delta)
+    l, l_ext = nibble(len(value))
+    return bytes([(d << 4) | l]) + d_ext + l_ext + value
+
+
+def encode(msg_type, code, mid, token, options, payload=b""):
+    """options: list of (number, bytes), any order."""
+    out = struct.pack(">BBH", 0x40 | (msg_type << 4) | len(token), code, mid) + token
+    last = 0
+    for number, value in sorted(options, key=lambda o: o[0]):
+        out += encode_option(number - last, value)
+        last = number
+    if payload:
+        out += b"\xff" + payload
+    return out
+
+
+def decode(data):
+    """Return (type, code, mid, token, {option: [values]}, payload)."""
+    if len(data) < 4 or data[0] >> 6 != 1:
+        raise ValueError("not a CoAP message")
+    msg_type = (data[0] >> 4) & 0x03
+    tkl = data[0] & 0x0F
+    code, mid = data[1], struct.unpack_from(">H", data, 2)[0]
+    token = data[4:4 + tkl]
+    pos, number, options = 4 + tkl, 0, {}
+    while pos < len(data) and data[pos] != 0xFF:
+        delta, length = data[pos] >> 4, data[pos] & 0x0F
+        pos += 1
+        if delta == 13:
+            delta, pos = 13 + data[pos], pos + 1
+        elif delta == 14:
+            delta, pos = 269 + struct.unpack_from(">H", data, pos)[0], pos + 2
+        if length == 13:
+            length, pos = 13 + data[pos], pos + 1
+        elif length == 14:
+            length, pos = 269 + struct.unpack_from(">H", data, pos)[0], pos + 2
+        number += delta
+        options.setdefault(number, []).append(data[pos:pos + length])
+        pos += length
+    payload = data[pos + 1:] if pos < len(data) else b""
+    return msg_type, code, mid, token, options, payload
+
+
+def describe(msg):
+    msg_type, code, mid, _token, options, payload = msg
+    opts = []
+    for number, values in sorted(options.items()):
+        for value in values:
+            opts.append("%s=%d" % (OPTION_NAMES.get(number, str(number)),
+                                   int.from_bytes(value, "big")))
+    return "%s %s mid=%d %s %s" % ("CON NON ACK RST".split()[msg_type], code_str(code), mid,
+                                   " ".join(opts), payload.decode("utf-8", "replace"))
+
+
+def request(sock, addr, path, observe=None, token=None):
+    mid = random.randrange(0x10000)
+    token = token if token is not None else os.urandom(4)
+    options = [(OPT_URI_PATH, seg.encode()) for seg in path.strip("/").split("/") if seg]
+    if observe is not None:
+        options.append((OPT_OBSERVE, encode_uint(observe)))
+    # Confirmable: retransmit with exponential backoff (RFC 7252 4.2)
+    timeout = 2.0
+    for _ in range(5):
+        sock.sendto(encode(CON, GET, mid, token, options), addr)
+        sock.settimeout(timeout)
+        try:
+            while True:
+                data, _ = sock.recvfrom(2048)
+                msg = decode(data)
+                if msg[2] == mid or msg[3] == token:
+                    return msg, token
+        except socket.timeout:
+            timeout *= 2
+    raise TimeoutError("no response from %s:%d" % addr)
+
+
+def observe(sock, addr, path):
+    msg, token = request(sock, addr, path, observe=0)
+    print(describe(msg))
+    if OPT_OBSERVE not in msg[4]:
+        print("not registered (server did not return Observe)", file=sys.stderr)
+        return
+
+    last_seq = int.from_bytes(msg[4][OPT_OBSERVE][0], "big")
+    sock.settimeout(None)
+    try:
+        while True:
+            data, src = sock.recvfrom(2048)
+            msg = decode(data)
+            if msg[3] != token:
+                if msg[0] == CON:
+                    sock.sendto(encode(RST, 0, msg[2], b"", []), src)
+                continue
+            if msg[0] == CON:
+                sock.sendto(encode(ACK, 0, msg[2], b"", []), src)
+            seq = int.from_bytes(msg[4].get(OPT_OBSERVE, [b""])[0], "big")
+            note = "" if seq == (last_seq + 1) & 0xFFFFFF else " [seq jump %d -> %d]" % (last_seq, seq)
+            last_seq = seq
+            print("%s %s%s" % (time.strftime("%H:%M:%S"), describe(msg), note))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        request(sock, addr, path, observe=1, token=token)
+        print("deregistered", file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=5683, help="CONFIG_COAP_PORT")
+    parser.add_argument("--path", default="sensors")
+    parser.add_argument("--observe", action="store_true", help="observe the resource")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    addr = (socket.gethostbyname(args.host), args.port)
+    if args.observe:
+        observe(sock, addr, args.path)
+    else:
+        msg, _ = request(sock, addr, args.path)
+        print(describe(msg))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""
+Decode deferred binary log records (include/log/log.h) back into text.
+
+Frames are interleaved with ordinary DEBUG_PRINT text on the same serial
+stream; text is passed through unchanged and frames are expanded using the
+format strings in include/log/log_messages.h.
+
+Usage:
+  tools/decode_log.py --port /dev/ttyACM0        # live (needs pyserial)
+  tools/decode_log.py capture.bin                # from a raw capture
+  cat capture.bin | tools/decode_log.py
+"""
+
+import argparse
+import pathlib
+import re
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+HEADER_LEN = 8
+MAX_ARGS = 8
+
+DEFAULT_TABLE = (
+    pathlib.Path(__file__).resolve().parent.parent
+    / "include" / "log" / "log_messages.h"
+)
+
+ENTRY_RE = re.compile(r'X\(\s*(\w+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+CONV_RE = re.compile(r"%[-+ #0]*\d*(?:\.\d+)?l?([a-zA-Z%])")
+
+
+def load_table(path):
+    """Return list of (name, level, format, arg struct) indexed by message ID."""
+    text = pathlib.Path(path).read_text(encoding="utf-8")
+    text = text[text.index("#define LOG_MESSAGES"):]
+    table = []
+    for name, level, fmt in ENTRY_RE.findall(text):
+        # Arguments are 32-bit words: signed for %ld/%d, unsigned otherwise
+        codes = "".join("i" if conv in "di" else "I"
+                        for conv in CONV_RE.findall(fmt) if conv != "%")
+        # Device formats are 32-bit (%lu/%ld/%lx); Python wants plain %u/%d/%x
+        fmt = fmt.replace("%lu", "%u").replace("%ld", "%d").replace("%lx", "%x")
+        table.append((name, level.replace("LOG_LEVEL_", ""), fmt, codes))
+    return table
+
+
+def unpack_args(table, msg_id, buf, argc):
+    """Unpack argc words, signed where the message format says so."""
+    codes = table[msg_id][3] if msg_id < len(table) else ""
+    codes = (codes + "I" * argc)[:argc]
+    return list(struct.unpack_from("<" + codes, buf, HEADER_LEN))
+
+
+def format_record(table, msg_id, timestamp, args):
+    if msg_id >= len(table):
+        return "[%10u] <unknown id %u> %s" % (timestamp, msg_id, args)
+    name, level, fmt, _ = table[msg_id]
+    try:
+        text = fmt % tuple(args)
+    except (TypeError, ValueError):
+        text = "%s %s" % (name, args)
+    return "[%10u] %-5s %s" % (timestamp, level, text)
+
+
+def decode_stream(chunks, table, out):
+    buf = b""
+    for chunk in chunks:
+        buf += chunk
+        while True:
+            idx = buf.find(SYNC)
+            if idx < 0:
+                # Keep a trailing 0xA5 in case the sync is split across reads
+                keep = 1 if buf.endswith(SYNC[:1]) else 0
+                out.write(buf[: len(buf) - keep].decode("utf-8", "replace"))
+                buf = buf[len(buf) - keep:]
+                break
+
+            if idx > 0:
+                out.write(buf[:idx].decode("utf-8", "replace"))
+                buf = buf[idx:]
+
+            if len(buf) < HEADER_LEN:
+                break
+
+            msg_id, argc = buf[2], buf[3]
+            if msg_id >= len(table) or argc > MAX_ARGS:
+                # Not a frame after all: emit sync bytes as text and move on
+                out.write(buf[:1].decode("utf-8", "replace"))
+                buf = buf[1:]
+                continue
+
+            frame_len = HEADER_LEN + 4 * argc
+            if len(buf) < frame_len:
+                break
+
+            (timestamp,) = struct.unpack_from("<I", buf, 4)
+            args = unpack_args(table, msg_id, buf, argc)
+            out.write(format_record(table, msg_id, timestamp, args) + "\n")
+            buf = buf[frame_len:]
+        out.flush()
+
+
+def serial_chunks(port, baud):
+    import serial  # pyserial
+
+    with serial.Serial(port, baud, timeout=0.1) as ser:
+        while True:
+            data = ser.read(256)
+            if data:
+                yield data
+
+
+def file_chunks(handle):
+    while True:
+        data = handle.read(4096)
+        if not data:
+            return
+        yield data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("capture", nargs="?", help="raw capture file (default: stdin)")
+    parser.add_argument("--port", help="serial port to read live")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--table", default=str(DEFAULT_TABLE),
+                        help="path to log_messages.h")
+    args = parser.parse_args()
+
+    table = load_table(args.table)
+
+    if args.port:
+        chunks = serial_chunks(args.port, args.baud)
+    elif args.capture:
+        chunks = file_chunks(open(args.capture, "rb"))
+    else:
+        chunks = file_chunks(sys.stdin.buffer)
+
+    try:
+        decode_stream(chunks, table, sys.stdout)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+"""
+Host test for the device's Prometheus endpoint
+(include/metrics/metrics_server.h), standard library only.
+
+Finds the device over mDNS (a one-shot query for _prometheus-http._tcp,
+answered by include/mdns/responder.h) unless a host is given, scrapes
+/metrics, and checks:
+
+  - the response is HTTP 200 with the text exposition content type
+  - every line is a comment or a valid "name{labels} value" sample, and
+    every sample belongs to a family declared with # TYPE
+  - the metrics every build serves are present
+  - counters never go backwards between scrapes, and
+    arduino_metrics_scrapes_total goes up by one per scrape
+  - (--concurrent) a second connection opened while a scrape is in
+    progress is served after it, not refused
+  - an unknown path gets a 404
+
+Exits non-zero on the first failed check. Prints the scrape latencies.
+
+Usage:
+  tools/metrics_scrape.py                        # discover, scrape 5 times
+  tools/metrics_scrape.py 192.168.1.50 --count 20 --interval 0.5
+  tools/metrics_scrape.py --concurrent --dump    # also print the last body
+"""
+
+import argparse
+import math
+import os
+import re
+import socket
+import struct
+import sys
+import threading
+import time
+
+SERVICE = "_prometheus-http._tcp.local"
+MDNS_ADDR = ("224.0.0.251", 5353)
+TYPE_A, TYPE_PTR, TYPE_TXT, TYPE_SRV = 1, 12, 16, 33
+
+REQUIRED = [
+    "arduino_uptime_seconds",
+    "arduino_device_state",
+    "arduino_rtc_state",
+    "arduino_mqtt_connected",
+    "arduino_publish_sent_total",
+    "arduino_publish_queue_depth",
+    "arduino_loop_passes_total",
+    "arduino_loop_seconds_total",
+    "arduino_loop_max_seconds",
+    "arduino_free_ram_bytes",
+    "arduino_metrics_scrapes_total",
+]
+
+NAME_RE = re.compile(r"[a-zA-Z_:][a-zA-Z0-9_:]*")
+SAMPLE_RE = re.compile(r'^([a-zA-Z_:][a-zA-Z0-9_:]*)(\{[a-zA-Z_][a-zA-Z0-9_]*="[^"\\]*"'
+                       r'(?:,[a-zA-Z_][a-zA-Z0-9_]*="[^"\\]*")*\})? (\S+)$')
+
+
+class CheckFailed(Exception):
+    pass
+
+
+def check(condition, message):
+    if not condition:
+        raise CheckFailed(message)
+
+
+# ----------------------------------------------------------------------------
+# mDNS discovery (legacy unicast query, RFC 6762 section 6.7)
+# ----------------------------------------------------------------------------
+
+def encode_name(name):
+    return b"".join(bytes([len(label)]) + label.encode() for label in name.split(".")) + b"\0"
+
+
+def decode_name(data, offset):
+    labels = []
+    end = None
+    for _ in range(64):
+        length = data[offset]
+        if length & 0xC0 == 0xC0:
+            if end is None:
+                end = offset + 2
+            offset = ((length & 0x3F) << 8) | data[offset + 1]
+            continue
+        if length == 0:
+            return ".".join(labels), (end if end is not None else offset + 1)
+        labels.append(data[offset + 1:offset + 1 + length].decode("utf-8", "replace"))
+        offset += length + 1
+    raise ValueError("name compression loop")
+
+
+def parse_records(data):
+    _, _, qdcount, ancount, nscount, arcount = struct.unpack(">HHHHHH", data[:12])
+    offset = 12
+    for _ in range(qdcount):
+        _, offset = decode_name(data, offset)
+        offset += 4
+    records = []
+    for _ in range(ancount + nscount + arcount):
+        name, offset = decode_name(data, offset)
+        rtype, _, ttl, rdlength = struct.unpack(">HHIH", data[offset:offset + 10])
+        offset += 10
+        records.append((name.lower(), rtype, ttl, data, offset, rdlength))
+        offset += rdlength
+    return records
+
+
+def discover(timeout):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(timeout)
+    query_id = struct.unpack(">H", os.urandom(2))[0]
+    query = struct.pack(">HHHHHH", query_id, 0, 1, 0, 0, 0) + encode_name(SERVICE) + \
+        struct.pack(">HH", TYPE_PTR, 1)
+    sock.sendto(query, MDNS_ADDR)
+
+    deadline = time.time() + timeout
+    while time.time() < deadline:
+        try:
+            data, src = sock.recvfrom(1500)
+        except socket.timeout:
+            break
+        if len(data) < 12 or struct.unpack(">H", data[:2])[0] != query_id:
+            continue
+
+        port, address, path = None, src[0], "/metrics"
+        for name, rtype, ttl, packet, rdata, rdlength in parse_records(data):
+            if rtype == TYPE_SRV:
+                port = struct.unpack(">H", packet[rdata + 4:rdata + 6])[0]
+                target, _ = decode_name(packet, rdata + 6)
+                print("found %s -> %s:%d (ttl %d)" % (name, target, port, ttl))
+            elif rtype == TYPE_A:
+                address = socket.inet_ntoa(packet[rdata:rdata + 4])
+            elif rtype == TYPE_TXT and rdlength > 1:
+                txt = packet[rdata + 1:rdata + 1 + packet[rdata]].decode("utf-8", "replace")
+                if txt.startswith("path="):
+                    path = txt[5:]
+        if port:
+            return address, port, path
+    raise CheckFailed("no mDNS answer for %s within %.1f s" % (SERVICE, timeout))
+
+
+# ----------------------------------------------------------------------------
+# Scraping and validation
+# ----------------------------------------------------------------------------
+
+def http_get(host, port, path, timeout, hold=None):
+    """Raw HTTP/1.0 GET; returns (status line, headers, body, seconds)."""
+    start = time.time()
+    with socket.create_connection((host, port), timeout=timeout) as sock:
+        if hold is not None:
+            hold.wait(timeout)  # Request sent only once the other scrape started
+        sock.sendall(("GET %s HTTP/1.0\r\nHost: %s\r\nAccept: text/plain\r\n\r\n"
+                      % (path, host)).encode())
+        chunks = []
+        while True:
+            chunk = sock.recv(4096)
+            if not chunk:
+                break
+            chunks.append(chunk)
+    elapsed = time.time() - start
+
+    response = b"".join(chunks).decode("utf-8", "replace")
+    head, sep, body = response.partition("\r\n\r\n")
+    check(sep, "response has no header terminator: %r" % response[:80])
+    lines = head.split("\r\n")
+    headers = {}
+    for line in lines[1:]:
+        key, _, value = line.partition(":")
+        headers[key.strip().lower()] = value.strip()
+    return lines[0], headers, body, elapsed
+
+
+def parse_exposition(body):
+    """Validate the text format; returns {name: [(labels, value)]}, {name: type}."""
+    types = {}
+    samples = {}
+    check(body.endswith("\n"), "body does not end with a newline")
+    for number, line in enumerate(body.split("\n")[:-1], 1):
+        if line.startswith("#"):
+            parts = line.split(" ", 3)
+            if len(parts) >= 3 and parts[1] in ("HELP", "TYPE"):
+                check(NAME_RE.fullmatch(parts[2]), "line %d: bad metric name" % number)
+            if len(parts) == 4 and parts[1] == "TYPE":
+                check(parts[3] in ("counter", "gauge", "histogram", "summary", "untyped"),
+                      "line %d: unknown type %r" % (number, parts[3]))
+                check(parts[2] not in types, "line %d: %s declared twice" % (number, parts[2]))
+                types[parts[2]] = parts[3]
+            continue
+
+        match = SAMPLE_RE.match(line)
+        check(match, "line %d: not a sample: %r" % (number, line))
+        name, labels, value = match.groups()
+        check(name in types, "line %d: %s has no # TYPE" % (number, name))
+        try:
+            number_value = float(value)
+        except ValueError:
+            raise CheckFailed("line %d: bad value %r" % (number, value))
+        check(not math.isnan(number_value), "line %d: NaN value" % number)
+        samples.setdefault(name, []).append((labels or "", number_value))
+    return samples, types
+
+
+def scrape(host, port, path, timeout, hold=None):
+    status, headers, body, elapsed = http_get(host, port, path, timeout, hold)
+    check(status.split(" ")[1:2] == ["200"], "unexpected status %r" % status)
+    check(headers.get("content-type", "").startswith("text/plain"),
+          "unexpected content type %r" % headers.get("content-type"))
+    samples, types = parse_exposition(body)
+    return samples, types, body, elapsed
+
+
+def value(samples, name):
+    return samples[name][0][1]
+
+
+def run(args):
+    if args.host:
+        host, port, path = args.host, args.port, "/metrics"
+    else:
+        host, port, path = discover(args.timeout)
+
+    latencies = []
+    previous = None
+    body = ""
+    for i in range(args.count):
+        samples, types, body, elapsed = scrape(host, port, path, args.timeout)
+        latencies.append(elapsed)
+
+        missing = [name for name in REQUIRED if name not in samples]
+        check(not missing, "missing metrics: %s" % ", ".join(missing))
+        check(sum(v for _, v in samples["arduino_device_state"]) == 1,
+              "arduino_device_state must have exactly one state set")
+
+        if previous is not None:
+            for name, kind in types.items():
+                if kind == "counter" and name in samples and name in previous:
+                    check(value(samples, name) >= value(previous, name),
+                          "%s went backwards (%g -> %g)"
+                          % (name, value(previous, name), value(samples, name)))
+            check(value(samples, "arduino_metrics_scrapes_total") ==
+                  value(previous, "arduino_metrics_scrapes_total") + 1,
+                  "arduino_metrics_scrapes_total did not count this scrape")
+        previous = samples
+
+        print("scrape %d: %d samples, %.0f ms" % (i + 1, sum(map(len, samples.values())),
+                                                  elapsed * 1000))
+        if i + 1 < args.count:
+            time.sleep(args.interval)
+
+    if args.concurrent:
+        # Open the second connection while the first scrape is in progress
+        started = threading.Event()
+        result = {}
+
+        def second():
+            try:
+                result["samples"] = scrape(host, port, path, args.timeout, hold=started)[0]
+            except (OSError, CheckFailed) as exc:
+                result["error"] = exc
+
+        thread = threading.Thread(target=second)
+        thread.start()
+        time.sleep(0.05)
+        started.set()
+        scrape(host, port, path, args.timeout)
+        thread.join(args.timeout * 2)
+        check("samples" in result, "second connection was not served: %s"
+              % result.get("error", "timed out"))
+        print("concurrent scrapes: both served")
+
+    status, _, _, _ = http_get(host, port, "/nope", args.timeout)
+    check(status.split(" ")[1:2] == ["404"], "unknown path returned %r" % status)
+
+    latencies.sort()
+    print("latency ms: min %.0f  median %.0f  max %.0f"
+          % (latencies[0] * 1000, latencies[len(latencies) // 2] * 1000,
+             latencies[-1] * 1000))
+    if args.dump:
+        sys.stdout.write(body)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("host", nargs="?", help="skip mDNS discovery")
+    parser.add_argument("--port", type=int, default=9100, help="CONFIG_METRICS_PORT")
+    parser.add_argument("--count", type=int, default=5, help="scrapes to run")
+    parser.add_argument("--interval", type=float, default=1.0, help="seconds between scrapes")
+    parser.add_argument("--timeout", type=float, default=5.0)
+    parser.add_argument("--concurrent", action="store_true",
+                        help="check that a second connection waits its turn")
+    parser.add_argument("--dump", action="store_true", help="print the last response body")
+    args = parser.parse_args()
+
+    try:
+        run(args)
+    except (CheckFailed, OSError) as exc:
+        print("FAIL: %s" % exc, file=sys.stderr)
+        sys.exit(1)
+    print("OK")
+
+
+if __name__ == "__main__":
+    main()
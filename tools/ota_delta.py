@@ -0,0 +1,709 @@
+#!/usr/bin/env python3
+"""
+Firmware patches for OTA updates (include/ota/delta.h), standard library only.
+
+A patch rebuilds a new image from the image the device is running. It is
+made of bsdiff-style operations on the target:
+
+  COPY   offset, length         bytes of the running image, unchanged
+  ADD    offset, length, diff   running image bytes plus a diff byte each
+                                (code that moved: mostly zero, a few
+                                pointer bytes changed)
+  INSERT length, bytes          new bytes
+
+The operation stream is cut into blocks of BLOCK_SIZE target bytes, and
+each block is compressed on its own with LZSS (heatshrink-style: a 256-byte
+window, so the device decompresses with 256 bytes of RAM). A dropped
+download resumes at the last block boundary with an HTTP Range request.
+
+Layout (little-endian):
+
+  "OTD1"  u32 target size  u32 base size  u16 block size
+  u8 window bits  u8 count bits
+  then per block: u16 compressed length, compressed operations
+
+LZSS bits are read MSB first: 1 + 8 bits is a literal, 0 + window bits
+(distance - 1) + count bits (count - 1) copies earlier output. The window
+starts out zero-filled for every block.
+
+A patch against an empty base (make /dev/null new.bin) is just the image,
+compressed.
+
+Self-test (--selftest) builds sample images (a code-like image, a bug fix,
+a function inserted mid-image, an unrelated image), makes patches, and
+applies them with the streaming decoder the device uses, interrupted and
+resumed at random points. It prints the patch sizes and exits non-zero if
+any image is not rebuilt exactly, or a wrong base goes unnoticed.
+
+The device's decoder (src/ota/delta.cpp) is tested on the host with
+smaller sample patches written by `fixture` (pio test -e native).
+
+Usage:
+  tools/ota_delta.py make build-1.3.0.bin build-1.4.0.bin -o 1.3.0-1.4.0.otd
+  tools/ota_delta.py apply build-1.3.0.bin 1.3.0-1.4.0.otd -o rebuilt.bin
+  tools/ota_delta.py fixture -o test/test_delta/delta_fixtures.h
+  tools/ota_delta.py --selftest
+"""
+
+import argparse
+import hashlib
+import random
+import struct
+import sys
+
+MAGIC = b"OTD1"
+HEADER = struct.Struct("<4sIIHBB")
+
+ROW_SIZE = 256              # FLASH_BANK_ROW_SIZE; blocks are whole rows
+BLOCK_SIZE = 4096           # Target bytes per block (resume granularity)
+WINDOW_BITS = 8             # CONFIG_OTA_DELTA_WINDOW_BITS
+COUNT_BITS = 4
+
+OP_COPY = 1
+OP_ADD = 2
+OP_INSERT = 3
+
+SEED = 8                    # Shortest exact match that starts an alignment
+COPY_MIN = 12               # Zero-diff run worth its own COPY
+LZSS_CANDIDATES = 32        # Window positions tried per byte
+
+
+class DeltaError(Exception):
+    pass
+
+
+# ----------------------------------------------------------------------------
+# Matching (new image against the running one)
+# ----------------------------------------------------------------------------
+
+def _index(old):
+    index = {}
+    for pos in range(len(old) - SEED + 1):
+        entry = index.setdefault(old[pos:pos + SEED], [])
+        if len(entry) < 4:
+            entry.append(pos)
+    return index
+
+
+def _exact(old, o, new, n):
+    length = 0
+    while o + length < len(old) and n + length < len(new) and old[o + length] == new[n + length]:
+        length += 1
+    return length
+
+
+def _extend(old, o, new, n, step, limit):
+    """Approximate extension (bsdiff): longest run where matches outnumber misses."""
+    score = best = best_len = 0
+    k = 0
+    while k < limit:
+        oi, ni = o + k * step, n + k * step
+        if step < 0:
+            oi, ni = oi - 1, ni - 1
+        if not (0 <= oi < len(old) and 0 <= ni < len(new)):
+            break
+        score += 1 if old[oi] == new[ni] else -1
+        k += 1
+        if score > best:
+            best, best_len = score, k
+        elif score < best - 32:
+            break
+    return best_len
+
+
+def diff(old, new):
+    """Operations rebuilding new from old: (kind, target offset, length, arg)."""
+    index = _index(old) if len(old) >= SEED else {}
+    ops = []
+    literal = 0
+    shift = None
+    i = 0
+    while i < len(new):
+        candidates = [] if shift is None else [i + shift]
+        candidates += index.get(new[i:i + SEED], [])
+        best_len, best_o = 0, None
+        for o in candidates:
+            if 0 <= o < len(old):
+                length = _exact(old, o, new, i)
+                if length > best_len:
+                    best_len, best_o = length, o
+        if best_len < SEED:
+            i += 1
+            continue
+
+        back = _extend(old, best_o, new, i, -1, min(i - literal, best_o))
+        length = _extend(old, best_o, new, i, 1, len(new))
+        start, o = i - back, best_o - back
+        if start > literal:
+            ops.append((OP_INSERT, literal, start - literal, new[literal:start]))
+        ops += _aligned(old, o, new, start, back + length)
+        i = literal = start + back + length
+        shift = o - start
+
+    if literal < len(new):
+        ops.append((OP_INSERT, literal, len(new) - literal, new[literal:]))
+    return ops
+
+
+def _aligned(old, o, new, n, length):
+    """Split an aligned region into COPY (long zero-diff runs) and ADD."""
+    diff_bytes = bytes((new[n + k] - old[o + k]) & 0xFF for k in range(length))
+    ops = []
+    k = 0
+    while k < length:
+        run = 0
+        while k + run < length and diff_bytes[k + run] == 0:
+            run += 1
+        if run >= COPY_MIN or k + run == length:
+            if run:
+                ops.append((OP_COPY, n + k, run, o + k))
+            k += run
+            continue
+        end = k + run
+        while end < length:
+            zeros = 0
+            while end + zeros < length and diff_bytes[end + zeros] == 0:
+                zeros += 1
+            if zeros >= COPY_MIN:
+                break
+            end += zeros if zeros else 1
+        ops.append((OP_ADD, n + k, end - k, (o + k, diff_bytes[k:end])))
+        k = end
+    return ops
+
+
+# ----------------------------------------------------------------------------
+# Serialization
+# ----------------------------------------------------------------------------
+
+def _varint(value):
+    out = bytearray()
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        out.append(byte | (0x80 if value else 0))
+        if not value:
+            return bytes(out)
+
+
+def _split(ops, block_size):
+    """Operations per block; an operation crossing a boundary is cut in two."""
+    blocks = {}
+    for kind, start, length, arg in ops:
+        while length:
+            block = start // block_size
+            take = min(length, (block + 1) * block_size - start)
+            if kind == OP_COPY:
+                piece = (kind, take, arg)
+                arg += take
+            elif kind == OP_ADD:
+                piece = (kind, take, (arg[0], arg[1][:take]))
+                arg = (arg[0] + take, arg[1][take:])
+            else:
+                piece = (kind, take, arg[:take])
+                arg = arg[take:]
+            blocks.setdefault(block, []).append(piece)
+            start += take
+            length -= take
+    return blocks
+
+
+def _serialize(block_ops):
+    out = bytearray()
+    for kind, length, arg in block_ops:
+        out.append(kind)
+        if kind == OP_COPY:
+            out += _varint(arg) + _varint(length)
+        elif kind == OP_ADD:
+            out += _varint(arg[0]) + _varint(length) + arg[1]
+        else:
+            out += _varint(length) + arg
+    return bytes(out)
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.bits = 0
+
+    def put(self, value, bits):
+        self.acc = (self.acc << bits) | value
+        self.bits += bits
+        while self.bits >= 8:
+            self.bits -= 8
+            self.out.append((self.acc >> self.bits) & 0xFF)
+        self.acc &= (1 << self.bits) - 1
+
+    def flush(self):
+        if self.bits:
+            self.out.append((self.acc << (8 - self.bits)) & 0xFF)
+        return bytes(self.out)
+
+
+def lzss(data, window_bits=WINDOW_BITS, count_bits=COUNT_BITS):
+    window = 1 << window_bits
+    max_count = 1 << count_bits
+    buf = bytes(window) + data   # The decoder's window starts zero-filled
+    chains = {}
+
+    def remember(pos):
+        chains.setdefault(buf[pos:pos + 2], []).append(pos)
+
+    for pos in range(window - 1):
+        remember(pos)
+
+    writer = BitWriter()
+    i = window
+    while i < len(buf):
+        remember(i - 1)
+        best_len, best_dist = 0, 0
+        chain = chains.get(buf[i:i + 2], [])
+        for pos in reversed(chain[-LZSS_CANDIDATES:]):
+            dist = i - pos
+            if dist > window:
+                break
+            length = 0
+            while length < max_count and i + length < len(buf) and buf[pos + length] == buf[i + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_dist = length, dist
+                if length == max_count:
+                    break
+        if best_len >= 2:
+            writer.put(0, 1)
+            writer.put(best_dist - 1, window_bits)
+            writer.put(best_len - 1, count_bits)
+            for pos in range(i, i + best_len - 1):
+                remember(pos)
+            i += best_len
+        else:
+            writer.put(1, 1)
+            writer.put(buf[i], 8)
+            i += 1
+    return writer.flush()
+
+
+def make(old, new, block_size=BLOCK_SIZE, window_bits=WINDOW_BITS, count_bits=COUNT_BITS):
+    if block_size % ROW_SIZE or not 0 < block_size < 65536:
+        raise ValueError("block size must be a whole number of %d-byte rows" % ROW_SIZE)
+    blocks = _split(diff(old, new), block_size)
+    out = bytearray(HEADER.pack(MAGIC, len(new), len(old), block_size, window_bits, count_bits))
+    for block in range((len(new) + block_size - 1) // block_size):
+        packed = lzss(_serialize(blocks[block]), window_bits, count_bits)
+        if len(packed) > 0xFFFF:
+            raise ValueError("block %d does not fit (use a smaller block size)" % block)
+        out += struct.pack("<H", len(packed)) + packed
+    return bytes(out)
+
+
+# ----------------------------------------------------------------------------
+# Streaming decoder (mirrors src/ota/delta.cpp)
+# ----------------------------------------------------------------------------
+
+class Decoder:
+    """Fed the patch in pieces of any size; rewind() resumes at a block boundary."""
+
+    def __init__(self, base, target_size=None, max_window_bits=WINDOW_BITS, block_align=ROW_SIZE):
+        self.base = base
+        self.target_size = target_size
+        self.max_window_bits = max_window_bits
+        self.block_align = block_align
+        self.resume_offset = 0
+        self.resume_target = 0
+        self.rewind()
+
+    def rewind(self):
+        """Continue from the last block boundary (stream offset resume_offset)."""
+        self.consumed = self.resume_offset
+        self.produced = self.resume_target
+        self.pending = bytearray()
+        self.state = "header" if self.resume_offset == 0 else "length"
+
+    @property
+    def done(self):
+        return self.state == "done"
+
+    def feed(self, data):
+        out = bytearray()
+        for byte in data:
+            if self.state == "done":
+                break
+            self.consumed += 1
+            if self.state == "header":
+                self._header(byte)
+            elif self.state == "length":
+                self._length(byte)
+            else:
+                self._block(byte, out)
+        return bytes(out)
+
+    def _header(self, byte):
+        self.pending.append(byte)
+        if len(self.pending) < HEADER.size:
+            return
+        magic, target, base, block, window_bits, count_bits = HEADER.unpack(bytes(self.pending))
+        if magic != MAGIC:
+            raise DeltaError("not a patch")
+        if self.target_size is None:
+            self.target_size = target
+        if (target != self.target_size or base > len(self.base) or block == 0 or
+                block % self.block_align or not 4 <= window_bits <= self.max_window_bits or
+                not 1 <= count_bits <= 8):
+            raise DeltaError("unsupported header")
+        self.block_size = block
+        self.window_bits = window_bits
+        self.count_bits = count_bits
+        self.base_size = base
+        self.pending = bytearray()
+        self.state = "length"
+
+    def _length(self, byte):
+        self.pending.append(byte)
+        if len(self.pending) < 2:
+            return
+        self.block_left = struct.unpack("<H", bytes(self.pending))[0]
+        if self.block_left == 0:
+            raise DeltaError("empty block")
+        self.block_target = min(self.block_size, self.target_size - self.produced)
+        self.window = bytearray(1 << self.window_bits)
+        self.wpos = 0
+        self.acc = 0
+        self.bits = 0
+        self.op = None
+        self.field = []
+        self.pending = bytearray()
+        self.state = "block"
+
+    def _block(self, byte, out):
+        """One compressed byte: decode every LZSS symbol it completes."""
+        self.block_left -= 1
+        self.acc = (self.acc << 8) | byte
+        self.bits += 8
+        mask = (1 << self.window_bits) - 1
+        while self.state == "block" and self.bits:
+            if (self.acc >> (self.bits - 1)) & 1:
+                if self.bits < 9:
+                    break
+                self.bits -= 9
+                count, dist, literal = 1, None, (self.acc >> self.bits) & 0xFF
+            else:
+                need = 1 + self.window_bits + self.count_bits
+                if self.bits < need:
+                    break
+                self.bits -= need
+                value = self.acc >> self.bits
+                count = (value & ((1 << self.count_bits) - 1)) + 1
+                dist = ((value >> self.count_bits) & mask) + 1
+            self.acc &= (1 << self.bits) - 1
+            for _ in range(count):
+                symbol = literal if dist is None else self.window[(self.wpos - dist) & mask]
+                self.window[self.wpos & mask] = symbol
+                self.wpos += 1
+                self._op(symbol, out)
+        if self.state == "block" and self.block_left == 0:
+            raise DeltaError("block ends early")
+
+    def _op(self, byte, out):
+        """One byte of the operation stream."""
+        if self.state != "block":
+            raise DeltaError("block runs over")
+        if self.op is None:
+            if byte not in (OP_COPY, OP_ADD, OP_INSERT):
+                raise DeltaError("bad operation %d" % byte)
+            self.op = byte
+            self.field = [0, 0] if byte != OP_INSERT else [0]
+            self.field_index = 0
+            self.shift = 0
+            return
+        if self.field_index < len(self.field):
+            if self.shift > 28:
+                raise DeltaError("bad varint")
+            self.field[self.field_index] |= (byte & 0x7F) << self.shift
+            self.shift += 7
+            if not byte & 0x80:
+                self.field_index += 1
+                self.shift = 0
+                if self.field_index == len(self.field):
+                    self._start(out)
+            return
+        source = byte if self.op == OP_INSERT else (self.base[self.offset] + byte) & 0xFF
+        self.offset += 1
+        self._emit(source, out)
+
+    def _start(self, out):
+        if self.op == OP_INSERT:
+            self.offset, self.left = 0, self.field[0]
+        else:
+            self.offset, self.left = self.field
+        if self.left == 0 or self.left > self.block_target - self.produced % self.block_size:
+            raise DeltaError("operation runs past the block")
+        if self.op != OP_INSERT and self.offset + self.left > self.base_size:
+            raise DeltaError("operation runs past the base")
+        while self.op == OP_COPY:
+            self.offset += 1
+            self._emit(self.base[self.offset - 1], out)
+
+    def _emit(self, byte, out):
+        out.append(byte)
+        self.produced += 1
+        self.left -= 1
+        if self.left == 0:
+            self.op = None
+        if self.produced % self.block_size == 0 or self.produced == self.target_size:
+            self._end_block()
+
+    def _end_block(self):
+        if self.op is not None or self.block_left != 0:
+            raise DeltaError("block length mismatch")
+        self.resume_offset = self.consumed
+        self.resume_target = self.produced
+        self.state = "done" if self.produced == self.target_size else "length"
+
+
+def apply(old, patch, target_size=None):
+    decoder = Decoder(old, target_size, max_window_bits=16)
+    new = decoder.feed(patch)
+    if not decoder.done:
+        raise DeltaError("patch is truncated")
+    return new
+
+
+# ----------------------------------------------------------------------------
+# Self-test
+# ----------------------------------------------------------------------------
+
+class Firmware:
+    """A code-like image: functions of Thumb-ish halfwords, each followed by
+    a literal pool of absolute addresses (of functions and strings), a
+    vector table in front and a string table at the end. Inserting or
+    growing a function moves everything after it, which changes every
+    pointer to what moved: the usual shape of a firmware patch."""
+
+    FLASH_BASE = 0x2000
+
+    def __init__(self, seed, functions=180):
+        rng = random.Random(seed)
+        opcodes = [rng.getrandbits(16) for _ in range(120)]
+        self.rng = rng
+        self.functions = [self._function(rng, opcodes, functions) for _ in range(functions)]
+        self.strings = [b"%s %d\0" % (rng.choice([b"sensor", b"mqtt", b"wifi", b"rtc", b"ota"]), i)
+                        for i in range(60)]
+        self.opcodes = opcodes
+
+    @staticmethod
+    def _function(rng, opcodes, count):
+        body = [rng.choice(opcodes) for _ in range(rng.randint(40, 300))]
+        refs = [(rng.randrange(2), rng.randrange(count)) for _ in range(rng.randint(1, 6))]
+        return body, refs
+
+    def image(self):
+        vectors = 48 * 4
+        offsets, pos = [], vectors
+        for body, refs in self.functions:
+            offsets.append(pos)
+            pos += len(body) * 2 + len(refs) * 4
+        string_offsets = []
+        for text in self.strings:
+            string_offsets.append(pos)
+            pos += len(text)
+
+        out = bytearray()
+        for i in range(48):
+            out += struct.pack("<I", self.FLASH_BASE + offsets[i % len(offsets)] + 1)
+        for body, refs in self.functions:
+            out += struct.pack("<%dH" % len(body), *body)
+            for kind, target in refs:
+                table = offsets if kind == 0 else string_offsets
+                out += struct.pack("<I", self.FLASH_BASE + table[target % len(table)] + (kind == 0))
+        for text in self.strings:
+            out += text
+        return bytes(out)
+
+    def fix_bug(self):
+        """A few instructions in one function change (same length)."""
+        body, refs = self.functions[len(self.functions) // 2]
+        for k in range(3):
+            body[10 + k * 7] = self.rng.choice(self.opcodes)
+        self.strings[0] = b"fw 1.4.1\0"
+
+    def add_function(self):
+        """A new function in the middle, called from two places."""
+        middle = len(self.functions) // 3
+        self.functions.insert(middle, self._function(self.rng, self.opcodes, len(self.functions)))
+        for index in (5, len(self.functions) - 10):
+            self.functions[index][1].append((0, middle))
+        self.strings.append(b"new feature\0")
+
+
+def _resumed(base, patch, target_size, rng):
+    """Apply like the device: pieces of random size, connection dropped at
+    random points, each time resumed from the last block boundary."""
+    bank = bytearray(target_size)
+    decoder = Decoder(base, target_size)
+    drops = 0
+    while not decoder.done:
+        offset = decoder.consumed
+        cut = rng.randint(offset + 1, len(patch)) if drops < 4 and rng.random() < 0.7 else len(patch)
+        while offset < cut and not decoder.done:
+            piece = patch[offset:min(cut, offset + rng.randint(1, 64))]
+            start = decoder.produced
+            out = decoder.feed(piece)
+            bank[start:start + len(out)] = out
+            offset += len(piece)
+        if not decoder.done:
+            drops += 1
+            decoder.rewind()
+    return bytes(bank), drops
+
+
+def selftest():
+    rng = random.Random(7)
+    v1 = Firmware(1)
+    old = v1.image()
+    v1.fix_bug()
+    fixed = v1.image()
+    v1.add_function()
+    grown = v1.image()
+    unrelated = Firmware(2).image()
+
+    cases = [
+        # (name, base, target, smallest acceptable ratio)
+        ("bug fix", old, fixed, 10.0),
+        ("new function", old, grown, 5.0),
+        ("unrelated", old, unrelated, 0.9),
+        ("no base", b"", grown, 1.0),
+    ]
+    failed = 0
+    print("%-13s %7s %7s %6s %6s  %s" % ("case", "image", "patch", "ratio", "drops", "result"))
+    for name, base, target, ratio_min in cases:
+        patch = make(base, target)
+        rebuilt, drops = _resumed(base, patch, len(target), rng)
+        ratio = len(target) / float(len(patch))
+        ok = rebuilt == target and ratio >= ratio_min and apply(base, patch) == target
+        failed += not ok
+        print("%-13s %7d %7d %5.1fx %6d  %s" % (name, len(target), len(patch), ratio, drops,
+                                               "ok" if ok else "FAIL"))
+
+    # The wrong running image, and damage in transit, must not go unnoticed
+    patch = make(old, fixed)
+    digest = hashlib.sha256(fixed).digest()
+    for name, base, damaged in [("wrong base", unrelated + bytes(len(old)), patch),
+                                ("damaged", old, patch[:900] + bytes([patch[900] ^ 0x10]) + patch[901:])]:
+        try:
+            caught = hashlib.sha256(apply(base, damaged, len(fixed))).digest() != digest
+            how = "hash"
+        except DeltaError as error:
+            caught, how = True, str(error)
+        failed += not caught
+        print("%-13s %-30s %s" % (name, "caught (%s)" % how if caught else "not caught",
+                                  "ok" if caught else "FAIL"))
+    return failed == 0
+
+
+# ----------------------------------------------------------------------------
+# Fixtures for the device decoder's host test (test/test_delta)
+# ----------------------------------------------------------------------------
+
+FIXTURE_BLOCK_SIZE = 1024   # Several blocks, so several resume points
+
+
+def fnv1a(data):
+    value = 0x811c9dc5
+    for byte in data:
+        value = ((value ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def _c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, max(len(data), 1))]
+    for pos in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[pos:pos + 16]) + ",")
+    if not data:
+        lines.append("  0x00,")
+    return "\n".join(lines + ["};", ""])
+
+
+def fixture():
+    """C header with a running image, patches from it and their targets' hashes."""
+    v1 = Firmware(1, functions=16)
+    old = v1.image()
+    v1.fix_bug()
+    fixed = v1.image()
+    v1.add_function()
+    grown = v1.image()
+
+    cases = [("bug_fix", old, fixed), ("new_function", old, grown), ("no_base", b"", grown)]
+    out = ["// Generated by tools/ota_delta.py fixture -- do not edit",
+           "",
+           "#ifndef DELTA_FIXTURES_H",
+           "#define DELTA_FIXTURES_H",
+           "",
+           "#include <stdint.h>",
+           "",
+           "#define FIXTURE_BLOCK_SIZE %d" % FIXTURE_BLOCK_SIZE,
+           "",
+           _c_array("fixture_base", old)]
+    for name, base, target in cases:
+        patch = make(base, target, FIXTURE_BLOCK_SIZE)
+        out.append(_c_array("fixture_%s_patch" % name, patch))
+    out.append("typedef struct {")
+    out.append("  const char* name;")
+    out.append("  uint32_t base_size;")
+    out.append("  const uint8_t* patch;")
+    out.append("  uint32_t patch_size;")
+    out.append("  uint32_t target_size;")
+    out.append("  uint32_t target_fnv1a;")
+    out.append("} DeltaFixture;")
+    out.append("")
+    out.append("static const DeltaFixture fixtures[] = {")
+    for name, base, target in cases:
+        out.append('  {"%s", %d, fixture_%s_patch, sizeof(fixture_%s_patch), %d, 0x%08xUL},'
+                   % (name.replace("_", " "), len(base), name, name, len(target), fnv1a(target)))
+    out.append("};")
+    out.append("")
+    out.append("#endif  // DELTA_FIXTURES_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("command", nargs="?", choices=["make", "apply", "fixture"])
+    parser.add_argument("old", nargs="?", help="running image (.bin), /dev/null for none")
+    parser.add_argument("new", nargs="?", help="new image (make) or patch (apply)")
+    parser.add_argument("-o", "--output", help="output file")
+    parser.add_argument("--block-size", type=int, default=BLOCK_SIZE)
+    parser.add_argument("--selftest", action="store_true")
+    args = parser.parse_args()
+
+    if args.selftest:
+        sys.exit(0 if selftest() else 1)
+    if args.command == "fixture" and args.output:
+        with open(args.output, "w", encoding="ascii") as handle:
+            handle.write(fixture())
+        return
+    if not (args.command and args.old and args.new and args.output):
+        parser.error("command, both inputs and -o are required")
+
+    with open(args.old, "rb") as handle:
+        old = handle.read()
+    with open(args.new, "rb") as handle:
+        data = handle.read()
+
+    if args.command == "make":
+        out = make(old, data, args.block_size)
+        print("%d -> %d bytes (%.1fx), sha256 of the image %s"
+              % (len(data), len(out), len(data) / float(len(out)), hashlib.sha256(data).hexdigest()))
+    else:
+        try:
+            out = apply(old, data)
+        except DeltaError as error:
+            sys.exit("patch does not apply: %s" % error)
+        print("%d bytes, sha256 %s" % (len(out), hashlib.sha256(out).hexdigest()))
+    with open(args.output, "wb") as handle:
+        handle.write(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,477 @@
+#!/usr/bin/env python3
+"""
+Local firmware server and host test for OTA updates (include/ota/ota.h),
+standard library only.
+
+Serve mode (default) serves IMAGE at /firmware/<name> over HTTP/1.0 with a
+Content-Length, and prints the "firmware" offer to add to the config
+server's response:
+
+  "firmware": {"version": "1.4.0", "url": "http://192.168.1.20:8070/firmware/fw.bin",
+               "size": 98304, "sha256": "...", "signature": "..."}
+
+--key KEYFILE signs the offer (tools/ota_sign.py); without it the offer has
+no "signature" and the device refuses it.
+
+With --delta-from OLD.bin --from-version 1.3.2 it also makes a patch from
+OLD to IMAGE (tools/ota_delta.py), serves it at /firmware/<name>.otd and
+adds it to the offer as "delta". Range requests get 206, so dropped
+downloads resume (--no-range answers 200, as a plain server would).
+
+Faults for exercising the device's error paths: --drop-at N closes the
+connection once, at body byte N, --corrupt-at N flips a bit in byte N,
+--rate limits the throughput (bytes/s, as seen on a weak link).
+
+Replay mode (--replay URL) downloads URL the way the device does (with
+--key, after checking the offer's signature as the device does): one
+256-byte chunk at a time into a simulated flash bank with NOR rules (a
+row is erased before it is written, programming only clears bits, every
+row is read back), resuming dropped transfers and falling back from a
+patch that doesn't apply, then SHA-256 over the bank, checked against the
+offer made from IMAGE. It prints the outcome using the device's error
+names.
+
+Self-test mode (--selftest) serves generated images from this process and
+replays them: an unsigned offer and one whose version was changed after
+signing (signature), an offer that isn't newer (ignored), a good image, a dropped connection (resumed), a server
+without Range support, a corrupted byte (hash), a wrong Content-Length
+(http), an image too large for the bank (too_large), a patch, a dropped
+patch (resumed) and a patch for a different running image (falls back to
+the full image). Exits non-zero if any outcome is not the expected one.
+
+Usage:
+  tools/ota_server.py build/firmware.bin --version 1.4.0 --key ota_key.hex
+  tools/ota_server.py build/firmware.bin --version 1.4.0 --delta-from build-1.3.2.bin --from-version 1.3.2
+  tools/ota_server.py build/firmware.bin --drop-at 40000 --rate 20000
+  tools/ota_server.py build/firmware.bin --replay http://127.0.0.1:8070/firmware/firmware.bin
+  tools/ota_server.py --selftest
+"""
+
+import argparse
+import hashlib
+import http.server
+import json
+import os
+import re
+import socket
+import sys
+import threading
+import time
+import urllib.parse
+
+import ota_delta
+import ota_sign
+
+CHUNK_SIZE = 256            # CONFIG_OTA_CHUNK_SIZE (one flash row)
+BANK_SIZE = 0x20000 - 0x2000  # Staging bank: 120 KB
+STALL_TIMEOUT = 10.0        # CONFIG_OTA_STALL_TIMEOUT_MS
+MAX_ATTEMPTS = 3            # CONFIG_OTA_MAX_ATTEMPTS
+INPUT_SIZE = 64             # CONFIG_OTA_DELTA_INPUT_SIZE
+
+
+# ----------------------------------------------------------------------------
+# Server
+# ----------------------------------------------------------------------------
+
+class FirmwareHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.0"
+    files = {}              # path -> bytes
+    drop_at = None
+    dropped = False
+    corrupt_at = None
+    rate = None
+    length_override = None
+    no_range = False
+    quiet = False
+
+    def do_GET(self):
+        if self.path not in self.files:
+            self.send_error(404)
+            return
+
+        body = bytearray(self.files[self.path])
+        if self.corrupt_at is not None and self.corrupt_at < len(body):
+            body[self.corrupt_at] ^= 0x01
+
+        start = 0
+        match = re.match(r"bytes=(\d+)-$", self.headers.get("Range", ""))
+        if match and not self.no_range and int(match.group(1)) < len(body):
+            start = int(match.group(1))
+            self.send_response(206)
+            self.send_header("Content-Range", "bytes %d-%d/%d" % (start, len(body) - 1, len(body)))
+        else:
+            self.send_response(200)
+        length = self.length_override if self.length_override is not None else len(body) - start
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(length))
+        self.end_headers()
+
+        began = time.time()
+        end = len(body)
+        if self.drop_at is not None and not self.dropped and start < self.drop_at < end:
+            type(self).dropped = True   # Once per server
+            end = self.drop_at
+        sent = start
+        try:
+            while sent < end:
+                piece = body[sent:min(sent + 1460, end)]
+                self.wfile.write(piece)
+                sent += len(piece)
+                if self.rate:
+                    time.sleep(len(piece) / float(self.rate))
+        except OSError:
+            pass
+        if not self.quiet:
+            print("served %s bytes %d-%d of %d to %s in %.1f s"
+                  % (self.path, start, sent, len(body), self.client_address[0], time.time() - began))
+
+    def log_message(self, fmt, *args):
+        if not self.quiet:
+            sys.stderr.write("%s - %s\n" % (self.client_address[0], fmt % args))
+
+
+def make_offer(image, version, url, patch=None, from_version=None, patch_url=None, key=None):
+    offer = {"version": version, "url": url, "size": len(image),
+             "sha256": hashlib.sha256(image).hexdigest()}
+    if patch is not None:
+        offer["delta"] = {"from": from_version, "url": patch_url, "size": len(patch)}
+    if key is not None:
+        offer["signature"] = ota_sign.sign_offer(key, offer)
+    return offer
+
+
+def version_key(version):
+    """Numeric dot-separated parts, as the device compares them ("dev" is 0)."""
+    parts = []
+    for part in version.split("."):
+        digits = re.match(r"\d*", part).group()
+        parts.append(int(digits) if digits else 0)
+        if len(digits) != len(part):
+            break
+    while parts and parts[-1] == 0:
+        parts.pop()
+    return parts
+
+
+def start_server(files, port, **faults):
+    handler = type("Handler", (FirmwareHandler,), dict(files=files, **faults))
+    server = http.server.ThreadingHTTPServer(("", port), handler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    return server
+
+
+def local_address():
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        sock.connect(("192.0.2.1", 9))  # No packet is sent
+        return sock.getsockname()[0]
+    except OSError:
+        return "127.0.0.1"
+    finally:
+        sock.close()
+
+
+# ----------------------------------------------------------------------------
+# Device replay (mirrors src/ota/ota.cpp and the simulated flash bank)
+# ----------------------------------------------------------------------------
+
+class FlashBank:
+    """NOR flash: rows erase to 0xFF, programming only clears bits."""
+
+    def __init__(self, size):
+        self.data = bytearray(size)  # Not erased: garbage until a row is erased
+
+    def write(self, offset, chunk):
+        if offset % CHUNK_SIZE or offset + len(chunk) > len(self.data):
+            return False
+        for row in range(offset, offset + len(chunk), CHUNK_SIZE):
+            self.data[row:row + CHUNK_SIZE] = b"\xff" * CHUNK_SIZE
+        for i, byte in enumerate(chunk):
+            self.data[offset + i] &= byte
+        return bytes(self.data[offset:offset + len(chunk)]) == bytes(chunk)
+
+
+class Device:
+    """One offer, downloaded like the device: attempts, resumes, patch fallback."""
+
+    def __init__(self, offer, base=b"", version="dev", bank_size=BANK_SIZE, public=None):
+        self.offer = offer
+        self.base = base
+        self.version = version
+        self.public = public
+        self.bank = FlashBank(bank_size)
+        self.attempts = self.resumes = self.transferred = self.received = 0
+        self.delta = self.delta_failed = self.resumable = False
+        self.resume_from = self.attempt_from = 0
+        self.decoder = None
+
+    def run(self):
+        """Returns the final error name ("none" once verified)."""
+        if version_key(self.offer["version"]) <= version_key(self.version):
+            return "ignored"
+        if self.public is not None and not ota_sign.verify_offer(self.public, self.offer):
+            return "signature"
+        if self.offer["size"] > len(self.bank.data):
+            return "too_large"
+        if not _usable(self.offer["url"]):
+            return "url"
+        counted = True
+        while True:
+            self._start(counted)
+            error = self._transfer()
+            if error == "none":
+                digest = hashlib.sha256(self.bank.data[:self.offer["size"]]).hexdigest()
+                error = "none" if digest == self.offer["sha256"] else "hash"
+            if error == "none":
+                return error
+            self._fail(error)
+            counted = not (self.resumable and self.resume_from > self.attempt_from)
+            if counted and self.attempts >= MAX_ATTEMPTS:
+                return error
+
+    def _begin_body(self):
+        self.resume_from = self.received = 0
+        if self.delta:
+            self.decoder = ota_delta.Decoder(self.base, self.offer["size"])
+
+    def _start(self, counted):
+        if counted:
+            self.attempts += 1
+        else:
+            self.resumes += 1
+        if self.resumable:
+            if self.delta:
+                self.decoder.rewind()
+                self.received = self.decoder.resume_target
+        else:
+            patch = self.offer.get("delta")
+            self.delta = bool(patch and not self.delta_failed and patch["from"] == self.version
+                              and _usable(patch["url"]))
+            self.url = patch["url"] if self.delta else self.offer["url"]
+            self.body_size = patch["size"] if self.delta else self.offer["size"]
+            self._begin_body()
+        self.attempt_from = self.resume_from
+        self.resumable = False
+
+    def _fail(self, error):
+        self.resumable = error in ("connect", "stalled", "short")
+        if self.resumable:
+            self.resume_from = self.decoder.resume_offset if self.delta else self.received
+        if self.delta and error in ("delta", "hash"):
+            self.delta_failed = True
+
+    def _transfer(self):
+        parts = urllib.parse.urlsplit(self.url)
+        try:
+            sock = socket.create_connection((parts.hostname, parts.port or 80), timeout=STALL_TIMEOUT)
+        except OSError:
+            return "connect"
+
+        with sock:
+            rng = "Range: bytes=%d-\r\n" % self.resume_from if self.resume_from else ""
+            sock.sendall(("GET %s HTTP/1.1\r\nHost: %s:%d\r\nUser-Agent: Arduino/1.0\r\n%s"
+                          "Connection: close\r\n\r\n"
+                          % (parts.path or "/", parts.hostname, parts.port or 80, rng)).encode())
+            stream = sock.makefile("rb")
+            try:
+                return self._response(stream)
+            except socket.timeout:
+                return "stalled"
+
+    def _response(self, stream):
+        status = stream.readline().decode("latin-1")
+        content_length = None
+        while True:
+            line = stream.readline().decode("latin-1")
+            if line in ("\r\n", "\n", ""):
+                break
+            key, _, value = line.partition(":")
+            if key.strip().lower() == "content-length":
+                content_length = int(value.strip())
+
+        code = (status.split(" ")[1:2] or [""])[0]
+        if code == "200" and self.resume_from:
+            self._begin_body()   # Range ignored: start over
+        expected = "206" if self.resume_from else "200"
+        if code != expected or (content_length is not None and
+                                content_length != self.body_size - self.resume_from):
+            return "http"
+        return self._patch(stream) if self.delta else self._image(stream)
+
+    def _image(self, stream):
+        size = self.offer["size"]
+        while self.received < size:
+            want = min(CHUNK_SIZE, size - self.received)
+            chunk = stream.read(want)
+            self.transferred += len(chunk)
+            if len(chunk) < want:
+                return "short"
+            if not self.bank.write(self.received, chunk):
+                return "flash"
+            self.received += len(chunk)
+        return "none"
+
+    def _patch(self, stream):
+        pending = bytearray()
+        while not self.decoder.done:
+            data = stream.read1(INPUT_SIZE)
+            if not data:
+                return "short"
+            self.transferred += len(data)
+            try:
+                pending += self.decoder.feed(data)
+            except ota_delta.DeltaError:
+                return "delta"
+            while len(pending) >= CHUNK_SIZE or (self.decoder.done and pending):
+                row = bytes(pending[:CHUNK_SIZE])
+                if not self.bank.write(self.received, row):
+                    return "flash"
+                self.received += len(row)
+                del pending[:CHUNK_SIZE]
+        return "none"
+
+
+def _usable(url):
+    parts = urllib.parse.urlsplit(url)
+    return parts.scheme == "http" and bool(parts.hostname)
+
+
+# ----------------------------------------------------------------------------
+# Self-test
+# ----------------------------------------------------------------------------
+
+def sample_image(size, seed):
+    out = bytearray()
+    counter = 0
+    while len(out) < size:
+        out += hashlib.sha256(b"%d:%d" % (seed, counter)).digest()
+        counter += 1
+    return bytes(out[:size])
+
+
+def selftest():
+    running = ota_delta.Firmware(1)
+    old = running.image()
+    running.fix_bug()
+    running.add_function()
+    new = running.image()
+    patch = ota_delta.make(old, new)
+    other = ota_delta.Firmware(2).image() + bytes(len(old))
+
+    key = ota_sign.new_key()
+    public = ota_sign.public_key(key)
+
+    cases = [
+        # (name, image, patch, running image, server faults, expected error)
+        ("unsigned", sample_image(98_317, 0), None, b"", {"unsigned": True}, "signature"),
+        ("tampered", sample_image(98_317, 0), None, b"", {"tamper": True}, "signature"),
+        ("not-newer", sample_image(98_317, 0), None, b"", {"older": True}, "ignored"),
+        ("good", sample_image(98_317, 0), None, b"", {}, "none"),
+        ("row-aligned", sample_image(64 * 1024, 1), None, b"", {}, "none"),
+        ("dropped", sample_image(98_317, 2), None, b"", {"drop_at": 40_000}, "none"),
+        ("no-range", sample_image(98_317, 3), None, b"",
+         {"drop_at": 40_000, "no_range": True}, "none"),
+        ("corrupted", sample_image(98_317, 4), None, b"", {"corrupt_at": 77_777}, "hash"),
+        ("bad-length", sample_image(98_317, 5), None, b"", {"length_override": 1000}, "http"),
+        ("too-large", sample_image(BANK_SIZE + 1, 6), None, b"", {}, "too_large"),
+        ("patch", new, patch, old, {}, "none"),
+        ("patch-drop", new, patch, old, {"drop_at": len(patch) // 2}, "none"),
+        ("wrong-base", new, patch, other, {}, "none"),
+    ]
+    failed = 0
+    print("%-12s %-9s %-10s %7s %7s %5s %4s %6s" % ("case", "error", "(expected)", "image",
+                                                  "moved", "tries", "res", "time"))
+    for name, image, diff, base, faults, expected in cases:
+        files = {"/firmware/fw.bin": image}
+        if diff is not None:
+            files["/firmware/fw.otd"] = diff
+        unsigned = faults.pop("unsigned", False)
+        tamper = faults.pop("tamper", False)
+        version = "0.9.0" if faults.pop("older", False) else "1.1.0"
+        server = start_server(files, 0, quiet=True, **faults)
+        root = "http://127.0.0.1:%d/firmware/" % server.server_address[1]
+        offer = make_offer(image, version, root + "fw.bin", diff, "1.0.0", root + "fw.otd",
+                           None if unsigned else key)
+        if tamper:
+            offer["version"] = "9.9.9"
+        device = Device(offer, base, "1.0.0", public=public)
+        began = time.time()
+        error = device.run()
+        seconds = time.time() - began
+        server.shutdown()
+        server.server_close()
+
+        ok = error == expected
+        failed += not ok
+        print("%-12s %-9s %-10s %7d %7d %5d %4d %5.2fs  %s"
+              % (name, error, "(%s)" % expected, len(image), device.transferred,
+                 device.attempts, device.resumes, seconds, "ok" if ok else "FAIL"))
+    return failed == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("image", nargs="?", help="firmware image (.bin)")
+    parser.add_argument("--version", default="dev", help="version to offer")
+    parser.add_argument("--key", metavar="KEYFILE", help="sign the offer (tools/ota_sign.py)")
+    parser.add_argument("--running", default="dev",
+                        help="version the replaying device runs (offer must be newer)")
+    parser.add_argument("--port", type=int, default=8070)
+    parser.add_argument("--delta-from", metavar="OLD", help="also serve a patch from this image")
+    parser.add_argument("--from-version", help="version of --delta-from")
+    parser.add_argument("--no-range", action="store_true", help="ignore Range requests")
+    parser.add_argument("--drop-at", type=int, help="close once, after this many body bytes")
+    parser.add_argument("--corrupt-at", type=int, help="flip a bit in this byte")
+    parser.add_argument("--rate", type=int, help="throughput limit (bytes/s)")
+    parser.add_argument("--replay", metavar="URL", help="download URL like the device")
+    parser.add_argument("--selftest", action="store_true")
+    args = parser.parse_args()
+
+    if args.selftest:
+        sys.exit(0 if selftest() else 1)
+    if not args.image:
+        parser.error("an image is required")
+    if args.delta_from and not args.from_version:
+        parser.error("--delta-from needs --from-version")
+
+    with open(args.image, "rb") as handle:
+        image = handle.read()
+    name = os.path.basename(args.image)
+    key = ota_sign.load_key(args.key) if args.key else None
+
+    if args.replay:
+        device = Device(make_offer(image, args.version, args.replay, key=key), version=args.running,
+                        public=ota_sign.public_key(key) if key is not None else None)
+        error = device.run()
+        print("%s: %d bytes received, %d transferred, %d attempts, %d resumes"
+              % (error, device.received, device.transferred, device.attempts, device.resumes))
+        sys.exit(0 if error == "none" else 1)
+
+    root = "http://%s:%d/firmware/" % (local_address(), args.port)
+    files = {"/firmware/" + name: image}
+    patch = None
+    if args.delta_from:
+        with open(args.delta_from, "rb") as handle:
+            patch = ota_delta.make(handle.read(), image)
+        files["/firmware/" + name + ".otd"] = patch
+    offer = make_offer(image, args.version, root + name, patch, args.from_version,
+                       root + name + ".otd", key)
+    if key is None:
+        print("warning: unsigned offer (no --key); the device will refuse it")
+    print('"firmware": %s' % json.dumps(offer))
+    if patch is not None:
+        print("patch: %d bytes (%.1fx smaller than the image)" % (len(patch), len(image) / float(len(patch))))
+    if len(image) > BANK_SIZE:
+        print("warning: image is larger than the device's bank (%d bytes)" % BANK_SIZE)
+    server = start_server(files, args.port, drop_at=args.drop_at, corrupt_at=args.corrupt_at,
+                          rate=args.rate, no_range=args.no_range)
+    try:
+        while True:
+            time.sleep(3600)
+    except KeyboardInterrupt:
+        server.shutdown()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Signing key and offer signatures for OTA updates (include/ota/ota.h),
+standard library only.
+
+The device installs an offer only if "signature" verifies against the
+public key built into it (CONFIG_OTA_PUBLIC_KEY). The signature is ECDSA
+P-256 over
+
+  SHA-256( sha256 of the image (32 bytes) | size (uint32, little-endian) | version )
+
+so neither the image, its size nor the version can be changed without the
+private key. The image digest is still checked after the download, so the
+signature covers the bytes installed.
+
+The device verifies in the ECCX08 crypto chip; this tool signs in pure
+Python (RFC 6979 deterministic nonces), slowly but without dependencies.
+Keep the private key off the config server.
+
+Usage:
+  tools/ota_sign.py keygen ota_key.hex
+      writes the private key, prints the build flag with the public key
+  tools/ota_sign.py sign ota_key.hex --version 1.4.0 --image build/firmware.bin
+      prints the "signature" value for the offer
+  tools/ota_sign.py pubkey ota_key.hex
+"""
+
+import argparse
+import hashlib
+import hmac
+import secrets
+import struct
+import sys
+
+# NIST P-256 (secp256r1)
+P = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+A = P - 3
+N = 0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551
+G = (0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296,
+     0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5)
+
+
+# ----------------------------------------------------------------------------
+# Curve arithmetic (affine; None is the point at infinity)
+# ----------------------------------------------------------------------------
+
+def _add(p1, p2):
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    if p1[0] == p2[0] and (p1[1] + p2[1]) % P == 0:
+        return None
+    if p1 == p2:
+        slope = (3 * p1[0] * p1[0] + A) * pow(2 * p1[1], -1, P) % P
+    else:
+        slope = (p2[1] - p1[1]) * pow(p2[0] - p1[0], -1, P) % P
+    x = (slope * slope - p1[0] - p2[0]) % P
+    return x, (slope * (p1[0] - x) - p1[1]) % P
+
+
+def _mul(k, point):
+    result = None
+    while k:
+        if k & 1:
+            result = _add(result, point)
+        point = _add(point, point)
+        k >>= 1
+    return result
+
+
+# ----------------------------------------------------------------------------
+# ECDSA
+# ----------------------------------------------------------------------------
+
+def _nonce(key, digest):
+    """RFC 6979 section 3.2 with HMAC-SHA256."""
+    x = key.to_bytes(32, "big")
+    h = (int.from_bytes(digest, "big") % N).to_bytes(32, "big")
+    v = b"\x01" * 32
+    k = b"\x00" * 32
+    k = hmac.new(k, v + b"\x00" + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    k = hmac.new(k, v + b"\x01" + x + h, hashlib.sha256).digest()
+    v = hmac.new(k, v, hashlib.sha256).digest()
+    while True:
+        v = hmac.new(k, v, hashlib.sha256).digest()
+        candidate = int.from_bytes(v, "big")
+        if 1 <= candidate < N:
+            return candidate
+        k = hmac.new(k, v + b"\x00", hashlib.sha256).digest()
+        v = hmac.new(k, v, hashlib.sha256).digest()
+
+
+def sign(key, digest):
+    """64-byte r | s over a 32-byte digest."""
+    e = int.from_bytes(digest, "big")
+    while True:
+        k = _nonce(key, digest)
+        r = _mul(k, G)[0] % N
+        s = pow(k, -1, N) * (e + r * key) % N
+        if r and s:
+            return r.to_bytes(32, "big") + s.to_bytes(32, "big")
+        digest = hashlib.sha256(digest).digest()  # Practically unreachable
+
+
+def verify(public, digest, signature):
+    """public: 64-byte X | Y, as the device holds it."""
+    if len(signature) != 64 or len(public) != 64:
+        return False
+    r = int.from_bytes(signature[:32], "big")
+    s = int.from_bytes(signature[32:], "big")
+    if not (0 < r < N and 0 < s < N):
+        return False
+    point = (int.from_bytes(public[:32], "big"), int.from_bytes(public[32:], "big"))
+    w = pow(s, -1, N)
+    e = int.from_bytes(digest, "big")
+    xy = _add(_mul(e * w % N, G), _mul(r * w % N, point))
+    return xy is not None and xy[0] % N == r
+
+
+def public_key(key):
+    x, y = _mul(key, G)
+    return x.to_bytes(32, "big") + y.to_bytes(32, "big")
+
+
+def new_key():
+    return secrets.randbelow(N - 1) + 1
+
+
+# ----------------------------------------------------------------------------
+# Offers
+# ----------------------------------------------------------------------------
+
+def offer_digest(version, size, sha256_hex):
+    """What the device hashes before verifying (src/ota/ota.cpp offerSigned)."""
+    return hashlib.sha256(bytes.fromhex(sha256_hex) + struct.pack("<I", size) +
+                          version.encode()).digest()
+
+
+def sign_offer(key, offer):
+    return sign(key, offer_digest(offer["version"], offer["size"], offer["sha256"])).hex()
+
+
+def verify_offer(public, offer):
+    try:
+        signature = bytes.fromhex(offer.get("signature", ""))
+    except ValueError:
+        return False
+    return verify(public, offer_digest(offer["version"], offer["size"], offer["sha256"]),
+                  signature)
+
+
+def load_key(path):
+    with open(path, encoding="ascii") as handle:
+        return int(handle.read().strip(), 16)
+
+
+def build_flag(key):
+    return '-D CONFIG_OTA_PUBLIC_KEY=\'"%s"\'' % public_key(key).hex()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest="command", required=True)
+    keygen = sub.add_parser("keygen", help="write a new private key")
+    keygen.add_argument("key")
+    pubkey = sub.add_parser("pubkey", help="print the build flag for a key")
+    pubkey.add_argument("key")
+    signer = sub.add_parser("sign", help="print the signature for an offer")
+    signer.add_argument("key")
+    signer.add_argument("--version", required=True)
+    signer.add_argument("--image", required=True)
+    args = parser.parse_args()
+
+    if args.command == "keygen":
+        key = new_key()
+        with open(args.key, "x", encoding="ascii") as handle:
+            handle.write("%064x\n" % key)
+        print(build_flag(key))
+    elif args.command == "pubkey":
+        print(build_flag(load_key(args.key)))
+    else:
+        with open(args.image, "rb") as handle:
+            image = handle.read()
+        offer = {"version": args.version, "size": len(image),
+                 "sha256": hashlib.sha256(image).hexdigest()}
+        print(sign_offer(load_key(args.key), offer))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
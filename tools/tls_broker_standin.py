@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""
+Local TLS MQTT broker stand-in for measuring handshake cost.
+
+Server mode (default) accepts TLS on --port, times each handshake from
+TCP accept to handshake completion, and reports whether the session was
+resumed. It then speaks just enough MQTT 3.1.1 to keep the device
+connected: CONNACK, PINGRESP and printing PUBLISH (QoS 0) messages. Idle
+gaps between client packets are shown, which also helps when checking
+keepalive behaviour.
+
+Without --cert/--key a throwaway ECDSA P-256 CA and server certificate are
+generated with openssl. Upload the CA (ca.pem) to the NINA module so the
+device can verify the server:
+
+  arduino-fwuploader certificates flash -b arduino:samd:mkrwifi1010 \\
+      -a /dev/ttyACM0 --file <dir>/ca.pem
+
+Bench mode (--bench HOST) runs host-side handshakes against any TLS server
+(this stand-in, or a real broker): N full handshakes, then N resumed ones
+that reuse the first session. This gives the full vs resumed cost on the
+same server and network path. The device itself always does full
+handshakes (WiFiNINA exposes no session cache).
+
+Usage:
+  tools/tls_broker_standin.py                        # serve on :8883
+  tools/tls_broker_standin.py --cert srv.pem --key srv.key
+  tools/tls_broker_standin.py --bench 127.0.0.1 --count 20
+"""
+
+import argparse
+import os
+import socket
+import ssl
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+TLS_VERSION = ssl.TLSVersion.TLSv1_2     # What the NINA module negotiates
+
+
+def make_certs(directory, hostname):
+    """Create ca.pem and server.pem/server.key (ECDSA P-256) in directory."""
+    ca_key, ca_pem = os.path.join(directory, "ca.key"), os.path.join(directory, "ca.pem")
+    key, csr = os.path.join(directory, "server.key"), os.path.join(directory, "server.csr")
+    pem, ext = os.path.join(directory, "server.pem"), os.path.join(directory, "san.ext")
+
+    def run(*args):
+        subprocess.run(["openssl"] + list(args), check=True, capture_output=True)
+
+    run("ecparam", "-name", "prime256v1", "-genkey", "-noout", "-out", ca_key)
+    run("req", "-x509", "-new", "-key", ca_key, "-days", "365", "-subj",
+        "/CN=arduino-mdns-query test CA", "-out", ca_pem)
+    run("ecparam", "-name", "prime256v1", "-genkey", "-noout", "-out", key)
+    run("req", "-new", "-key", key, "-subj", "/CN=%s" % hostname, "-out", csr)
+    san = "IP:%s" % hostname if hostname.replace(".", "").isdigit() else "DNS:%s" % hostname
+    with open(ext, "w") as handle:
+        handle.write("subjectAltName=%s\n" % san)
+    run("x509", "-req", "-in", csr, "-CA", ca_pem, "-CAkey", ca_key, "-CAcreateserial",
+        "-days", "365", "-extfile", ext, "-out", pem)
+    return pem, key, ca_pem
+
+
+# ----------------------------------------------------------------------------
+# Server mode
+# ----------------------------------------------------------------------------
+
+def read_packet(conn):
+    """Return (type, payload) of one MQTT packet, or None on close."""
+    header = conn.recv(1)
+    if not header:
+        return None
+    length, shift = 0, 0
+    while True:
+        byte = conn.recv(1)
+        if not byte:
+            return None
+        length |= (byte[0] & 0x7F) << shift
+        shift += 7
+        if not byte[0] & 0x80:
+            break
+    payload = b""
+    while len(payload) < length:
+        chunk = conn.recv(length - len(payload))
+        if not chunk:
+            return None
+        payload += chunk
+    return header[0] >> 4, payload
+
+
+def serve_client(raw, addr, context, lock):
+    started = time.monotonic()
+    try:
+        conn = context.wrap_socket(raw, server_side=True)
+    except (ssl.SSLError, OSError) as err:
+        print("%s handshake failed: %s" % (addr[0], err))
+        return
+    handshake_ms = (time.monotonic() - started) * 1000
+    with lock:
+        print("%s TLS %s %s handshake %.0f ms%s" % (
+            addr[0], conn.version(), conn.cipher()[0], handshake_ms,
+            " (resumed)" if conn.session_reused else " (full)"))
+        sys.stdout.flush()
+
+    last = time.monotonic()
+    try:
+        while True:
+            packet = read_packet(conn)
+            if packet is None:
+                break
+            kind, payload = packet
+            now = time.monotonic()
+            idle = now - last
+            last = now
+            if kind == 1:                                   # CONNECT
+                keepalive = int.from_bytes(payload[8:10], "big") if len(payload) >= 10 else 0
+                print("%s CONNECT keepalive %d s" % (addr[0], keepalive))
+                conn.sendall(b"\x20\x02\x00\x00")
+            elif kind == 3:                                 # PUBLISH (QoS 0)
+                topic_len = int.from_bytes(payload[0:2], "big")
+                topic = payload[2:2 + topic_len].decode("utf-8", "replace")
+                body = payload[2 + topic_len:].decode("utf-8", "replace")
+                print("%s PUBLISH %s (idle %.1f s) %s" % (addr[0], topic, idle, body))
+            elif kind == 12:                                # PINGREQ
+                print("%s PINGREQ (idle %.1f s)" % (addr[0], idle))
+                conn.sendall(b"\xd0\x00")
+            elif kind == 14:                                # DISCONNECT
+                break
+            sys.stdout.flush()
+    except (ssl.SSLError, OSError):
+        pass
+    finally:
+        print("%s closed" % addr[0])
+        conn.close()
+
+
+def serve(args):
+    if args.cert and args.key:
+        cert, key = args.cert, args.key
+    else:
+        directory = tempfile.mkdtemp(prefix="tls-standin-")
+        cert, key, ca = make_certs(directory, args.hostname)
+        print("generated CA %s (upload it to the NINA module)" % ca, file=sys.stderr)
+
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    context.minimum_version = TLS_VERSION
+    context.maximum_version = TLS_VERSION
+    context.load_cert_chain(cert, key)
+
+    listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    listener.bind((args.bind, args.port))
+    listener.listen(4)
+    print("TLS broker stand-in on %s:%d" % (args.bind, args.port), file=sys.stderr)
+
+    lock = threading.Lock()
+    try:
+        while True:
+            raw, addr = listener.accept()
+            threading.Thread(target=serve_client, args=(raw, addr, context, lock),
+                             daemon=True).start()
+    except KeyboardInterrupt:
+        pass
+
+
+# ----------------------------------------------------------------------------
+# Bench mode
+# ----------------------------------------------------------------------------
+
+def handshake(context, host, port, session=None):
+    """Return (ms, ssl session, reused) for one TCP connect + TLS handshake."""
+    started = time.monotonic()
+    raw = socket.create_connection((host, port), timeout=10)
+    conn = context.wrap_socket(raw, server_hostname=host, session=session)
+    elapsed = (time.monotonic() - started) * 1000
+    result = (elapsed, conn.session, conn.session_reused)
+    conn.close()
+    return result
+
+
+def bench(args):
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    context.minimum_version = TLS_VERSION
+    context.maximum_version = TLS_VERSION
+    if args.ca:
+        context.load_verify_locations(args.ca)
+    else:
+        context.check_hostname = False
+        context.verify_mode = ssl.CERT_NONE
+
+    full = [handshake(context, args.bench, args.port)[0] for _ in range(args.count)]
+
+    _, session, _ = handshake(context, args.bench, args.port)
+    resumed, reused = [], 0
+    for _ in range(args.count):
+        elapsed, _, was_reused = handshake(context, args.bench, args.port, session)
+        resumed.append(elapsed)
+        reused += was_reused
+
+    print("full handshake:    median %.1f ms (min %.1f, max %.1f, n=%d)"
+          % (statistics.median(full), min(full), max(full), len(full)))
+    print("resumed handshake: median %.1f ms (min %.1f, max %.1f, n=%d, %d resumed)"
+          % (statistics.median(resumed), min(resumed), max(resumed), len(resumed), reused))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bind", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=8883, help="CONFIG_MQTT_TLS_PORT")
+    parser.add_argument("--hostname", default=socket.gethostname(),
+                        help="name or IP put in the generated server certificate")
+    parser.add_argument("--cert", help="server certificate (PEM)")
+    parser.add_argument("--key", help="server private key (PEM)")
+    parser.add_argument("--bench", metavar="HOST", help="run handshake benchmark against HOST")
+    parser.add_argument("--count", type=int, default=10)
+    parser.add_argument("--ca", help="CA to verify the server with in bench mode")
+    args = parser.parse_args()
+
+    if args.bench:
+        bench(args)
+    else:
+        serve(args)
+
+
+if __name__ == "__main__":
+    main()
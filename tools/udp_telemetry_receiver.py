@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Reference receiver for the UDP telemetry transport
+(include/transport/udp_transport.h).
+
+Prints every message as "<topic> seq=<n> <payload>", acks frames that ask
+for it, and reports gaps, duplicates and device restarts per sender. It
+stands in for the config server's receiver in host tests; --drop simulates
+a lossy link to exercise the device's retransmissions.
+
+--emit turns it into a sender using the same frame format, so a receiver
+(this script or your own) can be tested without a device.
+
+Usage:
+  tools/udp_telemetry_receiver.py                      # listen on 0.0.0.0:5555
+  tools/udp_telemetry_receiver.py --port 6000 --drop 20
+  tools/udp_telemetry_receiver.py --emit 127.0.0.1 --count 10 --ack
+"""
+
+import argparse
+import json
+import random
+import socket
+import struct
+import sys
+import time
+
+MAGIC = b"\xd7\x54"
+VERSION = 0x10
+FLAG_ACK_REQUEST = 0x01
+FLAG_ACK = 0x02
+FLAG_RETRANSMIT = 0x04
+HEADER = struct.Struct(">2sBBI")   # magic, flags, topic_len, seq
+
+
+def encode(seq, topic, payload, flags=0):
+    topic = topic.encode("utf-8")
+    return HEADER.pack(MAGIC, VERSION | flags, len(topic), seq) + topic + payload.encode("utf-8")
+
+
+def encode_ack(seq):
+    return HEADER.pack(MAGIC, VERSION | FLAG_ACK, 0, seq)
+
+
+def decode(data):
+    """Return (flags, seq, topic, payload) or None if not a telemetry frame."""
+    if len(data) < HEADER.size:
+        return None
+    magic, flags, topic_len, seq = HEADER.unpack_from(data)
+    if magic != MAGIC or (flags & 0xF0) != VERSION or len(data) < HEADER.size + topic_len:
+        return None
+    topic = data[HEADER.size:HEADER.size + topic_len].decode("utf-8", "replace")
+    payload = data[HEADER.size + topic_len:].decode("utf-8", "replace")
+    return flags, seq, topic, payload
+
+
+class SenderState:
+    """Sequence tracking for one device (address)."""
+
+    def __init__(self):
+        self.last_seq = None
+        self.received = 0
+        self.gaps = 0
+        self.duplicates = 0
+
+    def update(self, seq):
+        """Return a note about this seq, or '' if in order."""
+        note = ""
+        if self.last_seq is None:
+            note = "first"
+        elif seq == self.last_seq:
+            self.duplicates += 1
+            return "duplicate"
+        elif seq < self.last_seq:
+            note = "restart"
+        elif seq > self.last_seq + 1:
+            self.gaps += seq - self.last_seq - 1
+            note = "gap %d" % (seq - self.last_seq - 1)
+        self.last_seq = seq
+        self.received += 1
+        return note
+
+
+def receive(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind((args.bind, args.port))
+    print("listening on %s:%d (drop %d%%)" % (args.bind, args.port, args.drop), file=sys.stderr)
+
+    senders = {}
+    try:
+        while True:
+            data, addr = sock.recvfrom(2048)
+            if args.drop and random.randrange(100) < args.drop:
+                continue
+
+            frame = decode(data)
+            if not frame:
+                print("%s:%d non-telemetry datagram (%d bytes)" % (addr[0], addr[1], len(data)))
+                continue
+
+            flags, seq, topic, payload = frame
+            if flags & FLAG_ACK:
+                continue
+
+            if flags & FLAG_ACK_REQUEST:
+                sock.sendto(encode_ack(seq), addr)
+
+            state = senders.setdefault(addr[0], SenderState())
+            note = state.update(seq)
+            if flags & FLAG_RETRANSMIT:
+                note = (note + " retransmit").strip()
+
+            print("%s seq=%d%s %s" % (topic, seq, " [%s]" % note if note else "", payload))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        for host, state in senders.items():
+            print("%s: received=%d gaps=%d duplicates=%d"
+                  % (host, state.received, state.gaps, state.duplicates), file=sys.stderr)
+
+
+def emit(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.settimeout(0.5)
+    acked = 0
+    for seq in range(1, args.count + 1):
+        payload = json.dumps({"temperature_celsius": round(20 + random.random() * 5, 2),
+                              "timestamp": int(time.time())}, separators=(",", ":"))
+        flags = FLAG_ACK_REQUEST if args.ack else 0
+        for attempt in range(4 if args.ack else 1):
+            sock.sendto(encode(seq, args.topic, payload, flags), (args.emit, args.port))
+            if not args.ack:
+                break
+            try:
+                data, _ = sock.recvfrom(64)
+                frame = decode(data)
+                if frame and frame[0] & FLAG_ACK and frame[1] == seq:
+                    acked += 1
+                    break
+            except socket.timeout:
+                flags |= FLAG_RETRANSMIT
+        time.sleep(args.interval)
+    if args.ack:
+        print("acked %d/%d" % (acked, args.count), file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--bind", default="0.0.0.0")
+    parser.add_argument("--port", type=int, default=5555,
+                        help="CONFIG_UDP_TELEMETRY_DEFAULT_PORT")
+    parser.add_argument("--drop", type=int, default=0,
+                        help="percentage of frames to drop (simulated loss)")
+    parser.add_argument("--emit", metavar="HOST",
+                        help="send test frames to HOST instead of receiving")
+    parser.add_argument("--count", type=int, default=5)
+    parser.add_argument("--interval", type=float, default=0.2)
+    parser.add_argument("--topic", default="home/devices/test/updated")
+    parser.add_argument("--ack", action="store_true", help="request acks when emitting")
+    args = parser.parse_args()
+
+    if args.emit:
+        emit(args)
+    else:
+        receive(args)
+
+
+if __name__ == "__main__":
+    main()
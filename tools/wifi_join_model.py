@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""
+Connect-time model for the WiFi supervisor's DHCP join vs. fast join
+(cached IP settings, see include/wifi/wifi_cache.h).
+
+A join on the NINA module is modelled as a sequence of phases:
+
+  spi      begin() hand-off and status polling granularity (CONFIG_WIFI_POLL_MS)
+  scan     active scan until the AP is found (ESP-IDF fast scan: channels in
+           order, stops on the first match)
+  assoc    802.11 authentication + association
+  eapol    WPA2 4-way handshake
+  dhcp     DISCOVER/OFFER/REQUEST/ACK (DHCP join only)
+  verify   gateway ping (fast join only)
+
+Defaults are typical values for an ESP32 station on a home AP; override
+them with the options below to match your network. With --measured, join
+times decoded from the device log ("WiFi up: join N ms (fast=F)" lines from
+tools/decode_log.py) are summarised next to the model.
+
+Usage:
+  tools/wifi_join_model.py
+  tools/wifi_join_model.py --channel 11 --dhcp-ms 2500
+  tools/decode_log.py capture.bin | tools/wifi_join_model.py --measured -
+"""
+
+import argparse
+import re
+import statistics
+import sys
+
+JOIN_RE = re.compile(r"WiFi up: join (\d+) ms \(fast=(\d)\)")
+
+
+def model(args):
+    """Return {"dhcp": {...}, "fast": {...}} phase durations in ms."""
+    scan = args.channel * args.dwell_ms
+    # Status is polled, so on average half a poll interval is added
+    spi = args.spi_ms + args.poll_ms / 2.0
+
+    common = {
+        "spi": spi,
+        "scan": scan,
+        "assoc": args.assoc_ms,
+        "eapol": args.eapol_ms,
+    }
+    dhcp = dict(common, dhcp=args.dhcp_ms)
+    fast = dict(common, verify=args.ping_ms)
+    return {"dhcp": dhcp, "fast": fast}
+
+
+def print_model(phases, fallback_rate, fast_timeout_ms):
+    for name in ("dhcp", "fast"):
+        total = sum(phases[name].values())
+        detail = ", ".join("%s %.0f" % (k, v) for k, v in phases[name].items())
+        print("%-5s join: %6.0f ms  (%s)" % (name, total, detail))
+
+    dhcp_total = sum(phases["dhcp"].values())
+    fast_total = sum(phases["fast"].values())
+    # A failed fast attempt costs up to the fast-join timeout, then a DHCP join
+    expected = ((1 - fallback_rate) * fast_total
+                + fallback_rate * (fast_timeout_ms + dhcp_total))
+    print("expected with %.0f%% fast-join fallbacks: %.0f ms (%.0f%% of DHCP join)"
+          % (fallback_rate * 100, expected, 100.0 * expected / dhcp_total))
+
+
+def print_measured(handle):
+    samples = {"0": [], "1": []}
+    for line in handle:
+        match = JOIN_RE.search(line)
+        if match:
+            samples[match.group(2)].append(int(match.group(1)))
+
+    for flag, label in (("0", "dhcp"), ("1", "fast")):
+        values = samples[flag]
+        if not values:
+            print("measured %-4s: no samples" % label)
+            continue
+        print("measured %-4s: n=%d median %d ms, min %d, max %d"
+              % (label, len(values), statistics.median(values), min(values), max(values)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--channel", type=int, default=6,
+                        help="AP channel (channels scanned before a match)")
+    parser.add_argument("--dwell-ms", type=float, default=120,
+                        help="active scan dwell time per channel")
+    parser.add_argument("--assoc-ms", type=float, default=60)
+    parser.add_argument("--eapol-ms", type=float, default=120)
+    parser.add_argument("--dhcp-ms", type=float, default=1500,
+                        help="DHCP exchange incl. server ARP probe")
+    parser.add_argument("--ping-ms", type=float, default=20,
+                        help="gateway ping verifying a reused address")
+    parser.add_argument("--spi-ms", type=float, default=30,
+                        help="begin() SPI hand-off to NINA")
+    parser.add_argument("--poll-ms", type=float, default=500,
+                        help="CONFIG_WIFI_POLL_MS")
+    parser.add_argument("--fast-timeout-ms", type=float, default=8000,
+                        help="CONFIG_WIFI_FAST_JOIN_TIMEOUT_MS")
+    parser.add_argument("--fallback-rate", type=float, default=0.05,
+                        help="fraction of fast joins falling back to DHCP")
+    parser.add_argument("--measured", metavar="LOG",
+                        help="decoded device log ('-' for stdin)")
+    args = parser.parse_args()
+
+    print_model(model(args), args.fallback_rate, args.fast_timeout_ms)
+
+    if args.measured:
+        handle = sys.stdin if args.measured == "-" else open(args.measured, encoding="utf-8")
+        print_measured(handle)
+
+
+if __name__ == "__main__":
+    main()